@@ -449,6 +449,33 @@ if (PKG_CONFIG_FOUND)
   set (OGRE_INCLUDE_DIRS ${ogre_include_dirs}
        CACHE INTERNAL "Ogre include path")
 
+  ########################################
+  # Find EGL, used to render without an X server. OGRE's GL render system
+  # must be built with EGL support to render into an EGL context.
+  if (UNIX AND NOT APPLE)
+    pkg_check_modules(EGL egl)
+    if (EGL_FOUND)
+      set (CMAKE_REQUIRED_INCLUDES ${OGRE_INCLUDE_DIRS})
+      check_cxx_source_compiles("
+        #include <OgreBuildSettings.h>
+        #ifndef OGRE_GLSUPPORT_USE_EGL
+        #error OGRE is built without EGL support
+        #endif
+        int main() { return 0; }" OGRE_GLSUPPORT_USE_EGL)
+      unset (CMAKE_REQUIRED_INCLUDES)
+    endif ()
+
+    if (EGL_FOUND AND OGRE_GLSUPPORT_USE_EGL)
+      set (HAVE_EGL ON CACHE BOOL "HAVE EGL" FORCE)
+    elseif (EGL_FOUND)
+      set (HAVE_EGL OFF CACHE BOOL "HAVE EGL" FORCE)
+      BUILD_WARNING ("OGRE is built without EGL support. Rendering without an X server will be disabled.")
+    else ()
+      set (HAVE_EGL OFF CACHE BOOL "HAVE EGL" FORCE)
+      BUILD_WARNING ("EGL not found. Rendering without an X server will be disabled.")
+    endif ()
+  endif ()
+
   ########################################
   # Check and find libccd (if needed)
   pkg_check_modules(CCD ccd>=1.4)
@@ -581,6 +608,11 @@ if (PKG_CONFIG_FOUND)
     add_definitions( -DLIBBULLET_VERSION_GT_282 )
   endif()
 
+  # Multithreaded dynamics world and sequential impulse solver
+  if (BULLET_VERSION VERSION_GREATER 2.87)
+    add_definitions( -DLIBBULLET_VERSION_GT_287 )
+  endif()
+
   ########################################
   # Find libusb
   pkg_check_modules(libusb-1.0 libusb-1.0)
@@ -200,6 +200,13 @@ bool Server::ParseArgs(int _argc, char **_argv)
     ("seed",  po::value<double>(), "Start with a given random number seed.")
     ("iters",  po::value<unsigned int>(), "Number of iterations to simulate.")
     ("minimal_comms", "Reduce the TCP/IP traffic output by gzserver")
+    ("io_threads", po::value<unsigned int>(),
+     "Number of threads handling network IO.")
+    ("precise_pacing", "Sleep and then spin until each world update is due, "
+     "for a stable update period at high real time update rates.")
+    ("world_cpu", po::value<int>(), "Pin the world thread to a CPU.")
+    ("world_priority", po::value<int>(),
+     "Run the world thread with a real time (SCHED_FIFO) priority.")
     ("server-plugin,s", po::value<std::vector<std::string> >(),
      "Load a plugin.")
     ("profile,o", po::value<std::string>(),
@@ -265,6 +272,12 @@ bool Server::ParseArgs(int _argc, char **_argv)
   else
     gazebo::transport::setMinimalComms(false);
 
+  if (this->dataPtr->vm.count("io_threads"))
+  {
+    gazebo::transport::setIOThreads(
+        this->dataPtr->vm["io_threads"].as<unsigned int>());
+  }
+
   // Set the random number seed if present on the command line.
   if (this->dataPtr->vm.count("seed"))
   {
@@ -557,6 +570,16 @@ bool Server::LoadImpl(sdf::ElementPtr _elem,
     {
       gzthrow("Failed to load the World\n"  << e);
     }
+
+    // Real time pacing of the world thread
+    world->SetPrecisePacing(this->dataPtr->vm.count("precise_pacing") > 0);
+    if (this->dataPtr->vm.count("world_cpu"))
+      world->SetThreadAffinity(this->dataPtr->vm["world_cpu"].as<int>());
+    if (this->dataPtr->vm.count("world_priority"))
+    {
+      world->SetThreadPriority(
+          this->dataPtr->vm["world_priority"].as<int>());
+    }
   }
 
   this->dataPtr->node = transport::NodePtr(new transport::Node());
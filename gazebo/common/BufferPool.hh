@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_COMMON_BUFFERPOOL_HH_
+#define GAZEBO_COMMON_BUFFERPOOL_HH_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace gazebo
+{
+  namespace common
+  {
+    /// \addtogroup gazebo_common
+    /// \{
+
+    /// \class BufferPool BufferPool.hh common/common.hh
+    /// \brief A pool of reference counted buffers, used to hand frames from
+    /// a producer to any number of consumers without copying them.
+    ///
+    /// Acquire() returns a buffer that nobody but the pool references. The
+    /// producer fills it, then shares it as a pointer to const data.
+    /// Consumers may keep the pointer as long as they need the frame. The
+    /// pool reuses the buffer once all of them have released it, so no
+    /// memory is allocated once the pool is warm.
+    template<typename T>
+    class BufferPool
+    {
+      /// \brief Pointer to a buffer of the pool.
+      public: using BufferPtr = std::shared_ptr<std::vector<T>>;
+
+      /// \brief Constructor.
+      /// \param[in] _capacity Maximum number of buffers kept in the pool.
+      public: explicit BufferPool(const size_t _capacity = 4)
+              : capacity(_capacity)
+      {
+      }
+
+      /// \brief Get a buffer that is not referenced outside of the pool.
+      /// When all the buffers of a full pool are in use, a buffer that is
+      /// not kept by the pool is allocated, so slow consumers never block
+      /// the producer.
+      /// \param[in] _size Number of elements of the buffer. The content of
+      /// a reused buffer is left as is.
+      /// \return The buffer.
+      public: BufferPtr Acquire(const size_t _size)
+      {
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        // Only the pool references a free buffer, and only the pool can
+        // share it again, so its use count cannot grow behind our back.
+        for (auto &buffer : this->buffers)
+        {
+          if (buffer.use_count() == 1)
+          {
+            buffer->resize(_size);
+            return buffer;
+          }
+        }
+
+        ++this->allocationCount;
+        BufferPtr buffer = std::make_shared<std::vector<T>>(_size);
+        if (this->buffers.size() < this->capacity)
+          this->buffers.push_back(buffer);
+        return buffer;
+      }
+
+      /// \brief Get the maximum number of buffers kept in the pool.
+      /// \return The capacity.
+      public: size_t Capacity() const
+      {
+        return this->capacity;
+      }
+
+      /// \brief Get the number of buffers kept in the pool.
+      /// \return Number of buffers.
+      public: size_t Size() const
+      {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->buffers.size();
+      }
+
+      /// \brief Get the number of buffers allocated by Acquire(). Once the
+      /// pool is warm, this only grows when consumers hold on to more
+      /// buffers than the capacity.
+      /// \return Number of allocations.
+      public: uint64_t AllocationCount() const
+      {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->allocationCount;
+      }
+
+      /// \brief Maximum number of buffers kept in the pool.
+      private: const size_t capacity;
+
+      /// \brief Buffers of the pool.
+      private: std::vector<BufferPtr> buffers;
+
+      /// \brief Number of buffers allocated by Acquire().
+      private: uint64_t allocationCount = 0;
+
+      /// \brief Protects buffers and allocationCount.
+      private: mutable std::mutex mutex;
+    };
+    /// \}
+  }
+}
+#endif
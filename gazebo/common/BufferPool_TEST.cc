@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <memory>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "gazebo/common/BufferPool.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+
+class BufferPool : public gazebo::testing::AutoLogFixture { };
+
+/////////////////////////////////////////////////
+TEST_F(BufferPool, ReuseReleasedBuffers)
+{
+  common::BufferPool<float> pool(2);
+  EXPECT_EQ(2u, pool.Capacity());
+  EXPECT_EQ(0u, pool.Size());
+
+  // A buffer that was released is handed out again
+  const float *data = nullptr;
+  {
+    auto buffer = pool.Acquire(16);
+    ASSERT_NE(nullptr, buffer);
+    EXPECT_EQ(16u, buffer->size());
+    data = buffer->data();
+  }
+  for (int i = 0; i < 10; ++i)
+  {
+    auto buffer = pool.Acquire(16);
+    EXPECT_EQ(data, buffer->data());
+  }
+  EXPECT_EQ(1u, pool.Size());
+  EXPECT_EQ(1u, pool.AllocationCount());
+
+  // A smaller frame reuses the memory as well
+  EXPECT_EQ(8u, pool.Acquire(8)->size());
+  EXPECT_EQ(1u, pool.AllocationCount());
+}
+
+/////////////////////////////////////////////////
+TEST_F(BufferPool, SharedBuffersAreNotReused)
+{
+  common::BufferPool<float> pool(2);
+
+  // Consumers hold on to the first buffer
+  std::shared_ptr<const std::vector<float>> held = pool.Acquire(4);
+  auto second = pool.Acquire(4);
+  EXPECT_NE(held.get(), second.get());
+  EXPECT_EQ(2u, pool.Size());
+
+  // The first buffer is still held, the second one is free again
+  auto buffer = second.get();
+  second.reset();
+  EXPECT_EQ(buffer, pool.Acquire(4).get());
+  EXPECT_EQ(2u, pool.AllocationCount());
+}
+
+/////////////////////////////////////////////////
+TEST_F(BufferPool, FullPool)
+{
+  common::BufferPool<unsigned char> pool(2);
+
+  std::vector<common::BufferPool<unsigned char>::BufferPtr> held;
+  for (int i = 0; i < 3; ++i)
+    held.push_back(pool.Acquire(1));
+
+  // The third buffer is not kept by the pool
+  EXPECT_EQ(2u, pool.Size());
+  EXPECT_EQ(3u, pool.AllocationCount());
+  EXPECT_EQ(1, held[2].use_count());
+
+  // Once released, the pooled buffers are reused
+  auto first = held[0].get();
+  held.clear();
+  EXPECT_EQ(first, pool.Acquire(1).get());
+  EXPECT_EQ(3u, pool.AllocationCount());
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
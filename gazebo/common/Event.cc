@@ -15,21 +15,88 @@
  *
  */
 
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
 #include "gazebo/common/Console.hh"
 #include "gazebo/common/Event.hh"
+#include "gazebo/common/ScopeProfiler.hh"
 
 using namespace gazebo;
 using namespace event;
 
+namespace
+{
+  /// \brief Names of the registered connection owners, by id.
+  struct OwnerRegistry
+  {
+    /// \brief Protects the registry.
+    std::mutex mutex;
+
+    /// \brief Owner names, the id of an owner is its index plus one.
+    std::vector<std::string> names;
+
+    /// \brief Owner ids by name.
+    std::map<std::string, uint32_t> ids;
+  };
+
+  /// \brief Get the owner registry. It is never destroyed, so that events
+  /// can be signaled during static destruction.
+  OwnerRegistry &Owners()
+  {
+    static OwnerRegistry *registry = new OwnerRegistry();
+    return *registry;
+  }
+
+  /// \brief Owner of the connections made on this thread.
+  thread_local uint32_t g_currentOwner = 0;
+
+  /// \brief Names of the named events. They are kept outside of Event so
+  /// that its layout is unchanged.
+  struct EventNames
+  {
+    /// \brief Protects names.
+    std::mutex mutex;
+
+    /// \brief Name of each named event.
+    std::map<const Event *, std::string> names;
+  };
+
+  /// \brief Get the event names. They are never destroyed, so that events
+  /// can be destroyed during static destruction.
+  EventNames &Names()
+  {
+    static EventNames *names = new EventNames();
+    return *names;
+  }
+}
+
 //////////////////////////////////////////////////
 Event::Event()
   : signaled(false)
 {
 }
 
+//////////////////////////////////////////////////
+Event::Event(const std::string &_name)
+  : signaled(false)
+{
+  if (!_name.empty())
+  {
+    EventNames &names = Names();
+    std::lock_guard<std::mutex> lock(names.mutex);
+    names.names[this] = _name;
+  }
+}
+
 //////////////////////////////////////////////////
 Event::~Event()
 {
+  EventNames &names = Names();
+  std::lock_guard<std::mutex> lock(names.mutex);
+  names.names.erase(this);
 }
 
 //////////////////////////////////////////////////
@@ -44,6 +111,17 @@ void Event::SetSignaled(const bool _sig)
   this->signaled = _sig;
 }
 
+//////////////////////////////////////////////////
+std::string Event::Name() const
+{
+  EventNames &names = Names();
+  std::lock_guard<std::mutex> lock(names.mutex);
+  auto iter = names.names.find(this);
+  if (iter != names.names.end())
+    return iter->second;
+  return std::string();
+}
+
 //////////////////////////////////////////////////
 Connection::Connection(Event *_e, const int _i)
   : event(_e), id(_i)
@@ -75,3 +153,77 @@ int Connection::Id() const
 {
   return this->id;
 }
+
+//////////////////////////////////////////////////
+ConnectionOwner::ConnectionOwner(const std::string &_filename,
+    const std::string &_instance)
+  : previous(g_currentOwner)
+{
+  std::string ownerName = "Plugin::" + _filename + "::" + _instance;
+
+  OwnerRegistry &owners = Owners();
+  std::lock_guard<std::mutex> lock(owners.mutex);
+  auto iter = owners.ids.find(ownerName);
+  if (iter != owners.ids.end())
+  {
+    g_currentOwner = iter->second;
+  }
+  else
+  {
+    owners.names.push_back(ownerName);
+    g_currentOwner = static_cast<uint32_t>(owners.names.size());
+    owners.ids[ownerName] = g_currentOwner;
+  }
+}
+
+//////////////////////////////////////////////////
+ConnectionOwner::ConnectionOwner(const uint32_t _id)
+  : previous(g_currentOwner)
+{
+  g_currentOwner = _id;
+}
+
+//////////////////////////////////////////////////
+ConnectionOwner::~ConnectionOwner()
+{
+  g_currentOwner = this->previous;
+}
+
+//////////////////////////////////////////////////
+uint32_t ConnectionOwner::Current()
+{
+  return g_currentOwner;
+}
+
+//////////////////////////////////////////////////
+uint32_t ConnectionOwner::Scope(const uint32_t _id, const std::string &_event)
+{
+  std::string ownerName;
+  {
+    OwnerRegistry &owners = Owners();
+    std::lock_guard<std::mutex> lock(owners.mutex);
+    if (_id == 0 || _id > owners.names.size())
+      return 0;
+    ownerName = owners.names[_id - 1];
+  }
+
+  return common::ScopeProfiler::RegisterScope(ownerName + "::" + _event);
+}
+
+//////////////////////////////////////////////////
+void CallbackScope::Begin()
+{
+  this->previous = g_currentOwner;
+  g_currentOwner = this->owner;
+  if (common::ScopeProfiler::Enabled())
+    this->start = common::ScopeProfiler::Now();
+}
+
+//////////////////////////////////////////////////
+void CallbackScope::End()
+{
+  if (this->start != 0)
+    common::ScopeProfiler::Record(this->scope, this->start,
+        common::ScopeProfiler::Now());
+  g_currentOwner = this->previous;
+}
@@ -18,11 +18,13 @@
 #define GAZEBO_COMMON_EVENT_HH_
 
 #include <atomic>
+#include <cstdint>
 #include <functional>
 #include <list>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <string>
 
 #include "gazebo/gazebo_config.h"
 #include "gazebo/common/Time.hh"
@@ -47,6 +49,11 @@ namespace gazebo
       /// \brief Constructor
       public: Event();
 
+      /// \brief Constructor of a named event. The callbacks that plugins
+      /// connect to a named event are timed by the built-in profiler.
+      /// \param[in] _name Name of the event.
+      public: explicit Event(const std::string &_name);
+
       /// \brief Destructor
       public: virtual ~Event();
 
@@ -62,10 +69,94 @@ namespace gazebo
       /// \param[in] _sig True if the event has been signaled.
       public: void SetSignaled(const bool _sig);
 
+      /// \brief Get the name of the event.
+      /// \return Name of the event, empty for an unnamed event.
+      public: std::string Name() const;
+
       /// \brief True if the event has been signaled.
       private: bool signaled;
     };
 
+    /// \class ConnectionOwner Event.hh common/common.hh
+    /// \brief Attributes the event connections made on the calling thread
+    /// to a plugin while this object exists. The callbacks of those
+    /// connections to named events, such as Events::worldUpdateBegin, are
+    /// recorded by the built-in profiler in a scope named
+    /// "Plugin::<filename>::<instance>::<event>". Connections made from
+    /// within such a callback are attributed to the same plugin.
+    class GZ_COMMON_VISIBLE ConnectionOwner
+    {
+      /// \brief Constructor.
+      /// \param[in] _filename File name of the plugin.
+      /// \param[in] _instance Name of the plugin instance.
+      public: ConnectionOwner(const std::string &_filename,
+                              const std::string &_instance);
+
+      /// \brief Constructor.
+      /// \param[in] _id Id of a registered owner.
+      public: explicit ConnectionOwner(const uint32_t _id);
+
+      /// \brief Destructor. Restores the previous owner.
+      public: ~ConnectionOwner();
+
+      /// \brief Get the owner of the connections made on the calling
+      /// thread.
+      /// \return Id of the owner, 0 if there is none.
+      public: static uint32_t Current();
+
+      /// \brief Get the profiler scope of the callbacks of an owner to an
+      /// event.
+      /// \param[in] _id Id of the owner.
+      /// \param[in] _event Name of the event.
+      /// \return Id of the profiler scope.
+      public: static uint32_t Scope(const uint32_t _id,
+                                    const std::string &_event);
+
+      /// \brief Owner to restore on destruction.
+      private: uint32_t previous;
+    };
+
+    /// \internal
+    /// \brief Times the callback of an owned connection, and makes its
+    /// owner current while the callback runs.
+    class GZ_COMMON_VISIBLE CallbackScope
+    {
+      /// \brief Constructor.
+      /// \param[in] _owner Id of the owner of the connection, 0 for none.
+      /// \param[in] _scope Id of the profiler scope of the callback.
+      public: CallbackScope(const uint32_t _owner, const uint32_t _scope)
+              : owner(_owner), scope(_scope)
+              {
+                if (this->owner != 0)
+                  this->Begin();
+              }
+
+      /// \brief Destructor.
+      public: ~CallbackScope()
+              {
+                if (this->owner != 0)
+                  this->End();
+              }
+
+      /// \brief Start timing the callback.
+      private: void Begin();
+
+      /// \brief Record the callback.
+      private: void End();
+
+      /// \brief Id of the owner of the connection.
+      private: const uint32_t owner;
+
+      /// \brief Id of the profiler scope.
+      private: const uint32_t scope;
+
+      /// \brief Owner to restore after the callback.
+      private: uint32_t previous = 0;
+
+      /// \brief Time stamp at the start of the callback.
+      private: uint64_t start = 0;
+    };
+
     /// \brief A class that encapsulates a connection.
     class GZ_COMMON_VISIBLE Connection
     {
@@ -101,6 +192,10 @@ namespace gazebo
       /// \brief Constructor.
       public: EventT();
 
+      /// \brief Constructor of a named event.
+      /// \param[in] _name Name of the event.
+      public: explicit EventT(const std::string &_name);
+
       /// \brief Destructor.
       public: virtual ~EventT();
 
@@ -280,6 +375,7 @@ namespace gazebo
           if ((iter.second != NULL) && iter.second->on)
           {
             IGN_PROFILE_BEGIN("callback0");
+            CallbackScope scope(iter.second->owner, iter.second->scope);
             iter.second->callback();
             IGN_PROFILE_END();
           }
@@ -301,6 +397,7 @@ namespace gazebo
           if ((iter.second != NULL) && iter.second->on)
           {
             IGN_PROFILE_BEGIN("callback1");
+            CallbackScope scope(iter.second->owner, iter.second->scope);
             iter.second->callback(_p);
             IGN_PROFILE_END();
           }
@@ -323,6 +420,7 @@ namespace gazebo
           if ((iter.second != NULL) && iter.second->on)
           {
             IGN_PROFILE_BEGIN("callback2");
+            CallbackScope scope(iter.second->owner, iter.second->scope);
             iter.second->callback(_p1, _p2);
             IGN_PROFILE_END();
           }
@@ -346,6 +444,7 @@ namespace gazebo
           if ((iter.second != NULL) && iter.second->on)
           {
             IGN_PROFILE_BEGIN("callback3");
+            CallbackScope scope(iter.second->owner, iter.second->scope);
             iter.second->callback(_p1, _p2, _p3);
             IGN_PROFILE_END();
           }
@@ -371,6 +470,7 @@ namespace gazebo
           if ((iter.second != NULL) && iter.second->on)
           {
             IGN_PROFILE_BEGIN("callback4");
+            CallbackScope scope(iter.second->owner, iter.second->scope);
             iter.second->callback(_p1, _p2, _p3, _p4);
             IGN_PROFILE_END();
           }
@@ -398,6 +498,7 @@ namespace gazebo
           if ((iter.second != NULL) && iter.second->on)
           {
             IGN_PROFILE_BEGIN("callback5");
+            CallbackScope scope(iter.second->owner, iter.second->scope);
             iter.second->callback(_p1, _p2, _p3, _p4, _p5);
             IGN_PROFILE_END();
           }
@@ -426,6 +527,7 @@ namespace gazebo
           if ((iter.second != NULL) && iter.second->on)
           {
             IGN_PROFILE_BEGIN("callback6");
+            CallbackScope scope(iter.second->owner, iter.second->scope);
             iter.second->callback(_p1, _p2, _p3, _p4, _p5, _p6);
             IGN_PROFILE_END();
           }
@@ -455,6 +557,7 @@ namespace gazebo
           if ((iter.second != NULL) && iter.second->on)
           {
             IGN_PROFILE_BEGIN("callback7");
+            CallbackScope scope(iter.second->owner, iter.second->scope);
             iter.second->callback(_p1, _p2, _p3, _p4, _p5, _p6, _p7);
             IGN_PROFILE_END();
           }
@@ -486,6 +589,7 @@ namespace gazebo
           if ((iter.second != NULL) && iter.second->on)
           {
             IGN_PROFILE_BEGIN("callback8");
+            CallbackScope scope(iter.second->owner, iter.second->scope);
             iter.second->callback(_p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8);
             IGN_PROFILE_END();
           }
@@ -519,6 +623,7 @@ namespace gazebo
           if ((iter.second != NULL) && iter.second->on)
           {
             IGN_PROFILE_BEGIN("callback9");
+            CallbackScope scope(iter.second->owner, iter.second->scope);
             iter.second->callback(
                 _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9);
             IGN_PROFILE_END();
@@ -554,6 +659,7 @@ namespace gazebo
           if ((iter.second != NULL) && iter.second->on)
           {
             IGN_PROFILE_BEGIN("callback10");
+            CallbackScope scope(iter.second->owner, iter.second->scope);
             iter.second->callback(
                 _p1, _p2, _p3, _p4, _p5, _p6, _p7, _p8, _p9, _p10);
             IGN_PROFILE_END();
@@ -583,6 +689,12 @@ namespace gazebo
 
         /// \brief Callback function
         public: std::function<T> callback;
+
+        /// \brief Owner of the connection, 0 for none.
+        public: uint32_t owner = 0;
+
+        /// \brief Profiler scope of the callback, if owned.
+        public: uint32_t scope = 0;
       };
 
       /// \def EvtConnectionMap
@@ -607,6 +719,14 @@ namespace gazebo
     {
     }
 
+    /// \brief Constructor of a named event.
+    /// \param[in] _name Name of the event.
+    template<typename T>
+    EventT<T>::EventT(const std::string &_name)
+    : Event(_name)
+    {
+    }
+
     /// \brief Destructor. Deletes all the associated connections.
     template<typename T>
     EventT<T>::~EventT()
@@ -627,7 +747,20 @@ namespace gazebo
         auto const &iter = this->connections.rbegin();
         index = iter->first + 1;
       }
-      this->connections[index].reset(new EventConnection(true, _subscriber));
+      std::unique_ptr<EventConnection> &conn = this->connections[index];
+      conn.reset(new EventConnection(true, _subscriber));
+
+      // Attribute the connection to the plugin making it
+      uint32_t owner = ConnectionOwner::Current();
+      if (owner != 0)
+      {
+        std::string eventName = this->Name();
+        if (!eventName.empty())
+        {
+          conn->owner = owner;
+          conn->scope = ConnectionOwner::Scope(owner, eventName);
+        }
+      }
       return ConnectionPtr(new Connection(this, index));
     }
 
@@ -17,10 +17,13 @@
 
 #include <functional>
 #include <future>
+#include <string>
 #include <thread>
 #include <gtest/gtest.h>
 #include <gazebo/common/Time.hh>
 #include <gazebo/common/Event.hh>
+#include <gazebo/common/ScopeProfiler.hh>
+#include "gazebo/test/helper_profiler.hh"
 #include "test/util.hh"
 
 using namespace gazebo;
@@ -294,6 +297,55 @@ TEST_F(EventTest, RaceConditions)
 }
 
 
+/////////////////////////////////////////////////
+TEST_F(EventTest, ConnectionOwner)
+{
+  common::ScopeProfiler::SetEnabled(true);
+  common::ScopeProfiler::Collect();
+  common::ScopeProfiler::Reset();
+
+  event::EventT<void ()> named("testEvent");
+  event::EventT<void ()> other("otherEvent");
+  event::EventT<void ()> unnamed;
+  EXPECT_EQ("testEvent", named.Name());
+  EXPECT_TRUE(unnamed.Name().empty());
+  EXPECT_EQ(0u, event::ConnectionOwner::Current());
+
+  int count = 0;
+  event::ConnectionPtr innerConn;
+  event::ConnectionPtr conn;
+  event::ConnectionPtr unnamedConn;
+  event::ConnectionPtr unownedConn = named.Connect([&count]() { ++count; });
+  {
+    event::ConnectionOwner owner("libtest_plugin.so", "model::plugin");
+    EXPECT_NE(0u, event::ConnectionOwner::Current());
+
+    conn = named.Connect([&]()
+        {
+          ++count;
+          // Connections made by a callback belong to its plugin
+          if (!innerConn)
+            innerConn = other.Connect([&count]() { ++count; });
+        });
+    unnamedConn = unnamed.Connect([&count]() { ++count; });
+  }
+  EXPECT_EQ(0u, event::ConnectionOwner::Current());
+
+  named();
+  named();
+  unnamed();
+  other();
+  EXPECT_EQ(6, count);
+
+  // Only the owned callbacks of named events are timed
+  common::ScopeProfiler::Collect();
+  std::string scope = "Plugin::libtest_plugin.so::model::plugin::";
+  EXPECT_EQ(2u, gazebo::testing::FindProfileStats(
+      scope + "testEvent").count);
+  EXPECT_EQ(1u, gazebo::testing::FindProfileStats(
+      scope + "otherEvent").count);
+}
+
 /////////////////////////////////////////////////
 int main(int argc, char **argv)
 {
@@ -30,17 +30,19 @@ EventT<void (std::string, std::string)> Events::setSelectedEntity;
 EventT<void (std::string)> Events::addEntity;
 EventT<void (std::string)> Events::deleteEntity;
 
-EventT<void (const common::UpdateInfo &)> Events::worldUpdateBegin;
-EventT<void (const common::UpdateInfo &)> Events::beforePhysicsUpdate;
+EventT<void (const common::UpdateInfo &)>
+    Events::worldUpdateBegin("worldUpdateBegin");
+EventT<void (const common::UpdateInfo &)>
+    Events::beforePhysicsUpdate("beforePhysicsUpdate");
 
-EventT<void ()> Events::worldUpdateEnd;
-EventT<void ()> Events::worldReset;
+EventT<void ()> Events::worldUpdateEnd("worldUpdateEnd");
+EventT<void ()> Events::worldReset("worldReset");
 EventT<void ()> Events::timeReset;
 
-EventT<void ()> Events::preRender;
+EventT<void ()> Events::preRender("preRender");
 EventT<void ()> Events::preRenderEnded;
-EventT<void ()> Events::render;
-EventT<void ()> Events::postRender;
+EventT<void ()> Events::render("render");
+EventT<void ()> Events::postRender("postRender");
 
 EventT<void (std::string)> Events::diagTimerStart;
 EventT<void (std::string)> Events::diagTimerStop;
@@ -0,0 +1,289 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "gazebo/common/Console.hh"
+#include "gazebo/common/Exception.hh"
+#include "gazebo/common/FrameQueue.hh"
+
+using namespace gazebo;
+using namespace common;
+
+namespace
+{
+  /// \brief A frame waiting in the queue.
+  class Frame
+  {
+    /// \brief Copy of the frame data, in a buffer from the pool.
+    public: std::vector<unsigned char> data;
+
+    /// \brief Function that processes the frame.
+    public: FrameQueue::Processor processor;
+  };
+}
+
+/// \brief Private data for the FrameQueue class
+class gazebo::common::FrameQueuePrivate
+{
+  /// \brief Worker thread loop.
+  public: void Run();
+
+  /// \brief Maximum number of frames waiting in the queue.
+  public: size_t capacity;
+
+  /// \brief What to do when the queue is full.
+  public: FrameQueue::OverflowPolicy policy;
+
+  /// \brief Protects the members below.
+  public: mutable std::mutex mutex;
+
+  /// \brief Signaled when a frame is pushed, or when stopping.
+  public: std::condition_variable pushed;
+
+  /// \brief Signaled when a worker takes a frame, or finishes one.
+  public: std::condition_variable popped;
+
+  /// \brief Frames waiting to be processed.
+  public: std::deque<Frame> frames;
+
+  /// \brief Buffers that are not in use.
+  public: std::vector<std::vector<unsigned char>> pool;
+
+  /// \brief Number of frames being copied into the queue.
+  public: size_t reserved = 0;
+
+  /// \brief Number of frames being processed.
+  public: size_t active = 0;
+
+  /// \brief Number of frames processed.
+  public: uint64_t processed = 0;
+
+  /// \brief Number of frames dropped.
+  public: uint64_t dropped = 0;
+
+  /// \brief Number of frames whose processor threw an exception.
+  public: uint64_t failed = 0;
+
+  /// \brief True when the workers must exit once the queue is empty.
+  public: bool stop = false;
+
+  /// \brief Worker threads.
+  public: std::vector<std::thread> threads;
+};
+
+//////////////////////////////////////////////////
+void FrameQueuePrivate::Run()
+{
+  std::unique_lock<std::mutex> lock(this->mutex);
+  while (true)
+  {
+    this->pushed.wait(lock, [this]
+        {
+          return this->stop || !this->frames.empty();
+        });
+    if (this->frames.empty())
+      return;
+
+    Frame frame = std::move(this->frames.front());
+    this->frames.pop_front();
+    ++this->active;
+    this->popped.notify_all();
+
+    lock.unlock();
+
+    // An exception would end the worker thread and the process, so a
+    // frame that fails to process is dropped instead.
+    bool ok = false;
+    try
+    {
+      frame.processor(frame.data.data(), frame.data.size());
+      ok = true;
+    }
+    catch(common::Exception &_e)
+    {
+      gzerr << "Dropping a frame that failed to process: "
+            << _e.GetErrorStr() << std::endl;
+    }
+    catch(std::exception &_e)
+    {
+      gzerr << "Dropping a frame that failed to process: "
+            << _e.what() << std::endl;
+    }
+    lock.lock();
+
+    this->pool.push_back(std::move(frame.data));
+    --this->active;
+    if (ok)
+      ++this->processed;
+    else
+      ++this->failed;
+    this->popped.notify_all();
+  }
+}
+
+//////////////////////////////////////////////////
+FrameQueue::FrameQueue(const size_t _capacity, const unsigned int _threads,
+    const OverflowPolicy _policy)
+  : dataPtr(new FrameQueuePrivate)
+{
+  this->dataPtr->capacity = std::max<size_t>(_capacity, 1u);
+  this->dataPtr->policy = _policy;
+
+  for (unsigned int i = 0; i < std::max(_threads, 1u); ++i)
+  {
+    this->dataPtr->threads.push_back(
+        std::thread(&FrameQueuePrivate::Run, this->dataPtr.get()));
+  }
+}
+
+//////////////////////////////////////////////////
+FrameQueue::~FrameQueue()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+    this->dataPtr->stop = true;
+  }
+  this->dataPtr->pushed.notify_all();
+
+  for (auto &thread : this->dataPtr->threads)
+    thread.join();
+}
+
+//////////////////////////////////////////////////
+bool FrameQueue::Push(const unsigned char *_data, const size_t _size,
+    Processor _processor)
+{
+  std::unique_lock<std::mutex> lock(this->dataPtr->mutex);
+
+  auto full = [this]
+  {
+    return this->dataPtr->frames.size() + this->dataPtr->reserved >=
+        this->dataPtr->capacity;
+  };
+
+  if (full())
+  {
+    if (this->dataPtr->policy == OverflowPolicy::DROP_NEWEST)
+    {
+      ++this->dataPtr->dropped;
+      return false;
+    }
+    else if (this->dataPtr->policy == OverflowPolicy::DROP_OLDEST &&
+        !this->dataPtr->frames.empty())
+    {
+      this->dataPtr->pool.push_back(
+          std::move(this->dataPtr->frames.front().data));
+      this->dataPtr->frames.pop_front();
+      ++this->dataPtr->dropped;
+    }
+    else
+    {
+      // Block, or the only frames in the way are still being copied
+      this->dataPtr->popped.wait(lock, [&full] {return !full();});
+    }
+  }
+
+  Frame frame;
+  if (!this->dataPtr->pool.empty())
+  {
+    frame.data = std::move(this->dataPtr->pool.back());
+    this->dataPtr->pool.pop_back();
+  }
+  frame.processor = std::move(_processor);
+
+  // Copy outside of the lock, in a slot reserved for this frame
+  ++this->dataPtr->reserved;
+  lock.unlock();
+  frame.data.resize(_size);
+  if (_size > 0)
+    std::memcpy(frame.data.data(), _data, _size);
+  lock.lock();
+  --this->dataPtr->reserved;
+
+  this->dataPtr->frames.push_back(std::move(frame));
+  lock.unlock();
+  this->dataPtr->pushed.notify_one();
+  return true;
+}
+
+//////////////////////////////////////////////////
+void FrameQueue::Flush()
+{
+  std::unique_lock<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->popped.wait(lock, [this]
+      {
+        return this->dataPtr->frames.empty() &&
+            this->dataPtr->reserved == 0 && this->dataPtr->active == 0;
+      });
+}
+
+//////////////////////////////////////////////////
+void FrameQueue::SetPolicy(const OverflowPolicy _policy)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->policy = _policy;
+}
+
+//////////////////////////////////////////////////
+FrameQueue::OverflowPolicy FrameQueue::Policy() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->policy;
+}
+
+//////////////////////////////////////////////////
+size_t FrameQueue::Capacity() const
+{
+  return this->dataPtr->capacity;
+}
+
+//////////////////////////////////////////////////
+size_t FrameQueue::Pending() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->frames.size() + this->dataPtr->active;
+}
+
+//////////////////////////////////////////////////
+uint64_t FrameQueue::ProcessedCount() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->processed;
+}
+
+//////////////////////////////////////////////////
+uint64_t FrameQueue::DroppedCount() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->dropped;
+}
+
+//////////////////////////////////////////////////
+uint64_t FrameQueue::FailedCount() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->failed;
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_COMMON_FRAMEQUEUE_HH_
+#define GAZEBO_COMMON_FRAMEQUEUE_HH_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace common
+  {
+    // Forward declare private data class
+    class FrameQueuePrivate;
+
+    /// \addtogroup gazebo_common
+    /// \{
+
+    /// \class FrameQueue FrameQueue.hh common/common.hh
+    /// \brief A bounded queue of frames that are processed on worker
+    /// threads, for example to encode images or videos without blocking the
+    /// render thread. Push() copies a frame into a buffer taken from a pool,
+    /// so the caller can reuse its buffer right away, and no memory is
+    /// allocated once the pool is warm.
+    ///
+    /// With a single worker thread, the frames are processed in the order
+    /// they were pushed.
+    class GZ_COMMON_VISIBLE FrameQueue
+    {
+      /// \brief What Push() does when the queue is full.
+      public: enum class OverflowPolicy
+      {
+        /// \brief Wait until a worker takes a frame from the queue.
+        BLOCK,
+
+        /// \brief Drop the frame being pushed.
+        DROP_NEWEST,
+
+        /// \brief Drop the oldest frame waiting in the queue.
+        DROP_OLDEST
+      };
+
+      /// \brief Function that processes a frame on a worker thread.
+      /// \param[in] _data Copy of the frame.
+      /// \param[in] _size Size of the frame in bytes.
+      public: using Processor =
+                  std::function<void(const unsigned char *_data,
+                                     const size_t _size)>;
+
+      /// \brief Constructor.
+      /// \param[in] _capacity Maximum number of frames waiting in the queue.
+      /// \param[in] _threads Number of worker threads.
+      /// \param[in] _policy What to do when the queue is full.
+      public: FrameQueue(const size_t _capacity = 8,
+                  const unsigned int _threads = 1,
+                  const OverflowPolicy _policy = OverflowPolicy::BLOCK);
+
+      /// \brief Destructor. Processes the frames left in the queue, then
+      /// stops the worker threads.
+      public: ~FrameQueue();
+
+      /// \brief Copy a frame into the queue.
+      /// \param[in] _data Frame data.
+      /// \param[in] _size Size of the frame in bytes.
+      /// \param[in] _processor Function that processes the copy of the frame
+      /// on a worker thread.
+      /// \return False if the frame was dropped because the queue is full.
+      public: bool Push(const unsigned char *_data, const size_t _size,
+                  Processor _processor);
+
+      /// \brief Wait until all the frames pushed so far are processed.
+      public: void Flush();
+
+      /// \brief Set what Push() does when the queue is full.
+      /// \param[in] _policy The overflow policy.
+      public: void SetPolicy(const OverflowPolicy _policy);
+
+      /// \brief Get what Push() does when the queue is full.
+      /// \return The overflow policy.
+      public: OverflowPolicy Policy() const;
+
+      /// \brief Get the maximum number of frames waiting in the queue.
+      /// \return The capacity.
+      public: size_t Capacity() const;
+
+      /// \brief Get the number of frames waiting or being processed.
+      /// \return Number of pending frames.
+      public: size_t Pending() const;
+
+      /// \brief Get the number of frames that were processed.
+      /// \return Number of processed frames.
+      public: uint64_t ProcessedCount() const;
+
+      /// \brief Get the number of frames that were dropped because the
+      /// queue was full.
+      /// \return Number of dropped frames.
+      public: uint64_t DroppedCount() const;
+
+      /// \brief Get the number of frames that were dropped because their
+      /// processor threw an exception.
+      /// \return Number of failed frames.
+      public: uint64_t FailedCount() const;
+
+      /// \internal
+      /// \brief Private data pointer.
+      private: std::unique_ptr<FrameQueuePrivate> dataPtr;
+    };
+    /// \}
+  }
+}
+#endif
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "gazebo/common/FrameQueue.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+
+class FrameQueue : public gazebo::testing::AutoLogFixture { };
+
+/// \brief Holds the workers of a queue until released.
+class Gate
+{
+  /// \brief Wait until the gate is open.
+  public: void Wait()
+  {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->condition.wait(lock, [this] {return this->open;});
+  }
+
+  /// \brief Open the gate.
+  public: void Open()
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      this->open = true;
+    }
+    this->condition.notify_all();
+  }
+
+  /// \brief Protects open.
+  private: std::mutex mutex;
+
+  /// \brief Signaled when the gate opens.
+  private: std::condition_variable condition;
+
+  /// \brief True if the gate is open.
+  private: bool open = false;
+};
+
+/////////////////////////////////////////////////
+TEST_F(FrameQueue, ProcessInOrder)
+{
+  std::vector<unsigned char> received;
+  {
+    common::FrameQueue queue(4, 1);
+    EXPECT_EQ(4u, queue.Capacity());
+    EXPECT_EQ(common::FrameQueue::OverflowPolicy::BLOCK, queue.Policy());
+
+    for (unsigned char i = 0; i < 100; ++i)
+    {
+      // The queue keeps its own copy of the frame
+      std::vector<unsigned char> frame(16, i);
+      EXPECT_TRUE(queue.Push(frame.data(), frame.size(),
+          [&received](const unsigned char *_data, const size_t _size)
+          {
+            EXPECT_EQ(16u, _size);
+            received.push_back(_data[_size - 1]);
+          }));
+      frame.assign(16, 255);
+    }
+
+    queue.Flush();
+    EXPECT_EQ(0u, queue.Pending());
+    EXPECT_EQ(100u, queue.ProcessedCount());
+    EXPECT_EQ(0u, queue.DroppedCount());
+  }
+
+  ASSERT_EQ(100u, received.size());
+  for (unsigned char i = 0; i < 100; ++i)
+    EXPECT_EQ(i, received[i]);
+}
+
+/////////////////////////////////////////////////
+TEST_F(FrameQueue, DropNewest)
+{
+  Gate gate;
+  std::vector<unsigned char> received;
+
+  common::FrameQueue queue(2, 1,
+      common::FrameQueue::OverflowPolicy::DROP_NEWEST);
+  std::atomic<bool> started(false);
+  auto process = [&](const unsigned char *_data, const size_t)
+  {
+    started = true;
+    gate.Wait();
+    received.push_back(_data[0]);
+  };
+
+  // The first frame blocks the worker, then two fill the queue
+  unsigned char value = 0;
+  EXPECT_TRUE(queue.Push(&value, 1, process));
+  while (!started)
+    std::this_thread::yield();
+  for (value = 1; value < 5; ++value)
+    EXPECT_EQ(value < 3, queue.Push(&value, 1, process));
+
+  EXPECT_EQ(2u, queue.DroppedCount());
+  gate.Open();
+  queue.Flush();
+
+  EXPECT_EQ(std::vector<unsigned char>({0, 1, 2}), received);
+}
+
+/////////////////////////////////////////////////
+TEST_F(FrameQueue, DropOldest)
+{
+  Gate gate;
+  std::vector<unsigned char> received;
+
+  common::FrameQueue queue(2, 1,
+      common::FrameQueue::OverflowPolicy::DROP_OLDEST);
+  std::atomic<bool> started(false);
+  auto process = [&](const unsigned char *_data, const size_t)
+  {
+    started = true;
+    gate.Wait();
+    received.push_back(_data[0]);
+  };
+
+  unsigned char value = 0;
+  EXPECT_TRUE(queue.Push(&value, 1, process));
+  while (!started)
+    std::this_thread::yield();
+  for (value = 1; value < 5; ++value)
+    EXPECT_TRUE(queue.Push(&value, 1, process));
+
+  EXPECT_EQ(2u, queue.DroppedCount());
+  gate.Open();
+  queue.Flush();
+
+  EXPECT_EQ(std::vector<unsigned char>({0, 3, 4}), received);
+}
+
+/////////////////////////////////////////////////
+TEST_F(FrameQueue, Block)
+{
+  std::atomic<unsigned int> count(0);
+  std::vector<unsigned char> frame(1024, 1);
+
+  // Several workers, and a producer that is faster than them
+  common::FrameQueue queue(2, 3);
+  for (int i = 0; i < 200; ++i)
+  {
+    EXPECT_TRUE(queue.Push(frame.data(), frame.size(),
+        [&count](const unsigned char *_data, const size_t _size)
+        {
+          EXPECT_EQ(1024u, _size);
+          EXPECT_EQ(1, _data[0]);
+          std::this_thread::sleep_for(std::chrono::microseconds(100));
+          ++count;
+        }));
+    EXPECT_LE(queue.Pending(), 2u + 3u);
+  }
+
+  queue.Flush();
+  EXPECT_EQ(200u, count);
+  EXPECT_EQ(0u, queue.DroppedCount());
+}
+
+/////////////////////////////////////////////////
+TEST_F(FrameQueue, ProcessorThrows)
+{
+  std::atomic<unsigned int> count(0);
+  unsigned char value = 0;
+
+  common::FrameQueue queue(4, 2);
+  for (int i = 0; i < 10; ++i)
+  {
+    EXPECT_TRUE(queue.Push(&value, 1,
+        [&count, i](const unsigned char *, const size_t)
+        {
+          if (i % 2 == 0)
+            throw std::runtime_error("unable to encode frame");
+          ++count;
+        }));
+  }
+
+  // The frames that failed are dropped, and the workers keep running
+  queue.Flush();
+  EXPECT_EQ(5u, count);
+  EXPECT_EQ(5u, queue.ProcessedCount());
+  EXPECT_EQ(5u, queue.FailedCount());
+  EXPECT_EQ(0u, queue.DroppedCount());
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
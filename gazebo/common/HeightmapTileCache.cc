@@ -0,0 +1,474 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <ignition/math/Helpers.hh>
+
+#include "gazebo/gazebo_config.h"
+#include "gazebo/common/Console.hh"
+#include "gazebo/common/Dem.hh"
+#include "gazebo/common/HeightmapTileCache.hh"
+
+using namespace gazebo;
+using namespace common;
+
+namespace
+{
+  /// \brief Identifies a heightmap tile cache file.
+  const char kMagic[8] = {'G', 'Z', 'H', 'T', 'C', 'A', 'C', 'H'};
+
+  /// \brief Current version of the file layout.
+  const uint32_t kVersion = 1;
+
+  /// \brief On-disk header, followed by the tiles in row-major tile order.
+  /// Every tile holds tileSize * tileSize floats, edge tiles are padded.
+  struct TileCacheHeader
+  {
+    char magic[8];
+    uint32_t version;
+    uint32_t vertSize;
+    uint32_t tileSize;
+    uint32_t tilesPerSide;
+    int32_t subSampling;
+    float minHeight;
+    float maxHeight;
+    uint32_t reserved;
+    double size[3];
+  };
+
+  static_assert(sizeof(TileCacheHeader) == 64,
+      "Unexpected heightmap tile cache header size");
+
+  /// \brief Default number of tiles kept in memory.
+  const unsigned int kDefaultMaxResidentTiles = 64;
+}
+
+/// \brief Private data for the HeightmapTileCache class.
+class gazebo::common::HeightmapTileCachePrivate
+{
+  /// \brief Copy a tile from the mapped file into the resident set,
+  /// evicting the least recently used tile if needed.
+  /// Must be called with mutex locked.
+  /// \param[in] _index Tile index.
+  /// \return Pointer to the tile heights.
+  public: const float *Tile(uint32_t _index);
+
+  /// \brief Mapped cache file.
+  public: boost::iostreams::mapped_file_source file;
+
+  /// \brief Header of the mapped file.
+  public: TileCacheHeader header;
+
+  /// \brief Resident tiles, keyed by tile index.
+  public: std::unordered_map<uint32_t,
+          std::pair<std::vector<float>, std::list<uint32_t>::iterator>> tiles;
+
+  /// \brief Tile indices, most recently used first.
+  public: std::list<uint32_t> lru;
+
+  /// \brief Maximum number of resident tiles.
+  public: unsigned int maxResidentTiles = kDefaultMaxResidentTiles;
+
+  /// \brief Index of the last tile accessed, to skip the map lookup for
+  /// consecutive queries in the same tile.
+  public: uint32_t lastIndex = std::numeric_limits<uint32_t>::max();
+
+  /// \brief Heights of the last tile accessed.
+  public: const float *lastTile = nullptr;
+
+  /// \brief Protects the resident set.
+  public: std::mutex mutex;
+};
+
+//////////////////////////////////////////////////
+const float *HeightmapTileCachePrivate::Tile(uint32_t _index)
+{
+  if (_index == this->lastIndex)
+    return this->lastTile;
+
+  auto iter = this->tiles.find(_index);
+  if (iter != this->tiles.end())
+  {
+    // Move to the front of the LRU list
+    this->lru.splice(this->lru.begin(), this->lru, iter->second.second);
+  }
+  else
+  {
+    while (!this->lru.empty() && this->tiles.size() >= this->maxResidentTiles)
+    {
+      this->tiles.erase(this->lru.back());
+      this->lru.pop_back();
+    }
+
+    const size_t tileCount =
+        this->header.tileSize * this->header.tileSize;
+    const float *src = reinterpret_cast<const float *>(this->file.data() +
+        sizeof(TileCacheHeader)) + static_cast<size_t>(_index) * tileCount;
+
+    this->lru.push_front(_index);
+    auto &entry = this->tiles[_index];
+    entry.first.assign(src, src + tileCount);
+    entry.second = this->lru.begin();
+    iter = this->tiles.find(_index);
+  }
+
+  this->lastIndex = _index;
+  this->lastTile = iter->second.first.data();
+  return this->lastTile;
+}
+
+//////////////////////////////////////////////////
+HeightmapTileCache::HeightmapTileCache()
+  : dataPtr(new HeightmapTileCachePrivate)
+{
+  std::memset(&this->dataPtr->header, 0, sizeof(TileCacheHeader));
+}
+
+//////////////////////////////////////////////////
+HeightmapTileCache::~HeightmapTileCache()
+{
+  if (this->dataPtr->file.is_open())
+    this->dataPtr->file.close();
+}
+
+//////////////////////////////////////////////////
+bool HeightmapTileCache::Bake(HeightmapData *_data, int _subSampling,
+    const ignition::math::Vector3d &_size, unsigned int _tileSize,
+    const std::string &_filename)
+{
+  if (!_data)
+  {
+    gzerr << "Unable to bake a heightmap tile cache without data\n";
+    return false;
+  }
+
+  if (_subSampling <= 0 || (_subSampling & (_subSampling - 1)))
+  {
+    gzerr << "Heightmap sampling value must be a power of 2\n";
+    return false;
+  }
+
+  if (_data->GetWidth() != _data->GetHeight() ||
+      !ignition::math::isPowerOfTwo(_data->GetWidth() - 1))
+  {
+    gzerr << "Heightmap data size must be square, with a size of 2^n+1\n";
+    return false;
+  }
+
+  // Same computation as physics::HeightmapShape::Init
+  unsigned int vertSize = (_data->GetWidth() * _subSampling) - _subSampling + 1;
+
+  ignition::math::Vector3d scale;
+  scale.X() = _size.X() / vertSize;
+  scale.Y() = _size.Y() / vertSize;
+
+  double heightmapSizeZ = _data->GetMaxElevation();
+#ifdef HAVE_GDAL
+  auto demData = dynamic_cast<Dem *>(_data);
+  if (demData)
+    heightmapSizeZ = heightmapSizeZ - demData->GetMinElevation();
+#endif
+
+  if (ignition::math::equal(heightmapSizeZ, 0.0))
+    scale.Z() = 1.0;
+  else
+    scale.Z() = std::fabs(_size.Z()) / heightmapSizeZ;
+
+  std::vector<float> heights;
+  _data->FillHeightMap(_subSampling, vertSize, _size, scale, false, heights);
+
+  return Bake(heights, vertSize, _subSampling, _size, _tileSize, _filename);
+}
+
+//////////////////////////////////////////////////
+bool HeightmapTileCache::Bake(const std::vector<float> &_heights,
+    unsigned int _vertSize, int _subSampling,
+    const ignition::math::Vector3d &_size, unsigned int _tileSize,
+    const std::string &_filename)
+{
+  if (_vertSize == 0 || _tileSize == 0 ||
+      _heights.size() != static_cast<size_t>(_vertSize) * _vertSize)
+  {
+    gzerr << "Invalid heightmap tile cache dimensions\n";
+    return false;
+  }
+
+  std::ofstream out(_filename.c_str(), std::ios::out | std::ios::binary);
+  if (!out)
+  {
+    gzerr << "Unable to open heightmap tile cache [" << _filename
+          << "] for writing\n";
+    return false;
+  }
+
+  TileCacheHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kVersion;
+  header.vertSize = _vertSize;
+  header.tileSize = _tileSize;
+  header.tilesPerSide = (_vertSize + _tileSize - 1) / _tileSize;
+  header.subSampling = _subSampling;
+  auto minmax = std::minmax_element(_heights.begin(), _heights.end());
+  header.minHeight = *minmax.first;
+  header.maxHeight = *minmax.second;
+  header.size[0] = _size.X();
+  header.size[1] = _size.Y();
+  header.size[2] = _size.Z();
+
+  out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+  std::vector<float> tile(_tileSize * _tileSize);
+  for (unsigned int ty = 0; ty < header.tilesPerSide; ++ty)
+  {
+    for (unsigned int tx = 0; tx < header.tilesPerSide; ++tx)
+    {
+      std::fill(tile.begin(), tile.end(), header.minHeight);
+      for (unsigned int y = 0; y < _tileSize; ++y)
+      {
+        unsigned int gy = ty * _tileSize + y;
+        if (gy >= _vertSize)
+          break;
+        unsigned int gx = tx * _tileSize;
+        unsigned int count = std::min(_tileSize, _vertSize - gx);
+        const size_t offset = static_cast<size_t>(gy) * _vertSize + gx;
+        std::copy(_heights.begin() + offset,
+                  _heights.begin() + offset + count,
+                  tile.begin() + static_cast<size_t>(y) * _tileSize);
+      }
+      out.write(reinterpret_cast<const char *>(tile.data()),
+          tile.size() * sizeof(float));
+    }
+  }
+
+  if (!out)
+  {
+    gzerr << "Failed to write heightmap tile cache [" << _filename << "]\n";
+    return false;
+  }
+
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool HeightmapTileCache::IsTileCache(const std::string &_filename)
+{
+  std::ifstream in(_filename.c_str(), std::ios::in | std::ios::binary);
+  if (!in)
+    return false;
+
+  char magic[sizeof(kMagic)];
+  in.read(magic, sizeof(magic));
+  return in && std::memcmp(magic, kMagic, sizeof(kMagic)) == 0;
+}
+
+//////////////////////////////////////////////////
+bool HeightmapTileCache::Load(const std::string &_filename)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+
+  this->dataPtr->tiles.clear();
+  this->dataPtr->lru.clear();
+  this->dataPtr->lastIndex = std::numeric_limits<uint32_t>::max();
+  this->dataPtr->lastTile = nullptr;
+  if (this->dataPtr->file.is_open())
+    this->dataPtr->file.close();
+
+  try
+  {
+    this->dataPtr->file.open(_filename);
+  }
+  catch(std::exception &_e)
+  {
+    gzerr << "Unable to map heightmap tile cache [" << _filename << "]: "
+          << _e.what() << std::endl;
+    return false;
+  }
+
+  if (this->dataPtr->file.size() < sizeof(TileCacheHeader))
+  {
+    gzerr << "Heightmap tile cache [" << _filename << "] is truncated\n";
+    this->dataPtr->file.close();
+    return false;
+  }
+
+  TileCacheHeader &header = this->dataPtr->header;
+  std::memcpy(&header, this->dataPtr->file.data(), sizeof(TileCacheHeader));
+
+  const size_t expectedSize = sizeof(TileCacheHeader) +
+      static_cast<size_t>(header.tilesPerSide) * header.tilesPerSide *
+      header.tileSize * header.tileSize * sizeof(float);
+
+  if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+      header.version != kVersion || header.tileSize == 0 ||
+      this->dataPtr->file.size() != expectedSize)
+  {
+    gzerr << "Invalid heightmap tile cache [" << _filename << "]\n";
+    std::memset(&header, 0, sizeof(TileCacheHeader));
+    this->dataPtr->file.close();
+    return false;
+  }
+
+  return true;
+}
+
+//////////////////////////////////////////////////
+bool HeightmapTileCache::Valid() const
+{
+  return this->dataPtr->file.is_open();
+}
+
+//////////////////////////////////////////////////
+float HeightmapTileCache::Height(unsigned int _x, unsigned int _y)
+{
+  const TileCacheHeader &header = this->dataPtr->header;
+  if (_x >= header.vertSize || _y >= header.vertSize)
+    return 0.0f;
+
+  const uint32_t index = (_y / header.tileSize) * header.tilesPerSide +
+      (_x / header.tileSize);
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  const float *tile = this->dataPtr->Tile(index);
+  return tile[(_y % header.tileSize) * header.tileSize +
+      (_x % header.tileSize)];
+}
+
+//////////////////////////////////////////////////
+void HeightmapTileCache::Prefetch(unsigned int _minX, unsigned int _minY,
+    unsigned int _maxX, unsigned int _maxY)
+{
+  const TileCacheHeader &header = this->dataPtr->header;
+  if (header.vertSize == 0)
+    return;
+
+  _maxX = std::min(_maxX, header.vertSize - 1);
+  _maxY = std::min(_maxY, header.vertSize - 1);
+
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  for (unsigned int ty = _minY / header.tileSize;
+       ty <= _maxY / header.tileSize; ++ty)
+  {
+    for (unsigned int tx = _minX / header.tileSize;
+         tx <= _maxX / header.tileSize; ++tx)
+    {
+      this->dataPtr->Tile(ty * header.tilesPerSide + tx);
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void HeightmapTileCache::FillHeights(bool _flipY,
+    std::vector<float> &_heights)
+{
+  const TileCacheHeader &header = this->dataPtr->header;
+  _heights.resize(static_cast<size_t>(header.vertSize) * header.vertSize);
+
+  // Read straight from the mapped file so the resident set is untouched.
+  const float *data = reinterpret_cast<const float *>(
+      this->dataPtr->file.data() + sizeof(TileCacheHeader));
+  const size_t tileCount =
+      static_cast<size_t>(header.tileSize) * header.tileSize;
+
+  for (unsigned int y = 0; y < header.vertSize; ++y)
+  {
+    const size_t row = _flipY ? header.vertSize - y - 1 : y;
+    for (unsigned int x = 0; x < header.vertSize; ++x)
+    {
+      const size_t index =
+          static_cast<size_t>(y / header.tileSize) * header.tilesPerSide +
+          (x / header.tileSize);
+      _heights[row * header.vertSize + x] = data[index * tileCount +
+          static_cast<size_t>(y % header.tileSize) * header.tileSize +
+          (x % header.tileSize)];
+    }
+  }
+}
+
+//////////////////////////////////////////////////
+void HeightmapTileCache::SetMaxResidentTiles(unsigned int _count)
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  this->dataPtr->maxResidentTiles = std::max(1u, _count);
+
+  while (this->dataPtr->tiles.size() > this->dataPtr->maxResidentTiles)
+  {
+    this->dataPtr->tiles.erase(this->dataPtr->lru.back());
+    this->dataPtr->lru.pop_back();
+  }
+  this->dataPtr->lastIndex = std::numeric_limits<uint32_t>::max();
+  this->dataPtr->lastTile = nullptr;
+}
+
+//////////////////////////////////////////////////
+unsigned int HeightmapTileCache::MaxResidentTiles() const
+{
+  return this->dataPtr->maxResidentTiles;
+}
+
+//////////////////////////////////////////////////
+unsigned int HeightmapTileCache::ResidentTiles() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  return this->dataPtr->tiles.size();
+}
+
+//////////////////////////////////////////////////
+unsigned int HeightmapTileCache::VertSize() const
+{
+  return this->dataPtr->header.vertSize;
+}
+
+//////////////////////////////////////////////////
+unsigned int HeightmapTileCache::TileSize() const
+{
+  return this->dataPtr->header.tileSize;
+}
+
+//////////////////////////////////////////////////
+int HeightmapTileCache::SubSampling() const
+{
+  return this->dataPtr->header.subSampling;
+}
+
+//////////////////////////////////////////////////
+ignition::math::Vector3d HeightmapTileCache::Size() const
+{
+  return ignition::math::Vector3d(this->dataPtr->header.size[0],
+      this->dataPtr->header.size[1], this->dataPtr->header.size[2]);
+}
+
+//////////////////////////////////////////////////
+float HeightmapTileCache::MinHeight() const
+{
+  return this->dataPtr->header.minHeight;
+}
+
+//////////////////////////////////////////////////
+float HeightmapTileCache::MaxHeight() const
+{
+  return this->dataPtr->header.maxHeight;
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_COMMON_HEIGHTMAPTILECACHE_HH_
+#define GAZEBO_COMMON_HEIGHTMAPTILECACHE_HH_
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <ignition/math/Vector3.hh>
+
+#include "gazebo/common/HeightmapData.hh"
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace common
+  {
+    // Forward declare private data class.
+    class HeightmapTileCachePrivate;
+
+    /// \addtogroup gazebo_common Common
+    /// \{
+
+    /// \class HeightmapTileCache HeightmapTileCache.hh common/common.hh
+    /// \brief Out-of-core storage for very large heightmaps.
+    ///
+    /// A tile cache is a file produced once from a DEM or image with Bake().
+    /// It holds the final, subsampled and scaled height grid split into
+    /// square tiles. At runtime the file is memory-mapped and tiles are
+    /// copied into a bounded least-recently-used set the first time one of
+    /// their heights is requested, so only the regions around colliding
+    /// entities are ever resident.
+    class GZ_COMMON_VISIBLE HeightmapTileCache
+    {
+      /// \brief Constructor.
+      public: HeightmapTileCache();
+
+      /// \brief Destructor.
+      public: virtual ~HeightmapTileCache();
+
+      /// \brief Bake a tile cache file from heightmap data. The heights are
+      /// computed exactly as physics::HeightmapShape would compute them for
+      /// the same size and sampling, unflipped along the y direction.
+      /// \param[in] _data Heightmap data to bake.
+      /// \param[in] _subSampling Subsampling, must be a power of 2.
+      /// \param[in] _size Size of the terrain in meters.
+      /// \param[in] _tileSize Number of vertices per tile side.
+      /// \param[in] _filename Path of the cache file to write.
+      /// \return True on success.
+      public: static bool Bake(HeightmapData *_data, int _subSampling,
+          const ignition::math::Vector3d &_size, unsigned int _tileSize,
+          const std::string &_filename);
+
+      /// \brief Bake a tile cache file from an already computed height grid.
+      /// \param[in] _heights Heights, row major, _vertSize * _vertSize values.
+      /// \param[in] _vertSize Number of vertices per side.
+      /// \param[in] _subSampling Subsampling used to compute the heights.
+      /// \param[in] _size Size of the terrain in meters.
+      /// \param[in] _tileSize Number of vertices per tile side.
+      /// \param[in] _filename Path of the cache file to write.
+      /// \return True on success.
+      public: static bool Bake(const std::vector<float> &_heights,
+          unsigned int _vertSize, int _subSampling,
+          const ignition::math::Vector3d &_size, unsigned int _tileSize,
+          const std::string &_filename);
+
+      /// \brief Check whether a file is a heightmap tile cache.
+      /// \param[in] _filename Path to the file.
+      /// \return True if the file starts with a valid tile cache header.
+      public: static bool IsTileCache(const std::string &_filename);
+
+      /// \brief Memory-map a tile cache file.
+      /// \param[in] _filename Path to the cache file.
+      /// \return True on success.
+      public: bool Load(const std::string &_filename);
+
+      /// \brief Get whether a cache file is currently loaded.
+      /// \return True if Load() succeeded.
+      public: bool Valid() const;
+
+      /// \brief Get a height, paging in its tile if needed.
+      /// \param[in] _x X vertex index.
+      /// \param[in] _y Y vertex index.
+      /// \return The height, or 0 when out of bounds.
+      public: float Height(unsigned int _x, unsigned int _y);
+
+      /// \brief Page in every tile overlapping a rectangle of vertices.
+      /// \param[in] _minX Minimum x vertex index.
+      /// \param[in] _minY Minimum y vertex index.
+      /// \param[in] _maxX Maximum x vertex index.
+      /// \param[in] _maxY Maximum y vertex index.
+      public: void Prefetch(unsigned int _minX, unsigned int _minY,
+          unsigned int _maxX, unsigned int _maxY);
+
+      /// \brief Read the whole height grid, for consumers that cannot page.
+      /// \param[in] _flipY True to invert the order of the rows.
+      /// \param[out] _heights Vector of VertSize() * VertSize() heights.
+      public: void FillHeights(bool _flipY, std::vector<float> &_heights);
+
+      /// \brief Set the maximum number of tiles kept in memory.
+      /// \param[in] _count Number of tiles, at least 1.
+      public: void SetMaxResidentTiles(unsigned int _count);
+
+      /// \brief Get the maximum number of tiles kept in memory.
+      /// \return Number of tiles.
+      public: unsigned int MaxResidentTiles() const;
+
+      /// \brief Get the number of tiles currently in memory.
+      /// \return Number of tiles.
+      public: unsigned int ResidentTiles() const;
+
+      /// \brief Get the number of vertices per side of the grid.
+      /// \return Number of vertices.
+      public: unsigned int VertSize() const;
+
+      /// \brief Get the number of vertices per tile side.
+      /// \return Number of vertices.
+      public: unsigned int TileSize() const;
+
+      /// \brief Get the subsampling used to bake the cache.
+      /// \return The subsampling.
+      public: int SubSampling() const;
+
+      /// \brief Get the terrain size used to bake the cache.
+      /// \return Size in meters.
+      public: ignition::math::Vector3d Size() const;
+
+      /// \brief Get the minimum height of the whole grid.
+      /// \return Minimum height.
+      public: float MinHeight() const;
+
+      /// \brief Get the maximum height of the whole grid.
+      /// \return Maximum height.
+      public: float MaxHeight() const;
+
+      /// \internal
+      /// \brief Pointer to private data.
+      private: std::unique_ptr<HeightmapTileCachePrivate> dataPtr;
+    };
+    /// \}
+  }
+}
+#endif
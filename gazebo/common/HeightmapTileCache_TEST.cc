@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <algorithm>
+#include <boost/filesystem.hpp>
+#include <gtest/gtest.h>
+
+#include "gazebo/common/HeightmapTileCache.hh"
+#include "gazebo/common/ImageHeightmap.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+
+class HeightmapTileCacheTest : public gazebo::testing::AutoLogFixture { };
+
+/////////////////////////////////////////////////
+TEST_F(HeightmapTileCacheTest, InvalidFile)
+{
+  common::HeightmapTileCache cache;
+  EXPECT_FALSE(cache.Valid());
+  EXPECT_FALSE(cache.Load("/file/shouldn/never/exist.gzhtc"));
+  EXPECT_FALSE(common::HeightmapTileCache::IsTileCache(
+      "/file/shouldn/never/exist.gzhtc"));
+  EXPECT_FLOAT_EQ(0.0f, cache.Height(0, 0));
+}
+
+/////////////////////////////////////////////////
+TEST_F(HeightmapTileCacheTest, BakeAndPage)
+{
+  boost::filesystem::path pathOut(boost::filesystem::current_path());
+  boost::filesystem::create_directories(pathOut / "tmp");
+  std::string filename = (pathOut / "tmp" / "bowl.gzhtc").string();
+
+  common::ImageHeightmap img;
+  ASSERT_EQ(0, img.Load("file://media/materials/textures/heightmap_bowl.png"));
+
+  ignition::math::Vector3d size(129, 129, 10);
+  EXPECT_TRUE(common::HeightmapTileCache::Bake(&img, 2, size, 64, filename));
+  EXPECT_TRUE(common::HeightmapTileCache::IsTileCache(filename));
+
+  common::HeightmapTileCache cache;
+  ASSERT_TRUE(cache.Load(filename));
+  EXPECT_TRUE(cache.Valid());
+  EXPECT_EQ(257u, cache.VertSize());
+  EXPECT_EQ(64u, cache.TileSize());
+  EXPECT_EQ(2, cache.SubSampling());
+  EXPECT_EQ(size, cache.Size());
+
+  // Compare against the heights computed in memory
+  unsigned int vertSize = cache.VertSize();
+  ignition::math::Vector3d scale(size.X() / vertSize, size.Y() / vertSize,
+      size.Z() / img.GetMaxElevation());
+  std::vector<float> expected;
+  img.FillHeightMap(2, vertSize, size, scale, false, expected);
+
+  cache.SetMaxResidentTiles(4);
+  for (unsigned int y = 0; y < vertSize; ++y)
+  {
+    for (unsigned int x = 0; x < vertSize; ++x)
+      EXPECT_FLOAT_EQ(expected[y * vertSize + x], cache.Height(x, y));
+  }
+
+  // The resident set never grows past its bound
+  EXPECT_EQ(4u, cache.ResidentTiles());
+
+  // Out of bounds
+  EXPECT_FLOAT_EQ(0.0f, cache.Height(vertSize, 0));
+
+  // Prefetch pages in every tile of the region
+  cache.SetMaxResidentTiles(100);
+  cache.Prefetch(0, 0, vertSize - 1, vertSize - 1);
+  EXPECT_EQ(25u, cache.ResidentTiles());
+
+  // Full read, flipped
+  std::vector<float> flipped;
+  cache.FillHeights(true, flipped);
+  ASSERT_EQ(expected.size(), flipped.size());
+  EXPECT_FLOAT_EQ(expected[(vertSize - 1) * vertSize], flipped[0]);
+  EXPECT_FLOAT_EQ(expected[0], flipped[(vertSize - 1) * vertSize]);
+
+  EXPECT_FLOAT_EQ(*std::min_element(expected.begin(), expected.end()),
+      cache.MinHeight());
+  EXPECT_FLOAT_EQ(*std::max_element(expected.begin(), expected.end()),
+      cache.MaxHeight());
+
+  boost::filesystem::remove_all(pathOut / "tmp");
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,629 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <ignition/math/Color.hh>
+#include <ignition/math/Matrix4.hh>
+#include <ignition/math/Vector2.hh>
+#include <ignition/math/Vector3.hh>
+
+#include "gazebo/common/Console.hh"
+#include "gazebo/common/Material.hh"
+#include "gazebo/common/Mesh.hh"
+#include "gazebo/common/MeshCache.hh"
+#include "gazebo/common/Skeleton.hh"
+#include "gazebo/common/SkeletonAnimation.hh"
+
+using namespace gazebo;
+using namespace common;
+
+namespace
+{
+  /// \brief Identifies a mesh cache file.
+  const char kMagic[8] = {'G', 'Z', 'M', 'E', 'S', 'H', 'C', 'A'};
+
+  /// \brief Version of the file layout. Bump it whenever the layout or the
+  /// output of a mesh loader changes, so that stale entries are ignored.
+  const uint32_t kVersion = 1;
+
+  /// \brief Appends binary values to a buffer.
+  class Writer
+  {
+    public: template<typename T> void Pod(const T &_value)
+    {
+      const char *data = reinterpret_cast<const char *>(&_value);
+      this->buffer.append(data, sizeof(T));
+    }
+
+    public: void String(const std::string &_value)
+    {
+      this->Pod<uint32_t>(_value.size());
+      this->buffer.append(_value);
+    }
+
+    public: void Vector3(const ignition::math::Vector3d &_v)
+    {
+      this->Pod(_v.X());
+      this->Pod(_v.Y());
+      this->Pod(_v.Z());
+    }
+
+    public: void Color(const ignition::math::Color &_c)
+    {
+      this->Pod(_c.R());
+      this->Pod(_c.G());
+      this->Pod(_c.B());
+      this->Pod(_c.A());
+    }
+
+    public: void Matrix(const ignition::math::Matrix4d &_m)
+    {
+      for (unsigned int i = 0; i < 4; ++i)
+        for (unsigned int j = 0; j < 4; ++j)
+          this->Pod(_m(i, j));
+    }
+
+    public: std::string buffer;
+  };
+
+  /// \brief Reads binary values from a memory-mapped buffer. Throws
+  /// std::out_of_range on truncated input.
+  class Reader
+  {
+    public: Reader(const char *_data, size_t _size)
+      : data(_data), size(_size)
+    {
+    }
+
+    public: const char *Bytes(size_t _count)
+    {
+      if (_count > this->size - this->offset)
+        throw std::out_of_range("truncated mesh cache");
+      const char *result = this->data + this->offset;
+      this->offset += _count;
+      return result;
+    }
+
+    public: template<typename T> T Pod()
+    {
+      T value;
+      std::memcpy(&value, this->Bytes(sizeof(T)), sizeof(T));
+      return value;
+    }
+
+    public: std::string String()
+    {
+      uint32_t count = this->Count(1);
+      return std::string(this->Bytes(count), count);
+    }
+
+    /// \brief Read an element count, checking that the elements fit in
+    /// the rest of the buffer before anything is allocated for them.
+    public: uint32_t Count(size_t _elementSize)
+    {
+      uint32_t count = this->Pod<uint32_t>();
+      if (static_cast<size_t>(count) * _elementSize >
+          this->size - this->offset)
+      {
+        throw std::out_of_range("truncated mesh cache");
+      }
+      return count;
+    }
+
+    public: ignition::math::Vector3d Vector3()
+    {
+      double v[3];
+      std::memcpy(v, this->Bytes(sizeof(v)), sizeof(v));
+      return ignition::math::Vector3d(v[0], v[1], v[2]);
+    }
+
+    public: ignition::math::Color Color()
+    {
+      float c[4];
+      std::memcpy(c, this->Bytes(sizeof(c)), sizeof(c));
+      return ignition::math::Color(c[0], c[1], c[2], c[3]);
+    }
+
+    public: ignition::math::Matrix4d Matrix()
+    {
+      double m[16];
+      std::memcpy(m, this->Bytes(sizeof(m)), sizeof(m));
+      return ignition::math::Matrix4d(
+          m[0], m[1], m[2], m[3], m[4], m[5], m[6], m[7],
+          m[8], m[9], m[10], m[11], m[12], m[13], m[14], m[15]);
+    }
+
+    private: const char *data;
+    private: size_t size;
+    private: size_t offset = 0;
+  };
+
+  //////////////////////////////////////////////////
+  /// \brief Key of a cache entry.
+  std::string EntryKey(const std::string &_filename,
+      const std::string &_variant)
+  {
+    return _variant.empty() ? _filename : _filename + "#" + _variant;
+  }
+
+  /// \brief Stamp identifying the version of a source file.
+  struct SourceStamp
+  {
+    uint64_t size = 0;
+    int64_t mtime = 0;
+  };
+
+  //////////////////////////////////////////////////
+  bool Stamp(const std::string &_filename, SourceStamp &_stamp)
+  {
+    boost::system::error_code ec;
+    _stamp.size = boost::filesystem::file_size(_filename, ec);
+    if (ec)
+      return false;
+    _stamp.mtime = boost::filesystem::last_write_time(_filename, ec);
+    return !ec;
+  }
+
+  //////////////////////////////////////////////////
+  void WriteMaterial(Writer &_w, const Material *_mat)
+  {
+    _w.String(_mat->GetTextureImage());
+    _w.Color(_mat->Ambient());
+    _w.Color(_mat->Diffuse());
+    _w.Color(_mat->Specular());
+    _w.Color(_mat->Emissive());
+    _w.Pod(_mat->GetTransparency());
+    _w.Pod(_mat->GetShininess());
+    _w.Pod(_mat->GetPointSize());
+    double srcFactor, dstFactor;
+    _mat->GetBlendFactors(srcFactor, dstFactor);
+    _w.Pod(srcFactor);
+    _w.Pod(dstFactor);
+    _w.Pod<int32_t>(_mat->GetBlendMode());
+    _w.Pod<int32_t>(_mat->GetShadeMode());
+    _w.Pod<uint8_t>(_mat->GetDepthWrite());
+    _w.Pod<uint8_t>(_mat->GetLighting());
+  }
+
+  //////////////////////////////////////////////////
+  Material *ReadMaterial(Reader &_r)
+  {
+    std::unique_ptr<Material> mat(new Material());
+    mat->SetTextureImage(_r.String());
+    mat->SetAmbient(_r.Color());
+    mat->SetDiffuse(_r.Color());
+    mat->SetSpecular(_r.Color());
+    mat->SetEmissive(_r.Color());
+    mat->SetTransparency(_r.Pod<double>());
+    mat->SetShininess(_r.Pod<double>());
+    mat->SetPointSize(_r.Pod<double>());
+    double srcFactor = _r.Pod<double>();
+    double dstFactor = _r.Pod<double>();
+    mat->SetBlendFactors(srcFactor, dstFactor);
+    mat->SetBlendMode(static_cast<Material::BlendMode>(_r.Pod<int32_t>()));
+    mat->SetShadeMode(static_cast<Material::ShadeMode>(_r.Pod<int32_t>()));
+    mat->SetDepthWrite(_r.Pod<uint8_t>() != 0);
+    mat->SetLighting(_r.Pod<uint8_t>() != 0);
+    return mat.release();
+  }
+
+  //////////////////////////////////////////////////
+  void WriteSubMesh(Writer &_w, const SubMesh *_sub)
+  {
+    _w.String(_sub->GetName());
+    _w.Pod<int32_t>(_sub->GetPrimitiveType());
+    _w.Pod<int32_t>(_sub->GetMaterialIndex());
+
+    _w.Pod<uint32_t>(_sub->GetVertexCount());
+    for (unsigned int i = 0; i < _sub->GetVertexCount(); ++i)
+      _w.Vector3(_sub->Vertex(i));
+
+    _w.Pod<uint32_t>(_sub->GetNormalCount());
+    for (unsigned int i = 0; i < _sub->GetNormalCount(); ++i)
+      _w.Vector3(_sub->Normal(i));
+
+    _w.Pod<uint32_t>(_sub->GetTexCoordCount());
+    for (unsigned int i = 0; i < _sub->GetTexCoordCount(); ++i)
+    {
+      ignition::math::Vector2d uv = _sub->TexCoord(i);
+      _w.Pod(uv.X());
+      _w.Pod(uv.Y());
+    }
+
+    _w.Pod<uint32_t>(_sub->GetIndexCount());
+    for (unsigned int i = 0; i < _sub->GetIndexCount(); ++i)
+      _w.Pod<uint32_t>(_sub->GetIndex(i));
+
+    _w.Pod<uint32_t>(_sub->GetNodeAssignmentsCount());
+    for (unsigned int i = 0; i < _sub->GetNodeAssignmentsCount(); ++i)
+    {
+      NodeAssignment na = _sub->GetNodeAssignment(i);
+      _w.Pod<uint32_t>(na.vertexIndex);
+      _w.Pod<uint32_t>(na.nodeIndex);
+      _w.Pod(na.weight);
+    }
+  }
+
+  //////////////////////////////////////////////////
+  SubMesh *ReadSubMesh(Reader &_r)
+  {
+    std::unique_ptr<SubMesh> sub(new SubMesh());
+    sub->SetName(_r.String());
+    sub->SetPrimitiveType(
+        static_cast<SubMesh::PrimitiveType>(_r.Pod<int32_t>()));
+    sub->SetMaterialIndex(_r.Pod<int32_t>());
+
+    uint32_t count = _r.Count(3 * sizeof(double));
+    const char *v = _r.Bytes(static_cast<size_t>(count) * 3 * sizeof(double));
+    std::vector<ignition::math::Vector3d> vertices(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      double xyz[3];
+      std::memcpy(xyz, v + i * sizeof(xyz), sizeof(xyz));
+      vertices[i].Set(xyz[0], xyz[1], xyz[2]);
+    }
+    sub->CopyVertices(vertices);
+
+    count = _r.Count(3 * sizeof(double));
+    sub->SetNormalCount(count);
+    for (uint32_t i = 0; i < count; ++i)
+      sub->SetNormal(i, _r.Vector3());
+
+    count = _r.Count(2 * sizeof(double));
+    sub->SetTexCoordCount(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      double u = _r.Pod<double>();
+      double t = _r.Pod<double>();
+      sub->SetTexCoord(i, ignition::math::Vector2d(u, t));
+    }
+
+    count = _r.Count(sizeof(uint32_t));
+    const char *indices =
+        _r.Bytes(static_cast<size_t>(count) * sizeof(uint32_t));
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      uint32_t index;
+      std::memcpy(&index, indices + i * sizeof(uint32_t), sizeof(uint32_t));
+      sub->AddIndex(index);
+    }
+
+    count = _r.Count(2 * sizeof(uint32_t) + sizeof(float));
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      uint32_t vertex = _r.Pod<uint32_t>();
+      uint32_t node = _r.Pod<uint32_t>();
+      float weight = _r.Pod<float>();
+      sub->AddNodeAssignment(vertex, node, weight);
+    }
+
+    return sub.release();
+  }
+
+  //////////////////////////////////////////////////
+  void WriteSkeleton(Writer &_w, Skeleton *_skel)
+  {
+    // Nodes in handle order, which lists every parent before its children
+    // and children in the order they were added.
+    _w.Pod<uint32_t>(_skel->GetNumNodes());
+    for (unsigned int h = 0; h < _skel->GetNumNodes(); ++h)
+    {
+      SkeletonNode *node = _skel->GetNodeByHandle(h);
+      _w.Pod<int32_t>(node->GetParent() ?
+          static_cast<int32_t>(node->GetParent()->GetHandle()) : -1);
+      _w.String(node->GetName());
+      _w.String(node->GetId());
+      _w.Pod<uint8_t>(node->IsJoint());
+      _w.Matrix(node->Transform());
+      _w.Matrix(node->InverseBindTransform());
+
+      std::vector<NodeTransform> raw = node->GetRawTransforms();
+      _w.Pod<uint32_t>(raw.size());
+      for (auto &nt : raw)
+      {
+        _w.String(nt.GetSID());
+        _w.Pod<int32_t>(nt.GetType());
+        _w.Matrix(nt.GetTransform());
+      }
+    }
+
+    _w.Matrix(_skel->BindShapeTransform());
+
+    _w.Pod<uint32_t>(_skel->NumVertAttached());
+    for (unsigned int v = 0; v < _skel->NumVertAttached(); ++v)
+    {
+      _w.Pod<uint32_t>(_skel->GetNumVertNodeWeights(v));
+      for (unsigned int i = 0; i < _skel->GetNumVertNodeWeights(v); ++i)
+      {
+        auto nw = _skel->GetVertNodeWeight(v, i);
+        _w.String(nw.first);
+        _w.Pod(nw.second);
+      }
+    }
+
+    _w.Pod<uint32_t>(_skel->GetNumAnimations());
+    for (unsigned int a = 0; a < _skel->GetNumAnimations(); ++a)
+    {
+      SkeletonAnimation *anim = _skel->GetAnimation(a);
+      _w.String(anim->GetName());
+      _w.Pod<uint32_t>(anim->GetNodeCount());
+      for (unsigned int n = 0; n < anim->GetNodeCount(); ++n)
+      {
+        const NodeAnimation *nodeAnim = anim->NodeAnimationByIndex(n);
+        _w.String(nodeAnim->GetName());
+        _w.Pod<uint32_t>(nodeAnim->GetFrameCount());
+        for (unsigned int k = 0; k < nodeAnim->GetFrameCount(); ++k)
+        {
+          auto frame = nodeAnim->KeyFrame(k);
+          _w.Pod(frame.first);
+          _w.Matrix(frame.second);
+        }
+      }
+    }
+  }
+
+  //////////////////////////////////////////////////
+  Skeleton *ReadSkeleton(Reader &_r)
+  {
+    uint32_t nodeCount = _r.Count(sizeof(int32_t));
+    std::vector<SkeletonNode *> nodes;
+    nodes.reserve(nodeCount);
+
+    try
+    {
+      for (uint32_t h = 0; h < nodeCount; ++h)
+      {
+        int32_t parent = _r.Pod<int32_t>();
+        if (parent >= static_cast<int32_t>(h) || (h > 0 && parent < 0))
+          throw std::out_of_range("invalid skeleton node parent");
+
+        std::string name = _r.String();
+        std::string id = _r.String();
+        bool joint = _r.Pod<uint8_t>() != 0;
+
+        SkeletonNode *node = new SkeletonNode(
+            parent < 0 ? nullptr : nodes[parent], name, id,
+            joint ? SkeletonNode::JOINT : SkeletonNode::NODE);
+        nodes.push_back(node);
+
+        node->SetTransform(_r.Matrix(), false);
+        node->SetInverseBindTransform(_r.Matrix());
+
+        uint32_t rawCount = _r.Pod<uint32_t>();
+        for (uint32_t i = 0; i < rawCount; ++i)
+        {
+          std::string sid = _r.String();
+          auto type = static_cast<NodeTransform::TransformType>(
+              _r.Pod<int32_t>());
+          node->AddRawTransform(NodeTransform(_r.Matrix(), sid, type));
+        }
+      }
+    }
+    catch(...)
+    {
+      for (auto node : nodes)
+        delete node;
+      throw;
+    }
+
+    if (nodes.empty())
+      throw std::out_of_range("skeleton without nodes");
+
+    std::unique_ptr<Skeleton> skel(new Skeleton(nodes[0]));
+    skel->SetBindShapeTransform(_r.Matrix());
+
+    uint32_t vertCount = _r.Count(sizeof(uint32_t));
+    skel->SetNumVertAttached(vertCount);
+    for (uint32_t v = 0; v < vertCount; ++v)
+    {
+      uint32_t weightCount = _r.Pod<uint32_t>();
+      for (uint32_t i = 0; i < weightCount; ++i)
+      {
+        std::string node = _r.String();
+        skel->AddVertNodeWeight(v, node, _r.Pod<double>());
+      }
+    }
+
+    uint32_t animCount = _r.Pod<uint32_t>();
+    for (uint32_t a = 0; a < animCount; ++a)
+    {
+      SkeletonAnimation *anim = new SkeletonAnimation(_r.String());
+      skel->AddAnimation(anim);
+
+      uint32_t nodeAnimCount = _r.Pod<uint32_t>();
+      for (uint32_t n = 0; n < nodeAnimCount; ++n)
+      {
+        std::string node = _r.String();
+        uint32_t frameCount = _r.Pod<uint32_t>();
+        for (uint32_t k = 0; k < frameCount; ++k)
+        {
+          double time = _r.Pod<double>();
+          anim->AddKeyFrame(node, time, _r.Matrix());
+        }
+      }
+    }
+
+    return skel.release();
+  }
+}
+
+//////////////////////////////////////////////////
+MeshCache::MeshCache(const std::string &_path)
+  : path(_path)
+{
+}
+
+//////////////////////////////////////////////////
+std::string MeshCache::DefaultPath()
+{
+  const char *env = getenv("GAZEBO_MESH_CACHE_PATH");
+  if (env)
+    return env;
+
+  return "";
+}
+
+//////////////////////////////////////////////////
+std::string MeshCache::Path() const
+{
+  return this->path;
+}
+
+//////////////////////////////////////////////////
+std::string MeshCache::CacheFilename(const std::string &_filename,
+    const std::string &_variant) const
+{
+  if (this->path.empty())
+    return "";
+
+  std::ostringstream stream;
+  stream << std::hex << std::hash<std::string>()(
+      EntryKey(_filename, _variant));
+  return (boost::filesystem::path(this->path) /
+      (stream.str() + ".gzmesh")).string();
+}
+
+//////////////////////////////////////////////////
+Mesh *MeshCache::Load(const std::string &_filename,
+    const std::string &_variant) const
+{
+  std::string cacheFilename = this->CacheFilename(_filename, _variant);
+  SourceStamp stamp;
+  if (cacheFilename.empty() || !boost::filesystem::exists(cacheFilename) ||
+      !Stamp(_filename, stamp))
+  {
+    return nullptr;
+  }
+
+  try
+  {
+    boost::iostreams::mapped_file_source file(cacheFilename);
+    Reader r(file.data(), file.size());
+
+    // Stale or colliding entries are silently ignored, they are
+    // overwritten by the next Save.
+    if (std::memcmp(r.Bytes(sizeof(kMagic)), kMagic, sizeof(kMagic)) != 0 ||
+        r.Pod<uint32_t>() != kVersion ||
+        r.Pod<uint64_t>() != stamp.size ||
+        r.Pod<int64_t>() != stamp.mtime ||
+        r.String() != EntryKey(_filename, _variant))
+    {
+      return nullptr;
+    }
+
+    std::unique_ptr<Mesh> mesh(new Mesh());
+    mesh->SetName(r.String());
+    mesh->SetPath(r.String());
+
+    uint32_t count = r.Pod<uint32_t>();
+    for (uint32_t i = 0; i < count; ++i)
+      mesh->AddMaterial(ReadMaterial(r));
+
+    count = r.Pod<uint32_t>();
+    for (uint32_t i = 0; i < count; ++i)
+      mesh->AddSubMesh(ReadSubMesh(r));
+
+    if (r.Pod<uint8_t>())
+      mesh->SetSkeleton(ReadSkeleton(r));
+
+    return mesh.release();
+  }
+  catch(std::exception &_e)
+  {
+    gzwarn << "Ignoring invalid mesh cache entry[" << cacheFilename
+           << "] for [" << _filename << "]: " << _e.what() << std::endl;
+  }
+
+  return nullptr;
+}
+
+//////////////////////////////////////////////////
+bool MeshCache::Save(const Mesh *_mesh, const std::string &_filename,
+    const std::string &_variant) const
+{
+  std::string cacheFilename = this->CacheFilename(_filename, _variant);
+  SourceStamp stamp;
+  if (!_mesh || cacheFilename.empty() || !Stamp(_filename, stamp))
+    return false;
+
+  Writer w;
+  w.buffer.append(kMagic, sizeof(kMagic));
+  w.Pod(kVersion);
+  w.Pod(stamp.size);
+  w.Pod(stamp.mtime);
+  w.String(EntryKey(_filename, _variant));
+
+  w.String(_mesh->GetName());
+  w.String(_mesh->GetPath());
+
+  w.Pod<uint32_t>(_mesh->GetMaterialCount());
+  for (unsigned int i = 0; i < _mesh->GetMaterialCount(); ++i)
+    WriteMaterial(w, _mesh->GetMaterial(i));
+
+  w.Pod<uint32_t>(_mesh->GetSubMeshCount());
+  for (unsigned int i = 0; i < _mesh->GetSubMeshCount(); ++i)
+    WriteSubMesh(w, _mesh->GetSubMesh(i));
+
+  w.Pod<uint8_t>(_mesh->HasSkeleton());
+  if (_mesh->HasSkeleton())
+    WriteSkeleton(w, _mesh->GetSkeleton());
+
+  // The cache is an optimization, skip it silently when its directory can't
+  // be created or written to, such as in read-only or sandboxed runs.
+  boost::system::error_code ec;
+  boost::filesystem::create_directories(this->path, ec);
+  if (ec)
+    return false;
+
+  // Write to a temporary file first so that concurrent readers never see a
+  // partially written entry.
+  std::string tmpFilename = cacheFilename + "." +
+      boost::filesystem::unique_path().string();
+  {
+    std::ofstream out(tmpFilename.c_str(), std::ios::out | std::ios::binary);
+    if (!out)
+      return false;
+
+    out.write(w.buffer.data(), w.buffer.size());
+    if (!out)
+    {
+      gzwarn << "Unable to write mesh cache entry[" << cacheFilename << "]\n";
+      boost::filesystem::remove(tmpFilename, ec);
+      return false;
+    }
+  }
+
+  boost::filesystem::rename(tmpFilename, cacheFilename, ec);
+  if (ec)
+  {
+    boost::filesystem::remove(tmpFilename, ec);
+    return false;
+  }
+
+  return true;
+}
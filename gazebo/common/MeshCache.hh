@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_COMMON_MESHCACHE_HH_
+#define GAZEBO_COMMON_MESHCACHE_HH_
+
+#include <string>
+
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace common
+  {
+    class Mesh;
+
+    /// \addtogroup gazebo_common Common
+    /// \{
+
+    /// \class MeshCache MeshCache.hh common/common.hh
+    /// \brief On-disk cache of loaded meshes.
+    ///
+    /// Each mesh file loaded through a MeshLoader is stored once in a
+    /// binary file, including its submeshes, materials, skeleton and
+    /// animations. Cache entries are keyed by the full path of the source
+    /// file and invalidated when its size or modification time changes.
+    /// Loading an entry memory-maps the file and bulk copies its arrays,
+    /// which skips XML parsing and text to number conversion entirely.
+    /// Meshes derived from a file, such as simplified collision meshes, are
+    /// stored as variants of the file's entry.
+    ///
+    /// The cache is disabled by default. Set the GAZEBO_MESH_CACHE_PATH
+    /// environment variable to a writable directory to enable it.
+    class GZ_COMMON_VISIBLE MeshCache
+    {
+      /// \brief Constructor.
+      /// \param[in] _path Directory holding the cache files. An empty path
+      /// disables the cache.
+      public: explicit MeshCache(const std::string &_path);
+
+      /// \brief Default cache directory. This is the GAZEBO_MESH_CACHE_PATH
+      /// environment variable.
+      /// \return Path to the cache directory, empty if the variable is not
+      /// set, which disables the cache.
+      public: static std::string DefaultPath();
+
+      /// \brief Get the cache directory.
+      /// \return Path to the cache directory, empty if disabled.
+      public: std::string Path() const;
+
+      /// \brief Get the cache file used for a mesh file.
+      /// \param[in] _filename Full path to the mesh file.
+      /// \param[in] _variant Name of a mesh derived from the file, empty
+      /// for the mesh of the file itself.
+      /// \return Path to the cache file, empty if the cache is disabled.
+      public: std::string CacheFilename(const std::string &_filename,
+                  const std::string &_variant = "") const;
+
+      /// \brief Load a mesh from the cache.
+      /// \param[in] _filename Full path to the mesh file.
+      /// \param[in] _variant Name of a mesh derived from the file, empty
+      /// for the mesh of the file itself.
+      /// \return A new mesh, or nullptr if there is no valid entry for the
+      /// current version of the file.
+      public: Mesh *Load(const std::string &_filename,
+                  const std::string &_variant = "") const;
+
+      /// \brief Store a mesh in the cache.
+      /// \param[in] _mesh Mesh loaded from _filename.
+      /// \param[in] _filename Full path to the mesh file.
+      /// \param[in] _variant Name of a mesh derived from the file, empty
+      /// for the mesh of the file itself.
+      /// \return True on success, false if the cache is disabled or its
+      /// directory is not writable.
+      public: bool Save(const Mesh *_mesh, const std::string &_filename,
+                  const std::string &_variant = "") const;
+
+      /// \brief Directory holding the cache files.
+      private: std::string path;
+    };
+    /// \}
+  }
+}
+#endif
@@ -0,0 +1,252 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <boost/filesystem.hpp>
+#include <gtest/gtest.h>
+
+#include "test_config.h"
+#include "gazebo/common/ColladaLoader.hh"
+#include "gazebo/common/Material.hh"
+#include "gazebo/common/Mesh.hh"
+#include "gazebo/common/MeshCache.hh"
+#include "gazebo/common/Skeleton.hh"
+#include "gazebo/common/SkeletonAnimation.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+
+class MeshCache : public gazebo::testing::AutoLogFixture
+{
+  /// \brief Create an empty cache directory.
+  protected: void SetUp() override
+  {
+    gazebo::testing::AutoLogFixture::SetUp();
+    this->cachePath = boost::filesystem::current_path() / "tmp" / "mesh_cache";
+    boost::filesystem::remove_all(this->cachePath);
+  }
+
+  /// \brief Remove the cache directory.
+  protected: void TearDown() override
+  {
+    boost::filesystem::remove_all(this->cachePath);
+    gazebo::testing::AutoLogFixture::TearDown();
+  }
+
+  /// \brief Cache directory.
+  protected: boost::filesystem::path cachePath;
+};
+
+/////////////////////////////////////////////////
+TEST_F(MeshCache, Disabled)
+{
+  common::MeshCache cache("");
+  EXPECT_TRUE(cache.CacheFilename("/some/mesh.dae").empty());
+
+  common::ColladaLoader loader;
+  std::string filename = std::string(PROJECT_SOURCE_PATH) +
+      "/test/data/box.dae";
+  std::unique_ptr<common::Mesh> mesh(loader.Load(filename));
+  EXPECT_FALSE(cache.Save(mesh.get(), filename));
+  EXPECT_EQ(nullptr, cache.Load(filename));
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshCache, DefaultPath)
+{
+  // The cache is opt-in
+  unsetenv("GAZEBO_MESH_CACHE_PATH");
+  EXPECT_TRUE(common::MeshCache::DefaultPath().empty());
+
+  setenv("GAZEBO_MESH_CACHE_PATH", this->cachePath.string().c_str(), 1);
+  EXPECT_EQ(this->cachePath.string(), common::MeshCache::DefaultPath());
+  unsetenv("GAZEBO_MESH_CACHE_PATH");
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshCache, NotWritable)
+{
+  // A cache directory below a regular file can never be created
+  boost::filesystem::create_directories(this->cachePath);
+  std::string blocker = (this->cachePath / "file").string();
+  std::ofstream(blocker.c_str()) << "not a directory";
+  common::MeshCache cache(blocker + "/cache");
+
+  common::ColladaLoader loader;
+  std::string filename = std::string(PROJECT_SOURCE_PATH) +
+      "/test/data/box.dae";
+  std::unique_ptr<common::Mesh> mesh(loader.Load(filename));
+  EXPECT_FALSE(cache.Save(mesh.get(), filename));
+  EXPECT_EQ(nullptr, cache.Load(filename));
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshCache, SaveLoad)
+{
+  common::MeshCache cache(this->cachePath.string());
+  EXPECT_EQ(this->cachePath.string(), cache.Path());
+
+  common::ColladaLoader loader;
+  std::string filename = std::string(PROJECT_SOURCE_PATH) +
+      "/test/data/box.dae";
+
+  // Nothing cached yet
+  EXPECT_EQ(nullptr, cache.Load(filename));
+
+  std::unique_ptr<common::Mesh> mesh(loader.Load(filename));
+  ASSERT_NE(nullptr, mesh);
+  EXPECT_TRUE(cache.Save(mesh.get(), filename));
+  EXPECT_TRUE(boost::filesystem::exists(cache.CacheFilename(filename)));
+
+  std::unique_ptr<common::Mesh> cached(cache.Load(filename));
+  ASSERT_NE(nullptr, cached);
+
+  EXPECT_EQ(mesh->GetName(), cached->GetName());
+  EXPECT_EQ(mesh->GetPath(), cached->GetPath());
+  EXPECT_EQ(mesh->Min(), cached->Min());
+  EXPECT_EQ(mesh->Max(), cached->Max());
+  ASSERT_EQ(mesh->GetSubMeshCount(), cached->GetSubMeshCount());
+  for (unsigned int i = 0; i < mesh->GetSubMeshCount(); ++i)
+  {
+    const common::SubMesh *a = mesh->GetSubMesh(i);
+    const common::SubMesh *b = cached->GetSubMesh(i);
+    EXPECT_EQ(a->GetName(), b->GetName());
+    EXPECT_EQ(a->GetPrimitiveType(), b->GetPrimitiveType());
+    EXPECT_EQ(a->GetMaterialIndex(), b->GetMaterialIndex());
+    ASSERT_EQ(a->GetVertexCount(), b->GetVertexCount());
+    for (unsigned int v = 0; v < a->GetVertexCount(); ++v)
+      EXPECT_EQ(a->Vertex(v), b->Vertex(v));
+    ASSERT_EQ(a->GetNormalCount(), b->GetNormalCount());
+    for (unsigned int n = 0; n < a->GetNormalCount(); ++n)
+      EXPECT_EQ(a->Normal(n), b->Normal(n));
+    ASSERT_EQ(a->GetTexCoordCount(), b->GetTexCoordCount());
+    for (unsigned int t = 0; t < a->GetTexCoordCount(); ++t)
+      EXPECT_EQ(a->TexCoord(t), b->TexCoord(t));
+    ASSERT_EQ(a->GetIndexCount(), b->GetIndexCount());
+    for (unsigned int j = 0; j < a->GetIndexCount(); ++j)
+      EXPECT_EQ(a->GetIndex(j), b->GetIndex(j));
+  }
+
+  ASSERT_EQ(mesh->GetMaterialCount(), cached->GetMaterialCount());
+  for (unsigned int i = 0; i < mesh->GetMaterialCount(); ++i)
+  {
+    const common::Material *a = mesh->GetMaterial(i);
+    const common::Material *b = cached->GetMaterial(i);
+    EXPECT_EQ(a->GetTextureImage(), b->GetTextureImage());
+    EXPECT_EQ(a->Ambient(), b->Ambient());
+    EXPECT_EQ(a->Diffuse(), b->Diffuse());
+    EXPECT_EQ(a->Specular(), b->Specular());
+    EXPECT_EQ(a->Emissive(), b->Emissive());
+    EXPECT_DOUBLE_EQ(a->GetTransparency(), b->GetTransparency());
+    EXPECT_DOUBLE_EQ(a->GetShininess(), b->GetShininess());
+    EXPECT_EQ(a->GetBlendMode(), b->GetBlendMode());
+    EXPECT_EQ(a->GetShadeMode(), b->GetShadeMode());
+    EXPECT_EQ(a->GetLighting(), b->GetLighting());
+  }
+
+  EXPECT_FALSE(cached->HasSkeleton());
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshCache, SaveLoadSkeleton)
+{
+  common::MeshCache cache(this->cachePath.string());
+
+  common::ColladaLoader loader;
+  std::string filename = std::string(PROJECT_SOURCE_PATH) +
+      "/test/data/box_with_animation_outside_skeleton.dae";
+  std::unique_ptr<common::Mesh> mesh(loader.Load(filename));
+  ASSERT_NE(nullptr, mesh);
+  ASSERT_TRUE(mesh->HasSkeleton());
+  EXPECT_TRUE(cache.Save(mesh.get(), filename));
+
+  std::unique_ptr<common::Mesh> cached(cache.Load(filename));
+  ASSERT_NE(nullptr, cached);
+  ASSERT_TRUE(cached->HasSkeleton());
+
+  common::Skeleton *a = mesh->GetSkeleton();
+  common::Skeleton *b = cached->GetSkeleton();
+  ASSERT_EQ(a->GetNumNodes(), b->GetNumNodes());
+  EXPECT_EQ(a->GetNumJoints(), b->GetNumJoints());
+  EXPECT_EQ(a->BindShapeTransform(), b->BindShapeTransform());
+  for (unsigned int h = 0; h < a->GetNumNodes(); ++h)
+  {
+    common::SkeletonNode *na = a->GetNodeByHandle(h);
+    common::SkeletonNode *nb = b->GetNodeByHandle(h);
+    EXPECT_EQ(na->GetName(), nb->GetName());
+    EXPECT_EQ(na->GetId(), nb->GetId());
+    EXPECT_EQ(na->IsJoint(), nb->IsJoint());
+    EXPECT_EQ(na->Transform(), nb->Transform());
+    EXPECT_EQ(na->InverseBindTransform(), nb->InverseBindTransform());
+    EXPECT_EQ(na->GetChildCount(), nb->GetChildCount());
+  }
+
+  ASSERT_EQ(a->NumVertAttached(), b->NumVertAttached());
+  for (unsigned int v = 0; v < a->NumVertAttached(); ++v)
+  {
+    ASSERT_EQ(a->GetNumVertNodeWeights(v), b->GetNumVertNodeWeights(v));
+    for (unsigned int i = 0; i < a->GetNumVertNodeWeights(v); ++i)
+      EXPECT_EQ(a->GetVertNodeWeight(v, i), b->GetVertNodeWeight(v, i));
+  }
+
+  ASSERT_EQ(1u, b->GetNumAnimations());
+  common::SkeletonAnimation *anim = b->GetAnimation(0);
+  EXPECT_EQ(a->GetAnimation(0)->GetName(), anim->GetName());
+  EXPECT_DOUBLE_EQ(a->GetAnimation(0)->GetLength(), anim->GetLength());
+  EXPECT_TRUE(anim->HasNode("Armature"));
+  EXPECT_EQ(a->GetAnimation(0)->PoseAt(1.0).at("Armature"),
+      anim->PoseAt(1.0).at("Armature"));
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshCache, Stale)
+{
+  common::MeshCache cache(this->cachePath.string());
+
+  // Copy a mesh so that its modification time can be changed
+  boost::filesystem::create_directories(this->cachePath);
+  std::string filename = (this->cachePath / "box.dae").string();
+  boost::filesystem::copy_file(
+      std::string(PROJECT_SOURCE_PATH) + "/test/data/box.dae", filename);
+
+  common::ColladaLoader loader;
+  std::unique_ptr<common::Mesh> mesh(loader.Load(filename));
+  ASSERT_NE(nullptr, mesh);
+  EXPECT_TRUE(cache.Save(mesh.get(), filename));
+  std::unique_ptr<common::Mesh> cached(cache.Load(filename));
+  EXPECT_NE(nullptr, cached);
+
+  boost::filesystem::last_write_time(filename,
+      boost::filesystem::last_write_time(filename) + 10);
+  cached.reset(cache.Load(filename));
+  EXPECT_EQ(nullptr, cached);
+
+  // A corrupted entry is ignored
+  EXPECT_TRUE(cache.Save(mesh.get(), filename));
+  boost::filesystem::resize_file(cache.CacheFilename(filename), 64);
+  cached.reset(cache.Load(filename));
+  EXPECT_EQ(nullptr, cached);
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -17,7 +17,13 @@
 
 #include <sys/stat.h>
 #include <string>
+#include <functional>
 #include <map>
+#include <memory>
+#include <set>
+
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
 
 #include <ignition/math/Helpers.hh>
 #include <ignition/math/Matrix3.hh>
@@ -31,6 +37,8 @@
 #include "gazebo/common/Exception.hh"
 #include "gazebo/common/Console.hh"
 #include "gazebo/common/Mesh.hh"
+#include "gazebo/common/MeshCache.hh"
+#include "gazebo/common/MeshSimplifier.hh"
 #include "gazebo/common/ColladaLoader.hh"
 #include "gazebo/common/ColladaExporter.hh"
 #include "gazebo/common/STLLoader.hh"
@@ -51,41 +59,96 @@ namespace common
 //////////////////////////////////////////////////
 class MeshManagerPrivate
 {
-  /// \brief 3D mesh loader for COLLADA files
-  public: ColladaLoader *colladaLoader = nullptr;
-
   /// \brief 3D mesh exporter for COLLADA files
   public: ColladaExporter *colladaExporter = nullptr;
 
-  /// \brief 3D mesh loader for STL files
-  public: STLLoader *stlLoader = nullptr;
-
-  // \brief 3D mesh loader for FBX files
-  // \todo The FBX loader needs to be implemented.
-  // public: FBXLoader *fbxLoader = nullptr;
-
   /// \brief Dictionary of meshes, indexed by name
   public: std::map<std::string, Mesh*> meshes;
 
   /// \brief supported file extensions for meshes
   public: std::vector<std::string> fileExtensions;
 
-  /// \brief Mutex to protect from loading the same mesh in different threads
-  /// at the same time.
+  /// \brief On-disk cache of meshes loaded from files. Shared so that
+  /// loads in progress keep using it while the cache path changes.
+  public: std::shared_ptr<MeshCache> cache;
+
+  /// \brief Names of the meshes being parsed by some thread.
+  public: std::set<std::string> loading;
+
+  /// \brief Notified when a mesh is removed from the loading set.
+  public: boost::condition_variable loadingCond;
+
+  /// \brief Mutex to protect the meshes, the loading set and the cache.
   public: boost::mutex mutex;
+
+  /// \brief Get a mesh derived from a loaded mesh, creating it once.
+  /// \param[in] _name Name of the loaded mesh.
+  /// \param[in] _fullname File the mesh was loaded from, empty if none.
+  /// \param[in] _variant Unique name of the derivation.
+  /// \param[in] _create Creates the derived mesh from the loaded one.
+  /// \return The derived mesh, or nullptr on failure.
+  public: const Mesh *Derived(const std::string &_name,
+      const std::string &_fullname, const std::string &_variant,
+      const std::function<Mesh *(const Mesh *)> &_create);
 };
 
-// added here for ABI compatibility
-// TODO move to header / private class when merging forward.
-static OBJLoader objLoader;
+//////////////////////////////////////////////////
+const Mesh *MeshManagerPrivate::Derived(const std::string &_name,
+    const std::string &_fullname, const std::string &_variant,
+    const std::function<Mesh *(const Mesh *)> &_create)
+{
+  std::string key = _name + "#" + _variant;
+  const Mesh *source = nullptr;
+  std::shared_ptr<MeshCache> meshCache;
+  {
+    boost::mutex::scoped_lock lock(this->mutex);
+    while (this->loading.count(key))
+      this->loadingCond.wait(lock);
+
+    auto iter = this->meshes.find(key);
+    if (iter != this->meshes.end())
+      return iter->second;
+
+    iter = this->meshes.find(_name);
+    if (iter == this->meshes.end())
+    {
+      gzerr << "Mesh[" << _name << "] is not loaded\n";
+      return nullptr;
+    }
+    source = iter->second;
+    this->loading.insert(key);
+    meshCache = this->cache;
+  }
+
+  Mesh *mesh = _fullname.empty() ? nullptr :
+      meshCache->Load(_fullname, _variant);
+  if (!mesh)
+  {
+    mesh = _create(source);
+    if (mesh && !_fullname.empty())
+      meshCache->Save(mesh, _fullname, _variant);
+  }
+
+  {
+    boost::mutex::scoped_lock lock(this->mutex);
+    this->loading.erase(key);
+    if (mesh)
+    {
+      mesh->SetName(key);
+      this->meshes.insert(std::make_pair(key, mesh));
+    }
+  }
+  this->loadingCond.notify_all();
+
+  return mesh;
+}
 
 //////////////////////////////////////////////////
 MeshManager::MeshManager()
   : dataPtr(new MeshManagerPrivate)
 {
-  this->dataPtr->colladaLoader = new ColladaLoader();
   this->dataPtr->colladaExporter = new ColladaExporter();
-  this->dataPtr->stlLoader = new STLLoader();
+  this->dataPtr->cache.reset(new MeshCache(MeshCache::DefaultPath()));
 
   // Create some basic shapes
   this->CreatePlane("unit_plane",
@@ -124,9 +187,7 @@ MeshManager::MeshManager()
 //////////////////////////////////////////////////
 MeshManager::~MeshManager()
 {
-  delete this->dataPtr->colladaLoader;
   delete this->dataPtr->colladaExporter;
-  delete this->dataPtr->stlLoader;
   for (auto &pairNameMesh : this->dataPtr->meshes)
   {
     delete pairNameMesh.second;
@@ -146,81 +207,145 @@ const Mesh *MeshManager::Load(const std::string &_filename)
     return nullptr;
   }
 
-  Mesh *mesh = nullptr;
-
-  std::string extension;
-
-  if (this->HasMesh(_filename))
-  {
-    return this->dataPtr->meshes[_filename];
-
-    // This breaks trimesh geom. Each new trimesh should have a unique name.
-    /*
-    // erase mesh from this->dataPtr->meshes.
-    // This allows a mesh to be modified and
-    // inserted into gazebo again without closing gazebo.
-    std::map<std::string, Mesh*>::iterator iter;
-    iter = this->dataPtr->meshes.find(_filename);
-    delete iter->second;
-    iter->second = nullptr;
-    this->dataPtr->meshes.erase(iter);
-    */
+  {
+    boost::mutex::scoped_lock lock(this->dataPtr->mutex);
+    auto iter = this->dataPtr->meshes.find(_filename);
+    if (iter != this->dataPtr->meshes.end())
+      return iter->second;
   }
 
   std::string fullname = common::find_file(_filename);
+  if (fullname.empty())
+  {
+    gzerr << "Unable to find file[" << _filename << "]\n";
+    return nullptr;
+  }
 
-  if (!fullname.empty())
+  std::string extension = fullname.substr(fullname.rfind(".")+1,
+      fullname.size());
+  std::transform(extension.begin(), extension.end(),
+      extension.begin(), ::tolower);
+
+  // Loaders keep state while parsing, so each load uses its own loader.
+  // This lets different meshes be parsed in parallel.
+  std::unique_ptr<MeshLoader> loader;
+  if (extension == "stl" || extension == "stlb" || extension == "stla")
+    loader.reset(new STLLoader());
+  else if (extension == "dae")
+    loader.reset(new ColladaLoader());
+  else if (extension == "obj")
+    loader.reset(new OBJLoader());
+  else
   {
-    extension = fullname.substr(fullname.rfind(".")+1, fullname.size());
-    std::transform(extension.begin(), extension.end(),
-        extension.begin(), ::tolower);
-    MeshLoader *loader = nullptr;
+    gzerr << "Unsupported mesh format for file[" << _filename << "]\n";
+    return nullptr;
+  }
 
-    if (extension == "stl" || extension == "stlb" || extension == "stla")
-      loader = this->dataPtr->stlLoader;
-    else if (extension == "dae")
-      loader = this->dataPtr->colladaLoader;
-    else if (extension == "obj")
-      loader = &objLoader;
-    else
-    {
-      gzerr << "Unsupported mesh format for file[" << _filename << "]\n";
-      return nullptr;
-    }
+  std::shared_ptr<MeshCache> cache;
+  {
+    // Wait for any other thread parsing the same mesh, so that each mesh
+    // is only parsed once.
+    boost::mutex::scoped_lock lock(this->dataPtr->mutex);
+    while (this->dataPtr->loading.count(_filename))
+      this->dataPtr->loadingCond.wait(lock);
+
+    auto iter = this->dataPtr->meshes.find(_filename);
+    if (iter != this->dataPtr->meshes.end())
+      return iter->second;
+
+    this->dataPtr->loading.insert(_filename);
+    cache = this->dataPtr->cache;
+  }
 
-    try
+  Mesh *mesh = nullptr;
+  try
+  {
+    mesh = cache->Load(fullname);
+    if (!mesh && (mesh = loader->Load(fullname)) != nullptr)
+      cache->Save(mesh, fullname);
+  }
+  catch(gazebo::common::Exception &e)
+  {
     {
-      // This mutex prevents two threads from loading the same mesh at the
-      // same time.
       boost::mutex::scoped_lock lock(this->dataPtr->mutex);
-      if (!this->HasMesh(_filename))
-      {
-        if ((mesh = loader->Load(fullname)) != nullptr)
-        {
-          mesh->SetName(_filename);
-          this->dataPtr->meshes.insert(std::make_pair(_filename, mesh));
-        }
-        else
-          gzerr << "Unable to load mesh[" << fullname << "]\n";
-      }
-      else
-      {
-        mesh = this->dataPtr->meshes[_filename];
-      }
+      this->dataPtr->loading.erase(_filename);
     }
-    catch(gazebo::common::Exception &e)
+    this->dataPtr->loadingCond.notify_all();
+
+    gzerr << "Error loading mesh[" << fullname << "]\n";
+    gzerr << e << "\n";
+    gzthrow(e);
+  }
+
+  {
+    boost::mutex::scoped_lock lock(this->dataPtr->mutex);
+    this->dataPtr->loading.erase(_filename);
+    if (mesh != nullptr)
     {
-      gzerr << "Error loading mesh[" << fullname << "]\n";
-      gzerr << e << "\n";
-      gzthrow(e);
+      mesh->SetName(_filename);
+      this->dataPtr->meshes.insert(std::make_pair(_filename, mesh));
     }
   }
-  else
-    gzerr << "Unable to find file[" << _filename << "]\n";
+  this->dataPtr->loadingCond.notify_all();
+
+  if (mesh == nullptr)
+    gzerr << "Unable to load mesh[" << fullname << "]\n";
 
   return mesh;
 }
 
+//////////////////////////////////////////////////
+const Mesh *MeshManager::SimplifiedMesh(const std::string &_name,
+    const unsigned int _targetTriangles)
+{
+  std::string fullname;
+  if (this->IsValidFilename(_name))
+    fullname = common::find_file(_name);
+
+  return this->dataPtr->Derived(_name, fullname,
+      "simplified_" + std::to_string(_targetTriangles),
+      [&](const Mesh *_source)
+      {
+        return MeshSimplifier::Simplify(_source, _targetTriangles);
+      });
+}
+
+//////////////////////////////////////////////////
+const Mesh *MeshManager::ConvexDecomposition(const std::string &_name,
+    const unsigned int _maxHulls, const unsigned int _maxHullVertices,
+    const unsigned int _targetTriangles)
+{
+  std::string fullname;
+  if (this->IsValidFilename(_name))
+    fullname = common::find_file(_name);
+
+  return this->dataPtr->Derived(_name, fullname,
+      "convex_" + std::to_string(_maxHulls) + "_" +
+      std::to_string(_maxHullVertices) + "_" +
+      std::to_string(_targetTriangles),
+      [&](const Mesh *_source)
+      {
+        if (_targetTriangles > 0)
+          _source = this->SimplifiedMesh(_name, _targetTriangles);
+        return MeshSimplifier::ConvexDecomposition(_source, _maxHulls,
+            _maxHullVertices);
+      });
+}
+
+//////////////////////////////////////////////////
+void MeshManager::SetCachePath(const std::string &_path)
+{
+  boost::mutex::scoped_lock lock(this->dataPtr->mutex);
+  this->dataPtr->cache.reset(new MeshCache(_path));
+}
+
+//////////////////////////////////////////////////
+std::string MeshManager::CachePath() const
+{
+  boost::mutex::scoped_lock lock(this->dataPtr->mutex);
+  return this->dataPtr->cache->Path();
+}
+
 //////////////////////////////////////////////////
 void MeshManager::Export(const Mesh *_mesh, const std::string &_filename,
     const std::string &_extension, bool _exportTextures)
@@ -257,28 +382,31 @@ void MeshManager::GetMeshAABB(const Mesh *_mesh,
     ignition::math::Vector3d &_center,
     ignition::math::Vector3d &_minXYZ, ignition::math::Vector3d &_maxXYZ)
 {
-  if (this->HasMesh(_mesh->GetName()))
-    this->dataPtr->meshes[_mesh->GetName()]->GetAABB(_center, _minXYZ, _maxXYZ);
+  Mesh *mesh = this->GetMeshPtr(_mesh->GetName());
+  if (mesh)
+    mesh->GetAABB(_center, _minXYZ, _maxXYZ);
 }
 
 //////////////////////////////////////////////////
 void MeshManager::GenSphericalTexCoord(const Mesh *_mesh,
     const ignition::math::Vector3d &_center)
 {
-  if (this->HasMesh(_mesh->GetName()))
-    this->dataPtr->meshes[_mesh->GetName()]->GenSphericalTexCoord(_center);
+  Mesh *mesh = this->GetMeshPtr(_mesh->GetName());
+  if (mesh)
+    mesh->GenSphericalTexCoord(_center);
 }
 
 //////////////////////////////////////////////////
 void MeshManager::AddMesh(Mesh *_mesh)
 {
-  if (!this->HasMesh(_mesh->GetName()))
-    this->dataPtr->meshes[_mesh->GetName()] = _mesh;
+  boost::mutex::scoped_lock lock(this->dataPtr->mutex);
+  this->dataPtr->meshes.insert(std::make_pair(_mesh->GetName(), _mesh));
 }
 
 //////////////////////////////////////////////////
 const Mesh *MeshManager::GetMesh(const std::string &_name) const
 {
+  boost::mutex::scoped_lock lock(this->dataPtr->mutex);
   std::map<std::string, Mesh*>::const_iterator iter;
 
   iter = this->dataPtr->meshes.find(_name);
@@ -291,6 +419,7 @@ const Mesh *MeshManager::GetMesh(const std::string &_name) const
 
 Mesh * MeshManager::GetMeshPtr(const std::string &  name)
 {
+  boost::mutex::scoped_lock lock(this->dataPtr->mutex);
   std::map<std::string, Mesh*>::iterator iter;
 
   iter = this->dataPtr->meshes.find(name);
@@ -308,6 +437,7 @@ bool MeshManager::HasMesh(const std::string &_name) const
   if (_name.empty())
     return false;
 
+  boost::mutex::scoped_lock lock(this->dataPtr->mutex);
   std::map<std::string, Mesh*>::const_iterator iter;
   iter = this->dataPtr->meshes.find(_name);
 
@@ -331,7 +461,10 @@ void MeshManager::CreateSphere(const std::string &name, float radius,
 
   Mesh *mesh = new Mesh();
   mesh->SetName(name);
-  this->dataPtr->meshes.insert(std::make_pair(name, mesh));
+  {
+    boost::mutex::scoped_lock lock(this->dataPtr->mutex);
+    this->dataPtr->meshes.insert(std::make_pair(name, mesh));
+  }
 
   SubMesh *subMesh = new SubMesh();
   mesh->AddSubMesh(subMesh);
@@ -399,7 +532,10 @@ void MeshManager::CreatePlane(const std::string &_name,
 
   Mesh *mesh = new Mesh();
   mesh->SetName(_name);
-  this->dataPtr->meshes.insert(std::make_pair(_name, mesh));
+  {
+    boost::mutex::scoped_lock lock(this->dataPtr->mutex);
+    this->dataPtr->meshes.insert(std::make_pair(_name, mesh));
+  }
 
   SubMesh *subMesh = new SubMesh();
   mesh->AddSubMesh(subMesh);
@@ -479,7 +615,10 @@ void MeshManager::CreateBox(const std::string &_name,
 
   Mesh *mesh = new Mesh();
   mesh->SetName(_name);
-  this->dataPtr->meshes.insert(std::make_pair(_name, mesh));
+  {
+    boost::mutex::scoped_lock lock(this->dataPtr->mutex);
+    this->dataPtr->meshes.insert(std::make_pair(_name, mesh));
+  }
 
   SubMesh *subMesh = new SubMesh();
   mesh->AddSubMesh(subMesh);
@@ -780,7 +919,10 @@ void MeshManager::CreateExtrudedPolyline(const std::string &_name,
     }
   }
 
-  this->dataPtr->meshes.insert(std::make_pair(_name, mesh));
+  {
+    boost::mutex::scoped_lock lock(this->dataPtr->mutex);
+    this->dataPtr->meshes.insert(std::make_pair(_name, mesh));
+  }
   return;
 }
 
@@ -796,7 +938,10 @@ void MeshManager::CreateCamera(const std::string &_name, float _scale)
 
   Mesh *mesh = new Mesh();
   mesh->SetName(_name);
-  this->dataPtr->meshes.insert(std::make_pair(_name, mesh));
+  {
+    boost::mutex::scoped_lock lock(this->dataPtr->mutex);
+    this->dataPtr->meshes.insert(std::make_pair(_name, mesh));
+  }
 
   SubMesh *subMesh = new SubMesh();
   mesh->AddSubMesh(subMesh);
@@ -897,7 +1042,10 @@ void MeshManager::CreateCylinder(const std::string &name, float radius,
 
   Mesh *mesh = new Mesh();
   mesh->SetName(name);
-  this->dataPtr->meshes.insert(std::make_pair(name, mesh));
+  {
+    boost::mutex::scoped_lock lock(this->dataPtr->mutex);
+    this->dataPtr->meshes.insert(std::make_pair(name, mesh));
+  }
 
   SubMesh *subMesh = new SubMesh();
   mesh->AddSubMesh(subMesh);
@@ -1014,7 +1162,10 @@ void MeshManager::CreateCone(const std::string &name, float radius,
 
   Mesh *mesh = new Mesh();
   mesh->SetName(name);
-  this->dataPtr->meshes.insert(std::make_pair(name, mesh));
+  {
+    boost::mutex::scoped_lock lock(this->dataPtr->mutex);
+    this->dataPtr->meshes.insert(std::make_pair(name, mesh));
+  }
 
   SubMesh *subMesh = new SubMesh();
   mesh->AddSubMesh(subMesh);
@@ -1131,7 +1282,10 @@ void MeshManager::CreateTube(const std::string &_name, float _innerRadius,
 
   Mesh *mesh = new Mesh();
   mesh->SetName(_name);
-  this->dataPtr->meshes.insert(std::make_pair(_name, mesh));
+  {
+    boost::mutex::scoped_lock lock(this->dataPtr->mutex);
+    this->dataPtr->meshes.insert(std::make_pair(_name, mesh));
+  }
   SubMesh *subMesh = new SubMesh();
   mesh->AddSubMesh(subMesh);
 
@@ -1352,7 +1506,10 @@ void MeshManager::CreateBoolean(const std::string &_name, const Mesh *_m1,
   MeshCSG csg;
   Mesh *mesh = csg.CreateBoolean(_m1, _m2, _operation, _offset);
   mesh->SetName(_name);
-  this->dataPtr->meshes.insert(std::make_pair(_name, mesh));
+  {
+    boost::mutex::scoped_lock lock(this->dataPtr->mutex);
+    this->dataPtr->meshes.insert(std::make_pair(_name, mesh));
+  }
 }
 #endif
 
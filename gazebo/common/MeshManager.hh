@@ -54,10 +54,12 @@ namespace gazebo
 
       /// \brief Destructor.
       ///
-      /// Destroys the collada loader, the stl loader and all the meshes
+      /// Destroys the collada exporter and all the meshes
       private: virtual ~MeshManager();
 
-      /// \brief Load a mesh from a file
+      /// \brief Load a mesh from a file. This is safe to call from several
+      /// threads at once: different meshes are parsed in parallel and a
+      /// mesh requested by several threads is only parsed once.
       /// \param[in] _filename the path to the mesh
       /// \return a pointer to the created mesh
       public: const Mesh *Load(const std::string &_filename);
@@ -71,6 +73,17 @@ namespace gazebo
       public: void Export(const Mesh *_mesh, const std::string &_filename,
           const std::string &_extension, bool _exportTextures = false);
 
+      /// \brief Set the directory of the on-disk mesh cache. Meshes loaded
+      /// from files are stored there once and read back on later loads.
+      /// \param[in] _path Cache directory, an empty path disables the cache.
+      /// The cache is disabled by default.
+      /// \sa MeshCache::DefaultPath
+      public: void SetCachePath(const std::string &_path);
+
+      /// \brief Get the directory of the on-disk mesh cache.
+      /// \return Cache directory, empty if the cache is disabled.
+      public: std::string CachePath() const;
+
       /// \brief Checks a path extension against the list of valid extensions.
       /// \return true if the file extension is loadable
       public: bool IsValidFilename(const std::string &_filename);
@@ -236,6 +249,33 @@ namespace gazebo
           const ignition::math::Pose3d &_offset = ignition::math::Pose3d::Zero);
 #endif
 
+      /// \brief Get a simplified version of a loaded mesh, meant for
+      /// collisions. It is created once, then kept in memory and, for
+      /// meshes loaded from files, in the on-disk mesh cache.
+      /// \param[in] _name Name of a loaded mesh.
+      /// \param[in] _targetTriangles Maximum number of triangles.
+      /// \return The simplified mesh, or nullptr if the mesh is not loaded
+      /// or has no triangles.
+      /// \sa MeshSimplifier::Simplify
+      public: const Mesh *SimplifiedMesh(const std::string &_name,
+                  const unsigned int _targetTriangles);
+
+      /// \brief Get a convex decomposition of a loaded mesh, with one
+      /// convex submesh per hull. It is created once, then kept in memory
+      /// and, for meshes loaded from files, in the on-disk mesh cache.
+      /// \param[in] _name Name of a loaded mesh.
+      /// \param[in] _maxHulls Maximum number of hulls.
+      /// \param[in] _maxHullVertices Maximum number of vertices per hull.
+      /// \param[in] _targetTriangles If not 0, the mesh is simplified to
+      /// this number of triangles before being decomposed.
+      /// \return The decomposition, or nullptr if the mesh is not loaded
+      /// or has no triangles.
+      /// \sa MeshSimplifier::ConvexDecomposition
+      public: const Mesh *ConvexDecomposition(const std::string &_name,
+                  const unsigned int _maxHulls,
+                  const unsigned int _maxHullVertices,
+                  const unsigned int _targetTriangles = 0);
+
       /// \brief Converts a vector of polylines into a table of vertices and
       /// a list of edges (each made of 2 points from the table of vertices.
       /// \param[in] _polys the polylines
@@ -15,6 +15,9 @@
  *
 */
 
+#include <string>
+#include <thread>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include "test_config.h"
@@ -266,6 +269,82 @@ TEST_F(MeshManager, CreateExtrudedPolylineInvalid)
   EXPECT_TRUE(!common::MeshManager::Instance()->HasMesh(meshName));
 }
 
+/////////////////////////////////////////////////
+TEST_F(MeshManager, SimplifiedMesh)
+{
+  common::MeshManager *mgr = common::MeshManager::Instance();
+  mgr->CreateSphere("simplified_sphere", 1.0, 64, 64);
+  ASSERT_TRUE(mgr->HasMesh("simplified_sphere"));
+
+  const common::Mesh *simplified =
+      mgr->SimplifiedMesh("simplified_sphere", 500);
+  ASSERT_NE(nullptr, simplified);
+  EXPECT_LE(simplified->GetIndexCount() / 3, 500u);
+  EXPECT_GT(simplified->GetIndexCount() / 3, 100u);
+  EXPECT_TRUE(mgr->HasMesh(simplified->GetName()));
+
+  // Created only once
+  EXPECT_EQ(simplified, mgr->SimplifiedMesh("simplified_sphere", 500));
+
+  // A sphere is convex
+  const common::Mesh *hulls =
+      mgr->ConvexDecomposition("simplified_sphere", 8, 32, 500);
+  ASSERT_NE(nullptr, hulls);
+  ASSERT_EQ(1u, hulls->GetSubMeshCount());
+  EXPECT_LE(hulls->GetSubMesh(0)->GetVertexCount(), 32u);
+  EXPECT_EQ(hulls, mgr->ConvexDecomposition("simplified_sphere", 8, 32, 500));
+
+  EXPECT_EQ(nullptr, mgr->SimplifiedMesh("no_such_mesh", 10));
+}
+
+/////////////////////////////////////////////////
+// Create, add and look meshes up from several threads at once
+TEST_F(MeshManager, ConcurrentAccess)
+{
+  common::MeshManager *mgr = common::MeshManager::Instance();
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t)
+  {
+    threads.emplace_back([mgr, t]()
+    {
+      for (int i = 0; i < 50; ++i)
+      {
+        const std::string name =
+            "concurrent_" + std::to_string(t) + "_" + std::to_string(i);
+        if (i % 2)
+        {
+          mgr->CreateBox(name, ignition::math::Vector3d::One,
+              ignition::math::Vector2d::One);
+        }
+        else
+        {
+          common::Mesh *mesh = new common::Mesh();
+          mesh->SetName(name);
+          mgr->AddMesh(mesh);
+        }
+        EXPECT_TRUE(mgr->HasMesh(name));
+        EXPECT_NE(nullptr, mgr->GetMesh(name));
+
+        // Look up the meshes of the other threads while they are added
+        mgr->HasMesh("concurrent_" + std::to_string((t + 1) % 4) + "_" +
+            std::to_string(i));
+      }
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+
+  for (int t = 0; t < 4; ++t)
+  {
+    for (int i = 0; i < 50; ++i)
+    {
+      EXPECT_TRUE(mgr->HasMesh(
+          "concurrent_" + std::to_string(t) + "_" + std::to_string(i)));
+    }
+  }
+}
+
 /////////////////////////////////////////////////
 int main(int argc, char **argv)
 {
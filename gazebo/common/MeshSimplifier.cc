@@ -0,0 +1,864 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <memory>
+#include <queue>
+#include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <ignition/math/Helpers.hh>
+
+#include "gazebo/common/Mesh.hh"
+#include "gazebo/common/MeshSimplifier.hh"
+
+using namespace gazebo;
+using namespace common;
+
+namespace
+{
+  /// \brief Weight of the planes that keep open boundaries in place,
+  /// relative to the planes of the triangles.
+  const double kBoundaryWeight = 1000.0;
+
+  /// \brief Parts of a convex decomposition whose surface is closer than
+  /// this fraction of the mesh diagonal to their hull are not split.
+  const double kConcavityTolerance = 0.01;
+
+  /// \brief Thickness given to flat hulls, as a fraction of their size.
+  const double kFlatHullThickness = 1e-3;
+
+  /// \brief Orders positions so that equal positions can be welded.
+  struct VectorLess
+  {
+    bool operator()(const ignition::math::Vector3d &_a,
+                    const ignition::math::Vector3d &_b) const
+    {
+      return std::make_tuple(_a.X(), _a.Y(), _a.Z()) <
+             std::make_tuple(_b.X(), _b.Y(), _b.Z());
+    }
+  };
+
+  /// \brief Triangles of a mesh sharing their vertices.
+  struct WeldedMesh
+  {
+    /// \brief Unique vertex positions.
+    std::vector<ignition::math::Vector3d> vertices;
+
+    /// \brief Triangles, as indices into vertices.
+    std::vector<std::array<unsigned int, 3>> triangles;
+  };
+
+  /// \brief Symmetric 4x4 matrix measuring the squared distance of a point
+  /// to a set of planes.
+  struct Quadric
+  {
+    /// \brief Add a plane _n.p + _d = 0.
+    void AddPlane(const ignition::math::Vector3d &_n, const double _d,
+        const double _weight)
+    {
+      const double a = _n.X(), b = _n.Y(), c = _n.Z();
+      this->q[0] += _weight * a * a;
+      this->q[1] += _weight * a * b;
+      this->q[2] += _weight * a * c;
+      this->q[3] += _weight * a * _d;
+      this->q[4] += _weight * b * b;
+      this->q[5] += _weight * b * c;
+      this->q[6] += _weight * b * _d;
+      this->q[7] += _weight * c * c;
+      this->q[8] += _weight * c * _d;
+      this->q[9] += _weight * _d * _d;
+    }
+
+    Quadric &operator+=(const Quadric &_other)
+    {
+      for (unsigned int i = 0; i < 10; ++i)
+        this->q[i] += _other.q[i];
+      return *this;
+    }
+
+    /// \brief Weighted sum of the squared distances of _v to the planes.
+    double Error(const ignition::math::Vector3d &_v) const
+    {
+      const double x = _v.X(), y = _v.Y(), z = _v.Z();
+      return this->q[0]*x*x + 2*this->q[1]*x*y + 2*this->q[2]*x*z +
+             2*this->q[3]*x + this->q[4]*y*y + 2*this->q[5]*y*z +
+             2*this->q[6]*y + this->q[7]*z*z + 2*this->q[8]*z + this->q[9];
+    }
+
+    /// \brief Find the point with the smallest error.
+    /// \return False if the planes do not constrain a single point.
+    bool Optimal(ignition::math::Vector3d &_v) const
+    {
+      const double *m = this->q;
+      double det = m[0] * (m[4]*m[7] - m[5]*m[5]) -
+                   m[1] * (m[1]*m[7] - m[5]*m[2]) +
+                   m[2] * (m[1]*m[5] - m[4]*m[2]);
+      double scale = m[0] + m[4] + m[7];
+      if (std::abs(det) <= 1e-10 * scale * scale * scale)
+        return false;
+
+      const double r0 = -m[3], r1 = -m[6], r2 = -m[8];
+      _v.Set(
+          (r0 * (m[4]*m[7] - m[5]*m[5]) - m[1] * (r1*m[7] - m[5]*r2) +
+           m[2] * (r1*m[5] - m[4]*r2)) / det,
+          (m[0] * (r1*m[7] - m[5]*r2) - r0 * (m[1]*m[7] - m[5]*m[2]) +
+           m[2] * (m[1]*r2 - r1*m[2])) / det,
+          (m[0] * (m[4]*r2 - r1*m[5]) - m[1] * (m[1]*r2 - r1*m[2]) +
+           r0 * (m[1]*m[5] - m[4]*m[2])) / det);
+      return true;
+    }
+
+    double q[10] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+  };
+
+  /// \brief Candidate edge collapse.
+  struct Collapse
+  {
+    double cost;
+    unsigned int v0;
+    unsigned int v1;
+    unsigned int version0;
+    unsigned int version1;
+    ignition::math::Vector3d target;
+
+    /// \brief Makes std::priority_queue return the cheapest collapse.
+    bool operator<(const Collapse &_other) const
+    {
+      return this->cost > _other.cost;
+    }
+  };
+
+  /// \brief Hull face with its outward plane n.p = d.
+  struct HullFace
+  {
+    std::array<unsigned int, 3> v;
+    ignition::math::Vector3d n;
+    double d;
+    bool alive;
+  };
+
+  //////////////////////////////////////////////////
+  WeldedMesh Weld(const Mesh *_mesh)
+  {
+    WeldedMesh result;
+    std::map<ignition::math::Vector3d, unsigned int, VectorLess> index;
+
+    for (unsigned int s = 0; s < _mesh->GetSubMeshCount(); ++s)
+    {
+      const SubMesh *sub = _mesh->GetSubMesh(s);
+      if (sub->GetPrimitiveType() != SubMesh::TRIANGLES)
+        continue;
+
+      std::vector<unsigned int> remap(sub->GetVertexCount());
+      for (unsigned int v = 0; v < sub->GetVertexCount(); ++v)
+      {
+        auto inserted = index.insert(
+            std::make_pair(sub->Vertex(v), result.vertices.size()));
+        if (inserted.second)
+          result.vertices.push_back(sub->Vertex(v));
+        remap[v] = inserted.first->second;
+      }
+
+      bool indexed = sub->GetIndexCount() > 0;
+      unsigned int count = indexed ? sub->GetIndexCount() :
+          sub->GetVertexCount();
+      for (unsigned int i = 0; i + 2 < count; i += 3)
+      {
+        std::array<unsigned int, 3> tri;
+        bool valid = true;
+        for (unsigned int k = 0; k < 3; ++k)
+        {
+          unsigned int v = indexed ? sub->GetIndex(i + k) : i + k;
+          valid = valid && v < remap.size();
+          tri[k] = valid ? remap[v] : 0;
+        }
+        if (valid && tri[0] != tri[1] && tri[1] != tri[2] && tri[0] != tri[2])
+          result.triangles.push_back(tri);
+      }
+    }
+
+    return result;
+  }
+
+  //////////////////////////////////////////////////
+  /// \brief Unnormalized normal of a triangle.
+  ignition::math::Vector3d TriangleNormal(const ignition::math::Vector3d &_a,
+      const ignition::math::Vector3d &_b, const ignition::math::Vector3d &_c)
+  {
+    return (_b - _a).Cross(_c - _a);
+  }
+
+  //////////////////////////////////////////////////
+  /// \brief Check whether moving vertex _v of the triangles in _tris to
+  /// _target flips or degenerates a triangle that does not also contain
+  /// _other.
+  bool CollapseFlips(const WeldedMesh &_mesh,
+      const std::vector<unsigned int> &_tris,
+      const std::vector<bool> &_removed, const unsigned int _v,
+      const unsigned int _other, const ignition::math::Vector3d &_target)
+  {
+    for (auto t : _tris)
+    {
+      if (_removed[t])
+        continue;
+      const auto &tri = _mesh.triangles[t];
+      if (tri[0] == _other || tri[1] == _other || tri[2] == _other)
+        continue;
+
+      ignition::math::Vector3d p[3];
+      for (unsigned int k = 0; k < 3; ++k)
+        p[k] = tri[k] == _v ? _target : _mesh.vertices[tri[k]];
+
+      ignition::math::Vector3d before = TriangleNormal(
+          _mesh.vertices[tri[0]], _mesh.vertices[tri[1]],
+          _mesh.vertices[tri[2]]);
+      ignition::math::Vector3d after = TriangleNormal(p[0], p[1], p[2]);
+      if (after.Length() <= 1e-12 * before.Length() ||
+          before.Dot(after) <= 0)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  //////////////////////////////////////////////////
+  /// \brief Pick the points furthest along a set of evenly spread
+  /// directions.
+  std::vector<ignition::math::Vector3d> ExtremePoints(
+      const std::vector<ignition::math::Vector3d> &_points,
+      const unsigned int _count)
+  {
+    // Fibonacci sphere
+    const double golden = IGN_PI * (3.0 - std::sqrt(5.0));
+    std::set<size_t> chosen;
+    for (unsigned int i = 0; i < _count; ++i)
+    {
+      double z = 1.0 - 2.0 * (i + 0.5) / _count;
+      double r = std::sqrt(std::max(0.0, 1.0 - z * z));
+      ignition::math::Vector3d dir(r * std::cos(golden * i),
+          r * std::sin(golden * i), z);
+
+      size_t best = 0;
+      double bestDot = dir.Dot(_points[0]);
+      for (size_t p = 1; p < _points.size(); ++p)
+      {
+        double dot = dir.Dot(_points[p]);
+        if (dot > bestDot)
+        {
+          bestDot = dot;
+          best = p;
+        }
+      }
+      chosen.insert(best);
+    }
+
+    std::vector<ignition::math::Vector3d> result;
+    for (auto i : chosen)
+      result.push_back(_points[i]);
+    return result;
+  }
+
+  //////////////////////////////////////////////////
+  /// \brief Incremental 3D convex hull.
+  SubMesh *Hull(const std::vector<ignition::math::Vector3d> &_points)
+  {
+    if (_points.size() < 3)
+      return nullptr;
+
+    ignition::math::Vector3d min = _points[0], max = _points[0];
+    for (auto const &p : _points)
+    {
+      min.Min(p);
+      max.Max(p);
+    }
+    ignition::math::Vector3d extent = max - min;
+    double diag = extent.Length();
+    if (diag <= 0)
+      return nullptr;
+    const double eps = 1e-9 * diag;
+
+    // Initial tetrahedron: extremes along the widest axis, the point
+    // furthest from their line and the point furthest from their plane.
+    unsigned int axis = extent.X() >= extent.Y() ?
+        (extent.X() >= extent.Z() ? 0 : 2) : (extent.Y() >= extent.Z() ? 1 : 2);
+    unsigned int i0 = 0, i1 = 0;
+    for (unsigned int i = 1; i < _points.size(); ++i)
+    {
+      if (_points[i][axis] < _points[i0][axis])
+        i0 = i;
+      if (_points[i][axis] > _points[i1][axis])
+        i1 = i;
+    }
+
+    ignition::math::Vector3d lineDir = (_points[i1] - _points[i0]).Normalize();
+    unsigned int i2 = i0;
+    double best = 0;
+    for (unsigned int i = 0; i < _points.size(); ++i)
+    {
+      double dist = lineDir.Cross(_points[i] - _points[i0]).Length();
+      if (dist > best)
+      {
+        best = dist;
+        i2 = i;
+      }
+    }
+    if (best <= 1e-7 * diag)
+      return nullptr;
+
+    ignition::math::Vector3d planeN = TriangleNormal(
+        _points[i0], _points[i1], _points[i2]).Normalize();
+    unsigned int i3 = i0;
+    best = 0;
+    for (unsigned int i = 0; i < _points.size(); ++i)
+    {
+      double dist = std::abs(planeN.Dot(_points[i] - _points[i0]));
+      if (dist > best)
+      {
+        best = dist;
+        i3 = i;
+      }
+    }
+
+    // Give flat point sets a small thickness, so that engines get a
+    // solid hull.
+    if (best <= 1e-7 * diag)
+    {
+      ignition::math::Vector3d offset = planeN * (0.5 * kFlatHullThickness *
+          diag);
+      std::vector<ignition::math::Vector3d> thick;
+      for (auto const &p : _points)
+      {
+        thick.push_back(p + offset);
+        thick.push_back(p - offset);
+      }
+      return Hull(thick);
+    }
+
+    ignition::math::Vector3d interior = (_points[i0] + _points[i1] +
+        _points[i2] + _points[i3]) * 0.25;
+
+    std::vector<HullFace> faces;
+    auto addFace = [&](unsigned int _a, unsigned int _b, unsigned int _c)
+    {
+      HullFace face;
+      face.v = {{_a, _b, _c}};
+      face.n = TriangleNormal(_points[_a], _points[_b], _points[_c]);
+      face.n.Normalize();
+      face.d = face.n.Dot(_points[_a]);
+      if (face.n.Dot(interior) - face.d > 0)
+      {
+        std::swap(face.v[1], face.v[2]);
+        face.n = -face.n;
+        face.d = -face.d;
+      }
+      face.alive = true;
+      faces.push_back(face);
+    };
+
+    addFace(i0, i1, i2);
+    addFace(i0, i1, i3);
+    addFace(i1, i2, i3);
+    addFace(i0, i2, i3);
+
+    unsigned int aliveCount = 4;
+    std::vector<unsigned int> visible;
+    std::map<std::pair<unsigned int, unsigned int>, unsigned int> edges;
+    for (unsigned int i = 0; i < _points.size(); ++i)
+    {
+      if (i == i0 || i == i1 || i == i2 || i == i3)
+        continue;
+
+      visible.clear();
+      for (unsigned int f = 0; f < faces.size(); ++f)
+      {
+        if (faces[f].alive && faces[f].n.Dot(_points[i]) - faces[f].d > eps)
+          visible.push_back(f);
+      }
+      if (visible.empty())
+        continue;
+
+      // Edges of a single visible face form the horizon
+      edges.clear();
+      for (auto f : visible)
+      {
+        faces[f].alive = false;
+        for (unsigned int k = 0; k < 3; ++k)
+        {
+          unsigned int a = faces[f].v[k];
+          unsigned int b = faces[f].v[(k + 1) % 3];
+          ++edges[std::make_pair(std::min(a, b), std::max(a, b))];
+        }
+      }
+      aliveCount -= visible.size();
+      for (auto const &edge : edges)
+      {
+        if (edge.second == 1)
+        {
+          addFace(edge.first.first, edge.first.second, i);
+          ++aliveCount;
+        }
+      }
+
+      // Drop dead faces once they outnumber the live ones
+      if (faces.size() > 2 * aliveCount)
+      {
+        faces.erase(std::remove_if(faces.begin(), faces.end(),
+            [](const HullFace &_f) { return !_f.alive; }), faces.end());
+      }
+    }
+
+    std::unique_ptr<SubMesh> sub(new SubMesh());
+    sub->SetPrimitiveType(SubMesh::TRIANGLES);
+    std::vector<int> remap(_points.size(), -1);
+    for (auto const &face : faces)
+    {
+      if (!face.alive)
+        continue;
+      for (auto v : face.v)
+      {
+        if (remap[v] < 0)
+        {
+          remap[v] = sub->GetVertexCount();
+          sub->AddVertex(_points[v]);
+        }
+        sub->AddIndex(remap[v]);
+      }
+    }
+    return sub.release();
+  }
+
+  //////////////////////////////////////////////////
+  /// \brief Largest distance from a point inside a convex hull to the
+  /// surface of the hull.
+  double Concavity(const std::vector<ignition::math::Vector3d> &_points,
+      const SubMesh *_hull)
+  {
+    std::vector<std::pair<ignition::math::Vector3d, double>> planes;
+    for (unsigned int i = 0; i + 2 < _hull->GetIndexCount(); i += 3)
+    {
+      ignition::math::Vector3d a = _hull->Vertex(_hull->GetIndex(i));
+      ignition::math::Vector3d n = TriangleNormal(a,
+          _hull->Vertex(_hull->GetIndex(i + 1)),
+          _hull->Vertex(_hull->GetIndex(i + 2)));
+      n.Normalize();
+      planes.push_back(std::make_pair(n, n.Dot(a)));
+    }
+
+    double result = 0;
+    for (auto const &p : _points)
+    {
+      double depth = std::numeric_limits<double>::max();
+      for (auto const &plane : planes)
+        depth = std::min(depth, plane.second - plane.first.Dot(p));
+      result = std::max(result, depth);
+    }
+    return result;
+  }
+}
+
+//////////////////////////////////////////////////
+Mesh *MeshSimplifier::Simplify(const Mesh *_mesh,
+    const unsigned int _targetTriangles)
+{
+  if (!_mesh)
+    return nullptr;
+
+  WeldedMesh welded = Weld(_mesh);
+  if (welded.triangles.empty())
+    return nullptr;
+
+  auto &pos = welded.vertices;
+  auto &tris = welded.triangles;
+  const size_t vertexCount = pos.size();
+
+  std::vector<Quadric> quadrics(vertexCount);
+  std::vector<std::vector<unsigned int>> vertexTris(vertexCount);
+  std::vector<bool> triRemoved(tris.size(), false);
+  std::vector<bool> vertRemoved(vertexCount, false);
+  std::vector<unsigned int> version(vertexCount, 0);
+
+  // Quadrics of the triangle planes, and number of triangles per edge
+  std::map<std::pair<unsigned int, unsigned int>, unsigned int> edgeUse;
+  std::vector<ignition::math::Vector3d> normals(tris.size());
+  for (unsigned int t = 0; t < tris.size(); ++t)
+  {
+    const auto &tri = tris[t];
+    ignition::math::Vector3d n = TriangleNormal(pos[tri[0]], pos[tri[1]],
+        pos[tri[2]]);
+    if (n.Length() > 0)
+      n.Normalize();
+    normals[t] = n;
+
+    for (unsigned int k = 0; k < 3; ++k)
+    {
+      quadrics[tri[k]].AddPlane(n, -n.Dot(pos[tri[0]]), 1.0);
+      vertexTris[tri[k]].push_back(t);
+
+      unsigned int a = tri[k], b = tri[(k + 1) % 3];
+      ++edgeUse[std::make_pair(std::min(a, b), std::max(a, b))];
+    }
+  }
+
+  // Planes through open boundary edges, perpendicular to their triangle,
+  // keep the boundaries from shrinking.
+  for (unsigned int t = 0; t < tris.size(); ++t)
+  {
+    for (unsigned int k = 0; k < 3; ++k)
+    {
+      unsigned int a = tris[t][k], b = tris[t][(k + 1) % 3];
+      if (edgeUse[std::make_pair(std::min(a, b), std::max(a, b))] != 1)
+        continue;
+
+      ignition::math::Vector3d n = (pos[b] - pos[a]).Cross(normals[t]);
+      if (n.Length() <= 0)
+        continue;
+      n.Normalize();
+      quadrics[a].AddPlane(n, -n.Dot(pos[a]), kBoundaryWeight);
+      quadrics[b].AddPlane(n, -n.Dot(pos[a]), kBoundaryWeight);
+    }
+  }
+
+  std::priority_queue<Collapse> heap;
+  auto push = [&](const unsigned int _a, const unsigned int _b)
+  {
+    Quadric q = quadrics[_a];
+    q += quadrics[_b];
+
+    // Use the optimal position unless it is far from the edge, which
+    // happens when the planes are nearly parallel.
+    ignition::math::Vector3d mid = (pos[_a] + pos[_b]) * 0.5;
+    ignition::math::Vector3d target;
+    if (!q.Optimal(target) ||
+        target.Distance(mid) > pos[_a].Distance(pos[_b]))
+    {
+      target = mid;
+      for (auto const &candidate : {pos[_a], pos[_b]})
+      {
+        if (q.Error(candidate) < q.Error(target))
+          target = candidate;
+      }
+    }
+
+    Collapse c;
+    c.cost = q.Error(target);
+    c.v0 = _a;
+    c.v1 = _b;
+    c.version0 = version[_a];
+    c.version1 = version[_b];
+    c.target = target;
+    heap.push(c);
+  };
+
+  for (auto const &edge : edgeUse)
+    push(edge.first.first, edge.first.second);
+
+  size_t triCount = tris.size();
+  std::vector<unsigned int> mark(vertexCount, 0);
+  unsigned int markStamp = 0;
+  while (triCount > _targetTriangles && !heap.empty())
+  {
+    Collapse c = heap.top();
+    heap.pop();
+
+    if (vertRemoved[c.v0] || vertRemoved[c.v1] ||
+        version[c.v0] != c.version0 || version[c.v1] != c.version1)
+    {
+      continue;
+    }
+
+    // Keep the surface manifold: the endpoints of an edge may only share
+    // the neighbors of the triangles on that edge.
+    ++markStamp;
+    for (auto t : vertexTris[c.v0])
+    {
+      if (!triRemoved[t])
+        for (auto v : tris[t])
+          mark[v] = markStamp;
+    }
+    std::set<unsigned int> sharedVerts;
+    for (auto t : vertexTris[c.v1])
+    {
+      if (triRemoved[t])
+        continue;
+      for (auto v : tris[t])
+      {
+        if (v != c.v0 && v != c.v1 && mark[v] == markStamp)
+          sharedVerts.insert(v);
+      }
+    }
+    if (sharedVerts.size() > 2)
+      continue;
+
+    if (CollapseFlips(welded, vertexTris[c.v0], triRemoved, c.v0, c.v1,
+          c.target) ||
+        CollapseFlips(welded, vertexTris[c.v1], triRemoved, c.v1, c.v0,
+          c.target))
+    {
+      continue;
+    }
+
+    // Collapse v1 into v0
+    pos[c.v0] = c.target;
+    quadrics[c.v0] += quadrics[c.v1];
+    vertRemoved[c.v1] = true;
+    for (auto t : vertexTris[c.v1])
+    {
+      if (triRemoved[t])
+        continue;
+      auto &tri = tris[t];
+      if (tri[0] == c.v0 || tri[1] == c.v0 || tri[2] == c.v0)
+      {
+        triRemoved[t] = true;
+        --triCount;
+      }
+      else
+      {
+        for (auto &v : tri)
+        {
+          if (v == c.v1)
+            v = c.v0;
+        }
+        vertexTris[c.v0].push_back(t);
+      }
+    }
+    vertexTris[c.v1].clear();
+
+    auto &v0Tris = vertexTris[c.v0];
+    v0Tris.erase(std::remove_if(v0Tris.begin(), v0Tris.end(),
+        [&](unsigned int _t) { return triRemoved[_t]; }), v0Tris.end());
+    ++version[c.v0];
+
+    std::set<unsigned int> neighbors;
+    for (auto t : v0Tris)
+    {
+      for (auto v : tris[t])
+      {
+        if (v != c.v0)
+          neighbors.insert(v);
+      }
+    }
+    for (auto n : neighbors)
+      push(c.v0, n);
+  }
+
+  std::unique_ptr<Mesh> mesh(new Mesh());
+  SubMesh *sub = new SubMesh();
+  sub->SetPrimitiveType(SubMesh::TRIANGLES);
+  mesh->AddSubMesh(sub);
+
+  std::vector<int> remap(vertexCount, -1);
+  for (unsigned int t = 0; t < tris.size(); ++t)
+  {
+    if (triRemoved[t])
+      continue;
+    for (auto v : tris[t])
+    {
+      if (remap[v] < 0)
+      {
+        remap[v] = sub->GetVertexCount();
+        sub->AddVertex(pos[v]);
+      }
+      sub->AddIndex(remap[v]);
+    }
+  }
+
+  return mesh.release();
+}
+
+//////////////////////////////////////////////////
+Mesh *MeshSimplifier::ConvexDecomposition(const Mesh *_mesh,
+    const unsigned int _maxHulls, const unsigned int _maxHullVertices)
+{
+  if (!_mesh)
+    return nullptr;
+
+  WeldedMesh welded = Weld(_mesh);
+  if (welded.triangles.empty())
+    return nullptr;
+
+  ignition::math::Vector3d min = welded.vertices[0];
+  ignition::math::Vector3d max = welded.vertices[0];
+  for (auto const &v : welded.vertices)
+  {
+    min.Min(v);
+    max.Max(v);
+  }
+  const double tolerance = kConcavityTolerance * (max - min).Length();
+
+  struct Part
+  {
+    std::vector<unsigned int> tris;
+    std::unique_ptr<SubMesh> hull;
+    double concavity = 0;
+    bool splittable = true;
+  };
+
+  std::vector<unsigned int> mark(welded.vertices.size(), 0);
+  unsigned int markStamp = 0;
+  auto centroid = [&](const unsigned int _t)
+  {
+    const auto &tri = welded.triangles[_t];
+    return (welded.vertices[tri[0]] + welded.vertices[tri[1]] +
+            welded.vertices[tri[2]]) / 3.0;
+  };
+
+  auto makePart = [&](std::vector<unsigned int> &&_tris)
+  {
+    std::unique_ptr<Part> part(new Part());
+    part->tris = std::move(_tris);
+
+    // Surface samples: unique vertices and triangle centroids
+    ++markStamp;
+    std::vector<ignition::math::Vector3d> vertices;
+    std::vector<ignition::math::Vector3d> samples;
+    for (auto t : part->tris)
+    {
+      for (auto v : welded.triangles[t])
+      {
+        if (mark[v] != markStamp)
+        {
+          mark[v] = markStamp;
+          vertices.push_back(welded.vertices[v]);
+        }
+      }
+      samples.push_back(centroid(t));
+    }
+
+    part->hull.reset(MeshSimplifier::ConvexHull(vertices, _maxHullVertices));
+    if (part->hull)
+    {
+      samples.insert(samples.end(), vertices.begin(), vertices.end());
+      part->concavity = Concavity(samples, part->hull.get());
+    }
+    else
+    {
+      part->splittable = false;
+    }
+    return part;
+  };
+
+  std::vector<unsigned int> all(welded.triangles.size());
+  for (unsigned int t = 0; t < all.size(); ++t)
+    all[t] = t;
+
+  std::vector<std::unique_ptr<Part>> parts;
+  parts.push_back(makePart(std::move(all)));
+
+  while (parts.size() < std::max(1u, _maxHulls))
+  {
+    // Split the most concave part
+    size_t worst = parts.size();
+    for (size_t i = 0; i < parts.size(); ++i)
+    {
+      if (parts[i]->splittable && parts[i]->concavity > tolerance &&
+          (worst == parts.size() ||
+           parts[i]->concavity > parts[worst]->concavity))
+      {
+        worst = i;
+      }
+    }
+    if (worst == parts.size())
+      break;
+
+    Part &part = *parts[worst];
+    ignition::math::Vector3d cMin = centroid(part.tris[0]);
+    ignition::math::Vector3d cMax = cMin;
+    for (auto t : part.tris)
+    {
+      cMin.Min(centroid(t));
+      cMax.Max(centroid(t));
+    }
+
+    // Try the median and middle planes of each axis, and keep the split
+    // leaving the least concave parts.
+    std::unique_ptr<Part> bestLeft, bestRight;
+    double bestScore = std::numeric_limits<double>::max();
+    for (unsigned int axis = 0; axis < 3; ++axis)
+    {
+      if (cMax[axis] <= cMin[axis])
+        continue;
+
+      std::vector<double> coords;
+      for (auto t : part.tris)
+        coords.push_back(centroid(t)[axis]);
+      std::nth_element(coords.begin(), coords.begin() + coords.size() / 2,
+          coords.end());
+
+      for (double split : {coords[coords.size() / 2],
+                           0.5 * (cMin[axis] + cMax[axis])})
+      {
+        std::vector<unsigned int> left, right;
+        for (auto t : part.tris)
+        {
+          if (centroid(t)[axis] < split)
+            left.push_back(t);
+          else
+            right.push_back(t);
+        }
+        if (left.empty() || right.empty())
+          continue;
+
+        std::unique_ptr<Part> l = makePart(std::move(left));
+        std::unique_ptr<Part> r = makePart(std::move(right));
+        double score = std::max(l->concavity, r->concavity);
+        if (score < bestScore)
+        {
+          bestScore = score;
+          bestLeft = std::move(l);
+          bestRight = std::move(r);
+        }
+      }
+    }
+
+    if (!bestLeft)
+    {
+      part.splittable = false;
+      continue;
+    }
+
+    parts[worst] = std::move(bestLeft);
+    parts.push_back(std::move(bestRight));
+  }
+
+  std::unique_ptr<Mesh> mesh(new Mesh());
+  for (auto &part : parts)
+  {
+    if (part->hull)
+      mesh->AddSubMesh(part->hull.release());
+  }
+
+  if (mesh->GetSubMeshCount() == 0)
+    return nullptr;
+  return mesh.release();
+}
+
+//////////////////////////////////////////////////
+SubMesh *MeshSimplifier::ConvexHull(
+    const std::vector<ignition::math::Vector3d> &_points,
+    const unsigned int _maxVertices)
+{
+  if (_maxVertices > 0 && _points.size() > _maxVertices)
+    return Hull(ExtremePoints(_points, _maxVertices));
+  return Hull(_points);
+}
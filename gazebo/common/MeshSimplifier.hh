@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_COMMON_MESHSIMPLIFIER_HH_
+#define GAZEBO_COMMON_MESHSIMPLIFIER_HH_
+
+#include <vector>
+
+#include <ignition/math/Vector3.hh>
+
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace common
+  {
+    class Mesh;
+    class SubMesh;
+
+    /// \addtogroup gazebo_common Common
+    /// \{
+
+    /// \class MeshSimplifier MeshSimplifier.hh common/common.hh
+    /// \brief Creates cheaper collision versions of triangle meshes.
+    ///
+    /// Only vertex positions and triangles are kept: the results are meant
+    /// for collision detection, not for rendering.
+    class GZ_COMMON_VISIBLE MeshSimplifier
+    {
+      /// \brief Reduce the number of triangles of a mesh using quadric
+      /// error metrics edge collapses. The triangles of all submeshes are
+      /// welded into one submesh first. Open boundaries are preserved.
+      /// \param[in] _mesh Mesh to simplify.
+      /// \param[in] _targetTriangles Maximum number of triangles of the
+      /// result. Fewer may be left if no more edges can be collapsed
+      /// without flipping triangles.
+      /// \return A new mesh with one submesh, or nullptr if _mesh has no
+      /// triangles.
+      public: static Mesh *Simplify(const Mesh *_mesh,
+                  const unsigned int _targetTriangles);
+
+      /// \brief Approximate a mesh with a set of convex hulls. The mesh is
+      /// split recursively along the longest axis of the most concave part,
+      /// until every part is nearly convex or _maxHulls is reached.
+      /// \param[in] _mesh Mesh to decompose.
+      /// \param[in] _maxHulls Maximum number of hulls.
+      /// \param[in] _maxHullVertices Maximum number of vertices per hull.
+      /// \return A new mesh with one closed convex submesh per hull, or
+      /// nullptr if _mesh has no triangles.
+      public: static Mesh *ConvexDecomposition(const Mesh *_mesh,
+                  const unsigned int _maxHulls,
+                  const unsigned int _maxHullVertices);
+
+      /// \brief Compute the convex hull of a set of points.
+      /// \param[in] _points Points to enclose.
+      /// \param[in] _maxVertices Maximum number of hull vertices, 0 for no
+      /// limit. When there are more points, only the ones furthest along a
+      /// set of evenly spread directions are used.
+      /// \return A new closed submesh with outward facing triangles, or
+      /// nullptr if the points are colinear.
+      public: static SubMesh *ConvexHull(
+                  const std::vector<ignition::math::Vector3d> &_points,
+                  const unsigned int _maxVertices = 0);
+    };
+    /// \}
+  }
+}
+#endif
@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <memory>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "gazebo/common/Mesh.hh"
+#include "gazebo/common/MeshSimplifier.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+
+class MeshSimplifier : public gazebo::testing::AutoLogFixture { };
+
+/////////////////////////////////////////////////
+/// \brief Add a closed box to a submesh.
+void AddBox(common::SubMesh *_sub, const ignition::math::Vector3d &_min,
+    const ignition::math::Vector3d &_max)
+{
+  unsigned int base = _sub->GetVertexCount();
+  for (unsigned int i = 0; i < 8; ++i)
+  {
+    _sub->AddVertex((i & 1) ? _max.X() : _min.X(),
+                    (i & 2) ? _max.Y() : _min.Y(),
+                    (i & 4) ? _max.Z() : _min.Z());
+  }
+
+  unsigned int faces[12][3] = {
+    {0, 2, 1}, {1, 2, 3}, {4, 5, 6}, {5, 7, 6}, {0, 1, 4}, {1, 5, 4},
+    {2, 6, 3}, {3, 6, 7}, {0, 4, 2}, {2, 4, 6}, {1, 3, 5}, {3, 7, 5}};
+  for (auto const &face : faces)
+  {
+    for (auto v : face)
+      _sub->AddIndex(base + v);
+  }
+}
+
+/////////////////////////////////////////////////
+/// \brief Volume enclosed by a closed submesh.
+double Volume(const common::SubMesh *_sub)
+{
+  double volume = 0;
+  for (unsigned int i = 0; i + 2 < _sub->GetIndexCount(); i += 3)
+  {
+    ignition::math::Vector3d a = _sub->Vertex(_sub->GetIndex(i));
+    ignition::math::Vector3d b = _sub->Vertex(_sub->GetIndex(i + 1));
+    ignition::math::Vector3d c = _sub->Vertex(_sub->GetIndex(i + 2));
+    volume += a.Dot(b.Cross(c)) / 6.0;
+  }
+  return volume;
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshSimplifier, ConvexHull)
+{
+  common::SubMesh box;
+  AddBox(&box, ignition::math::Vector3d(-1, -2, -3),
+      ignition::math::Vector3d(1, 2, 3));
+
+  std::vector<ignition::math::Vector3d> points;
+  for (unsigned int i = 0; i < box.GetVertexCount(); ++i)
+    points.push_back(box.Vertex(i));
+  points.push_back(ignition::math::Vector3d::Zero);
+  points.push_back(ignition::math::Vector3d(0.5, 0.5, 0.5));
+
+  // Interior points are dropped, faces point outwards
+  std::unique_ptr<common::SubMesh> hull(
+      common::MeshSimplifier::ConvexHull(points));
+  ASSERT_NE(nullptr, hull);
+  EXPECT_EQ(8u, hull->GetVertexCount());
+  EXPECT_EQ(36u, hull->GetIndexCount());
+  EXPECT_NEAR(48.0, Volume(hull.get()), 1e-9);
+
+  // Flat point sets get a small thickness
+  std::vector<ignition::math::Vector3d> flat = {
+    ignition::math::Vector3d(0, 0, 0), ignition::math::Vector3d(1, 0, 0),
+    ignition::math::Vector3d(0, 1, 0), ignition::math::Vector3d(1, 1, 0)};
+  hull.reset(common::MeshSimplifier::ConvexHull(flat));
+  ASSERT_NE(nullptr, hull);
+  EXPECT_EQ(8u, hull->GetVertexCount());
+  EXPECT_GT(Volume(hull.get()), 0.0);
+
+  // Colinear points have no hull
+  std::vector<ignition::math::Vector3d> line = {
+    ignition::math::Vector3d(0, 0, 0), ignition::math::Vector3d(1, 1, 1),
+    ignition::math::Vector3d(2, 2, 2)};
+  EXPECT_EQ(nullptr, common::MeshSimplifier::ConvexHull(line));
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshSimplifier, Simplify)
+{
+  // A flat grid of 2 * 20 * 20 triangles
+  common::Mesh grid;
+  common::SubMesh *sub = new common::SubMesh();
+  grid.AddSubMesh(sub);
+  const unsigned int n = 20;
+  for (unsigned int y = 0; y <= n; ++y)
+  {
+    for (unsigned int x = 0; x <= n; ++x)
+      sub->AddVertex(x, y, 0);
+  }
+  for (unsigned int y = 0; y < n; ++y)
+  {
+    for (unsigned int x = 0; x < n; ++x)
+    {
+      unsigned int a = y * (n + 1) + x;
+      sub->AddIndex(a);
+      sub->AddIndex(a + 1);
+      sub->AddIndex(a + n + 1);
+      sub->AddIndex(a + 1);
+      sub->AddIndex(a + n + 2);
+      sub->AddIndex(a + n + 1);
+    }
+  }
+
+  std::unique_ptr<common::Mesh> simplified(
+      common::MeshSimplifier::Simplify(&grid, 2));
+  ASSERT_NE(nullptr, simplified);
+  ASSERT_EQ(1u, simplified->GetSubMeshCount());
+  EXPECT_EQ(6u, simplified->GetIndexCount());
+
+  // The open boundary is preserved
+  EXPECT_EQ(ignition::math::Vector3d(0, 0, 0), simplified->Min());
+  EXPECT_EQ(ignition::math::Vector3d(n, n, 0), simplified->Max());
+
+  // Nothing to simplify
+  common::Mesh empty;
+  EXPECT_EQ(nullptr, common::MeshSimplifier::Simplify(&empty, 10));
+}
+
+/////////////////////////////////////////////////
+TEST_F(MeshSimplifier, ConvexDecomposition)
+{
+  // An L made of two boxes
+  common::Mesh mesh;
+  common::SubMesh *sub = new common::SubMesh();
+  mesh.AddSubMesh(sub);
+  AddBox(sub, ignition::math::Vector3d(0, 0, 0),
+      ignition::math::Vector3d(4, 1, 1));
+  AddBox(sub, ignition::math::Vector3d(0, 1, 0),
+      ignition::math::Vector3d(1, 4, 1));
+
+  std::unique_ptr<common::Mesh> hulls(
+      common::MeshSimplifier::ConvexDecomposition(&mesh, 8, 32));
+  ASSERT_NE(nullptr, hulls);
+  ASSERT_EQ(2u, hulls->GetSubMeshCount());
+  EXPECT_NEAR(7.0, Volume(hulls->GetSubMesh(0)) +
+      Volume(hulls->GetSubMesh(1)), 1e-9);
+
+  // A single hull when limited
+  hulls.reset(common::MeshSimplifier::ConvexDecomposition(&mesh, 1, 32));
+  ASSERT_NE(nullptr, hulls);
+  ASSERT_EQ(1u, hulls->GetSubMeshCount());
+  EXPECT_NEAR(16.0 - 4.5, Volume(hulls->GetSubMesh(0)), 1e-9);
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,558 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#if defined(_MSC_VER)
+  #include <intrin.h>
+  #define GZ_PROFILE_TSC
+#elif defined(__x86_64__) || defined(__i386__)
+  #include <x86intrin.h>
+  #define GZ_PROFILE_TSC
+#endif
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "gazebo/common/CommonIface.hh"
+#include "gazebo/common/Console.hh"
+#include "gazebo/common/ScopeProfiler.hh"
+
+using namespace gazebo;
+using namespace common;
+
+namespace
+{
+  /// \brief Number of scopes in the buffer of a thread.
+  const uint64_t kBufferSize = 1 << 12;
+
+  /// \brief Maximum nesting of GZ_PROFILE_BEGIN sections.
+  const unsigned int kStackSize = 64;
+
+  /// \brief Number of histogram buckets: 8 exact buckets for durations
+  /// below 8 ticks, then 8 buckets per power of two.
+  const unsigned int kBucketCount = 8 + 61 * 8;
+
+  /// \brief A scope that ran.
+  struct ProfileEvent
+  {
+    /// \brief Time stamp at the start.
+    uint64_t start;
+
+    /// \brief Time stamp at the end.
+    uint64_t end;
+
+    /// \brief Id of the scope.
+    uint32_t id;
+
+    /// \brief Id of the thread, only used by the trace.
+    uint32_t threadId;
+  };
+
+  /// \brief Single producer, single consumer ring buffer of the scopes
+  /// that ran on a thread. The thread writes head, Collect() writes tail.
+  class ThreadBuffer
+  {
+    /// \brief Recorded scopes.
+    public: std::array<ProfileEvent, kBufferSize> events;
+
+    /// \brief Number of scopes written.
+    public: std::atomic<uint64_t> head{0};
+
+    /// \brief Number of scopes read.
+    public: std::atomic<uint64_t> tail{0};
+
+    /// \brief Number of scopes lost because the buffer was full.
+    public: std::atomic<uint64_t> dropped{0};
+
+    /// \brief False once the thread has exited.
+    public: std::atomic<bool> alive{true};
+
+    /// \brief Id of the thread.
+    public: uint32_t threadId = 0;
+
+    /// \brief Scope ids of the open sections, only used by the thread.
+    public: std::array<uint32_t, kStackSize> stackIds;
+
+    /// \brief Start time stamps of the open sections.
+    public: std::array<uint64_t, kStackSize> stackStarts;
+
+    /// \brief Number of open sections.
+    public: unsigned int stackSize = 0;
+  };
+
+  /// \brief Log-linear histogram of durations in ticks.
+  class Histogram
+  {
+    /// \brief Add a duration.
+    /// \param[in] _ticks Duration.
+    public: void Add(const uint64_t _ticks)
+    {
+      if (this->buckets.empty())
+        this->buckets.resize(kBucketCount, 0);
+
+      ++this->buckets[Index(_ticks)];
+      if (this->count == 0 || _ticks < this->min)
+        this->min = _ticks;
+      this->max = std::max(this->max, _ticks);
+      this->total += _ticks;
+      ++this->count;
+    }
+
+    /// \brief Get a percentile of the durations.
+    /// \param[in] _q Fraction of the durations below the result.
+    /// \return The percentile in ticks.
+    public: uint64_t Percentile(const double _q) const
+    {
+      uint64_t target = static_cast<uint64_t>(std::ceil(_q * this->count));
+      uint64_t sum = 0;
+      for (unsigned int i = 0; i < this->buckets.size(); ++i)
+      {
+        sum += this->buckets[i];
+        if (sum >= target && sum > 0)
+          return std::min(this->max, std::max(this->min, Value(i)));
+      }
+      return this->max;
+    }
+
+    /// \brief Get the bucket of a duration.
+    /// \param[in] _ticks Duration.
+    /// \return Bucket index.
+    private: static unsigned int Index(const uint64_t _ticks)
+    {
+      if (_ticks < 8)
+        return static_cast<unsigned int>(_ticks);
+
+      unsigned int e = 3;
+      while (e < 63 && (_ticks >> (e + 1)) != 0)
+        ++e;
+      return 8 + (e - 3) * 8 + ((_ticks >> (e - 3)) & 7);
+    }
+
+    /// \brief Get the duration at the middle of a bucket.
+    /// \param[in] _index Bucket index.
+    /// \return Duration in ticks.
+    private: static uint64_t Value(const unsigned int _index)
+    {
+      if (_index < 8)
+        return _index;
+
+      unsigned int shift = (_index - 8) / 8;
+      uint64_t sub = (_index - 8) % 8;
+      return ((8 + sub) << shift) + ((uint64_t(1) << shift) >> 1);
+    }
+
+    /// \brief Number of durations per bucket.
+    public: std::vector<uint64_t> buckets;
+
+    /// \brief Number of durations.
+    public: uint64_t count = 0;
+
+    /// \brief Sum of the durations.
+    public: uint64_t total = 0;
+
+    /// \brief Shortest duration.
+    public: uint64_t min = 0;
+
+    /// \brief Longest duration.
+    public: uint64_t max = 0;
+  };
+
+  /// \brief Shared state of the profiler.
+  class ProfilerData
+  {
+    /// \brief Protects names and ids.
+    public: std::mutex scopeMutex;
+
+    /// \brief Name of each scope id.
+    public: std::vector<std::string> names;
+
+    /// \brief Id of each scope name.
+    public: std::map<std::string, uint32_t> ids;
+
+    /// \brief Protects threads and nextThreadId.
+    public: std::mutex threadMutex;
+
+    /// \brief Buffers of the threads that recorded scopes.
+    public: std::vector<std::shared_ptr<ThreadBuffer>> threads;
+
+    /// \brief Id of the next thread.
+    public: uint32_t nextThreadId = 1;
+
+    /// \brief Protects the members below.
+    public: std::mutex collectMutex;
+
+    /// \brief Histogram of each scope id.
+    public: std::vector<Histogram> histograms;
+
+    /// \brief Scopes lost by threads that have exited.
+    public: uint64_t dropped = 0;
+
+    /// \brief True to keep the individual scopes.
+    public: bool tracing = false;
+
+    /// \brief Maximum number of traced scopes.
+    public: size_t maxTraceEvents = 0;
+
+    /// \brief Traced scopes.
+    public: std::vector<ProfileEvent> trace;
+
+    /// \brief Time stamp at creation, used to calibrate the ticks.
+    public: const uint64_t tick0 = ScopeProfiler::Now();
+
+    /// \brief Clock time at creation, used to calibrate the ticks.
+    public: const std::chrono::steady_clock::time_point time0 =
+            std::chrono::steady_clock::now();
+  };
+
+  /// \brief Get the profiler state. It is never destroyed, so that threads
+  /// can record scopes during static destruction.
+  /// \return The profiler state.
+  ProfilerData &Data()
+  {
+    static ProfilerData *data = new ProfilerData;
+    return *data;
+  }
+
+  /// \brief Read the initial state of the profiler from the environment.
+  /// \return False if GAZEBO_PROFILER is 0.
+  bool InitEnabled()
+  {
+    // Create the profiler state at load time, so that tick0 precedes every
+    // time stamp taken through ScopeProfiler::Now().
+    Data();
+
+    const char *env = common::getEnv("GAZEBO_PROFILER");
+    return !env || std::string(env) != "0";
+  }
+
+  /// \brief True if scopes are recorded.
+  std::atomic<bool> g_enabled(InitEnabled());
+
+  /// \brief Owns the buffer of a thread, and marks it finished when the
+  /// thread exits.
+  class ThreadHolder
+  {
+    /// \brief Destructor.
+    public: ~ThreadHolder()
+    {
+      if (this->buffer)
+        this->buffer->alive = false;
+    }
+
+    /// \brief Buffer of the thread.
+    public: std::shared_ptr<ThreadBuffer> buffer;
+  };
+
+  thread_local ThreadHolder t_holder;
+
+  /// \brief Get the buffer of the calling thread.
+  /// \return The buffer.
+  ThreadBuffer &LocalBuffer()
+  {
+    if (!t_holder.buffer)
+    {
+      t_holder.buffer = std::make_shared<ThreadBuffer>();
+
+      ProfilerData &data = Data();
+      std::lock_guard<std::mutex> lock(data.threadMutex);
+      t_holder.buffer->threadId = data.nextThreadId++;
+      data.threads.push_back(t_holder.buffer);
+    }
+    return *t_holder.buffer;
+  }
+
+  /// \brief Get the number of ticks per second.
+  /// \param[in] _data Profiler state.
+  /// \return Ticks per second.
+  double TicksPerSecond(const ProfilerData &_data)
+  {
+#ifdef GZ_PROFILE_TSC
+    // Calibrate against the steady clock over at least 10 ms
+    auto elapsed = std::chrono::steady_clock::now() - _data.time0;
+    if (elapsed < std::chrono::milliseconds(10))
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10) - elapsed);
+    }
+    uint64_t ticks = ScopeProfiler::Now();
+    double seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - _data.time0).count();
+    return (ticks - _data.tick0) / seconds;
+#else
+    return static_cast<double>(std::chrono::steady_clock::period::den) /
+        std::chrono::steady_clock::period::num;
+#endif
+  }
+
+  /// \brief Escape a string for JSON.
+  /// \param[in] _str String to escape.
+  /// \return Escaped string.
+  std::string EscapeJson(const std::string &_str)
+  {
+    std::string result;
+    for (char c : _str)
+    {
+      if (c == '"' || c == '\\')
+        result += '\\';
+      if (static_cast<unsigned char>(c) >= 0x20)
+        result += c;
+    }
+    return result;
+  }
+}
+
+//////////////////////////////////////////////////
+uint32_t ScopeProfiler::RegisterScope(const std::string &_name)
+{
+  ProfilerData &data = Data();
+  std::lock_guard<std::mutex> lock(data.scopeMutex);
+
+  auto iter = data.ids.find(_name);
+  if (iter != data.ids.end())
+    return iter->second;
+
+  uint32_t id = static_cast<uint32_t>(data.names.size());
+  data.names.push_back(_name);
+  data.ids[_name] = id;
+  return id;
+}
+
+//////////////////////////////////////////////////
+std::string ScopeProfiler::ScopeName(const uint32_t _id)
+{
+  ProfilerData &data = Data();
+  std::lock_guard<std::mutex> lock(data.scopeMutex);
+  if (_id < data.names.size())
+    return data.names[_id];
+  return std::string();
+}
+
+//////////////////////////////////////////////////
+bool ScopeProfiler::Enabled()
+{
+  return g_enabled.load(std::memory_order_relaxed);
+}
+
+//////////////////////////////////////////////////
+void ScopeProfiler::SetEnabled(const bool _enabled)
+{
+  g_enabled = _enabled;
+}
+
+//////////////////////////////////////////////////
+uint64_t ScopeProfiler::Now()
+{
+#ifdef GZ_PROFILE_TSC
+  return __rdtsc();
+#else
+  return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+
+//////////////////////////////////////////////////
+void ScopeProfiler::Record(const uint32_t _id, const uint64_t _start,
+    const uint64_t _end)
+{
+  ThreadBuffer &buffer = LocalBuffer();
+
+  uint64_t head = buffer.head.load(std::memory_order_relaxed);
+  if (head - buffer.tail.load(std::memory_order_acquire) >= kBufferSize)
+  {
+    buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  ProfileEvent &event = buffer.events[head % kBufferSize];
+  event.start = _start;
+  event.end = _end;
+  event.id = _id;
+  event.threadId = buffer.threadId;
+  buffer.head.store(head + 1, std::memory_order_release);
+}
+
+//////////////////////////////////////////////////
+void ScopeProfiler::Begin(const uint32_t _id)
+{
+  ThreadBuffer &buffer = LocalBuffer();
+  if (buffer.stackSize < kStackSize)
+  {
+    buffer.stackIds[buffer.stackSize] = _id;
+    buffer.stackStarts[buffer.stackSize] = Enabled() ? Now() : 0;
+  }
+  ++buffer.stackSize;
+}
+
+//////////////////////////////////////////////////
+void ScopeProfiler::End()
+{
+  ThreadBuffer &buffer = LocalBuffer();
+  if (buffer.stackSize == 0)
+    return;
+
+  --buffer.stackSize;
+  if (buffer.stackSize < kStackSize &&
+      buffer.stackStarts[buffer.stackSize] != 0)
+  {
+    Record(buffer.stackIds[buffer.stackSize],
+        buffer.stackStarts[buffer.stackSize], Now());
+  }
+}
+
+//////////////////////////////////////////////////
+void ScopeProfiler::Collect()
+{
+  ProfilerData &data = Data();
+
+  std::vector<std::shared_ptr<ThreadBuffer>> threads;
+  {
+    std::lock_guard<std::mutex> lock(data.threadMutex);
+    threads = data.threads;
+  }
+
+  std::lock_guard<std::mutex> lock(data.collectMutex);
+  for (auto &buffer : threads)
+  {
+    uint64_t tail = buffer->tail.load(std::memory_order_relaxed);
+    uint64_t head = buffer->head.load(std::memory_order_acquire);
+
+    for (; tail != head; ++tail)
+    {
+      const ProfileEvent &event = buffer->events[tail % kBufferSize];
+      if (event.id >= data.histograms.size())
+        data.histograms.resize(event.id + 1);
+      data.histograms[event.id].Add(event.end - event.start);
+
+      if (data.tracing && data.trace.size() < data.maxTraceEvents)
+        data.trace.push_back(event);
+    }
+    buffer->tail.store(head, std::memory_order_release);
+  }
+
+  // Forget the threads that have exited
+  std::lock_guard<std::mutex> threadLock(data.threadMutex);
+  for (auto iter = data.threads.begin(); iter != data.threads.end();)
+  {
+    if (!(*iter)->alive && (*iter)->tail == (*iter)->head)
+    {
+      data.dropped += (*iter)->dropped;
+      iter = data.threads.erase(iter);
+    }
+    else
+      ++iter;
+  }
+}
+
+//////////////////////////////////////////////////
+std::vector<ProfileStats> ScopeProfiler::Stats()
+{
+  ProfilerData &data = Data();
+  double tickPeriod = 1.0 / TicksPerSecond(data);
+
+  std::vector<ProfileStats> result;
+  std::lock_guard<std::mutex> lock(data.collectMutex);
+  for (uint32_t id = 0; id < data.histograms.size(); ++id)
+  {
+    const Histogram &histogram = data.histograms[id];
+    if (histogram.count == 0)
+      continue;
+
+    ProfileStats stats;
+    stats.name = ScopeName(id);
+    stats.count = histogram.count;
+    stats.total = histogram.total * tickPeriod;
+    stats.min = histogram.min * tickPeriod;
+    stats.max = histogram.max * tickPeriod;
+    stats.p50 = histogram.Percentile(0.5) * tickPeriod;
+    stats.p99 = histogram.Percentile(0.99) * tickPeriod;
+    result.push_back(stats);
+  }
+
+  return result;
+}
+
+//////////////////////////////////////////////////
+void ScopeProfiler::Reset()
+{
+  ProfilerData &data = Data();
+  std::lock_guard<std::mutex> lock(data.collectMutex);
+  data.histograms.clear();
+}
+
+//////////////////////////////////////////////////
+uint64_t ScopeProfiler::DroppedCount()
+{
+  ProfilerData &data = Data();
+
+  std::lock_guard<std::mutex> lock(data.threadMutex);
+  uint64_t result = data.dropped;
+  for (auto const &buffer : data.threads)
+    result += buffer->dropped;
+  return result;
+}
+
+//////////////////////////////////////////////////
+void ScopeProfiler::SetTracing(const bool _enabled, const size_t _maxEvents)
+{
+  ProfilerData &data = Data();
+  std::lock_guard<std::mutex> lock(data.collectMutex);
+  data.tracing = _enabled;
+  data.maxTraceEvents = _maxEvents;
+  if (_enabled)
+    data.trace.reserve(std::min(_maxEvents, size_t(1) << 20));
+}
+
+//////////////////////////////////////////////////
+bool ScopeProfiler::WriteChromeTrace(const std::string &_filename)
+{
+  std::ofstream out(_filename);
+  if (!out.is_open())
+  {
+    gzerr << "Unable to open profiler trace file [" << _filename << "]\n";
+    return false;
+  }
+
+  ProfilerData &data = Data();
+  double usPerTick = 1e6 / TicksPerSecond(data);
+
+  std::lock_guard<std::mutex> lock(data.collectMutex);
+  out << std::fixed << std::setprecision(3);
+  out << "{\"traceEvents\":[";
+  for (size_t i = 0; i < data.trace.size(); ++i)
+  {
+    const ProfileEvent &event = data.trace[i];
+
+    // Time stamps are unsigned. Clamp a scope that started before tick0,
+    // or on a core whose time stamp counter lags behind.
+    uint64_t start = event.start > data.tick0 ? event.start - data.tick0 : 0;
+    out << (i == 0 ? "\n" : ",\n")
+        << "{\"name\":\"" << EscapeJson(ScopeName(event.id))
+        << "\",\"cat\":\"gazebo\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+        << event.threadId
+        << ",\"ts\":" << start * usPerTick
+        << ",\"dur\":" << (event.end - event.start) * usPerTick << "}";
+  }
+  out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+  return out.good();
+}
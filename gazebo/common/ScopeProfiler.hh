@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_COMMON_SCOPEPROFILER_HH_
+#define GAZEBO_COMMON_SCOPEPROFILER_HH_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "gazebo/util/system.hh"
+
+/// \brief Concatenate two tokens after expanding them.
+#define GZ_PROFILE_CONCAT_IMPL(_a, _b) _a ## _b
+#define GZ_PROFILE_CONCAT(_a, _b) GZ_PROFILE_CONCAT_IMPL(_a, _b)
+
+/// \brief Profile the rest of the enclosing scope with the built-in
+/// profiler. The name is registered once per call site, so the cost of a
+/// scope is two time stamps and a write into a per-thread buffer.
+/// \param[in] _name Name of the scope, a string literal.
+#define GZ_PROFILE(_name) \
+  static const uint32_t GZ_PROFILE_CONCAT(gzProfileId, __LINE__) = \
+    gazebo::common::ScopeProfiler::RegisterScope(_name); \
+  gazebo::common::ProfileScope GZ_PROFILE_CONCAT(gzProfileScope, __LINE__)( \
+    GZ_PROFILE_CONCAT(gzProfileId, __LINE__))
+
+/// \brief Start profiling a named section of code with the built-in
+/// profiler. Every GZ_PROFILE_BEGIN must be matched by a GZ_PROFILE_END on
+/// the same thread.
+/// \param[in] _name Name of the section, a string literal.
+#define GZ_PROFILE_BEGIN(_name) \
+  do { \
+    static const uint32_t gzProfileId = \
+      gazebo::common::ScopeProfiler::RegisterScope(_name); \
+    gazebo::common::ScopeProfiler::Begin(gzProfileId); \
+  } while (false)
+
+/// \brief Stop profiling the section started by the last GZ_PROFILE_BEGIN.
+#define GZ_PROFILE_END() gazebo::common::ScopeProfiler::End()
+
+namespace gazebo
+{
+  namespace common
+  {
+    /// \addtogroup gazebo_common
+    /// \{
+
+    /// \brief Timing statistics of a profiled scope. Durations are in
+    /// seconds.
+    class GZ_COMMON_VISIBLE ProfileStats
+    {
+      /// \brief Name of the scope.
+      public: std::string name;
+
+      /// \brief Number of times the scope ran.
+      public: uint64_t count = 0;
+
+      /// \brief Total time spent in the scope.
+      public: double total = 0;
+
+      /// \brief Shortest duration.
+      public: double min = 0;
+
+      /// \brief Longest duration.
+      public: double max = 0;
+
+      /// \brief Median duration.
+      public: double p50 = 0;
+
+      /// \brief 99th percentile of the duration.
+      public: double p99 = 0;
+    };
+
+    /// \class ScopeProfiler ScopeProfiler.hh common/common.hh
+    /// \brief A lightweight profiler that is always built in.
+    ///
+    /// Every thread writes the scopes it runs into its own lock-free ring
+    /// buffer, time stamped with the CPU time stamp counter where available.
+    /// Collect() drains the buffers into one histogram per scope, from which
+    /// Stats() computes percentiles. It can also keep the individual scopes
+    /// to write a trace that can be opened in chrome://tracing.
+    ///
+    /// The profiler is enabled by default. Set the GAZEBO_PROFILER
+    /// environment variable to 0 to disable it. gzserver publishes the
+    /// statistics on ~/profiler once per second, and writes a trace to the
+    /// file named by GAZEBO_PROFILER_TRACE when it exits.
+    class GZ_COMMON_VISIBLE ScopeProfiler
+    {
+      /// \brief Get the id of a scope, registering it the first time.
+      /// \param[in] _name Name of the scope.
+      /// \return Id of the scope.
+      public: static uint32_t RegisterScope(const std::string &_name);
+
+      /// \brief Get the name of a scope.
+      /// \param[in] _id Id of the scope.
+      /// \return Name of the scope, empty if the id is unknown.
+      public: static std::string ScopeName(const uint32_t _id);
+
+      /// \brief Check whether scopes are recorded.
+      /// \return True if the profiler is enabled.
+      public: static bool Enabled();
+
+      /// \brief Enable or disable the recording of scopes.
+      /// \param[in] _enabled True to enable the profiler.
+      public: static void SetEnabled(const bool _enabled);
+
+      /// \brief Get the current time stamp.
+      /// \return Time stamp in profiler ticks.
+      public: static uint64_t Now();
+
+      /// \brief Record a scope that ran on the calling thread.
+      /// \param[in] _id Id of the scope.
+      /// \param[in] _start Time stamp at the start of the scope.
+      /// \param[in] _end Time stamp at the end of the scope.
+      public: static void Record(const uint32_t _id, const uint64_t _start,
+                  const uint64_t _end);
+
+      /// \brief Start a section on the calling thread.
+      /// \param[in] _id Id of the section scope.
+      public: static void Begin(const uint32_t _id);
+
+      /// \brief End the last section started on the calling thread.
+      public: static void End();
+
+      /// \brief Move the recorded scopes of all threads into the
+      /// histograms, and into the trace if tracing.
+      public: static void Collect();
+
+      /// \brief Get the statistics of the collected scopes.
+      /// \return Statistics of the scopes that ran since the last Reset().
+      public: static std::vector<ProfileStats> Stats();
+
+      /// \brief Clear the histograms.
+      public: static void Reset();
+
+      /// \brief Get the number of scopes that were lost because a thread
+      /// buffer was full when it was written.
+      /// \return Number of lost scopes.
+      public: static uint64_t DroppedCount();
+
+      /// \brief Keep the individual scopes for a trace.
+      /// \param[in] _enabled True to start tracing, false to stop.
+      /// \param[in] _maxEvents Maximum number of scopes to keep.
+      public: static void SetTracing(const bool _enabled,
+                  const size_t _maxEvents = 1000000);
+
+      /// \brief Write the traced scopes in the Chrome trace event format.
+      /// \param[in] _filename Path of the JSON file.
+      /// \return True if the file was written.
+      public: static bool WriteChromeTrace(const std::string &_filename);
+    };
+
+    /// \brief Records the lifetime of an object as a profiled scope. Use
+    /// through the GZ_PROFILE macro.
+    class GZ_COMMON_VISIBLE ProfileScope
+    {
+      /// \brief Constructor.
+      /// \param[in] _id Id of the scope.
+      public: explicit ProfileScope(const uint32_t _id)
+              : id(_id), start(ScopeProfiler::Enabled() ?
+                               ScopeProfiler::Now() : 0)
+              {
+              }
+
+      /// \brief Destructor.
+      public: ~ProfileScope()
+              {
+                if (this->start != 0)
+                  ScopeProfiler::Record(this->id, this->start,
+                      ScopeProfiler::Now());
+              }
+
+      /// \brief Id of the scope.
+      private: const uint32_t id;
+
+      /// \brief Time stamp at construction, 0 if disabled.
+      private: const uint64_t start;
+    };
+    /// \}
+  }
+}
+#endif
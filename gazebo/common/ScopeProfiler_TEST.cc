@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "gazebo/common/ScopeProfiler.hh"
+#include "gazebo/test/helper_profiler.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+
+class ScopeProfiler : public gazebo::testing::AutoLogFixture { };
+
+/////////////////////////////////////////////////
+void SleepScope()
+{
+  GZ_PROFILE("ScopeProfiler_TEST::Sleep");
+  std::this_thread::sleep_for(std::chrono::milliseconds(2));
+}
+
+/////////////////////////////////////////////////
+TEST_F(ScopeProfiler, RegisterScope)
+{
+  uint32_t id = common::ScopeProfiler::RegisterScope("ScopeProfiler_TEST::A");
+  EXPECT_EQ(id, common::ScopeProfiler::RegisterScope("ScopeProfiler_TEST::A"));
+  EXPECT_NE(id, common::ScopeProfiler::RegisterScope("ScopeProfiler_TEST::B"));
+  EXPECT_EQ("ScopeProfiler_TEST::A", common::ScopeProfiler::ScopeName(id));
+  EXPECT_TRUE(common::ScopeProfiler::ScopeName(1000000).empty());
+}
+
+/////////////////////////////////////////////////
+TEST_F(ScopeProfiler, Stats)
+{
+  common::ScopeProfiler::SetEnabled(true);
+  common::ScopeProfiler::Collect();
+  common::ScopeProfiler::Reset();
+
+  for (int i = 0; i < 10; ++i)
+    SleepScope();
+
+  // Scopes recorded on other threads are collected too
+  std::thread thread([]()
+      {
+        for (int i = 0; i < 5; ++i)
+        {
+          GZ_PROFILE_BEGIN("ScopeProfiler_TEST::Thread");
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+          GZ_PROFILE_END();
+        }
+      });
+  thread.join();
+
+  common::ScopeProfiler::Collect();
+
+  common::ProfileStats stats = gazebo::testing::FindProfileStats(
+      "ScopeProfiler_TEST::Sleep");
+  EXPECT_EQ(10u, stats.count);
+  EXPECT_GE(stats.min, 0.0019);
+  EXPECT_GE(stats.max, stats.p99);
+  EXPECT_GE(stats.p99, stats.p50);
+  EXPECT_GE(stats.p50, stats.min);
+  EXPECT_GE(stats.total, 10 * stats.min);
+  EXPECT_LT(stats.p50, 0.1);
+
+  stats = gazebo::testing::FindProfileStats("ScopeProfiler_TEST::Thread");
+  EXPECT_EQ(5u, stats.count);
+  EXPECT_GE(stats.min, 0.0009);
+
+  // Nothing is recorded when disabled
+  common::ScopeProfiler::Reset();
+  common::ScopeProfiler::SetEnabled(false);
+  SleepScope();
+  common::ScopeProfiler::SetEnabled(true);
+  common::ScopeProfiler::Collect();
+  EXPECT_EQ(0u, gazebo::testing::FindProfileStats(
+      "ScopeProfiler_TEST::Sleep").count);
+  EXPECT_EQ(0u, common::ScopeProfiler::DroppedCount());
+}
+
+/////////////////////////////////////////////////
+TEST_F(ScopeProfiler, ChromeTrace)
+{
+  common::ScopeProfiler::SetEnabled(true);
+  common::ScopeProfiler::Collect();
+  common::ScopeProfiler::SetTracing(true);
+
+  SleepScope();
+  SleepScope();
+  common::ScopeProfiler::Collect();
+  common::ScopeProfiler::SetTracing(false);
+
+  std::string filename = "scope_profiler_test_trace.json";
+  ASSERT_TRUE(common::ScopeProfiler::WriteChromeTrace(filename));
+
+  std::ifstream in(filename);
+  std::stringstream content;
+  content << in.rdbuf();
+  std::string json = content.str();
+
+  EXPECT_EQ(0u, json.find("{\"traceEvents\":["));
+  size_t first = json.find("\"name\":\"ScopeProfiler_TEST::Sleep\"");
+  ASSERT_NE(std::string::npos, first);
+  EXPECT_NE(std::string::npos,
+      json.find("\"name\":\"ScopeProfiler_TEST::Sleep\"", first + 1));
+  EXPECT_NE(std::string::npos, json.find("\"ph\":\"X\""));
+
+  std::remove(filename.c_str());
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -219,6 +219,12 @@ void Skeleton::AddVertNodeWeight(unsigned int _vertex, std::string _node,
   this->rawNW[_vertex].push_back(std::make_pair(_node, _weight));
 }
 
+//////////////////////////////////////////////////
+unsigned int Skeleton::NumVertAttached() const
+{
+  return this->rawNW.size();
+}
+
 //////////////////////////////////////////////////
 unsigned int Skeleton::GetNumVertNodeWeights(unsigned int _vertex)
 {
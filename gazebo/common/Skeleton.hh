@@ -127,6 +127,10 @@ namespace gazebo
       public: void AddVertNodeWeight(unsigned int _vertex, std::string _node,
                                      double _weight);
 
+      /// \brief Returns the number of vertices attached to the skeleton
+      /// \return the count, as set by SetNumVertAttached
+      public: unsigned int NumVertAttached() const;
+
       /// \brief Returns the number of bone weights for a vertex
       /// \param[in] _vertex the index of the vertex
       /// \return the count
@@ -15,6 +15,7 @@
  *
 */
 
+#include <iterator>
 #include <ignition/math/Helpers.hh>
 #include <ignition/math/Matrix4.hh>
 #include <ignition/math/Pose3.hh>
@@ -246,6 +247,18 @@ bool SkeletonAnimation::HasNode(const std::string& _node) const
   return (this->animations.find(_node) != this->animations.end());
 }
 
+//////////////////////////////////////////////////
+const NodeAnimation *SkeletonAnimation::NodeAnimationByIndex(
+    const unsigned int _i) const
+{
+  if (_i >= this->animations.size())
+    return nullptr;
+
+  auto iter = this->animations.begin();
+  std::advance(iter, _i);
+  return iter->second;
+}
+
 //////////////////////////////////////////////////
 void SkeletonAnimation::AddKeyFrame(const std::string& _node,
     const double _time, const ignition::math::Matrix4d &_mat)
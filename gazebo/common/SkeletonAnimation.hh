@@ -150,6 +150,12 @@ namespace gazebo
       /// \return true if the node exits
       public: bool HasNode(const std::string &_node) const;
 
+      /// \brief Returns the animation of a node
+      /// \param[in] _i the index of the node animation, ordered by node name
+      /// \return the node animation, or nullptr if the index is out of range
+      public: const NodeAnimation *NodeAnimationByIndex(
+                  const unsigned int _i) const;
+
       /// \brief Adds or replaces a named key frame at a specific time
       /// \param[in] _node the name of the new or existing node
       /// \param[in] _time the time
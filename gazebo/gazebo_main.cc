@@ -62,6 +62,12 @@ void help()
   << "  --iters arg                   Number of iterations to simulate.\n"
   << "  --minimal_comms               Reduce the TCP/IP traffic output by "
   <<                                  "gazebo.\n"
+  << "  --io_threads arg              Number of threads handling network IO.\n"
+  << "  --precise_pacing              Sleep and then spin until each world "
+  <<                                  "update is due.\n"
+  << "  --world_cpu arg               Pin the world thread to a CPU.\n"
+  << "  --world_priority arg          Run the world thread with a real time "
+  <<                                  "priority.\n"
   << "  -g [ --gui-plugin ] arg       Load a System plugin (deprecated)\n"
   << "  --gui-client-plugin arg       Load a GUI plugin.\n"
   << "  -s [ --server-plugin ] arg    Load a server plugin.\n"
@@ -15,6 +15,9 @@
  *
  */
 #include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <string>
 
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/message.h>
@@ -28,6 +31,7 @@
 #include "gazebo/common/Events.hh"
 #include "gazebo/common/Image.hh"
 #include "gazebo/common/SystemPaths.hh"
+#include "gazebo/common/Timer.hh"
 #include "gazebo/common/URI.hh"
 
 #include "gazebo/gui/Conversions.hh"
@@ -83,6 +87,8 @@ ModelListWidget::ModelListWidget(QWidget *_parent)
       QAbstractItemView::SelectRows);
   this->dataPtr->modelTreeWidget->setVerticalScrollMode(
       QAbstractItemView::ScrollPerPixel);
+  // lets the view lay out only the visible rows of large worlds
+  this->dataPtr->modelTreeWidget->setUniformRowHeights(true);
 
   connect(this->dataPtr->modelTreeWidget, SIGNAL(itemClicked(QTreeWidgetItem *,
       int)),
@@ -90,6 +96,9 @@ ModelListWidget::ModelListWidget(QWidget *_parent)
   connect(this->dataPtr->modelTreeWidget,
       SIGNAL(customContextMenuRequested(const QPoint &)),
       this, SLOT(OnCustomContextMenu(const QPoint &)));
+  connect(this->dataPtr->modelTreeWidget,
+      SIGNAL(itemExpanded(QTreeWidgetItem *)),
+      this, SLOT(OnItemExpanded(QTreeWidgetItem *)));
 
   this->dataPtr->variantManager = new QtVariantPropertyManager();
   this->dataPtr->propTreeBrowser = new QtTreePropertyBrowser();
@@ -307,34 +316,48 @@ void ModelListWidget::OnSetSelectedEntity(const std::string &_name,
 /////////////////////////////////////////////////
 void ModelListWidget::Update()
 {
-  if (!this->dataPtr->fillTypes.empty())
+  // Refresh the property tree at most every 250 ms
+  const common::Time refreshPeriod(0, 250000000);
+  const common::Time now = common::Time::GetWallTime();
+
+  bool busy = false;
+  if (!this->dataPtr->fillTypes.empty() &&
+      now - this->dataPtr->lastFillTime < refreshPeriod)
+  {
+    busy = true;
+  }
+  else if (!this->dataPtr->fillTypes.empty())
   {
     std::lock_guard<std::mutex> lock(*this->dataPtr->propMutex);
     this->dataPtr->fillingPropertyTree = true;
     this->dataPtr->propTreeBrowser->clear();
 
-    if (this->dataPtr->fillTypes[0] == "Model")
+    // Each fill clears the tree, so only the latest response is shown
+    const std::string fillType = this->dataPtr->fillTypes.back();
+    this->dataPtr->fillTypes.clear();
+    this->dataPtr->lastFillTime = now;
+
+    if (fillType == "Model")
       this->FillPropertyTree(this->dataPtr->modelMsg, nullptr);
-    else if (this->dataPtr->fillTypes[0] == "Link")
+    else if (fillType == "Link")
       this->FillPropertyTree(this->dataPtr->linkMsg, nullptr);
-    else if (this->dataPtr->fillTypes[0] == "Joint")
+    else if (fillType == "Joint")
       this->FillPropertyTree(this->dataPtr->jointMsg, nullptr);
-    else if (this->dataPtr->fillTypes[0] == "Plugin")
+    else if (fillType == "Plugin")
       this->FillPropertyTree(this->dataPtr->pluginMsg, nullptr);
-    else if (this->dataPtr->fillTypes[0] == "Scene")
+    else if (fillType == "Scene")
       this->FillPropertyTree(this->dataPtr->sceneMsg, nullptr);
-    else if (this->dataPtr->fillTypes[0] == "Physics")
+    else if (fillType == "Physics")
       this->FillPropertyTree(this->dataPtr->physicsMsg, nullptr);
-    else if (this->dataPtr->fillTypes[0] == "Atmosphere")
+    else if (fillType == "Atmosphere")
       this->FillPropertyTree(this->dataPtr->atmosphereMsg, nullptr);
-    else if (this->dataPtr->fillTypes[0] == "Wind")
+    else if (fillType == "Wind")
       this->FillPropertyTree(this->dataPtr->windMsg, nullptr);
-    else if (this->dataPtr->fillTypes[0] == "Light")
+    else if (fillType == "Light")
       this->FillPropertyTree(this->dataPtr->lightMsg, nullptr);
-    else if (this->dataPtr->fillTypes[0] == "Spherical Coordinates")
+    else if (fillType == "Spherical Coordinates")
       this->FillPropertyTree(this->dataPtr->sphericalCoordMsg, nullptr);
     this->dataPtr->fillingPropertyTree = false;
-    this->dataPtr->fillTypes.pop_front();
   }
 
   if (!this->dataPtr->modelTreeWidget->currentItem())
@@ -346,16 +369,45 @@ void ModelListWidget::Update()
   this->ProcessRemoveEntity();
   this->ProcessModelMsgs();
   this->ProcessLightMsgs();
-  QTimer::singleShot(1000, this, SLOT(Update()));
+
+  // Come back sooner while model messages are left
+  {
+    std::lock_guard<std::mutex> lock(*this->dataPtr->receiveMutex);
+    busy = busy || !this->dataPtr->modelMsgs.empty();
+  }
+  QTimer::singleShot(busy ? 50 : 1000, this, SLOT(Update()));
 }
 
 /////////////////////////////////////////////////
 void ModelListWidget::OnModelUpdate(const msgs::Model &_msg)
 {
   std::lock_guard<std::mutex> lock(*this->dataPtr->receiveMutex);
+
+  // Only one message of a model is queued. The queued message may be the
+  // one that creates the item, while later messages, such as pose or scale
+  // updates, only carry part of the model. Those only refresh the name of
+  // an existing item, so the queued message is kept unless the model is
+  // deleted.
+  if (_msg.has_id())
+  {
+    auto iter = this->dataPtr->modelMsgIds.find(_msg.id());
+    if (iter != this->dataPtr->modelMsgIds.end())
+    {
+      if (_msg.has_deleted() && _msg.deleted())
+        iter->second->CopyFrom(_msg);
+      return;
+    }
+  }
+
   msgs::Model msg;
   msg.CopyFrom(_msg);
   this->dataPtr->modelMsgs.push_back(msg);
+
+  if (_msg.has_id())
+  {
+    this->dataPtr->modelMsgIds[_msg.id()] =
+        std::prev(this->dataPtr->modelMsgs.end());
+  }
 }
 
 /////////////////////////////////////////////////
@@ -370,139 +422,209 @@ void ModelListWidget::OnLightUpdate(const msgs::Light &_msg)
 /////////////////////////////////////////////////
 void ModelListWidget::ProcessModelMsgs()
 {
-  std::lock_guard<std::mutex> lock(*this->dataPtr->receiveMutex);
-  QFont subheaderFont;
-  subheaderFont.setBold(true);
+  // Stop once the time budget of an update is spent, so a large world
+  // doesn't freeze the GUI. The rest is processed on the next updates.
+  const common::Time maxTime(0, 20000000);
+  common::Timer timer;
+  timer.Start();
 
-  for (auto iter = this->dataPtr->modelMsgs.begin();
-       iter != this->dataPtr->modelMsgs.end(); ++iter)
+  QList<QTreeWidgetItem *> newItems;
+  while (timer.GetElapsed() < maxTime)
   {
-    std::string name = (*iter).name();
+    msgs::Model msg;
+    {
+      std::lock_guard<std::mutex> lock(*this->dataPtr->receiveMutex);
+      if (this->dataPtr->modelMsgs.empty())
+        break;
 
-    QTreeWidgetItem *listItem = this->ListItem((*iter).name(),
-                                                  this->dataPtr->modelsItem);
+      msg.Swap(&this->dataPtr->modelMsgs.front());
+      this->dataPtr->modelMsgs.pop_front();
+      if (msg.has_id())
+        this->dataPtr->modelMsgIds.erase(msg.id());
+    }
 
-    if (!listItem)
+    this->ProcessModelMsg(msg, newItems);
+  }
+
+  // Insert the new items at once, instead of one row at a time
+  if (!newItems.empty())
+    this->dataPtr->modelsItem->addChildren(newItems);
+}
+
+/////////////////////////////////////////////////
+void ModelListWidget::ProcessModelMsg(const msgs::Model &_msg,
+    QList<QTreeWidgetItem *> &_newItems)
+{
+  const std::string &name = _msg.name();
+
+  QTreeWidgetItem *listItem = this->ListItem(name, this->dataPtr->modelsItem);
+
+  if (!listItem)
+  {
+    if (!_msg.has_deleted() || !_msg.deleted())
     {
-      if (!(*iter).has_deleted() || !(*iter).deleted())
+      // Create an item for the model name
+      QTreeWidgetItem *topItem = new QTreeWidgetItem(
+          QStringList(QString("%1").arg(QString::fromStdString(name))));
+
+      topItem->setData(0, Qt::UserRole, QVariant(name.c_str()));
+      this->dataPtr->modelItems[name] = topItem;
+      _newItems.append(topItem);
+
+      // The children are added when the item is expanded
+      ModelListChildren children;
+      children.modelId = _msg.id();
+      for (int i = 0; i < _msg.link_size(); ++i)
+        children.links.push_back(_msg.link(i).name());
+      for (int i = 0; i < _msg.joint_size(); ++i)
+        children.joints.push_back(_msg.joint(i).name());
+      for (int i = 0; i < _msg.plugin_size(); ++i)
+        children.plugins.push_back(_msg.plugin(i).name());
+
+      if (!children.links.empty() || !children.joints.empty() ||
+          !children.plugins.empty())
       {
-        // Create an item for the model name
-        QTreeWidgetItem *topItem = new QTreeWidgetItem(
-            this->dataPtr->modelsItem,
-            QStringList(QString("%1").arg(QString::fromStdString(name))));
+        topItem->setChildIndicatorPolicy(QTreeWidgetItem::ShowIndicator);
+        this->dataPtr->unloadedChildren[topItem] = children;
+      }
+    }
+  }
+  else
+  {
+    if (_msg.has_deleted() && _msg.deleted())
+    {
+      this->UnindexListItem(listItem);
+      if (listItem->parent())
+        listItem->parent()->removeChild(listItem);
+      else
+        _newItems.removeOne(listItem);
+      delete listItem;
+    }
+    else
+    {
+      listItem->setText(0, name.c_str());
+      listItem->setData(1, Qt::UserRole, QVariant(name.c_str()));
+    }
+  }
+}
 
-        topItem->setData(0, Qt::UserRole, QVariant((*iter).name().c_str()));
-        this->dataPtr->modelTreeWidget->addTopLevelItem(topItem);
+/////////////////////////////////////////////////
+void ModelListWidget::OnItemExpanded(QTreeWidgetItem *_item)
+{
+  this->LoadChildren(_item);
+}
 
-        if ((*iter).link_size() > 0)
-        {
-          // Create subheader for links
-          QTreeWidgetItem *linkHeaderItem = new QTreeWidgetItem(topItem,
-          QStringList(QString("%1").arg(QString::fromStdString("LINKS"))));
-          linkHeaderItem->setFont(0, subheaderFont);
-          linkHeaderItem->setFlags(Qt::NoItemFlags);
-          this->dataPtr->modelTreeWidget->addTopLevelItem(linkHeaderItem);
-        }
+/////////////////////////////////////////////////
+void ModelListWidget::LoadChildren(QTreeWidgetItem *_item)
+{
+  auto iter = this->dataPtr->unloadedChildren.find(_item);
+  if (iter == this->dataPtr->unloadedChildren.end())
+    return;
 
-        for (int i = 0; i < (*iter).link_size(); ++i)
-        {
-          std::string linkName = (*iter).link(i).name();
-
-          // get unscoped name by stripping parent
-          int index = linkName.find(name) + name.length() + 2;
-          std::string linkNameShort = linkName.substr(index,
-                                                      linkName.size() - index);
-
-          QTreeWidgetItem *linkItem = new QTreeWidgetItem(topItem,
-              QStringList(QString("%1").arg(
-                  QString::fromStdString(linkNameShort))));
-
-          linkItem->setData(0, Qt::UserRole, QVariant(linkName.c_str()));
-          linkItem->setData(1, Qt::UserRole, QVariant((*iter).name().c_str()));
-          linkItem->setData(2, Qt::UserRole, QVariant((*iter).id()));
-          linkItem->setData(3, Qt::UserRole, QVariant("Link"));
-          this->dataPtr->modelTreeWidget->addTopLevelItem(linkItem);
-        }
+  const ModelListChildren children = iter->second;
+  this->dataPtr->unloadedChildren.erase(iter);
+  _item->setChildIndicatorPolicy(
+      QTreeWidgetItem::DontShowIndicatorWhenChildless);
 
-        if ((*iter).joint_size() > 0)
-        {
-          // Create subheader for joints
-          QTreeWidgetItem *jointHeaderItem = new QTreeWidgetItem(topItem,
-          QStringList(QString("%1").arg(QString::fromStdString("JOINTS"))));
-          jointHeaderItem->setFont(0, subheaderFont);
-          jointHeaderItem->setFlags(Qt::NoItemFlags);
-          this->dataPtr->modelTreeWidget->addTopLevelItem(jointHeaderItem);
-        }
+  const std::string name =
+      _item->data(0, Qt::UserRole).toString().toStdString();
 
-        for (int i = 0; i < (*iter).joint_size(); ++i)
-        {
-          std::string jointName = (*iter).joint(i).name();
+  QFont subheaderFont;
+  subheaderFont.setBold(true);
 
-          // get unscoped name by stripping parent
-          int index = jointName.find(name) + name.length() + 2;
-          std::string jointNameShort = jointName.substr(
-              index, jointName.size() - index);
+  QList<QTreeWidgetItem *> items;
 
-          QTreeWidgetItem *jointItem = new QTreeWidgetItem(topItem,
-              QStringList(QString("%1").arg(
-                  QString::fromStdString(jointNameShort))));
+  if (!children.links.empty())
+  {
+    // Create subheader for links
+    QTreeWidgetItem *linkHeaderItem = new QTreeWidgetItem(
+        QStringList(QString("%1").arg(QString::fromStdString("LINKS"))));
+    linkHeaderItem->setFont(0, subheaderFont);
+    linkHeaderItem->setFlags(Qt::NoItemFlags);
+    items.append(linkHeaderItem);
+  }
 
-          jointItem->setData(0, Qt::UserRole, QVariant(jointName.c_str()));
-          jointItem->setData(3, Qt::UserRole, QVariant("Joint"));
-          this->dataPtr->modelTreeWidget->addTopLevelItem(jointItem);
-        }
+  for (const auto &linkName : children.links)
+  {
+    // get unscoped name by stripping parent
+    int index = linkName.find(name) + name.length() + 2;
+    std::string linkNameShort = linkName.substr(index,
+                                                linkName.size() - index);
 
-        if ((*iter).plugin_size() > 0)
-        {
-          // Create subheader for plugins
-          QTreeWidgetItem *pluginHeaderItem = new QTreeWidgetItem(topItem,
-          QStringList(QString("%1").arg("PLUGINS")));
-          pluginHeaderItem->setFont(0, subheaderFont);
-          pluginHeaderItem->setFlags(Qt::NoItemFlags);
-          this->dataPtr->modelTreeWidget->addTopLevelItem(pluginHeaderItem);
-        }
+    QTreeWidgetItem *linkItem = new QTreeWidgetItem(
+        QStringList(QString("%1").arg(
+            QString::fromStdString(linkNameShort))));
 
-        for (int i = 0; i < (*iter).plugin_size(); ++i)
-        {
-          std::string pluginName = (*iter).plugin(i).name();
+    linkItem->setData(0, Qt::UserRole, QVariant(linkName.c_str()));
+    linkItem->setData(1, Qt::UserRole, QVariant(name.c_str()));
+    linkItem->setData(2, Qt::UserRole, QVariant(children.modelId));
+    linkItem->setData(3, Qt::UserRole, QVariant("Link"));
+    this->dataPtr->modelItems[linkName] = linkItem;
+    items.append(linkItem);
+  }
 
-          QTreeWidgetItem *pluginItem = new QTreeWidgetItem(topItem,
-              QStringList(QString("%1").arg(
-                  QString::fromStdString(pluginName))));
+  if (!children.joints.empty())
+  {
+    // Create subheader for joints
+    QTreeWidgetItem *jointHeaderItem = new QTreeWidgetItem(
+        QStringList(QString("%1").arg(QString::fromStdString("JOINTS"))));
+    jointHeaderItem->setFont(0, subheaderFont);
+    jointHeaderItem->setFlags(Qt::NoItemFlags);
+    items.append(jointHeaderItem);
+  }
 
-          common::URI pluginUri;
-          pluginUri.SetScheme("data");
+  for (const auto &jointName : children.joints)
+  {
+    // get unscoped name by stripping parent
+    int index = jointName.find(name) + name.length() + 2;
+    std::string jointNameShort = jointName.substr(
+        index, jointName.size() - index);
 
-          pluginUri.Path().PushBack("world");
-          pluginUri.Path().PushBack(gui::get_world());
-          pluginUri.Path().PushBack("model");
-          pluginUri.Path().PushBack((*iter).name());
-          pluginUri.Path().PushBack("plugin");
-          pluginUri.Path().PushBack(pluginName);
+    QTreeWidgetItem *jointItem = new QTreeWidgetItem(
+        QStringList(QString("%1").arg(
+            QString::fromStdString(jointNameShort))));
 
-          pluginItem->setData(0, Qt::UserRole,
-              QVariant(pluginUri.Str().c_str()));
-          pluginItem->setData(3, Qt::UserRole, QVariant("Plugin"));
+    jointItem->setData(0, Qt::UserRole, QVariant(jointName.c_str()));
+    jointItem->setData(3, Qt::UserRole, QVariant("Joint"));
+    this->dataPtr->modelItems[jointName] = jointItem;
+    items.append(jointItem);
+  }
 
-          this->dataPtr->modelTreeWidget->addTopLevelItem(pluginItem);
-        }
-      }
-    }
-    else
-    {
-      if ((*iter).has_deleted() && (*iter).deleted())
-      {
-        int i = this->dataPtr->modelsItem->indexOfChild(listItem);
-        this->dataPtr->modelsItem->takeChild(i);
-      }
-      else
-      {
-        listItem->setText(0, (*iter).name().c_str());
-        listItem->setData(1, Qt::UserRole, QVariant((*iter).name().c_str()));
-      }
-    }
+  if (!children.plugins.empty())
+  {
+    // Create subheader for plugins
+    QTreeWidgetItem *pluginHeaderItem = new QTreeWidgetItem(
+        QStringList(QString("%1").arg("PLUGINS")));
+    pluginHeaderItem->setFont(0, subheaderFont);
+    pluginHeaderItem->setFlags(Qt::NoItemFlags);
+    items.append(pluginHeaderItem);
+  }
+
+  for (const auto &pluginName : children.plugins)
+  {
+    QTreeWidgetItem *pluginItem = new QTreeWidgetItem(
+        QStringList(QString("%1").arg(
+            QString::fromStdString(pluginName))));
+
+    common::URI pluginUri;
+    pluginUri.SetScheme("data");
+
+    pluginUri.Path().PushBack("world");
+    pluginUri.Path().PushBack(gui::get_world());
+    pluginUri.Path().PushBack("model");
+    pluginUri.Path().PushBack(name);
+    pluginUri.Path().PushBack("plugin");
+    pluginUri.Path().PushBack(pluginName);
+
+    pluginItem->setData(0, Qt::UserRole,
+        QVariant(pluginUri.Str().c_str()));
+    pluginItem->setData(3, Qt::UserRole, QVariant("Plugin"));
+
+    this->dataPtr->modelItems[pluginUri.Str()] = pluginItem;
+    items.append(pluginItem);
   }
-  this->dataPtr->modelMsgs.clear();
+
+  _item->addChildren(items);
 }
 
 /////////////////////////////////////////////////
@@ -592,6 +714,7 @@ void ModelListWidget::OnResponse(ConstResponsePtr &_msg)
   {
     if (_msg->response() == "nonexistent")
     {
+      std::lock_guard<std::mutex> lock(*this->dataPtr->receiveMutex);
       this->dataPtr->removeEntityList.push_back(
         this->dataPtr->selectedEntityName);
     }
@@ -613,7 +736,12 @@ void ModelListWidget::RemoveEntity(const std::string &_name)
     QTreeWidgetItem *listItem = this->ListItem(_name, items[i]);
     if (listItem)
     {
-      items[i]->takeChild(items[i]->indexOfChild(listItem));
+      int index = items[i]->indexOfChild(listItem);
+      if (index >= 0)
+      {
+        this->UnindexListItem(listItem);
+        delete items[i]->takeChild(index);
+      }
       this->dataPtr->propTreeBrowser->clear();
       this->dataPtr->selectedEntityName.clear();
       this->dataPtr->sdfElement.reset();
@@ -627,33 +755,50 @@ void ModelListWidget::RemoveEntity(const std::string &_name)
 QTreeWidgetItem *ModelListWidget::ListItem(const std::string &_name,
                                               QTreeWidgetItem *_parent)
 {
-  QTreeWidgetItem *listItem = nullptr;
+  auto &items = _parent == this->dataPtr->lightsItem ?
+      this->dataPtr->lightItems : this->dataPtr->modelItems;
+
+  auto iter = items.find(_name);
+  if (iter != items.end())
+    return iter->second;
 
-  // Find an existing element with the name from the message
-  for (int i = 0; i < _parent->childCount() && !listItem; ++i)
+  if (_parent != this->dataPtr->modelsItem)
+    return nullptr;
+
+  // The entity may be in a model whose children were not added yet.
+  // Add the children of the models along its scoped name.
+  for (size_t pos = _name.find("::"); pos != std::string::npos;
+       pos = _name.find("::", pos + 2))
   {
-    QTreeWidgetItem *item = _parent->child(i);
-    std::string listData = item->data(0, Qt::UserRole).toString().toStdString();
+    auto modelIter = items.find(_name.substr(0, pos));
+    if (modelIter == items.end())
+      continue;
 
-    if (listData == _name)
-    {
-      listItem = item;
-      break;
-    }
+    this->LoadChildren(modelIter->second);
+    iter = items.find(_name);
+    if (iter != items.end())
+      return iter->second;
+  }
 
-    for (int j = 0; j < item->childCount(); j++)
-    {
-      QTreeWidgetItem *childItem = item->child(j);
-      listData = childItem->data(0, Qt::UserRole).toString().toStdString();
-      if (listData == _name)
-      {
-        listItem = childItem;
-        break;
-      }
-    }
+  return nullptr;
+}
+
+/////////////////////////////////////////////////
+void ModelListWidget::UnindexListItem(QTreeWidgetItem *_item)
+{
+  const std::string name =
+      _item->data(0, Qt::UserRole).toString().toStdString();
+
+  for (auto items : {&this->dataPtr->modelItems, &this->dataPtr->lightItems})
+  {
+    auto iter = items->find(name);
+    if (iter != items->end() && iter->second == _item)
+      items->erase(iter);
   }
+  this->dataPtr->unloadedChildren.erase(_item);
 
-  return listItem;
+  for (int i = 0; i < _item->childCount(); ++i)
+    this->UnindexListItem(_item->child(i));
 }
 
 /////////////////////////////////////////////////
@@ -2804,19 +2949,42 @@ void ModelListWidget::OnRequest(ConstRequestPtr &_msg)
 {
   if (_msg->request() == "entity_delete")
   {
+    std::lock_guard<std::mutex> lock(*this->dataPtr->receiveMutex);
     this->dataPtr->removeEntityList.push_back(_msg->data());
+
+    // Drop the messages queued before the delete. Removals are applied
+    // before the queued messages, so these would add the entity back.
+    for (auto iter = this->dataPtr->modelMsgs.begin();
+         iter != this->dataPtr->modelMsgs.end();)
+    {
+      if (iter->name() == _msg->data())
+      {
+        if (iter->has_id())
+          this->dataPtr->modelMsgIds.erase(iter->id());
+        iter = this->dataPtr->modelMsgs.erase(iter);
+      }
+      else
+        ++iter;
+    }
+
+    this->dataPtr->lightMsgs.remove_if([&_msg](const msgs::Light &_light)
+        {
+          return _light.name() == _msg->data();
+        });
   }
 }
 
 /////////////////////////////////////////////////
 void ModelListWidget::ProcessRemoveEntity()
 {
-  for (auto iter = this->dataPtr->removeEntityList.begin();
-       iter != this->dataPtr->removeEntityList.end(); ++iter)
+  std::list<std::string> removeEntityList;
   {
-    this->RemoveEntity(*iter);
+    std::lock_guard<std::mutex> lock(*this->dataPtr->receiveMutex);
+    removeEntityList.swap(this->dataPtr->removeEntityList);
   }
-  this->dataPtr->removeEntityList.clear();
+
+  for (auto const &name : removeEntityList)
+    this->RemoveEntity(name);
 }
 
 /////////////////////////////////////////////////
@@ -2904,6 +3072,9 @@ void ModelListWidget::InitTransport(const std::string &_name)
 void ModelListWidget::ResetTree()
 {
   this->dataPtr->modelTreeWidget->clear();
+  this->dataPtr->modelItems.clear();
+  this->dataPtr->lightItems.clear();
+  this->dataPtr->unloadedChildren.clear();
 
   // Create the top level of items in the tree widget
   {
@@ -3400,6 +3571,7 @@ void ModelListWidget::ProcessLightMsgs()
 
       item->setData(0, Qt::UserRole, QVariant((*iter).name().c_str()));
       this->dataPtr->modelTreeWidget->addTopLevelItem(item);
+      this->dataPtr->lightItems[name] = item;
     }
     else
     {
@@ -49,6 +49,10 @@ namespace gazebo
       private slots: void OnPropertyChanged(QtProperty *_item);
       private slots: void OnCustomContextMenu(const QPoint &_pt);
       private slots: void OnCurrentPropertyChanged(QtBrowserItem *_item);
+
+      /// \brief Add the children of a model item when it is expanded.
+      /// \param[in] _item The expanded item.
+      private slots: void OnItemExpanded(QTreeWidgetItem *_item);
       private: void OnSetSelectedEntity(const std::string &_name,
                                         const std::string &_mode);
       private: void OnResponse(ConstResponsePtr &_msg);
@@ -115,6 +119,15 @@ namespace gazebo
       private: QTreeWidgetItem *ListItem(const std::string &_name,
                                          QTreeWidgetItem *_parent);
 
+      /// \brief Add the links, joints and plugins of a model item to the
+      /// tree, if they were not added yet.
+      /// \param[in] _item The model item.
+      private: void LoadChildren(QTreeWidgetItem *_item);
+
+      /// \brief Remove an item and its children from the name indices.
+      /// \param[in] _item The item to remove.
+      private: void UnindexListItem(QTreeWidgetItem *_item);
+
       private: void FillPropertyTree(const msgs::Model &_msg,
                                      QtProperty *_parent);
 
@@ -188,6 +201,13 @@ namespace gazebo
       private: void AddProperty(QtProperty *_item, QtProperty *_parent);
 
       private: void ProcessModelMsgs();
+
+      /// \brief Add, update or remove the item of a model.
+      /// \param[in] _msg The model message.
+      /// \param[in,out] _newItems New model items, which are added to the
+      /// tree together once all the messages of an update are processed.
+      private: void ProcessModelMsg(const msgs::Model &_msg,
+                                    QList<QTreeWidgetItem *> &_newItems);
       private: void ProcessLightMsgs();
       private: void ProcessRemoveEntity();
 
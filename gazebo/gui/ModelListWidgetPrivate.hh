@@ -19,12 +19,14 @@
 
 #include <string>
 #include <list>
+#include <unordered_map>
 #include <vector>
 #include <deque>
 #include <sdf/sdf.hh>
 #include <ignition/msgs/plugin.pb.h>
 #include <ignition/transport/Node.hh>
 
+#include "gazebo/common/Time.hh"
 #include "gazebo/gui/qt.h"
 #include "gazebo/msgs/msgs.hh"
 #include "gazebo/transport/TransportTypes.hh"
@@ -37,6 +39,23 @@ namespace gazebo
 {
   namespace gui
   {
+    /// \brief Children of a model in the model tree. They are added to the
+    /// tree when the model item is first expanded.
+    class ModelListChildren
+    {
+      /// \brief Id of the model.
+      public: uint32_t modelId = 0;
+
+      /// \brief Scoped names of the links.
+      public: std::vector<std::string> links;
+
+      /// \brief Scoped names of the joints.
+      public: std::vector<std::string> joints;
+
+      /// \brief Names of the plugins.
+      public: std::vector<std::string> plugins;
+    };
+
     class ModelListWidgetPrivate
     {
       public: QTreeWidget *modelTreeWidget;
@@ -96,6 +115,23 @@ namespace gazebo
       typedef std::list<msgs::Model> ModelMsgs_L;
       public: ModelMsgs_L modelMsgs;
 
+      /// \brief Pending message of each model id. Updates of a model that
+      /// arrive before its message is processed replace the message.
+      public: std::unordered_map<uint32_t, ModelMsgs_L::iterator> modelMsgIds;
+
+      /// \brief Items under the models item, by entity name.
+      public: std::unordered_map<std::string, QTreeWidgetItem *> modelItems;
+
+      /// \brief Items under the lights item, by light name.
+      public: std::unordered_map<std::string, QTreeWidgetItem *> lightItems;
+
+      /// \brief Children of the model items that were not expanded yet.
+      public: std::unordered_map<QTreeWidgetItem *, ModelListChildren>
+          unloadedChildren;
+
+      /// \brief Wall time the property tree was last filled.
+      public: common::Time lastFillTime;
+
       typedef std::list<msgs::Light> LightMsgs_L;
       public: LightMsgs_L lightMsgs;
 
@@ -377,6 +377,112 @@ void ModelListWidget_TEST::ModelsTree()
   modelListWidget = nullptr;
 }
 
+/////////////////////////////////////////////////
+void ModelListWidget_TEST::PartialModelUpdate()
+{
+  this->Load("worlds/empty.world");
+
+  gazebo::gui::ModelListWidget *modelListWidget
+      = new gazebo::gui::ModelListWidget;
+  QCoreApplication::processEvents();
+
+  QTreeWidget *modelTreeWidget = modelListWidget->findChild<QTreeWidget *>(
+      "modelTreeWidget");
+  QVERIFY(modelTreeWidget != nullptr);
+  QList<QTreeWidgetItem *> treeModelItems =
+      modelTreeWidget->findItems(tr("Models"), Qt::MatchExactly);
+  QCOMPARE(treeModelItems.size(), 1);
+  QTreeWidgetItem *modelsItem = treeModelItems.front();
+  QVERIFY(modelsItem != nullptr);
+
+  // The message that creates the model, with a link, a joint and a plugin
+  gazebo::msgs::Model fullMsg;
+  fullMsg.set_name("partial_model");
+  fullMsg.set_id(424242);
+  auto linkMsg = fullMsg.add_link();
+  linkMsg->set_name("partial_model::link");
+  linkMsg->set_id(424243);
+  auto jointMsg = fullMsg.add_joint();
+  jointMsg->set_name("partial_model::joint");
+  jointMsg->set_parent("world");
+  jointMsg->set_child("partial_model::link");
+  auto pluginMsg = fullMsg.add_plugin();
+  pluginMsg->set_name("plugin");
+  pluginMsg->set_filename("libplugin.so");
+  pluginMsg->set_innerxml("");
+
+  // A later update, like the one sent when the model is modified, that
+  // only carries part of the model
+  gazebo::msgs::Model partialMsg;
+  partialMsg.set_name("partial_model");
+  partialMsg.set_id(424242);
+  gazebo::msgs::Set(partialMsg.mutable_pose(),
+      ignition::math::Pose3d(1, 2, 3, 0, 0, 0));
+
+  // Both arrive before the widget processes them
+  gazebo::gui::Events::modelUpdate(fullMsg);
+  gazebo::gui::Events::modelUpdate(partialMsg);
+
+  QTreeWidgetItem *modelItem = nullptr;
+  int sleep = 0;
+  int maxSleep = 10;
+  while (!modelItem && sleep < maxSleep)
+  {
+    QCoreApplication::processEvents();
+    QTest::qWait(500);
+    for (int i = 0; i < modelsItem->childCount(); ++i)
+    {
+      if (modelsItem->child(i)->text(0) == "partial_model")
+        modelItem = modelsItem->child(i);
+    }
+    sleep++;
+  }
+  QVERIFY(modelItem != nullptr);
+
+  // The children of the creation message are still there
+  modelTreeWidget->expandItem(modelItem);
+  QCoreApplication::processEvents();
+  bool hasLink = false;
+  bool hasJoint = false;
+  bool hasPlugin = false;
+  for (int i = 0; i < modelItem->childCount(); ++i)
+  {
+    QString text = modelItem->child(i)->text(0);
+    hasLink = hasLink || text == "link";
+    hasJoint = hasJoint || text == "joint";
+    hasPlugin = hasPlugin || text == "plugin";
+  }
+  QVERIFY(hasLink);
+  QVERIFY(hasJoint);
+  QVERIFY(hasPlugin);
+
+  // A deletion still replaces a queued message
+  gazebo::msgs::Model otherMsg;
+  otherMsg.CopyFrom(fullMsg);
+  otherMsg.set_name("deleted_model");
+  otherMsg.set_id(434343);
+  gazebo::msgs::Model deletedMsg;
+  deletedMsg.set_name("deleted_model");
+  deletedMsg.set_id(434343);
+  deletedMsg.set_deleted(true);
+  gazebo::gui::Events::modelUpdate(otherMsg);
+  gazebo::gui::Events::modelUpdate(deletedMsg);
+
+  sleep = 0;
+  maxSleep = 3;
+  while (sleep < maxSleep)
+  {
+    QCoreApplication::processEvents();
+    QTest::qWait(500);
+    sleep++;
+  }
+  for (int i = 0; i < modelsItem->childCount(); ++i)
+    QVERIFY(modelsItem->child(i)->text(0) != "deleted_model");
+
+  delete modelListWidget;
+  modelListWidget = nullptr;
+}
+
 /////////////////////////////////////////////////
 void ModelListWidget_TEST::ModelProperties()
 {
@@ -103,6 +103,10 @@ class ModelListWidget_TEST : public QTestFixture
   /// \brief Test that the model widget item contains all models in the world.
   private slots: void ModelsTree();
 
+  /// \brief Test that a partial model message received right after the
+  /// message that creates the model doesn't drop the children of its item.
+  private slots: void PartialModelUpdate();
+
   /// \brief Test that the property browser displays correct model properties.
   /// The test then modifies the properties, refresh the property browser, and
   /// verify the changes are set.
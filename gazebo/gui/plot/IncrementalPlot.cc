@@ -363,8 +363,15 @@ void IncrementalPlot::Update()
     ignition::math::Vector2d minPt = curve.second->Min();
     ignition::math::Vector2d maxPt = curve.second->Max();
 
-    this->dataPtr->directPainter->drawSeries(curve.second->Curve(),
-      pointCount - 1, pointCount - 1);
+    // the curve draws decimated points, so the last drawn point is not
+    // the last sample when zoomed out
+    curve.second->SetPixelWidth(this->canvas()->width());
+    int drawnCount = static_cast<int>(curve.second->DrawnSize());
+    if (drawnCount > 0)
+    {
+      this->dataPtr->directPainter->drawSeries(curve.second->Curve(),
+        drawnCount - 1, drawnCount - 1);
+    }
   }
 
   // get x axis lower and upper bounds
@@ -14,7 +14,11 @@
  * limitations under the License.
  *
 */
+#include <algorithm>
+#include <cmath>
+#include <deque>
 #include <map>
+#include <vector>
 #include <ignition/math/Color.hh>
 
 #include "gazebo/common/Assert.hh"
@@ -24,11 +28,6 @@
 #include "gazebo/gui/plot/IncrementalPlot.hh"
 #include "gazebo/gui/plot/PlotCurve.hh"
 
-// member variables in qwt_series_data were renamed in 6.2.0
-#if QWT_VERSION < 0x060200
-#define QWT_VERSION_LT_620
-#endif
-
 using namespace gazebo;
 using namespace gui;
 
@@ -50,136 +49,433 @@ namespace gazebo
           Colors[ColorGroupCount][ColorCount];
     };
 
-    /// \brief A class that manages curve data
-    class CurveData: public QwtArraySeriesData<QPointF>
+    /// \brief Lowest and highest sample of a range of curve samples.
+    class CurveBucket
     {
-      public: CurveData()
-              {}
+      /// \brief Merge a range of samples into the bucket.
+      /// \param[in] _min Sample with the lowest y value of the range.
+      /// \param[in] _max Sample with the highest y value of the range.
+      public: void Add(const QPointF &_min, const QPointF &_max)
+              {
+                if (this->count == 0u || _min.y() < this->min.y())
+                  this->min = _min;
+                if (this->count == 0u || _max.y() > this->max.y())
+                  this->max = _max;
+                this->count++;
+              }
 
-      private: inline const QRectF& BoundingRect() const
-               {
-#ifdef QWT_VERSION_LT_620
-                 return this->d_boundingRect;
-#else
-                 return this->cachedBoundingRect;
-#endif
-               }
+      /// \brief Sample with the lowest y value.
+      public: QPointF min;
 
-      private: inline QRectF& BoundingRect()
-               {
-#ifdef QWT_VERSION_LT_620
-                 return this->d_boundingRect;
-#else
-                 return this->cachedBoundingRect;
-#endif
-               }
+      /// \brief Sample with the highest y value.
+      public: QPointF max;
 
-      private: inline const QVector<QPointF>& SamplesRef() const
-               {
-#ifdef QWT_VERSION_LT_620
-                 return this->d_samples;
-#else
-                 return this->m_samples;
-#endif
-               }
+      /// \brief Number of samples or buckets merged into this bucket.
+      public: unsigned int count = 0u;
+    };
 
-      private: inline QVector<QPointF>& SamplesRef()
-               {
-#ifdef QWT_VERSION_LT_620
-                 return this->d_samples;
-#else
-                 return this->m_samples;
-#endif
-               }
+    /// \brief One level of the min / max pyramid of a curve.
+    class CurveLevel
+    {
+      /// \brief Complete buckets, oldest first.
+      public: std::deque<CurveBucket> buckets;
+
+      /// \brief Index of the first bucket since the curve was cleared.
+      public: uint64_t firstBucket = 0u;
+
+      /// \brief Bucket that is still being filled.
+      public: CurveBucket open;
+    };
+
+    /// \brief A class that manages curve data.
+    /// Samples are kept at full resolution for a duration of history. Each
+    /// sample is also merged into a pyramid of min / max buckets, so a
+    /// zoomed out plot draws a number of points that depends on its width in
+    /// pixels, and not on the number of samples in view.
+    class CurveData: public QwtSeriesData<QPointF>
+    {
+      /// \brief Number of samples in a bucket of the first level, and
+      /// number of buckets of a level in a bucket of the next.
+      public: static const unsigned int BucketFactor = 8u;
+
+      /// \brief Number of levels in the pyramid.
+      public: static const unsigned int LevelCount = 8u;
+
+      /// \brief Constructor.
+      public: CurveData()
+              {
+                this->Clear();
+              }
+
+      /// \brief Get the number of points to draw.
+      /// \return Number of points in view.
+      public: virtual size_t size() const
+              {
+                this->UpdateView();
+                return this->view.size();
+              }
 
-      /// \brief Bounding rectangle accessor. This create the object
-      /// if it does not already exist or is too small.
-      /// \return Bounding box of the sample.
+      /// \brief Get a point to draw.
+      /// \param[in] _i Index of the point in view.
+      /// \return The point.
+      public: virtual QPointF sample(size_t _i) const
+              {
+                this->UpdateView();
+                return this->view[_i];
+              }
+
+      /// \brief Bounding rectangle of all the samples.
+      /// \return Bounding box of the samples.
       public: virtual QRectF boundingRect() const
               {
-                if (this->BoundingRect().width() < 0.0)
-                {
-#ifdef QWT_VERSION_LT_620
-                  this->d_boundingRect = qwtBoundingRect(*this);
-#else
-                  this->cachedBoundingRect = qwtBoundingRect(*this);
-#endif
-                }
+                this->UpdateBounds();
+                QRectF rect = this->bounds;
 
                 // set a minimum bounding box height
                 // this prevents plot's auto scale to zoom in on near-zero
                 // floating point noise.
                 double minHeight = 1e-3;
-                double absHeight = std::fabs(this->BoundingRect().height());
-                if (absHeight < minHeight)
+                double absHeight = std::fabs(rect.height());
+                if (rect.width() >= 0.0 && absHeight < minHeight)
                 {
                   double halfMinHeight = minHeight * 0.5;
-                  double mid = this->BoundingRect().top() +
-                      (absHeight * 0.5);
-#ifdef QWT_VERSION_LT_620
-                  this->d_boundingRect.setTop(mid - halfMinHeight);
-                  this->d_boundingRect.setBottom(mid + halfMinHeight);
-#else
-                  this->cachedBoundingRect.setTop(mid - halfMinHeight);
-                  this->cachedBoundingRect.setBottom(mid + halfMinHeight);
-#endif
+                  double mid = rect.top() + (absHeight * 0.5);
+                  rect.setTop(mid - halfMinHeight);
+                  rect.setBottom(mid + halfMinHeight);
                 }
 
-                return this->BoundingRect();
+                return rect;
+              }
+
+      /// \brief Called by the plot when its axes change. Only the part of
+      /// the curve along the x axis range is drawn.
+      /// \param[in] _rect Rectangle of the plot in curve coordinates.
+      public: virtual void setRectOfInterest(const QRectF &_rect)
+              {
+                if (_rect.left() != this->interest.left() ||
+                    _rect.right() != this->interest.right())
+                {
+                  this->interest = _rect;
+                  this->viewDirty = true;
+                }
               }
 
       /// \brief Add a point to the sample.
       /// \param[in] _point Point to add.
-      public: inline void Add(const QPointF &_point)
+      public: void Add(const QPointF &_point)
               {
-                this->SamplesRef() += _point;
-
-                if (this->SamplesRef().size() > maxSampleSize)
+                if (!this->samples.empty() &&
+                    _point.x() < this->samples.back().x())
                 {
-                  // remove sample window
-                  // update bounding rect?
-                  this->SamplesRef().remove(0, windowSize);
+                  this->sorted = false;
                 }
 
-                if (this->SamplesRef().size() == 1)
+                this->samples.push_back(_point);
+                this->Merge(0u, _point, _point);
+                this->viewDirty = true;
+
+                if (!this->boundsDirty)
                 {
-                  // init bounding rect
-                  this->BoundingRect().setTopLeft(_point);
-                  this->BoundingRect().setBottomRight(_point);
-                  return;
+                  if (this->samples.size() == 1u)
+                  {
+                    this->bounds = QRectF(_point, _point);
+                  }
+                  else
+                  {
+                    // expand bounding rect
+                    if (_point.x() < this->bounds.left())
+                      this->bounds.setLeft(_point.x());
+                    else if (_point.x() > this->bounds.right())
+                      this->bounds.setRight(_point.x());
+                    if (_point.y() < this->bounds.top())
+                      this->bounds.setTop(_point.y());
+                    else if (_point.y() > this->bounds.bottom())
+                      this->bounds.setBottom(_point.y());
+                  }
                 }
 
-                // expand bounding rect
-                if (_point.x() < this->BoundingRect().left())
-                  this->BoundingRect().setLeft(_point.x());
-                else if (_point.x() > this->BoundingRect().right())
-                  this->BoundingRect().setRight(_point.x());
-                if (_point.y() < this->BoundingRect().top())
-                  this->BoundingRect().setTop(_point.y());
-                else if (_point.y() > this->BoundingRect().bottom())
-                  this->BoundingRect().setBottom(_point.y());
+                this->Trim();
               }
 
       /// \brief Clear the sample data.
       public: void Clear()
               {
-                this->SamplesRef().clear();
-                this->SamplesRef().squeeze();
-                this->BoundingRect() = QRectF(0.0, 0.0, -1.0, -1.0);
+                this->samples.clear();
+                this->samples.shrink_to_fit();
+                this->firstIndex = 0u;
+                this->levels.clear();
+                this->levels.resize(LevelCount);
+                this->sorted = true;
+                this->view.clear();
+                this->viewDirty = false;
+                this->bounds = QRectF(0.0, 0.0, -1.0, -1.0);
+                this->boundsDirty = false;
+              }
+
+      /// \brief Get the full resolution samples, oldest first.
+      /// \return The samples.
+      public: const std::deque<QPointF> &Samples() const
+              {
+                return this->samples;
+              }
+
+      /// \brief Set the duration of samples to keep.
+      /// \param[in] _history Duration along the x axis.
+      public: void SetHistory(const double _history)
+              {
+                this->history = _history;
+                this->Trim();
+              }
+
+      /// \brief Get the duration of samples to keep.
+      /// \return Duration along the x axis.
+      public: double History() const
+              {
+                return this->history;
               }
 
-      /// \brief Get the sample data.
-      /// \return A vector of same points.
-      public: QVector<QPointF> Samples() const
+      /// \brief Set the width of the plot, which is the number of
+      /// buckets drawn when zoomed out.
+      /// \param[in] _pixels Width in pixels.
+      public: void SetPixelWidth(const unsigned int _pixels)
               {
-                return this->SamplesRef();
+                const unsigned int pixels = std::max(_pixels, 1u);
+                if (pixels != this->pixelWidth)
+                {
+                  this->pixelWidth = pixels;
+                  this->viewDirty = true;
+                }
               }
 
-      /// \brief maxium sample size of this curve.
-      private: int maxSampleSize = 11000;
+      /// \brief Number of samples in a bucket of a level.
+      /// \param[in] _level Level of the pyramid.
+      /// \return Number of samples.
+      private: static uint64_t BucketSize(const unsigned int _level)
+               {
+                 uint64_t size = BucketFactor;
+                 for (unsigned int i = 0; i < _level; ++i)
+                   size *= BucketFactor;
+                 return size;
+               }
+
+      /// \brief Merge samples into the open bucket of a level, and
+      /// complete the bucket once full.
+      /// \param[in] _level Level of the pyramid.
+      /// \param[in] _min Sample with the lowest y value.
+      /// \param[in] _max Sample with the highest y value.
+      private: void Merge(const unsigned int _level, const QPointF &_min,
+                   const QPointF &_max)
+               {
+                 CurveLevel &level = this->levels[_level];
+                 level.open.Add(_min, _max);
+                 if (level.open.count < BucketFactor)
+                   return;
+
+                 const CurveBucket bucket = level.open;
+                 level.buckets.push_back(bucket);
+                 level.open = CurveBucket();
+
+                 if (_level + 1u < LevelCount)
+                   this->Merge(_level + 1u, bucket.min, bucket.max);
+               }
+
+      /// \brief Remove the samples and buckets older than the history.
+      private: void Trim()
+               {
+                 if (this->samples.empty())
+                   return;
+
+                 const double oldest = this->samples.back().x() - this->history;
+                 while (this->samples.size() > 1u &&
+                        this->samples.front().x() < oldest)
+                 {
+                   const QPointF &front = this->samples.front();
+                   if (front.x() <= this->bounds.left() ||
+                       front.y() <= this->bounds.top() ||
+                       front.y() >= this->bounds.bottom())
+                   {
+                     this->boundsDirty = true;
+                   }
+                   this->samples.pop_front();
+                   this->firstIndex++;
+                   this->viewDirty = true;
+                 }
+
+                 // Drop buckets that end before the first sample
+                 for (unsigned int i = 0; i < LevelCount; ++i)
+                 {
+                   const uint64_t size = BucketSize(i);
+                   CurveLevel &level = this->levels[i];
+                   while (!level.buckets.empty() &&
+                          (level.firstBucket + 1u) * size <= this->firstIndex)
+                   {
+                     level.buckets.pop_front();
+                     level.firstBucket++;
+                   }
+                 }
+               }
+
+      /// \brief Append the points of a range of samples, using the
+      /// coarsest buckets up to a level that fit in the range.
+      /// \param[in] _begin Index of the first sample since the curve was
+      /// cleared.
+      /// \param[in] _end Index past the last sample.
+      /// \param[in] _maxLevel Coarsest level to use, or -1 to append every
+      /// sample.
+      /// \param[out] _points Points to append to.
+      private: void Decimate(uint64_t _begin, const uint64_t _end,
+                   const int _maxLevel, QVector<QPointF> &_points) const
+               {
+                 while (_begin < _end)
+                 {
+                   const CurveBucket *bucket = nullptr;
+                   uint64_t size = 1u;
+                   for (int i = _maxLevel; i >= 0 && !bucket; --i)
+                   {
+                     const CurveLevel &level = this->levels[i];
+                     size = BucketSize(i);
+                     if (_begin % size != 0u || _begin + size > _end)
+                       continue;
+                     const uint64_t index = _begin / size;
+                     if (index >= level.firstBucket &&
+                         index < level.firstBucket + level.buckets.size())
+                     {
+                       bucket = &level.buckets[index - level.firstBucket];
+                     }
+                   }
+
+                   if (!bucket)
+                   {
+                     _points.append(this->samples[_begin - this->firstIndex]);
+                     _begin++;
+                     continue;
+                   }
+
+                   // keep the points of a bucket in order along the x axis
+                   const bool minFirst = bucket->min.x() <= bucket->max.x();
+                   _points.append(minFirst ? bucket->min : bucket->max);
+                   if (bucket->min != bucket->max)
+                     _points.append(minFirst ? bucket->max : bucket->min);
+                   _begin += size;
+                 }
+               }
+
+      /// \brief Rebuild the points in view if samples were added or the
+      /// view changed.
+      private: void UpdateView() const
+               {
+                 if (!this->viewDirty)
+                   return;
+                 this->viewDirty = false;
+                 this->view.clear();
+
+                 if (this->samples.empty())
+                   return;
+
+                 // Samples out of order along the x axis can't be searched
+                 size_t begin = 0u;
+                 size_t end = this->samples.size();
+                 if (this->sorted && this->interest.width() > 0.0)
+                 {
+                   auto byX = [](const QPointF &_a, const QPointF &_b)
+                   {
+                     return _a.x() < _b.x();
+                   };
+
+                   // include a sample on each side of the view, so the line
+                   // reaches its edges
+                   begin = std::lower_bound(this->samples.begin(),
+                       this->samples.end(), this->interest.topLeft(), byX) -
+                       this->samples.begin();
+                   end = std::upper_bound(this->samples.begin(),
+                       this->samples.end(), this->interest.bottomRight(), byX) -
+                       this->samples.begin();
+                   begin = begin > 0u ? begin - 1u : 0u;
+                   end = std::min(end + 1u, this->samples.size());
+                 }
+
+                 // Use the coarsest level that still has a bucket per pixel
+                 int maxLevel = -1;
+                 const uint64_t count = end - begin;
+                 if (this->sorted && count > 2u * this->pixelWidth)
+                 {
+                   while (maxLevel + 1 < static_cast<int>(LevelCount) &&
+                          BucketSize(maxLevel + 1) * this->pixelWidth <= count)
+                   {
+                     maxLevel++;
+                   }
+                 }
+
+                 this->Decimate(this->firstIndex + begin,
+                     this->firstIndex + end, maxLevel, this->view);
+               }
+
+      /// \brief Recompute the bounding rectangle after samples that
+      /// reached its edges were removed.
+      private: void UpdateBounds() const
+               {
+                 if (!this->boundsDirty)
+                   return;
+                 this->boundsDirty = false;
+
+                 if (this->samples.empty())
+                 {
+                   this->bounds = QRectF(0.0, 0.0, -1.0, -1.0);
+                   return;
+                 }
+
+                 QVector<QPointF> points;
+                 this->Decimate(this->firstIndex,
+                     this->firstIndex + this->samples.size(),
+                     this->sorted ? LevelCount - 1 : -1, points);
+
+                 double left = this->samples.front().x();
+                 double right = this->samples.back().x();
+                 double top = points.front().y();
+                 double bottom = top;
+                 for (const auto &pt : points)
+                 {
+                   left = std::min(left, pt.x());
+                   right = std::max(right, pt.x());
+                   top = std::min(top, pt.y());
+                   bottom = std::max(bottom, pt.y());
+                 }
+                 this->bounds = QRectF(QPointF(left, top),
+                     QPointF(right, bottom));
+               }
+
+      /// \brief Full resolution samples, oldest first.
+      private: std::deque<QPointF> samples;
+
+      /// \brief Index of the first sample since the curve was cleared.
+      private: uint64_t firstIndex = 0u;
+
+      /// \brief Min / max pyramid, finest level first.
+      private: std::vector<CurveLevel> levels;
+
+      /// \brief True if the samples are in order along the x axis.
+      private: bool sorted = true;
+
+      /// \brief Duration of samples to keep along the x axis.
+      private: double history = 300.0;
+
+      /// \brief Width of the plot in pixels.
+      private: unsigned int pixelWidth = 1024u;
 
-      /// \brief Size of samples to remove when maxSampleSize is reached.
-      private: int windowSize = 1000;
+      /// \brief Part of the plot in view.
+      private: QRectF interest;
+
+      /// \brief Points to draw.
+      private: mutable QVector<QPointF> view;
+
+      /// \brief True if the points to draw need to be rebuilt.
+      private: mutable bool viewDirty = false;
+
+      /// \brief Bounding rectangle of the samples.
+      private: mutable QRectF bounds;
+
+      /// \brief True if the bounding rectangle needs to be recomputed.
+      private: mutable bool boundsDirty = false;
     };
 
 
@@ -202,7 +498,7 @@ namespace gazebo
       /// \brief Qwt Curve object.
       public: QwtPlotCurve *curve = nullptr;
 
-      /// \brief Curve data in the form of QwtArraySeriesData
+      /// \brief Curve data, owned by the Qwt curve.
       public: CurveData *curveData;
 
       /// \brief Global id incremented on every new curve
@@ -395,7 +691,7 @@ void PlotCurve::SetAge(const unsigned int _age)
 /////////////////////////////////////////////////
 unsigned int PlotCurve::Size() const
 {
-  return static_cast<unsigned int>(this->dataPtr->curveData->samples().size());
+  return static_cast<unsigned int>(this->dataPtr->curveData->Samples().size());
 }
 
 /////////////////////////////////////////////////
@@ -415,17 +711,53 @@ ignition::math::Vector2d PlotCurve::Max()
 /////////////////////////////////////////////////
 ignition::math::Vector2d PlotCurve::Point(const unsigned int _index) const
 {
-  if (_index >= static_cast<unsigned int>(
-      this->dataPtr->curveData->samples().size()))
+  const std::deque<QPointF> &samples = this->dataPtr->curveData->Samples();
+  if (_index >= samples.size())
   {
     return ignition::math::Vector2d(ignition::math::NAN_D,
         ignition::math::NAN_D);
   }
 
-  const QPointF &pt = this->dataPtr->curveData->samples()[_index];
+  const QPointF &pt = samples[_index];
   return ignition::math::Vector2d(pt.x(), pt.y());
 }
 
+/////////////////////////////////////////////////
+std::vector<ignition::math::Vector2d> PlotCurve::Points() const
+{
+  const std::deque<QPointF> &samples = this->dataPtr->curveData->Samples();
+
+  std::vector<ignition::math::Vector2d> points;
+  points.reserve(samples.size());
+  for (const auto &pt : samples)
+    points.push_back(ignition::math::Vector2d(pt.x(), pt.y()));
+  return points;
+}
+
+/////////////////////////////////////////////////
+void PlotCurve::SetHistory(const double _history)
+{
+  this->dataPtr->curveData->SetHistory(_history);
+}
+
+/////////////////////////////////////////////////
+double PlotCurve::History() const
+{
+  return this->dataPtr->curveData->History();
+}
+
+/////////////////////////////////////////////////
+void PlotCurve::SetPixelWidth(const unsigned int _pixels)
+{
+  this->dataPtr->curveData->SetPixelWidth(_pixels);
+}
+
+/////////////////////////////////////////////////
+unsigned int PlotCurve::DrawnSize() const
+{
+  return static_cast<unsigned int>(this->dataPtr->curveData->size());
+}
+
 /////////////////////////////////////////////////
 QwtPlotCurve *PlotCurve::Curve()
 {
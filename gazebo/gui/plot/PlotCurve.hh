@@ -121,6 +121,27 @@ namespace gazebo
       /// \return Curve sample points
       public: std::vector<ignition::math::Vector2d> Points() const;
 
+      /// \brief Set how long samples are kept. Samples that are older
+      /// than the newest one by more than the history are removed.
+      /// \param[in] _history History duration along the x axis, in
+      /// seconds for plots of time.
+      public: void SetHistory(const double _history);
+
+      /// \brief Get how long samples are kept.
+      /// \return History duration along the x axis.
+      public: double History() const;
+
+      /// \brief Set the width of the plot the curve is drawn in. A zoomed
+      /// out curve is drawn as the min and max of ranges of samples, with
+      /// about one range per pixel.
+      /// \param[in] _pixels Width of the plot canvas in pixels.
+      public: void SetPixelWidth(const unsigned int _pixels);
+
+      /// \brief Get the number of points drawn for the part of the curve
+      /// in view, which is at most Size().
+      /// \return Number of points drawn.
+      public: unsigned int DrawnSize() const;
+
       /// \internal
       /// \brief Get the internal QwtPlotCurve object.
       /// \return QwtPlotCurve object.
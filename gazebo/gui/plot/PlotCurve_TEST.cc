@@ -15,6 +15,9 @@
  *
 */
 
+#include <ignition/math/Helpers.hh>
+
+#include "gazebo/gui/plot/qwt_gazebo.h"
 #include "gazebo/gui/plot/PlottingTypes.hh"
 #include "gazebo/gui/plot/PlotCurve.hh"
 #include "gazebo/gui/plot/PlotCurve_TEST.hh"
@@ -133,5 +136,63 @@ void PlotCurve_TEST::AddPoint()
   delete plotCurve;
 }
 
+/////////////////////////////////////////////////
+void PlotCurve_TEST::History()
+{
+  this->resMaxPercentChange = 5.0;
+  this->shareMaxPercentChange = 2.0;
+
+  this->Load("worlds/empty.world");
+
+  gazebo::gui::PlotCurve *plotCurve = new gazebo::gui::PlotCurve("curve01");
+  QVERIFY(plotCurve != nullptr);
+
+  plotCurve->SetHistory(10.0);
+  QCOMPARE(plotCurve->History(), 10.0);
+  plotCurve->SetPixelWidth(100u);
+
+  // 20 seconds at 1 kHz, with a spike in the last 10 seconds
+  for (unsigned int i = 0; i <= 20000u; ++i)
+  {
+    double y = (i % 2u) ? 1.0 : -1.0;
+    if (i == 15000u)
+      y = 100.0;
+    plotCurve->AddPoint(ignition::math::Vector2d(i * 1e-3, y));
+  }
+
+  // only the last 10 seconds are kept, at full resolution
+  QCOMPARE(plotCurve->Size(), 10001u);
+  QCOMPARE(plotCurve->Point(0), ignition::math::Vector2d(10.0, -1.0));
+  QCOMPARE(plotCurve->Point(5000), ignition::math::Vector2d(15.0, 100.0));
+  QCOMPARE(plotCurve->Points().size(), static_cast<size_t>(10001u));
+  QCOMPARE(plotCurve->Min(), ignition::math::Vector2d(10.0, -1.0));
+  QCOMPARE(plotCurve->Max(), ignition::math::Vector2d(20.0, 100.0));
+
+  // zoomed out, a few points per pixel are drawn, and the spike is kept
+  unsigned int drawn = plotCurve->DrawnSize();
+  QVERIFY(drawn >= 100u);
+  QVERIFY(drawn < 2000u);
+  bool spike = false;
+  for (unsigned int i = 0; i < drawn; ++i)
+  {
+    QPointF pt = plotCurve->Curve()->sample(i);
+    spike = spike || ignition::math::equal(pt.y(), 100.0);
+    if (i > 0u)
+      QVERIFY(pt.x() >= plotCurve->Curve()->sample(i - 1).x());
+  }
+  QVERIFY(spike);
+
+  // samples past the history are removed when it shrinks
+  plotCurve->SetHistory(1.0);
+  QCOMPARE(plotCurve->Size(), 1001u);
+  QCOMPARE(plotCurve->Max(), ignition::math::Vector2d(20.0, 1.0));
+
+  plotCurve->Clear();
+  QCOMPARE(plotCurve->Size(), 0u);
+  QCOMPARE(plotCurve->DrawnSize(), 0u);
+
+  delete plotCurve;
+}
+
 // Generate a main function for the test
 QTEST_MAIN(PlotCurve_TEST)
@@ -92,6 +92,19 @@ bool ContactManager::NeverDropContacts() const
   return this->neverDropContacts;
 }
 
+/////////////////////////////////////////////////
+bool ContactManager::ContactsRequested() const
+{
+  if (this->NeverDropContacts() ||
+      (this->contactPub && this->contactPub->HasConnections()))
+  {
+    return true;
+  }
+
+  boost::recursive_mutex::scoped_lock lock(*this->customMutex);
+  return !this->customContactPublishers.empty();
+}
+
 /////////////////////////////////////////////////
 bool ContactManager::SubscribersConnected(Collision *_collision1,
                                           Collision *_collision2) const
@@ -117,6 +117,14 @@ namespace gazebo
       /// If SetNeverDropContacts() was never called, this will return false.
       public: bool NeverDropContacts() const;
 
+      /// \brief Returns true if NewContact() may create contacts for any
+      /// pair of collisions in the current step, because contacts are never
+      /// dropped, or the contact topic or a filter topic has been created.
+      /// Physics engines can check this once per step to skip the
+      /// extraction of contact points when no one is listening.
+      /// \return False if NewContact() will return NULL for every pair.
+      public: bool ContactsRequested() const;
+
       /// \brief Returns true if any subscribers are connected
       /// which would be interested in contact details of either collision
       /// \e _collision1 or \e collision2, given that they have been loaded
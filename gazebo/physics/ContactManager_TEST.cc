@@ -194,6 +194,39 @@ TEST_F(ContactManagerTest, NeverDropContacts)
   }
 }
 
+/////////////////////////////////////////////////
+TEST_F(ContactManagerTest, ContactsRequested)
+{
+  Load("test/worlds/box.world", true);
+
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != nullptr);
+
+  physics::PhysicsEnginePtr physics = world->Physics();
+  ASSERT_TRUE(physics != nullptr);
+
+  physics::ContactManager *manager = physics->GetContactManager();
+  ASSERT_TRUE(manager != nullptr);
+
+  // No one is listening yet
+  EXPECT_FALSE(manager->ContactsRequested());
+
+  manager->SetNeverDropContacts(true);
+  EXPECT_TRUE(manager->ContactsRequested());
+  manager->SetNeverDropContacts(false);
+  EXPECT_FALSE(manager->ContactsRequested());
+
+  // A filter requests contacts
+  std::vector<std::string> collisions;
+  collisions.push_back("box::link::collision");
+  std::string filter = "box_filter";
+  manager->CreateFilter(filter, collisions);
+  EXPECT_TRUE(manager->ContactsRequested());
+  manager->RemoveFilter(filter);
+  EXPECT_FALSE(manager->ContactsRequested());
+}
+
+/////////////////////////////////////////////////
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
@@ -153,8 +153,12 @@ void Entity::SetStatic(const bool &_s)
 
   for (iter = this->children.begin(); iter != this->children.end(); ++iter)
   {
+    // Link::SetStatic is virtual, so that physics engines can update their
+    // own objects. Entity::SetStatic isn't, to keep the ABI of Entity.
     EntityPtr e = boost::dynamic_pointer_cast<Entity>(*iter);
-    if (e)
+    if (e && e->HasType(Base::LINK))
+      boost::static_pointer_cast<Link>(e)->SetStatic(_s);
+    else if (e)
       e->SetStatic(_s);
   }
 }
@@ -16,6 +16,7 @@
 */
 #include <algorithm>
 #include <cmath>
+#include <functional>
 #include <string>
 #include <ignition/math/Helpers.hh>
 #include <gazebo/gazebo_config.h>
@@ -25,7 +26,10 @@
 #include "gazebo/common/Image.hh"
 #include "gazebo/common/CommonIface.hh"
 #include "gazebo/common/SphericalCoordinates.hh"
+#include "gazebo/common/Events.hh"
+#include "gazebo/physics/Collision.hh"
 #include "gazebo/physics/HeightmapShape.hh"
+#include "gazebo/physics/Model.hh"
 #include "gazebo/physics/World.hh"
 #include "gazebo/transport/transport.hh"
 
@@ -48,6 +52,7 @@ HeightmapShape::HeightmapShape(CollisionPtr _parent)
 //////////////////////////////////////////////////
 HeightmapShape::~HeightmapShape()
 {
+  this->updateConnection.reset();
   this->requestSub.reset();
   this->responsePub.reset();
   if (this->node)
@@ -172,6 +177,29 @@ void HeightmapShape::Load(sdf::ElementPtr _sdf)
     return;
   }
 
+  if (common::HeightmapTileCache::IsTileCache(filename))
+  {
+    this->tileCache.reset(new common::HeightmapTileCache());
+    if (!this->tileCache->Load(filename))
+    {
+      gzerr << "Unable to load heightmap tile cache[" << filename << "]\n";
+      this->tileCache.reset();
+      return;
+    }
+
+    // Size and sampling were fixed when the cache was baked
+    this->heightmapSize = this->tileCache->Size();
+    this->subSampling = this->tileCache->SubSampling();
+    if (this->sdf->HasElement("sampling") &&
+        this->sdf->Get<int>("sampling") != this->subSampling)
+    {
+      gzwarn << "Heightmap tile cache[" << filename << "] was baked with a "
+             << "sampling of " << this->subSampling << ", ignoring <sampling>"
+             << std::endl;
+    }
+    return;
+  }
+
   if (this->LoadTerrainFile(filename) != 0)
   {
     gzerr << "Heightmap data size must be square, with a size of 2^n+1\n";
@@ -209,9 +237,21 @@ int HeightmapShape::GetSubSampling() const
   return this->subSampling;
 }
 
+//////////////////////////////////////////////////
+bool HeightmapShape::Paged() const
+{
+  return this->tileCache && this->pagedHeights;
+}
+
 //////////////////////////////////////////////////
 void HeightmapShape::FillHeightfield(std::vector<float>& _heights)
 {
+  if (this->tileCache)
+  {
+    this->tileCache->FillHeights(this->flipY, _heights);
+    return;
+  }
+
   this->heightmapData->FillHeightMap(this->subSampling, this->vertSize,
       this->Size(), this->scale, this->flipY, _heights);
 }
@@ -220,8 +260,7 @@ void HeightmapShape::FillHeightfield(std::vector<float>& _heights)
 void HeightmapShape::FillHeightfield(std::vector<double>& _heights)
 {
   std::vector<float> fHeights;
-  this->heightmapData->FillHeightMap(this->subSampling, this->vertSize,
-      this->Size(), this->scale, this->flipY, fHeights);
+  this->FillHeightfield(fHeights);
   _heights = std::vector<double>(fHeights.begin(), fHeights.end());
 }
 
@@ -237,6 +276,29 @@ void HeightmapShape::Init()
 
   ignition::math::Vector3d terrainSize = this->Size();
 
+  if (this->tileCache)
+  {
+    // Heights in the cache are already scaled
+    this->vertSize = this->tileCache->VertSize();
+    this->scale.X() = terrainSize.X() / this->vertSize;
+    this->scale.Y() = terrainSize.Y() / this->vertSize;
+    this->scale.Z() = 1.0;
+
+    if (!this->pagedHeights)
+    {
+      gzwarn << "The physics engine can not page heightmap tiles, the whole "
+             << "tile cache[" << this->GetURI() << "] will be loaded in memory"
+             << std::endl;
+      this->FillHeightfield(this->heights);
+    }
+    else
+    {
+      this->updateConnection = event::Events::ConnectWorldUpdateBegin(
+          std::bind(&HeightmapShape::PrefetchTiles, this));
+    }
+    return;
+  }
+
   // sampling size along image width and height
   this->vertSize = (this->heightmapData->GetWidth() * this->subSampling)
       - this->subSampling + 1;
@@ -311,8 +373,8 @@ void HeightmapShape::FillHeights(msgs::Geometry &_msg) const
   {
     for (unsigned int x = 0; x < this->vertSize; ++x)
     {
-      int index = (this->vertSize - y - 1) * this->vertSize + x;
-      _msg.mutable_heightmap()->add_heights(this->heights[index]);
+      _msg.mutable_heightmap()->add_heights(
+          this->GetHeight(x, this->vertSize - y - 1));
     }
   }
 }
@@ -329,9 +391,69 @@ ignition::math::Vector2i HeightmapShape::VertexCount() const
   return ignition::math::Vector2i(this->vertSize, this->vertSize);
 }
 
+/////////////////////////////////////////////////
+void HeightmapShape::PrefetchTiles()
+{
+  if (!this->Paged() || !this->collisionParent || this->vertSize < 2)
+    return;
+
+  physics::WorldPtr world = this->collisionParent->GetWorld();
+  if (!world)
+    return;
+
+  const ignition::math::Pose3d pose = this->collisionParent->WorldPose();
+  const ignition::math::Vector3d terrainSize = this->Size();
+  const double cellsPerMeterX = (this->vertSize - 1) / terrainSize.X();
+  const double cellsPerMeterY = (this->vertSize - 1) / terrainSize.Y();
+  const double maxIndex = this->vertSize - 1;
+
+  for (auto const &model : world->Models())
+  {
+    if (model->IsStatic())
+      continue;
+
+    // Bound the model box by a circle, so that the region also covers
+    // terrains that are rotated about z.
+    const ignition::math::AxisAlignedBox box = model->BoundingBox();
+    const ignition::math::Vector3d center =
+        pose.Rot().RotateVectorReverse(box.Center() - pose.Pos());
+    const double radius = 0.5 * std::hypot(box.XLength(), box.YLength());
+
+    // The cache is not flipped: row 0 is at the +y edge of the terrain
+    const double minX = (center.X() - radius + terrainSize.X() * 0.5) *
+        cellsPerMeterX;
+    const double maxX = (center.X() + radius + terrainSize.X() * 0.5) *
+        cellsPerMeterX;
+    const double minY = (terrainSize.Y() * 0.5 - center.Y() - radius) *
+        cellsPerMeterY;
+    const double maxY = (terrainSize.Y() * 0.5 - center.Y() + radius) *
+        cellsPerMeterY;
+    if (maxX < 0 || maxY < 0 || minX > maxIndex || minY > maxIndex)
+      continue;
+
+    this->tileCache->Prefetch(
+        static_cast<unsigned int>(ignition::math::clamp(minX, 0.0, maxIndex)),
+        static_cast<unsigned int>(ignition::math::clamp(minY, 0.0, maxIndex)),
+        static_cast<unsigned int>(std::ceil(
+            ignition::math::clamp(maxX, 0.0, maxIndex))),
+        static_cast<unsigned int>(std::ceil(
+            ignition::math::clamp(maxY, 0.0, maxIndex))));
+  }
+}
+
 /////////////////////////////////////////////////
 HeightmapShape::HeightType HeightmapShape::GetHeight(int _x, int _y) const
 {
+  if (this->Paged())
+  {
+    if (_x < 0 || _y < 0)
+      return 0.0;
+
+    if (this->flipY)
+      _y = this->vertSize - _y - 1;
+    return this->tileCache->Height(_x, _y);
+  }
+
   int index =  _y * this->vertSize + _x;
   if (_x < 0 || _y < 0 || index >= static_cast<int>(this->heights.size()))
     return 0.0;
@@ -342,6 +464,13 @@ HeightmapShape::HeightType HeightmapShape::GetHeight(int _x, int _y) const
 /////////////////////////////////////////////////
 void HeightmapShape::SetHeight(int _x, int _y, HeightmapShape::HeightType _h)
 {
+  if (this->Paged())
+  {
+    gzerr << "SetHeight is not supported on heightmaps paged from a tile cache"
+          << std::endl;
+    return;
+  }
+
   int index =  _y * this->vertSize + _x;
   if (_x < 0 || _y < 0 || index >= static_cast<int>(this->heights.size()))
   {
@@ -356,6 +485,9 @@ void HeightmapShape::SetHeight(int _x, int _y, HeightmapShape::HeightType _h)
 /////////////////////////////////////////////////
 HeightmapShape::HeightType HeightmapShape::GetMaxHeight() const
 {
+  if (this->Paged())
+    return this->tileCache->MaxHeight();
+
   HeightType max = -std::numeric_limits<HeightType>::max();
   for (unsigned int i = 0; i < this->heights.size(); ++i)
   {
@@ -369,6 +501,9 @@ HeightmapShape::HeightType HeightmapShape::GetMaxHeight() const
 /////////////////////////////////////////////////
 HeightmapShape::HeightType HeightmapShape::GetMinHeight() const
 {
+  if (this->Paged())
+    return this->tileCache->MinHeight();
+
   HeightType min = std::numeric_limits<HeightType>::max();
   for (unsigned int i = 0; i < this->heights.size(); ++i)
   {
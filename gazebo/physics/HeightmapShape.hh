@@ -17,6 +17,7 @@
 #ifndef GAZEBO_PHYSICS_HEIGHTMAPSHAPE_HH_
 #define GAZEBO_PHYSICS_HEIGHTMAPSHAPE_HH_
 
+#include <memory>
 #include <string>
 #include <vector>
 #include <ignition/transport/Node.hh>
@@ -25,6 +26,7 @@
 
 #include "gazebo/common/ImageHeightmap.hh"
 #include "gazebo/common/HeightmapData.hh"
+#include "gazebo/common/HeightmapTileCache.hh"
 #include "gazebo/common/Dem.hh"
 #include "gazebo/transport/TransportTypes.hh"
 #include "gazebo/physics/PhysicsTypes.hh"
@@ -42,6 +44,11 @@ namespace gazebo
     /// \brief HeightmapShape collision shape builds a heightmap from
     /// an image.  The supplied image must be square with
     /// N*N+1 pixels per side, where N is an integer.
+    ///
+    /// The URI may also point to a tile cache baked with
+    /// `gz heightmap --bake`. In that case the heights are paged from disk
+    /// on demand by physics engines that query them through GetHeight(),
+    /// and fully loaded for the others.
     class GZ_PHYSICS_VISIBLE HeightmapShape : public Shape
     {
       /// \brief height field type, float or double
@@ -124,6 +131,11 @@ namespace gazebo
       /// \return Amount of subsampling.
       public: int GetSubSampling() const;
 
+      /// \brief Get whether the heights are paged from a tile cache
+      /// instead of being held in memory.
+      /// \return True if heights are paged.
+      public: bool Paged() const;
+
       /// \brief Return an image representation of the heightmap.
       /// \return Image where white pixels represents the highest locations,
       /// and black pixels the lowest.
@@ -141,6 +153,10 @@ namespace gazebo
       /// \param[in] _msg The request message.
       private: void OnRequest(ConstRequestPtr &_msg);
 
+      /// \brief Page in the tiles under the bounding boxes of the models
+      /// that are not static, before the physics engine queries them.
+      private: void PrefetchTiles();
+
       /// \brief Fills the heightmap data (float) into the vector
       /// by calling HeightmapData::FillHeightMap with \e heights
       /// \param[in] heights height field to fill with data.
@@ -167,6 +183,19 @@ namespace gazebo
       /// \brief The amount of subsampling. Default is 2.
       protected: int subSampling;
 
+      /// \brief Tile cache the heights are read from, null unless the URI
+      /// points to a baked tile cache.
+      protected: std::unique_ptr<common::HeightmapTileCache> tileCache;
+
+      /// \brief Set to true by physics engines that only access heights
+      /// through GetHeight(), so that a tile cache is paged instead of
+      /// being copied into \e heights. Default is false.
+      protected: bool pagedHeights = false;
+
+      /// \brief Connection to the world update, which prefetches tiles
+      /// while heights are paged.
+      private: event::ConnectionPtr updateConnection;
+
       /// \brief Transportation node.
       private: transport::NodePtr node;
 
@@ -72,6 +72,7 @@ void MeshShape::Init()
   if (this->submesh)
     delete this->submesh;
   this->submesh = NULL;
+  this->convexHulls = nullptr;
 
   if (this->sdf->HasElement("submesh"))
   {
@@ -98,6 +99,75 @@ void MeshShape::Init()
       }
     }
   }
+
+  if (this->mesh)
+    this->LoadSimplification(this->mesh->GetName());
+}
+
+//////////////////////////////////////////////////
+void MeshShape::LoadSimplification(const std::string &_meshName)
+{
+  const std::string kSimplification = "gz:mesh_simplification";
+  if (!this->collisionParent || !this->collisionParent->GetSDF() ||
+      !this->collisionParent->GetSDF()->HasElement(kSimplification))
+  {
+    return;
+  }
+
+  sdf::ElementPtr elem =
+      this->collisionParent->GetSDF()->GetElement(kSimplification);
+
+  if (this->submesh)
+  {
+    gzwarn << "Element <" << kSimplification << "> in collision ["
+           << this->collisionParent->GetScopedName() << "] is ignored "
+           << "because a submesh is used." << std::endl;
+    return;
+  }
+
+  unsigned int targetTriangles =
+      elem->Get<unsigned int>("target_triangles", 0u).first;
+  bool convex = elem->Get<bool>("convex_decomposition", false).first;
+  unsigned int maxHulls =
+      elem->Get<unsigned int>("max_convex_hulls", 16u).first;
+  unsigned int maxHullVertices =
+      elem->Get<unsigned int>("max_hull_vertices", 64u).first;
+
+  common::MeshManager *meshManager = common::MeshManager::Instance();
+
+  if (targetTriangles > 0)
+  {
+    const common::Mesh *simplified =
+        meshManager->SimplifiedMesh(_meshName, targetTriangles);
+    if (simplified)
+      this->mesh = simplified;
+    else
+    {
+      gzwarn << "Unable to simplify mesh[" << _meshName << "] of collision["
+             << this->collisionParent->GetScopedName()
+             << "], using the full mesh." << std::endl;
+    }
+  }
+
+  if (convex)
+  {
+    if (maxHulls == 0 || maxHullVertices < 4)
+    {
+      gzerr << "Element <" << kSimplification << "> in collision ["
+            << this->collisionParent->GetScopedName() << "] needs at least "
+            << "one hull of at least 4 vertices." << std::endl;
+      return;
+    }
+
+    this->convexHulls = meshManager->ConvexDecomposition(_meshName,
+        maxHulls, maxHullVertices, targetTriangles);
+    if (!this->convexHulls)
+    {
+      gzwarn << "Unable to decompose mesh[" << _meshName << "] of collision["
+             << this->collisionParent->GetScopedName()
+             << "] into convex hulls." << std::endl;
+    }
+  }
 }
 
 //////////////////////////////////////////////////
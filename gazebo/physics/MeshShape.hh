@@ -83,6 +83,17 @@ namespace gazebo
 
       /// \brief The submesh to use from within the parent mesh.
       protected: common::SubMesh *submesh;
+
+      /// \brief Convex hulls approximating the mesh, one per submesh. Set
+      /// when the collision requests a convex decomposition through
+      /// <gz:mesh_simplification>, nullptr otherwise.
+      protected: const common::Mesh *convexHulls = nullptr;
+
+      /// \brief Replace the loaded mesh with the cheaper collision
+      /// versions requested by the <gz:mesh_simplification> element of the
+      /// parent collision, if any.
+      /// \param[in] _meshName Name of the loaded mesh.
+      private: void LoadSimplification(const std::string &_meshName);
     };
     /// \}
   }
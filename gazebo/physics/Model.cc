@@ -1151,6 +1151,10 @@ void Model::LoadPlugin(sdf::ElementPtr _sdf)
 
     ModelPtr myself = boost::static_pointer_cast<Model>(shared_from_this());
 
+    // Attribute the event callbacks of the plugin to it
+    event::ConnectionOwner owner(filename,
+        this->GetScopedName() + "::" + pluginName);
+
     try
     {
       plugin->Load(myself, _sdf);
@@ -150,6 +150,23 @@ double MultiRayShape::GetRetro(unsigned int _index)
   return this->rays[_index]->GetRetro();
 }
 
+//////////////////////////////////////////////////
+void MultiRayShape::Ranges(std::vector<double> &_ranges,
+    std::vector<double> &_retros) const
+{
+  const size_t rayCount = this->rays.size();
+  _ranges.resize(rayCount);
+  _retros.resize(rayCount);
+
+  // Add min range, because we measured from min range.
+  const double minRange = this->GetMinRange();
+  for (size_t i = 0; i < rayCount; ++i)
+  {
+    _ranges[i] = minRange + this->rays[i]->GetLength();
+    _retros[i] = this->rays[i]->GetRetro();
+  }
+}
+
 //////////////////////////////////////////////////
 int MultiRayShape::GetFiducial(unsigned int _index)
 {
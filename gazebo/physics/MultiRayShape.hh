@@ -75,6 +75,15 @@ namespace gazebo
       /// \return Retro value for the ray.
       public: double GetRetro(unsigned int _index);
 
+      /// \brief Get the detected range and retro value of all the rays at
+      /// once, in ray order.
+      /// \param[out] _ranges Range of every ray, resized to the number of
+      /// rays.
+      /// \param[out] _retros Retro value of every ray, resized to the number
+      /// of rays.
+      public: void Ranges(std::vector<double> &_ranges,
+                  std::vector<double> &_retros) const;
+
       /// \brief Get detected fiducial value for a ray.
       /// \param[in] _index Index of the ray.
       /// \return Fiducial value for the ray.
@@ -16,14 +16,22 @@
 */
 
 #include <time.h>
+#ifndef _WIN32
+  #include <pthread.h>
+  #include <sched.h>
+#endif
 
 #include <tbb/parallel_for.h>
 #include <tbb/blocked_range.h>
 
 #include <sdf/sdf.hh>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <deque>
 #include <list>
+#include <map>
 #include <set>
 #include <string>
 #include <vector>
@@ -40,6 +48,7 @@
 #include "ignition/common/Profiler.hh"
 #include "ignition/common/URI.hh"
 #include "gazebo/common/FuelModelDatabase.hh"
+#include "gazebo/common/MeshManager.hh"
 
 #include "gazebo/transport/Node.hh"
 #include "gazebo/transport/TransportIface.hh"
@@ -54,6 +63,7 @@
 #include "gazebo/common/Exception.hh"
 #include "gazebo/common/Console.hh"
 #include "gazebo/common/Plugin.hh"
+#include "gazebo/common/ScopeProfiler.hh"
 #include "gazebo/common/SdfFrameSemantics.hh"
 #include "gazebo/common/Time.hh"
 #include "gazebo/common/URI.hh"
@@ -94,6 +104,45 @@ using namespace physics;
 /// This will be replaced with a class member variable in Gazebo 3.0
 bool g_clearModels;
 
+#ifndef _WIN32
+/// \brief Pin a thread to a CPU and give it a real time priority.
+/// \param[in] _thread Thread to configure.
+/// \param[in] _cpu Index of the CPU, -1 to leave the affinity as is.
+/// \param[in] _priority SCHED_FIFO priority, 0 to leave the policy as is.
+/// \param[in] _worldName Name of the world, for error messages.
+void setWorldThreadScheduling(pthread_t _thread, const int _cpu,
+    const int _priority, const std::string &_worldName)
+{
+  if (_cpu >= 0)
+  {
+#ifdef __linux__
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(_cpu, &cpus);
+    if (pthread_setaffinity_np(_thread, sizeof(cpus), &cpus) != 0)
+    {
+      gzwarn << "Unable to pin the thread of world[" << _worldName
+             << "] to CPU[" << _cpu << "]\n";
+    }
+#else
+    gzwarn << "Thread affinity is not supported on this platform\n";
+#endif
+  }
+
+  if (_priority > 0)
+  {
+    sched_param param;
+    param.sched_priority = _priority;
+    if (pthread_setschedparam(_thread, SCHED_FIFO, &param) != 0)
+    {
+      gzwarn << "Unable to set the real time priority of the thread of world["
+             << _worldName << "] to [" << _priority << "]. Check the "
+             << "rtprio limit of the user.\n";
+    }
+  }
+}
+#endif
+
 class ModelUpdate_TBB
 {
   public: explicit ModelUpdate_TBB(Model_V *_models) : models(_models) {}
@@ -149,6 +198,8 @@ World::World(const std::string &_name)
   this->dataPtr->enableAtmosphere = true;
 
   this->dataPtr->sleepOffset = common::Time(0);
+  this->dataPtr->stepPeriodStats.InsertStatistics("mean,min,max,var");
+  this->dataPtr->stepPeriodStatsTime = common::Time::GetWallTime();
 
   this->dataPtr->prevStatTime = common::Time::GetWallTime();
   this->dataPtr->prevProcessMsgsTime = common::Time::GetWallTime();
@@ -414,6 +465,7 @@ void World::Load(sdf::ElementPtr _sdf)
   // initialized improperly.
   {
     // Create all the entities
+    this->PreloadMeshes(this->dataPtr->sdf);
     this->LoadEntities(this->dataPtr->sdf, this->dataPtr->rootElement);
 
     for (unsigned int i = 0; i < this->ModelCount(); ++i)
@@ -587,6 +639,7 @@ bool World::Running() const
 void World::Stop()
 {
   this->dataPtr->stop = true;
+  this->WakePacing();
 
   // Make sure that the thread does not try to join with itself
   if (this->dataPtr->thread &&
@@ -605,6 +658,14 @@ void World::RunLoop()
 {
   this->dataPtr->physicsEngine->InitForThread();
 
+#ifndef _WIN32
+  setWorldThreadScheduling(pthread_self(), this->dataPtr->threadAffinity,
+      this->dataPtr->threadPriority, this->Name());
+#else
+  if (this->dataPtr->threadAffinity >= 0 || this->dataPtr->threadPriority > 0)
+    gzwarn << "World thread scheduling is not supported on Windows\n";
+#endif
+
   this->dataPtr->startTime = common::Time::GetWallTime();
 
   // This fixes a minor issue when the world is paused before it's started
@@ -656,6 +717,72 @@ void World::RunLoop()
   }
 }
 
+//////////////////////////////////////////////////
+void World::PaceStep(const double _updatePeriod)
+{
+  auto now = std::chrono::steady_clock::now();
+
+  // Unthrottled
+  if (_updatePeriod <= 0)
+  {
+    this->dataPtr->stepDeadline = now;
+    return;
+  }
+
+  auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+      std::chrono::duration<double>(_updatePeriod));
+
+  // Due times are a multiple of the period apart, so that the real time
+  // factor does not drift. When more than a period late, start over
+  // instead of running a burst of updates to catch up.
+  auto deadline = this->dataPtr->stepDeadline + period;
+  if (deadline + period < now)
+    deadline = now;
+
+  // While paused, an update only processes messages, so sleep until it is
+  // due instead of spinning. Wake up early when unpaused or stepped.
+  bool paused;
+  {
+    std::lock_guard<std::recursive_mutex> lock(
+        this->dataPtr->worldUpdateMutex);
+    paused = this->dataPtr->pause && this->dataPtr->stepInc == 0 &&
+        !this->dataPtr->needsReset;
+  }
+  if (paused)
+  {
+    std::unique_lock<std::mutex> lock(this->dataPtr->pacingMutex);
+    if (this->dataPtr->pacingCondition.wait_until(lock, deadline,
+          [this] { return this->dataPtr->pacingWake; }))
+    {
+      deadline = std::min(deadline, std::chrono::steady_clock::now());
+    }
+    this->dataPtr->pacingWake = false;
+    this->dataPtr->stepDeadline = deadline;
+    return;
+  }
+
+  // Sleep until shortly before the update is due, then spin
+  auto spin = std::chrono::nanoseconds(this->dataPtr->pacingSpinTime.load());
+  if (deadline - now > spin)
+    std::this_thread::sleep_until(deadline - spin);
+
+  while (std::chrono::steady_clock::now() < deadline)
+  {
+  }
+
+  this->dataPtr->stepDeadline = deadline;
+}
+
+//////////////////////////////////////////////////
+void World::WakePacing()
+{
+  {
+    std::lock_guard<std::mutex> lock(this->dataPtr->pacingMutex);
+    this->dataPtr->pacingWake = true;
+  }
+  this->dataPtr->pacingCondition.notify_all();
+}
+
 //////////////////////////////////////////////////
 void World::LogStep()
 {
@@ -748,12 +875,81 @@ void World::SetSensorWaitFunc(std::function<void(double, double)> _func)
   this->dataPtr->waitForSensors = _func;
 }
 
+//////////////////////////////////////////////////
+void World::SetPrecisePacing(const bool _enable)
+{
+  this->dataPtr->precisePacing = _enable;
+}
+
+//////////////////////////////////////////////////
+bool World::PrecisePacing() const
+{
+  return this->dataPtr->precisePacing;
+}
+
+//////////////////////////////////////////////////
+void World::SetPacingSpinTime(const common::Time &_time)
+{
+  this->dataPtr->pacingSpinTime =
+    std::max(static_cast<int64_t>(0),
+        static_cast<int64_t>(_time.sec) * 1000000000 + _time.nsec);
+}
+
+//////////////////////////////////////////////////
+common::Time World::PacingSpinTime() const
+{
+  int64_t ns = this->dataPtr->pacingSpinTime;
+  return common::Time(static_cast<int32_t>(ns / 1000000000),
+                      static_cast<int32_t>(ns % 1000000000));
+}
+
+//////////////////////////////////////////////////
+void World::SetThreadAffinity(const int _cpu)
+{
+  this->dataPtr->threadAffinity = _cpu;
+
+#ifndef _WIN32
+  if (this->dataPtr->thread && _cpu >= 0)
+  {
+    setWorldThreadScheduling(this->dataPtr->thread->native_handle(), _cpu, 0,
+        this->Name());
+  }
+#endif
+}
+
+//////////////////////////////////////////////////
+int World::ThreadAffinity() const
+{
+  return this->dataPtr->threadAffinity;
+}
+
+//////////////////////////////////////////////////
+void World::SetThreadPriority(const int _priority)
+{
+  this->dataPtr->threadPriority = _priority;
+
+#ifndef _WIN32
+  if (this->dataPtr->thread && _priority > 0)
+  {
+    setWorldThreadScheduling(this->dataPtr->thread->native_handle(), -1,
+        _priority, this->Name());
+  }
+#endif
+}
+
+//////////////////////////////////////////////////
+int World::ThreadPriority() const
+{
+  return this->dataPtr->threadPriority;
+}
+
 //////////////////////////////////////////////////
 void World::Step()
 {
   DIAG_TIMER_START("World::Step");
 
   IGN_PROFILE("World::Step");
+  GZ_PROFILE("World::Step");
 
   IGN_PROFILE_BEGIN("lockMutex");
   std::lock_guard<std::mutex> lock(this->dataPtr->stepMutex);
@@ -781,38 +977,51 @@ void World::Step()
   DIAG_TIMER_LAP("World::Step", "publishWorldStats");
 
   IGN_PROFILE_BEGIN("waitForSensors");
+  GZ_PROFILE_BEGIN("World::Step::waitForSensors");
   if (this->dataPtr->waitForSensors)
     this->dataPtr->waitForSensors(this->dataPtr->simTime.Double(),
         this->dataPtr->physicsEngine->GetMaxStepSize());
+  GZ_PROFILE_END();
   IGN_PROFILE_END();
 
   IGN_PROFILE_BEGIN("sleepOffset");
+  GZ_PROFILE_BEGIN("World::Step::sleep");
   double updatePeriod = this->dataPtr->physicsEngine->GetUpdatePeriod();
-  // sleep here to get the correct update rate
-  common::Time tmpTime = common::Time::GetWallTime();
-  common::Time sleepTime = this->dataPtr->prevStepWallTime +
-    common::Time(updatePeriod) - tmpTime - this->dataPtr->sleepOffset;
-
-  common::Time actualSleep;
-  if (sleepTime > 0)
+  if (this->dataPtr->precisePacing)
   {
-    common::Time::Sleep(sleepTime);
-    actualSleep = common::Time::GetWallTime() - tmpTime;
+    this->PaceStep(updatePeriod);
   }
   else
-    sleepTime = 0;
+  {
+    // sleep here to get the correct update rate
+    common::Time tmpTime = common::Time::GetWallTime();
+    common::Time sleepTime = this->dataPtr->prevStepWallTime +
+      common::Time(updatePeriod) - tmpTime - this->dataPtr->sleepOffset;
 
-  // exponentially avg out
-  this->dataPtr->sleepOffset = (actualSleep - sleepTime) * 0.01 +
-                      this->dataPtr->sleepOffset * 0.99;
+    common::Time actualSleep;
+    if (sleepTime > 0)
+    {
+      common::Time::Sleep(sleepTime);
+      actualSleep = common::Time::GetWallTime() - tmpTime;
+    }
+    else
+      sleepTime = 0;
 
+    // exponentially avg out
+    this->dataPtr->sleepOffset = (actualSleep - sleepTime) * 0.01 +
+                        this->dataPtr->sleepOffset * 0.99;
+  }
+
+  GZ_PROFILE_END();
   IGN_PROFILE_END();
   DIAG_TIMER_LAP("World::Step", "sleepOffset");
 
   IGN_PROFILE_BEGIN("worldUpdateMutex");
   // throttling update rate, with sleepOffset as tolerance
-  // the tolerance is needed as the sleep time is not exact
-  if (common::Time::GetWallTime() - this->dataPtr->prevStepWallTime +
+  // the tolerance is needed as the sleep time is not exact.
+  // Precise pacing has already waited until the update is due.
+  if (this->dataPtr->precisePacing ||
+      common::Time::GetWallTime() - this->dataPtr->prevStepWallTime +
       this->dataPtr->sleepOffset >= common::Time(updatePeriod))
   {
     std::lock_guard<std::recursive_mutex> lock(this->dataPtr->worldUpdateMutex);
@@ -821,6 +1030,17 @@ void World::Step()
 
     this->dataPtr->prevStepWallTime = common::Time::GetWallTime();
 
+    // Measure the update period on a monotonic clock
+    auto now = std::chrono::steady_clock::now();
+    if (this->dataPtr->prevUpdateTime !=
+        std::chrono::steady_clock::time_point())
+    {
+      this->dataPtr->stepPeriodStats.InsertData(
+          std::chrono::duration<double>(
+            now - this->dataPtr->prevUpdateTime).count());
+    }
+    this->dataPtr->prevUpdateTime = now;
+
     double stepTime = this->dataPtr->physicsEngine->GetMaxStepSize();
 
     if (!this->IsPaused() || this->dataPtr->stepInc > 0
@@ -851,7 +1071,9 @@ void World::Step()
   IGN_PROFILE_END();
 
   IGN_PROFILE_BEGIN("ProcessMessages");
+  GZ_PROFILE_BEGIN("World::Step::ProcessMessages");
   this->ProcessMessages();
+  GZ_PROFILE_END();
   IGN_PROFILE_END();
 
   DIAG_TIMER_STOP("World::Step");
@@ -875,6 +1097,7 @@ void World::Step(const unsigned int _steps)
     std::lock_guard<std::recursive_mutex> lock(this->dataPtr->worldUpdateMutex);
     this->dataPtr->stepInc = _steps;
   }
+  this->WakePacing();
 
   // block on completion
   bool wait = true;
@@ -893,6 +1116,7 @@ void World::Update()
   DIAG_TIMER_START("World::Update");
 
   IGN_PROFILE("World::Update");
+  GZ_PROFILE("World::Update");
   IGN_PROFILE_BEGIN("needsReset");
   if (this->dataPtr->needsReset)
   {
@@ -909,25 +1133,32 @@ void World::Update()
   DIAG_TIMER_LAP("World::Update", "needsReset");
 
   IGN_PROFILE_BEGIN("worldUpdateBegin");
+  GZ_PROFILE_BEGIN("World::Update::worldUpdateBegin");
   this->dataPtr->updateInfo.simTime = this->SimTime();
   this->dataPtr->updateInfo.realTime = this->RealTime();
   event::Events::worldUpdateBegin(this->dataPtr->updateInfo);
+  GZ_PROFILE_END();
   IGN_PROFILE_END();
   DIAG_TIMER_LAP("World::Update", "Events::worldUpdateBegin");
 
   IGN_PROFILE_BEGIN("Update");
+  GZ_PROFILE_BEGIN("World::Update::ModelUpdate");
   // Update all the models
   (*this.*dataPtr->modelUpdateFunc)();
+  GZ_PROFILE_END();
   IGN_PROFILE_END();
   DIAG_TIMER_LAP("World::Update", "Model::Update");
 
   IGN_PROFILE_BEGIN("UpdateCollision");
+  GZ_PROFILE_BEGIN("World::Update::UpdateCollision");
   // This must be called before PhysicsEngine::UpdatePhysics for ODE.
   this->dataPtr->physicsEngine->UpdateCollision();
+  GZ_PROFILE_END();
   IGN_PROFILE_END();
   DIAG_TIMER_LAP("World::Update", "PhysicsEngine::UpdateCollision");
 
   IGN_PROFILE_BEGIN("beforePhysicsUpdate");
+  GZ_PROFILE_BEGIN("World::Update::beforePhysicsUpdate");
   // Wait for logging to finish, if it's running.
   if (util::LogRecord::Instance()->Running())
   {
@@ -948,6 +1179,7 @@ void World::Update()
   this->dataPtr->updateInfo.realTime = this->RealTime();
   event::Events::beforePhysicsUpdate(this->dataPtr->updateInfo);
 
+  GZ_PROFILE_END();
   IGN_PROFILE_END();
   DIAG_TIMER_LAP("World::Update", "Events::beforePhysicsUpdate");
 
@@ -955,9 +1187,11 @@ void World::Update()
   if (this->dataPtr->enablePhysicsEngine && this->dataPtr->physicsEngine)
   {
     IGN_PROFILE_BEGIN("UpdatePhysics");
+    GZ_PROFILE_BEGIN("World::Update::UpdatePhysics");
     // This must be called directly after PhysicsEngine::UpdateCollision.
     this->dataPtr->physicsEngine->UpdatePhysics();
 
+    GZ_PROFILE_END();
     IGN_PROFILE_END();
     DIAG_TIMER_LAP("World::Update", "PhysicsEngine::UpdatePhysics");
 
@@ -966,6 +1200,7 @@ void World::Update()
     //           and we need to propagate it into Entity::worldPose
     {
       IGN_PROFILE_BEGIN("SetWorldPose(dirtyPoses)");
+      GZ_PROFILE("World::Update::SetWorldPose");
       // block any other pose updates (e.g. Joint::SetPosition)
       boost::recursive_mutex::scoped_lock plock(
           *this->Physics()->GetPhysicsUpdateMutex());
@@ -990,13 +1225,17 @@ void World::Update()
   DIAG_TIMER_LAP("World::Update", "LogRecordNotify");
 
   IGN_PROFILE_BEGIN("PublishContacts");
+  GZ_PROFILE_BEGIN("World::Update::PublishContacts");
   // Output the contact information
   this->dataPtr->physicsEngine->GetContactManager()->PublishContacts();
 
+  GZ_PROFILE_END();
   IGN_PROFILE_END();
   DIAG_TIMER_LAP("World::Update", "ContactManager::PublishContacts");
 
+  GZ_PROFILE_BEGIN("World::Update::worldUpdateEnd");
   event::Events::worldUpdateEnd();
+  GZ_PROFILE_END();
 
   gazebo::util::IntrospectionManager::Instance()->Update();
 
@@ -1007,6 +1246,7 @@ void World::Update()
 void World::Fini()
 {
   this->dataPtr->stop = true;
+  this->WakePacing();
   this->dataPtr->enablePhysicsEngine = false;
 
   // wait until World::Step has completed before proceeding
@@ -1363,6 +1603,167 @@ RoadPtr World::LoadRoad(sdf::ElementPtr _sdf , BasePtr _parent)
   return road;
 }
 
+//////////////////////////////////////////////////
+/// \brief Collect the mesh URIs of the collisions of a model and of its
+/// nested models.
+/// \param[in] _sdf Model SDF element.
+/// \param[out] _uris Absolute mesh URIs.
+static void collectModelMeshes(const sdf::ElementPtr &_sdf,
+    std::set<std::string> &_uris)
+{
+  for (auto linkElem = _sdf->HasElement("link") ?
+       _sdf->GetElement("link") : nullptr; linkElem;
+       linkElem = linkElem->GetNextElement("link"))
+  {
+    for (auto collElem = linkElem->HasElement("collision") ?
+         linkElem->GetElement("collision") : nullptr; collElem;
+         collElem = collElem->GetNextElement("collision"))
+    {
+      if (!collElem->HasElement("geometry"))
+        continue;
+      sdf::ElementPtr geomElem = collElem->GetElement("geometry");
+      if (!geomElem->HasElement("mesh"))
+        continue;
+      sdf::ElementPtr meshElem = geomElem->GetElement("mesh");
+      if (!meshElem->HasElement("uri"))
+        continue;
+
+      // Same resolution as MeshShape::Init
+      _uris.insert(common::asFullPath(meshElem->Get<std::string>("uri"),
+          meshElem->FilePath()));
+    }
+  }
+
+  for (auto modelElem = _sdf->HasElement("model") ?
+       _sdf->GetElement("model") : nullptr; modelElem;
+       modelElem = modelElem->GetNextElement("model"))
+  {
+    collectModelMeshes(modelElem, _uris);
+  }
+}
+
+//////////////////////////////////////////////////
+void World::PreloadMeshes(const sdf::ElementPtr &_sdf)
+{
+  // Meshes are keyed by their resolved filename, except for actor skins
+  // and animations which are loaded by the name given in the SDF.
+  std::set<std::string> uris;
+  std::set<std::string> names;
+
+  for (auto modelElem = _sdf->HasElement("model") ?
+       _sdf->GetElement("model") : nullptr; modelElem;
+       modelElem = modelElem->GetNextElement("model"))
+  {
+    collectModelMeshes(modelElem, uris);
+  }
+
+  common::MeshManager *meshManager = common::MeshManager::Instance();
+  for (auto actorElem = _sdf->HasElement("actor") ?
+       _sdf->GetElement("actor") : nullptr; actorElem;
+       actorElem = actorElem->GetNextElement("actor"))
+  {
+    if (actorElem->HasElement("skin"))
+    {
+      names.insert(
+          actorElem->GetElement("skin")->Get<std::string>("filename"));
+    }
+    for (auto animElem = actorElem->HasElement("animation") ?
+         actorElem->GetElement("animation") : nullptr; animElem;
+         animElem = animElem->GetNextElement("animation"))
+    {
+      std::string filename = animElem->Get<std::string>("filename");
+      if (meshManager->IsValidFilename(filename))
+        names.insert(filename);
+    }
+  }
+
+  // Resolve the filenames serially. find_file may download a model through
+  // the ModelDatabase, and neither that nor the SystemPaths lists are meant
+  // to be used from several threads at once.
+  std::vector<std::pair<std::string, std::string>> work;
+  for (auto const &uri : uris)
+  {
+    if (!meshManager->IsValidFilename(uri) || meshManager->HasMesh(uri))
+      continue;
+
+    std::string filename;
+    try
+    {
+      filename = common::find_file(uri);
+    }
+    catch(common::Exception &_e)
+    {
+      gzwarn << "Unable to find mesh[" << uri << "] to preload: "
+             << _e.GetErrorStr() << std::endl;
+    }
+
+    // Missing files are reported when the entities load the same meshes
+    if (!filename.empty() && !meshManager->HasMesh(filename))
+      work.push_back(std::make_pair(uri, filename));
+  }
+
+  // Actor meshes are loaded by the name given in the SDF, which
+  // MeshManager::Load resolves itself, so they are loaded serially as well.
+  for (auto const &name : names)
+  {
+    if (meshManager->HasMesh(name))
+      continue;
+
+    try
+    {
+      meshManager->Load(name);
+    }
+    catch(common::Exception &_e)
+    {
+      gzwarn << "Unable to preload mesh[" << name << "]: "
+             << _e.GetErrorStr() << std::endl;
+    }
+  }
+
+  if (work.size() < 2u)
+  {
+    for (auto const &entry : work)
+      this->PreloadMesh(entry.first, entry.second);
+    return;
+  }
+
+  common::Time startTime = common::Time::GetWallTime();
+
+  // Parsing dominates the load time of mesh-heavy worlds, and is
+  // independent per mesh. The filenames are absolute paths to existing
+  // files, so MeshManager::Load doesn't look them up again.
+  tbb::parallel_for(tbb::blocked_range<size_t>(0, work.size(), 1),
+      [&](const tbb::blocked_range<size_t> &_r)
+  {
+    for (size_t i = _r.begin(); i != _r.end(); ++i)
+      this->PreloadMesh(work[i].first, work[i].second);
+  });
+
+  gzlog << "Preloaded " << work.size() << " meshes in "
+        << (common::Time::GetWallTime() - startTime).Double() << " s\n";
+}
+
+//////////////////////////////////////////////////
+void World::PreloadMesh(const std::string &_uri, const std::string &_filename)
+{
+  // An exception must not escape a parallel_for, which would cancel the
+  // other meshes and lose the failing one.
+  try
+  {
+    common::MeshManager::Instance()->Load(_filename);
+  }
+  catch(common::Exception &_e)
+  {
+    gzwarn << "Unable to preload mesh[" << _uri << "]: "
+           << _e.GetErrorStr() << std::endl;
+  }
+  catch(std::exception &_e)
+  {
+    gzwarn << "Unable to preload mesh[" << _uri << "]: " << _e.what()
+           << std::endl;
+  }
+}
+
 //////////////////////////////////////////////////
 void World::LoadEntities(sdf::ElementPtr _sdf, BasePtr _parent)
 {
@@ -1506,6 +1907,7 @@ void World::Reset()
 void World::OnStep()
 {
   this->dataPtr->stepInc = 1;
+  this->WakePacing();
 }
 
 //////////////////////////////////////////////////
@@ -1577,6 +1979,9 @@ void World::SetPaused(const bool _p)
     this->dataPtr->pause = _p;
   }
 
+  if (!_p)
+    this->WakePacing();
+
   if (_p)
   {
     // This is also a good time to clear out the logging buffer.
@@ -1822,6 +2227,9 @@ void World::LoadPlugin(const std::string &_filename,
             << "Plugin filename[" << _filename << "] name[" << _name << "]\n";
       return;
     }
+    // Attribute the event callbacks of the plugin to it
+    event::ConnectionOwner owner(_filename, this->Name() + "::" + _name);
+
     plugin->Load(shared_from_this(), _sdf);
     this->dataPtr->plugins.push_back(plugin);
 
@@ -2963,6 +3371,36 @@ void World::PublishWorldStats()
   this->dataPtr->worldStatsMsg.set_iterations(this->dataPtr->iterations);
   this->dataPtr->worldStatsMsg.set_paused(this->IsPaused());
 
+  // Report the update period over the last second
+  common::Time wallTime = common::Time::GetWallTime();
+  if (wallTime - this->dataPtr->stepPeriodStatsTime >= common::Time(1, 0))
+  {
+    if (this->dataPtr->stepPeriodStats.Count() > 0)
+    {
+      std::map<std::string, double> values =
+        this->dataPtr->stepPeriodStats.Map();
+      msgs::WorldStatistics::StepPeriod &period = this->dataPtr->stepPeriodMsg;
+      period.set_target(this->dataPtr->physicsEngine->GetUpdatePeriod());
+      period.set_count(this->dataPtr->stepPeriodStats.Count());
+      period.set_mean(values["mean"]);
+      period.set_min(values["min"]);
+      period.set_max(values["max"]);
+      period.set_jitter(std::sqrt(std::max(0.0, values["var"])));
+      this->dataPtr->stepPeriodStats.Reset();
+    }
+    this->dataPtr->ioThreadUtilization = transport::getIOThreadUtilization();
+    this->dataPtr->stepPeriodStatsTime = wallTime;
+  }
+
+  if (this->dataPtr->stepPeriodMsg.has_count())
+  {
+    this->dataPtr->worldStatsMsg.mutable_step_period()->CopyFrom(
+        this->dataPtr->stepPeriodMsg);
+  }
+
+  for (auto const utilization : this->dataPtr->ioThreadUtilization)
+    this->dataPtr->worldStatsMsg.add_io_thread_utilization(utilization);
+
   if (util::LogPlay::Instance()->IsOpen())
   {
     msgs::LogPlaybackStatistics logStats;
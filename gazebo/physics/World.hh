@@ -464,6 +464,49 @@ namespace gazebo
       /// \param[in] _func function to be called
       public: void SetSensorWaitFunc(std::function<void(double, double)> _func);
 
+      /// \brief Enable precise real time pacing. The world thread then
+      /// sleeps until shortly before the next update is due and spins on a
+      /// monotonic clock for the rest of the wait. This keeps the update
+      /// period stable at rates of a few kHz, at the cost of a busy core.
+      /// \param[in] _enable True to enable precise pacing.
+      public: void SetPrecisePacing(const bool _enable);
+
+      /// \brief Get whether precise real time pacing is enabled.
+      /// \return True if precise pacing is enabled.
+      public: bool PrecisePacing() const;
+
+      /// \brief Set how long before an update is due precise pacing stops
+      /// sleeping and starts spinning. It should cover the wake up latency
+      /// of the system.
+      /// \param[in] _time Spin time.
+      public: void SetPacingSpinTime(const common::Time &_time);
+
+      /// \brief Get how long before an update is due precise pacing
+      /// starts spinning.
+      /// \return Spin time.
+      public: common::Time PacingSpinTime() const;
+
+      /// \brief Pin the thread that runs the world to a CPU. Only supported
+      /// on Linux.
+      /// \param[in] _cpu Index of the CPU, -1 to leave the thread as is.
+      public: void SetThreadAffinity(const int _cpu);
+
+      /// \brief Get the CPU the thread that runs the world is pinned to.
+      /// \return Index of the CPU, -1 if not pinned.
+      public: int ThreadAffinity() const;
+
+      /// \brief Run the thread that runs the world with a real time
+      /// (SCHED_FIFO) priority. This usually requires the CAP_SYS_NICE
+      /// capability or a suitable rtprio limit.
+      /// \param[in] _priority Real time priority, 0 to leave the thread
+      /// as is.
+      public: void SetThreadPriority(const int _priority);
+
+      /// \brief Get the real time priority of the thread that runs the
+      /// world.
+      /// \return Real time priority, 0 if not set.
+      public: int ThreadPriority() const;
+
       /// \brief Set Visual shininess value by scoped name
       /// \param[in] _scopedName Scoped name of visual.
       /// \param[in] _shininess Shininess value.
@@ -490,6 +533,20 @@ namespace gazebo
       /// \param[in] _parent Parent of the model to load.
       private: void LoadEntities(sdf::ElementPtr _sdf, BasePtr _parent);
 
+      /// \brief Resolve and load the collision and actor meshes used by
+      /// the entities of a world. Filenames are resolved serially, then the
+      /// meshes are parsed on a thread pool. LoadEntities then creates the engine
+      /// objects serially, finding the meshes already in the MeshManager.
+      /// \param[in] _sdf World SDF element.
+      private: void PreloadMeshes(const sdf::ElementPtr &_sdf);
+
+      /// \brief Load one mesh found by PreloadMeshes, reporting failures
+      /// instead of throwing.
+      /// \param[in] _uri Mesh URI given in the SDF.
+      /// \param[in] _filename Resolved filename of the mesh.
+      private: void PreloadMesh(const std::string &_uri,
+                   const std::string &_filename);
+
       /// \brief Load a model.
       /// \param[in] _sdf SDF element containing the Model description.
       /// \param[in] _parent Parent of the model.
@@ -521,6 +578,15 @@ namespace gazebo
       /// \brief Step the world once.
       private: void Step();
 
+      /// \brief Wait until the next update is due, sleeping and then
+      /// spinning on a monotonic clock. Used by precise pacing.
+      /// \param[in] _updatePeriod Real time update period in seconds.
+      private: void PaceStep(const double _updatePeriod);
+
+      /// \brief Wake precise pacing when the world is unpaused, stepped or
+      /// stopped.
+      private: void WakePacing();
+
       /// \brief Step the world once by reading from a log file.
       private: void LogStep();
 
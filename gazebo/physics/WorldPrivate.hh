@@ -18,6 +18,7 @@
 #define GAZEBO_PHYSICS_WORLDPRIVATE_HH_
 
 #include <atomic>
+#include <chrono>
 #include <deque>
 #include <vector>
 #include <list>
@@ -29,6 +30,7 @@
 #include <thread>
 #include <condition_variable>
 
+#include <ignition/math/SignalStats.hh>
 #include <ignition/transport.hh>
 
 #include "gazebo/common/Event.hh"
@@ -259,6 +261,48 @@ namespace gazebo
       /// \brief sleep timing error offset due to clock wake up latency
       public: common::Time sleepOffset;
 
+      /// \brief True to sleep and then spin until each update is due.
+      public: std::atomic<bool> precisePacing{false};
+
+      /// \brief Time before an update is due at which precise pacing
+      /// starts spinning, in nanoseconds.
+      public: std::atomic<int64_t> pacingSpinTime{500000};
+
+      /// \brief Time at which the last update was due with precise pacing.
+      public: std::chrono::steady_clock::time_point stepDeadline;
+
+      /// \brief Protects pacingWake.
+      public: std::mutex pacingMutex;
+
+      /// \brief Wakes precise pacing while the world is paused.
+      public: std::condition_variable pacingCondition;
+
+      /// \brief True when the world was unpaused, stepped or stopped while
+      /// precise pacing waits.
+      public: bool pacingWake = false;
+
+      /// \brief CPU the world thread is pinned to, -1 for none.
+      public: int threadAffinity = -1;
+
+      /// \brief Real time priority of the world thread, 0 for none.
+      public: int threadPriority = 0;
+
+      /// \brief Time of the last update, to measure the update period.
+      public: std::chrono::steady_clock::time_point prevUpdateTime;
+
+      /// \brief Statistics of the update period since the last report.
+      public: ignition::math::SignalStats stepPeriodStats;
+
+      /// \brief Last report of the update period statistics.
+      public: msgs::WorldStatistics::StepPeriod stepPeriodMsg;
+
+      /// \brief Wall time of the last update period report.
+      public: common::Time stepPeriodStatsTime;
+
+      /// \brief Utilization of each transport IO thread, measured with the
+      /// last update period report.
+      public: std::vector<double> ioThreadUtilization;
+
       /// \brief Last time incoming messages were processed.
       public: common::Time prevProcessMsgsTime;
 
@@ -116,3 +116,32 @@ void BulletMesh::CreateMesh(float *_vertices, int *_indices,
 
   _collision->SetCollisionShape(gimpactMeshShape);
 }
+
+/////////////////////////////////////////////////
+void BulletMesh::InitConvexHulls(const common::Mesh *_hulls,
+    BulletCollisionPtr _collision, const ignition::math::Vector3d &_scale)
+{
+  btCompoundShape *compoundShape = new btCompoundShape();
+
+  btTransform identity;
+  identity.setIdentity();
+
+  for (unsigned int h = 0; h < _hulls->GetSubMeshCount(); ++h)
+  {
+    const common::SubMesh *hull = _hulls->GetSubMesh(h);
+    if (hull->GetVertexCount() < 4)
+      continue;
+
+    btConvexHullShape *hullShape = new btConvexHullShape();
+    for (unsigned int i = 0; i < hull->GetVertexCount(); ++i)
+    {
+      ignition::math::Vector3d v = hull->Vertex(i) * _scale;
+      hullShape->addPoint(btVector3(v.X(), v.Y(), v.Z()), false);
+    }
+    hullShape->recalcLocalAabb();
+
+    compoundShape->addChildShape(identity, hullShape);
+  }
+
+  _collision->SetCollisionShape(compoundShape);
+}
@@ -56,6 +56,15 @@ namespace gazebo
                       BulletCollisionPtr _collision,
                       const ignition::math::Vector3d &_scale);
 
+      /// \brief Create a compound collision shape made of convex hulls.
+      /// \param[in] _hulls Mesh with one closed convex submesh per hull.
+      /// \param[in] _collision Pointer to the collision object.
+      /// \param[in] _scale Scaling factor.
+      /// \sa common::MeshSimplifier::ConvexDecomposition
+      public: void InitConvexHulls(const common::Mesh *_hulls,
+                      BulletCollisionPtr _collision,
+                      const ignition::math::Vector3d &_scale);
+
       /// \brief Helper function to create the collision shape.
       /// \param[in] _vertices Array of vertices.
       /// \param[in] _indices Array of indices.
@@ -60,7 +60,12 @@ void BulletMeshShape::Init()
   BulletCollisionPtr bParent =
     boost::static_pointer_cast<BulletCollision>(this->collisionParent);
 
-  if (this->submesh)
+  if (this->convexHulls)
+  {
+    this->bulletMesh->InitConvexHulls(this->convexHulls, bParent,
+        this->sdf->Get<ignition::math::Vector3d>("scale"));
+  }
+  else if (this->submesh)
   {
     this->bulletMesh->Init(this->submesh, bParent,
         this->sdf->Get<ignition::math::Vector3d>("scale"));
@@ -19,6 +19,7 @@
 #include <string>
 
 #include <ignition/common/Profiler.hh>
+#include <ignition/math/Helpers.hh>
 #include <ignition/math/Rand.hh>
 
 #include "gazebo/physics/bullet/BulletTypes.hh"
@@ -132,8 +133,15 @@ struct CollisionFilter : public btOverlapFilterCallback
 // Gets the contact information in the current state of
 // the world, updates the contact manager and
 // and sets the contact feedback information.
-void UpdateContacts(btDynamicsWorld *_world, btScalar _timeStep)
+void UpdateContacts(ContactManager *_contactManager,
+    const common::Time &_simTime, btDynamicsWorld *_world,
+    btScalar _timeStep)
 {
+  // The manifolds persist across steps, so walking them is only worth it
+  // when someone asked for the contacts.
+  if (!_contactManager->ContactsRequested())
+    return;
+
   int numManifolds = _world->getDispatcher()->getNumManifolds();
   for (int i = 0; i < numManifolds; ++i)
   {
@@ -167,15 +175,10 @@ void UpdateContacts(btDynamicsWorld *_world, btScalar _timeStep)
     if (!collisionPtr1 || !collisionPtr2)
       continue;
 
-    PhysicsEnginePtr engine = collisionPtr1->GetWorld()->Physics();
-    BulletPhysicsPtr bulletPhysics =
-          boost::static_pointer_cast<BulletPhysics>(engine);
-
     // Add a new contact to the manager. This will return nullptr if no one is
     // listening for contact information.
-    Contact *contactFeedback = bulletPhysics->GetContactManager()->NewContact(
-        collisionPtr1.get(), collisionPtr2.get(),
-        collisionPtr1->GetWorld()->SimTime());
+    Contact *contactFeedback = _contactManager->NewContact(
+        collisionPtr1.get(), collisionPtr2.get(), _simTime);
 
     if (!contactFeedback)
       continue;
@@ -235,7 +238,12 @@ void UpdateContacts(btDynamicsWorld *_world, btScalar _timeStep)
 //////////////////////////////////////////////////
 void InternalTickCallback(btDynamicsWorld *_world, btScalar _timeStep)
 {
-  UpdateContacts(_world, _timeStep);
+  BulletPhysics *physics =
+      static_cast<BulletPhysics *>(_world->getWorldUserInfo());
+  GZ_ASSERT(physics != nullptr, "Bullet world user info is null");
+
+  UpdateContacts(physics->GetContactManager(),
+      physics->World()->SimTime(), _world, _timeStep);
 }
 
 //////////////////////////////////////////////////
@@ -267,9 +275,6 @@ BulletPhysics::BulletPhysics(WorldPtr _world)
   // Default setup for memory and collisions
   this->collisionConfig = new btDefaultCollisionConfiguration();
 
-  // Default collision dispatcher, a multi-threaded dispatcher may be available
-  this->dispatcher = new btCollisionDispatcher(this->collisionConfig);
-
   // Broadphase collision detection uses axis-aligned bounding boxes (AABB)
   // to detect pairs of objects that may be in contact.
   // The narrow-phase collision detection evaluates each pair generated by the
@@ -282,16 +287,12 @@ BulletPhysics::BulletPhysics(WorldPtr _world)
   // Here we are using btDbvtBroadphase.
   this->broadPhase = new btDbvtBroadphase();
 
-  // Create btSequentialImpulseConstraintSolver, the default constraint solver.
-  // Note that a multi-threaded solver may be available.
-  this->solver = new btSequentialImpulseConstraintSolver;
-
-  // Create a btDiscreteDynamicsWorld, which is used for discrete rigid bodies.
-  // An alternative is btSoftRigidDynamicsWorld, which handles both soft and
-  // rigid bodies.
-  this->dynamicsWorld = new btDiscreteDynamicsWorld(this->dispatcher,
-      this->broadPhase, this->solver, this->collisionConfig);
+  // The dispatcher, solver and dynamics world are single threaded until
+  // Load() reads the solver type.
+  this->CreateDynamicsWorld(false);
 
+  // The overlapping pair cache belongs to the broadphase, so the filter
+  // survives a new dynamics world.
   btOverlapFilterCallback *filterCallback = new CollisionFilter();
   btOverlappingPairCache* pairCache = this->dynamicsWorld->getPairCache();
   GZ_ASSERT(pairCache != nullptr,
@@ -302,14 +303,9 @@ BulletPhysics::BulletPhysics(WorldPtr _world)
   gContactAddedCallback = ContactCallback;
   gContactProcessedCallback = ContactProcessed;
 
-  this->dynamicsWorld->setInternalTickCallback(
-      InternalTickCallback, static_cast<void *>(this));
-
   // Set random seed for physics engine based on gazebo's random seed.
   // Note: this was moved from physics::PhysicsEngine constructor.
   this->SetSeed(ignition::math::Rand::Seed());
-
-  btGImpactCollisionAlgorithm::registerAlgorithm(dispatcher);
 }
 
 //////////////////////////////////////////////////
@@ -325,6 +321,34 @@ void BulletPhysics::Load(sdf::ElementPtr _sdf)
 
   sdf::ElementPtr bulletElem = this->sdf->GetElement("bullet");
 
+  // Bodies are only added after the physics engine is loaded, so the
+  // dynamics world can still be replaced by a multithreaded one here.
+  this->solverType = bulletElem->GetElement("solver")->Get<std::string>("type");
+  if (this->solverType == "parallel_sequential_impulse")
+  {
+    if (!this->CreateDynamicsWorld(true))
+    {
+      gzwarn << "Falling back to the 'sequential_impulse' solver"
+             << std::endl;
+      this->solverType = "sequential_impulse";
+    }
+    else
+    {
+      // The SDF schema has no thread count for Bullet, so it is read from
+      // a custom element.
+      const std::string kThreadsElement = "ignition:threads";
+      sdf::ElementPtr solverElem = bulletElem->GetElement("solver");
+      if (solverElem->HasElement(kThreadsElement))
+        this->SetParam("threads", solverElem->Get<int>(kThreadsElement));
+    }
+  }
+  else if (this->solverType != "sequential_impulse")
+  {
+    gzwarn << "Unknown solver type [" << this->solverType
+           << "], using 'sequential_impulse'" << std::endl;
+    this->solverType = "sequential_impulse";
+  }
+
   auto g = this->world->Gravity();
   // ODEPhysics checks this, so we will too.
   if (g == ignition::math::Vector3d::Zero)
@@ -511,7 +535,8 @@ void BulletPhysics::UpdateCollision()
     // In addition, the contacts have to be updated in the contact
     // manager and for the feedback.
     IGN_PROFILE_BEGIN("UpdateContacts");
-    UpdateContacts(this->dynamicsWorld, this->maxStepSize);
+    UpdateContacts(this->contactManager, this->world->SimTime(),
+        this->dynamicsWorld, this->maxStepSize);
     IGN_PROFILE_END();
   }
 }
@@ -542,6 +567,10 @@ void BulletPhysics::Fini()
     delete this->solver;
   this->solver = nullptr;
 
+  if (this->solverPool)
+    delete this->solverPool;
+  this->solverPool = nullptr;
+
   if (this->broadPhase)
     delete this->broadPhase;
   this->broadPhase = nullptr;
@@ -568,6 +597,84 @@ void BulletPhysics::Reset()
 
 //////////////////////////////////////////////////
 
+//////////////////////////////////////////////////
+bool BulletPhysics::CreateDynamicsWorld(const bool _multithreaded)
+{
+  // Delete in reverse-order of creation, the broadphase and collision
+  // configuration are kept.
+  delete this->dynamicsWorld;
+  this->dynamicsWorld = nullptr;
+  delete this->solver;
+  this->solver = nullptr;
+  delete this->solverPool;
+  this->solverPool = nullptr;
+  delete this->dispatcher;
+  this->dispatcher = nullptr;
+
+  this->multithreaded = false;
+
+#ifdef LIBBULLET_VERSION_GT_287
+  if (_multithreaded)
+  {
+    // Bullet uses a single global task scheduler, which is shared by all
+    // multithreaded worlds and never deleted.
+    static btITaskScheduler *scheduler = btCreateDefaultTaskScheduler();
+    if (scheduler)
+    {
+      btSetTaskScheduler(scheduler);
+
+      // Collision pairs are processed in parallel
+      this->dispatcher = new btCollisionDispatcherMt(this->collisionConfig);
+
+      // The islands are solved in parallel by a pool of solvers, and large
+      // islands are split between the threads by the Mt solver.
+      btConstraintSolverPoolMt *pool =
+          new btConstraintSolverPoolMt(scheduler->getMaxNumThreads());
+      this->solverPool = pool;
+      this->solver = new btSequentialImpulseConstraintSolverMt;
+
+      this->dynamicsWorld = new btDiscreteDynamicsWorldMt(this->dispatcher,
+          this->broadPhase, pool, this->solver, this->collisionConfig);
+
+      this->multithreaded = true;
+      gzmsg << "Bullet is using [" << scheduler->getNumThreads()
+            << "] threads" << std::endl;
+    }
+    else
+    {
+      gzwarn << "Bullet was built without a task scheduler, "
+             << "multithreading is not available" << std::endl;
+    }
+  }
+#else
+  if (_multithreaded)
+    gzwarn << "Multithreading requires Bullet 2.88 or newer" << std::endl;
+#endif
+
+  if (!this->multithreaded)
+  {
+    // Default collision dispatcher
+    this->dispatcher = new btCollisionDispatcher(this->collisionConfig);
+
+    // Create btSequentialImpulseConstraintSolver, the default constraint
+    // solver.
+    this->solver = new btSequentialImpulseConstraintSolver;
+
+    // Create a btDiscreteDynamicsWorld, which is used for discrete rigid
+    // bodies. An alternative is btSoftRigidDynamicsWorld, which handles both
+    // soft and rigid bodies.
+    this->dynamicsWorld = new btDiscreteDynamicsWorld(this->dispatcher,
+        this->broadPhase, this->solver, this->collisionConfig);
+  }
+
+  this->dynamicsWorld->setInternalTickCallback(
+      InternalTickCallback, static_cast<void *>(this));
+
+  btGImpactCollisionAlgorithm::registerAlgorithm(this->dispatcher);
+
+  return this->multithreaded == _multithreaded;
+}
+
 //////////////////////////////////////////////////
 void BulletPhysics::SetSORPGSIters(unsigned int _iters)
 {
@@ -593,18 +700,43 @@ bool BulletPhysics::SetParam(const std::string &_key, const boost::any &_value)
     if (_key == "solver_type")
     {
       std::string value = any_cast<std::string>(_value);
-      if (value == "sequential_impulse")
+      if (value == "sequential_impulse" ||
+          value == "parallel_sequential_impulse")
       {
+        // The dynamics world can't be replaced once it holds bodies
+        if (value != this->solverType)
+        {
+          gzwarn << "Solver type [" << value << "] takes effect when "
+                 << "the world is loaded" << std::endl;
+        }
         bulletElem->GetElement("solver")->GetElement("type")->Set(value);
-        this->solverType = value;
       }
       else
       {
-        gzwarn << "Currently only 'sequential_impulse' solver is supported"
+        gzwarn << "Currently only 'sequential_impulse' and "
+               << "'parallel_sequential_impulse' solvers are supported"
                << std::endl;
         return false;
       }
     }
+    else if (_key == "threads")
+    {
+      int value = any_cast<int>(_value);
+#ifdef LIBBULLET_VERSION_GT_287
+      if (!this->multithreaded)
+      {
+        gzwarn << "The number of threads is only used by the "
+               << "'parallel_sequential_impulse' solver" << std::endl;
+        return false;
+      }
+      btITaskScheduler *scheduler = btGetTaskScheduler();
+      scheduler->setNumThreads(ignition::math::clamp(value, 1,
+          scheduler->getMaxNumThreads()));
+#else
+      gzwarn << "Multithreading requires Bullet 2.88 or newer" << std::endl;
+      return false;
+#endif
+    }
     else if (_key == "cfm")
     {
       double value = any_cast<double>(_value);
@@ -721,6 +853,15 @@ bool BulletPhysics::GetParam(const std::string &_key, boost::any &_value) const
     _value = this->sdf->GetElement("max_contacts")->Get<int>();
   else if (_key == "min_step_size")
     _value = bulletElem->GetElement("solver")->Get<double>("min_step_size");
+  else if (_key == "threads")
+  {
+    int threads = 1;
+#ifdef LIBBULLET_VERSION_GT_287
+    if (this->multithreaded)
+      threads = btGetTaskScheduler()->getNumThreads();
+#endif
+    _value = threads;
+  }
   else
   {
     return PhysicsEngine::GetParam(_key, _value);
@@ -172,11 +172,27 @@ namespace gazebo
       // Documentation inherited
       public: virtual void SetSORPGSIters(unsigned int iters);
 
+      /// \brief Create the collision dispatcher, constraint solver and
+      /// dynamics world, deleting the previous ones. The world must not
+      /// contain any bodies.
+      /// \param[in] _multithreaded True to create the multithreaded
+      /// versions, which need Bullet 2.88 built with a task scheduler.
+      /// \return False if multithreading was requested but is not
+      /// available, in which case the single threaded versions are created.
+      private: bool CreateDynamicsWorld(const bool _multithreaded);
+
       private: btBroadphaseInterface *broadPhase;
       private: btDefaultCollisionConfiguration *collisionConfig;
-      private: btCollisionDispatcher *dispatcher;
-      private: btSequentialImpulseConstraintSolver *solver;
-      private: btDiscreteDynamicsWorld *dynamicsWorld;
+      private: btCollisionDispatcher *dispatcher = nullptr;
+      private: btSequentialImpulseConstraintSolver *solver = nullptr;
+      private: btDiscreteDynamicsWorld *dynamicsWorld = nullptr;
+
+      /// \brief Pool of solvers of the multithreaded dynamics world, null
+      /// when single threaded.
+      private: btConstraintSolver *solverPool = nullptr;
+
+      /// \brief True if the dynamics world is multithreaded.
+      private: bool multithreaded = false;
 
       private: common::Time lastUpdateTime;
 
@@ -16,9 +16,12 @@
 */
 
 #include <gtest/gtest.h>
+#include <map>
+#include <mutex>
 #include <string>
 
 #include "gazebo/physics/physics.hh"
+#include "gazebo/physics/ContactManager.hh"
 #include "gazebo/physics/PhysicsEngine.hh"
 #include "gazebo/physics/bullet/BulletPhysics.hh"
 #include "gazebo/physics/bullet/BulletTypes.hh"
@@ -30,6 +33,13 @@ using namespace physics;
 
 class BulletPhysics_TEST : public ServerFixture
 {
+  /// \brief Load a world, step it, and get the final link positions.
+  /// \param[in] _worldFile World to load.
+  /// \param[out] _threads Number of solver threads.
+  /// \return Final position of the link of each model.
+  public: std::map<std::string, ignition::math::Vector3d> StepPile(
+              const std::string &_worldFile, int &_threads);
+
   public: void PhysicsMsgParam();
   public: void OnPhysicsMsgResponse(ConstResponsePtr &_msg);
   public: static msgs::Physics physicsPubMsg;
@@ -39,6 +49,23 @@ class BulletPhysics_TEST : public ServerFixture
 msgs::Physics BulletPhysics_TEST::physicsPubMsg;
 msgs::Physics BulletPhysics_TEST::physicsResponseMsg;
 
+/// \brief Number of contact messages received.
+static unsigned int g_contactMsgCount = 0;
+
+/// \brief Number of contacts in the last contact message.
+static int g_contactCount = 0;
+
+/// \brief Mutex to protect the contact message data.
+static std::mutex g_contactMutex;
+
+/////////////////////////////////////////////////
+void OnContacts(ConstContactsPtr &_msg)
+{
+  std::lock_guard<std::mutex> lock(g_contactMutex);
+  ++g_contactMsgCount;
+  g_contactCount = _msg->contact_size();
+}
+
 /////////////////////////////////////////////////
 /// Test setting and getting bullet physics params
 TEST_F(BulletPhysics_TEST, PhysicsParam)
@@ -180,6 +207,191 @@ TEST_F(BulletPhysics_TEST, PhysicsParam)
   EXPECT_DOUBLE_EQ(maxStepSize, maxStepSizeRet);
 }
 
+/////////////////////////////////////////////////
+/// Test the parameters of the multithreaded solver
+TEST_F(BulletPhysics_TEST, SolverThreads)
+{
+  Load("worlds/empty.world", true, "bullet");
+  WorldPtr world = get_world("default");
+  ASSERT_TRUE(world != nullptr);
+
+  PhysicsEnginePtr physics = world->Physics();
+  ASSERT_TRUE(physics != nullptr);
+
+  // The default world is single threaded
+  EXPECT_EQ(1, boost::any_cast<int>(physics->GetParam("threads")));
+  EXPECT_FALSE(physics->SetParam("threads", 2));
+
+  // The parallel solver is accepted, but only used by the next load
+  EXPECT_TRUE(physics->SetParam("solver_type",
+      std::string("parallel_sequential_impulse")));
+  EXPECT_EQ("parallel_sequential_impulse",
+      boost::any_cast<std::string>(physics->GetParam("solver_type")));
+  EXPECT_EQ(1, boost::any_cast<int>(physics->GetParam("threads")));
+
+  EXPECT_FALSE(physics->SetParam("solver_type", std::string("unknown")));
+}
+
+/////////////////////////////////////////////////
+std::map<std::string, ignition::math::Vector3d> BulletPhysics_TEST::StepPile(
+    const std::string &_worldFile, int &_threads)
+{
+  std::map<std::string, ignition::math::Vector3d> positions;
+
+  Load(_worldFile, true);
+  WorldPtr world = get_world("default");
+  EXPECT_TRUE(world != nullptr);
+  if (!world)
+    return positions;
+
+  PhysicsEnginePtr physics = world->Physics();
+  EXPECT_EQ("bullet", physics->GetType());
+  _threads = boost::any_cast<int>(physics->GetParam("threads"));
+
+  // Let the stacks settle on each other and on the ground
+  world->Step(2000);
+
+  for (auto const &model : world->Models())
+  {
+    LinkPtr link = model->GetLink("link");
+    if (link)
+      positions[model->GetName()] = link->WorldPose().Pos();
+  }
+
+  Unload();
+  return positions;
+}
+
+/////////////////////////////////////////////////
+/// Step a contact heavy world with the multithreaded solver, and compare
+/// the result with the sequential solver
+TEST_F(BulletPhysics_TEST, ParallelSolverPile)
+{
+#ifndef LIBBULLET_VERSION_GT_287
+  gzerr << "Multithreading requires Bullet 2.88 or newer, skipping test"
+        << std::endl;
+  return;
+#endif
+
+  int threads = 0;
+  std::map<std::string, ignition::math::Vector3d> sequential =
+      StepPile("test/worlds/bullet_box_pile.world", threads);
+  EXPECT_EQ(1, threads);
+
+  std::map<std::string, ignition::math::Vector3d> parallel =
+      StepPile("test/worlds/bullet_box_pile_parallel.world", threads);
+  if (threads == 1)
+  {
+    gzerr << "Bullet was built without a task scheduler, "
+          << "the parallel solver is not tested" << std::endl;
+    return;
+  }
+
+  // The thread count is read from the world file
+  EXPECT_EQ(4, threads);
+
+  ASSERT_EQ(48u, sequential.size());
+  ASSERT_EQ(sequential.size(), parallel.size());
+
+  // The solvers visit the constraints in a different order, so the piles
+  // only match to within a small tolerance
+  for (auto const &pos : sequential)
+  {
+    auto iter = parallel.find(pos.first);
+    ASSERT_TRUE(iter != parallel.end()) << pos.first;
+
+    // Nothing sinks into the ground or into the box below it
+    EXPECT_GT(iter->second.Z(), 0.2) << pos.first;
+    EXPECT_NEAR(pos.second.X(), iter->second.X(), 0.02) << pos.first;
+    EXPECT_NEAR(pos.second.Y(), iter->second.Y(), 0.02) << pos.first;
+    EXPECT_NEAR(pos.second.Z(), iter->second.Z(), 0.01) << pos.first;
+  }
+}
+
+/////////////////////////////////////////////////
+/// Test that contacts are only extracted when requested
+TEST_F(BulletPhysics_TEST, ContactsRequested)
+{
+  Load("test/worlds/box.world", true, "bullet");
+  WorldPtr world = get_world("default");
+  ASSERT_TRUE(world != nullptr);
+
+  PhysicsEnginePtr physics = world->Physics();
+  ASSERT_TRUE(physics != nullptr);
+  ContactManager *manager = physics->GetContactManager();
+  ASSERT_TRUE(manager != nullptr);
+
+  // The box rests on the ground, but no one asked for the contacts, so
+  // the manifolds are never walked
+  for (int i = 0; i < 100; ++i)
+  {
+    world->Step(1);
+    ASSERT_FALSE(manager->ContactsRequested());
+    ASSERT_EQ(0u, manager->GetContactCount());
+    ASSERT_TRUE(manager->GetContacts().empty());
+  }
+
+  manager->SetNeverDropContacts(true);
+  world->Step(1);
+  EXPECT_GT(manager->GetContactCount(), 0u);
+
+  manager->SetNeverDropContacts(false);
+  world->Step(1);
+  EXPECT_EQ(0u, manager->GetContactCount());
+
+  // A subscriber to the contact topic requests contacts
+  transport::NodePtr node(new transport::Node());
+  node->Init();
+  transport::SubscriberPtr sub =
+    node->Subscribe("~/physics/contacts", &OnContacts);
+
+  int sleep = 0;
+  const int maxSleep = 100;
+  while (!manager->ContactsRequested() && sleep++ < maxSleep)
+    common::Time::MSleep(10);
+  ASSERT_TRUE(manager->ContactsRequested());
+
+  sleep = 0;
+  while (sleep++ < maxSleep)
+  {
+    world->Step(1);
+    {
+      std::lock_guard<std::mutex> lock(g_contactMutex);
+      if (g_contactMsgCount > 0u && g_contactCount > 0)
+        break;
+    }
+    common::Time::MSleep(10);
+  }
+  {
+    std::lock_guard<std::mutex> lock(g_contactMutex);
+    EXPECT_GT(g_contactMsgCount, 0u);
+    EXPECT_GT(g_contactCount, 0);
+  }
+
+  // Once the subscriber is gone, contacts are neither extracted nor
+  // published
+  sub.reset();
+  sleep = 0;
+  while (manager->ContactsRequested() && sleep++ < maxSleep)
+    common::Time::MSleep(10);
+  ASSERT_FALSE(manager->ContactsRequested());
+
+  // Let messages that are already queued arrive
+  common::Time::MSleep(200);
+  {
+    std::lock_guard<std::mutex> lock(g_contactMutex);
+    g_contactMsgCount = 0u;
+  }
+  for (int i = 0; i < 10; ++i)
+  {
+    world->Step(1);
+    EXPECT_EQ(0u, manager->GetContactCount());
+  }
+  common::Time::MSleep(200);
+  std::lock_guard<std::mutex> lock(g_contactMutex);
+  EXPECT_EQ(0u, g_contactMsgCount);
+}
+
 /////////////////////////////////////////////////
 void BulletPhysics_TEST::OnPhysicsMsgResponse(ConstResponsePtr &_msg)
 {
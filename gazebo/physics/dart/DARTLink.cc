@@ -258,11 +258,17 @@ void DARTLink::Init()
   // We don't add dart body node to the skeleton here because dart body node
   // should be set its parent joint before being added. This body node will be
   // added to the skeleton in DARTModel::Init().
+
+  // Synchronize the pose of this link after every step
+  this->dataPtr->dartPhysics->AddDARTLink(this);
 }
 
 //////////////////////////////////////////////////
 void DARTLink::Fini()
 {
+  if (this->dataPtr->dartPhysics)
+    this->dataPtr->dartPhysics->RemoveDARTLink(this);
+
   Link::Fini();
 }
 
@@ -964,8 +970,20 @@ void DARTLink::updateDirtyPoseFromDARTTransformation()
 
   // Step 1: get dart body's transformation
   // Step 2: set gazebo link's pose using the transformation
-  ignition::math::Pose3d newPose = DARTTypes::ConvPoseIgn(
-      this->dataPtr->dtBodyNode->getTransform());
+  const Eigen::Isometry3d &dtTransform =
+      this->dataPtr->dtBodyNode->getTransform();
+
+  // Skip the link if DART did not move it since the last update, which
+  // saves World::Update() from setting the pose of static and resting links.
+  if (this->dataPtr->syncedTransformValid &&
+      dtTransform.matrix() == this->dataPtr->syncedTransform.matrix())
+  {
+    return;
+  }
+  this->dataPtr->syncedTransform = dtTransform;
+  this->dataPtr->syncedTransformValid = true;
+
+  ignition::math::Pose3d newPose = DARTTypes::ConvPoseIgn(dtTransform);
 
   // Set the new pose to this link
   this->dirtyPose = newPose;
@@ -162,6 +162,13 @@ namespace gazebo
       /// \brief Pointer to the DART BodyNode.
       public: dart::dynamics::BodyNode *dtBodyNode;
 
+      /// \brief Transform of dtBodyNode when the pose of the link was last
+      /// updated from DART.
+      public: Eigen::Isometry3d syncedTransform;
+
+      /// \brief True if syncedTransform was set.
+      public: bool syncedTransformValid = false;
+
       /// \brief List of pairs of slave BodyNodes and weld constraints.
       public: std::vector<std::pair <dart::dynamics::BodyNode *,
               dart::constraint::WeldJointConstraintPtr> > dtSlaveNodes;
@@ -180,6 +187,9 @@ namespace gazebo
 
       /// \brief Weld joint constraint for SetLinkStatic()
       public: dart::constraint::WeldJointConstraintPtr dtWeldJointConst;
+
+      // To get byte-aligned Eigen transforms
+      public: EIGEN_MAKE_ALIGNED_OPERATOR_NEW
     };
   }
 }
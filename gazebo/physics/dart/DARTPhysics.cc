@@ -25,11 +25,15 @@
 #include <dart/collision/dart/dart.hpp>
 #include <dart/collision/fcl/fcl.hpp>
 
+#include <algorithm>
+#include <unordered_map>
+
 #include <ignition/common/Profiler.hh>
 
 #include "gazebo/common/Assert.hh"
 #include "gazebo/common/Console.hh"
 #include "gazebo/common/Exception.hh"
+#include "gazebo/common/ScopeProfiler.hh"
 
 #include "gazebo/transport/Publisher.hh"
 
@@ -223,8 +227,18 @@ class LinkPair
 //////////////////////////////////////////////////
 static DARTLinkPtr StaticFindDARTLink(
     DARTPhysics *_dtPhysics,
+    const std::unordered_map<const dart::dynamics::BodyNode *, DARTLink *>
+        &_linksByBodyNode,
     const dart::dynamics::BodyNode *_dtBodyNode)
 {
+  auto linkIter = _linksByBodyNode.find(_dtBodyNode);
+  if (linkIter != _linksByBodyNode.end())
+  {
+    return boost::static_pointer_cast<DARTLink>(
+        linkIter->second->shared_from_this());
+  }
+
+  // Links which are not initialized yet are searched in the world
   DARTLinkPtr res;
 
   const Model_V& models = _dtPhysics->World()->Models();
@@ -253,10 +267,18 @@ static DARTLinkPtr StaticFindDARTLink(
 //////////////////////////////////////////////////
 static void RetrieveDARTCollisions(
     DARTPhysics* _dtPhysics,
+    const std::unordered_map<const dart::dynamics::BodyNode *, DARTLink *>
+        &_linksByBodyNode,
     const dart::collision::CollisionResult *_dtLastResult,
     ContactManager *_mgr)
 {
   _mgr->ResetCount();
+
+  // NewContact() would return NULL for every link pair, don't bother
+  // grouping the contacts.
+  if (!_mgr->ContactsRequested())
+    return;
+
   int numContacts = _dtLastResult->getNumContacts();
 
   // DART returns all contact points individually, without grouping
@@ -308,8 +330,10 @@ static void RetrieveDARTCollisions(
     GZ_ASSERT(dtBodyNode1, "body node 1 is null!");
     GZ_ASSERT(dtBodyNode2, "body node 2 is null!");
 
-    DARTLinkPtr dartLink1 = StaticFindDARTLink(_dtPhysics, dtBodyNode1);
-    DARTLinkPtr dartLink2 = StaticFindDARTLink(_dtPhysics, dtBodyNode2);
+    DARTLinkPtr dartLink1 =
+        StaticFindDARTLink(_dtPhysics, _linksByBodyNode, dtBodyNode1.get());
+    DARTLinkPtr dartLink2 =
+        StaticFindDARTLink(_dtPhysics, _linksByBodyNode, dtBodyNode2.get());
 
     GZ_ASSERT(dartLink1, "dartLink1 in collision pair is null");
     GZ_ASSERT(dartLink2, "dartLink2 in collision pair is null");
@@ -337,9 +361,8 @@ static void RetrieveDARTCollisions(
     // It would be nice to do this in the first loop in order to save
     // computation, but we can only add a new contact once per link pair,
     // which is information we only have after the first loop.
-    // We could avoid all the computation however if the contact manager
-    // had a function returning in advance whether the ContactManger::NewContact
-    // will return NULL!
+    // ContactManager::ContactsRequested() was checked before the first
+    // loop, so this only returns NULL for pairs no filter is interested in.
     Contact *contactFeedback = _mgr->NewContact(
                                  collisionPtr1.get(), collisionPtr2.get(),
                                  _dtPhysics->World()->SimTime());
@@ -419,6 +442,13 @@ void DARTPhysics::UpdateCollision()
 
   if (!this->world->PhysicsEnabled())
   {
+    if (!this->GetContactManager()->ContactsRequested())
+    {
+      this->GetContactManager()->ResetCount();
+      IGN_PROFILE_END();
+      return;
+    }
+
     dart::collision::CollisionResult localResult;
 
     // collision computation is disabled when UpdatePhysics() is not
@@ -431,7 +461,8 @@ void DARTPhysics::UpdateCollision()
     // so get the results and store them locally.
     this->dataPtr->dtWorld->checkCollision(opt, &localResult);
 
-    RetrieveDARTCollisions(this, &localResult, this->GetContactManager());
+    RetrieveDARTCollisions(this, this->dataPtr->linksByBodyNode,
+        &localResult, this->GetContactManager());
   }
   IGN_PROFILE_END();
 }
@@ -448,32 +479,22 @@ void DARTPhysics::UpdatePhysics()
   // common::Time currTime =  this->world->GetRealTime();
 
   this->dataPtr->dtWorld->setTimeStep(this->maxStepSize);
-  this->dataPtr->dtWorld->step(
-        this->dataPtr->resetAllForcesAfterSimulationStep);
-
-  // Update all the transformation of DART's links to gazebo's links
-  // TODO: How to visit all the links in the world?
-  unsigned int modelCount = this->world->ModelCount();
-  ModelPtr modelItr;
-
-  for (unsigned int i = 0; i < modelCount; ++i)
   {
-    modelItr = this->world->ModelByIndex(i);
-    // TODO: need to improve speed
-    Link_V links = modelItr->GetLinks();
-    unsigned int linkCount = links.size();
-    DARTLinkPtr dartLinkItr;
-
-    for (unsigned int j = 0; j < linkCount; ++j)
-    {
-      dartLinkItr
-          = boost::dynamic_pointer_cast<DARTLink>(links.at(j));
-      dartLinkItr->updateDirtyPoseFromDARTTransformation();
-    }
+    GZ_PROFILE("DARTPhysics::Step");
+    this->dataPtr->dtWorld->step(
+          this->dataPtr->resetAllForcesAfterSimulationStep);
   }
 
+  GZ_PROFILE("DARTPhysics::Sync");
+
+  // Update the transformation of DART's links to gazebo's links. Links that
+  // did not move are skipped by DARTLink.
+  for (auto const &link : this->dataPtr->links)
+    link->updateDirtyPoseFromDARTTransformation();
+
   RetrieveDARTCollisions(
         this,
+        this->dataPtr->linksByBodyNode,
         &(this->dataPtr->dtWorld->getLastCollisionResult()),
         this->GetContactManager());
   IGN_PROFILE_END();
@@ -885,9 +906,36 @@ void DARTPhysics::OnPhysicsMsg(ConstPhysicsPtr& _msg)
   this->world->EnableAllModels();
 }
 
+//////////////////////////////////////////////////
+void DARTPhysics::AddDARTLink(DARTLink *_link)
+{
+  const dart::dynamics::BodyNode *dtBodyNode = _link->DARTBodyNode();
+  if (this->dataPtr->linksByBodyNode.find(dtBodyNode) !=
+      this->dataPtr->linksByBodyNode.end())
+  {
+    return;
+  }
+
+  this->dataPtr->linksByBodyNode[dtBodyNode] = _link;
+  this->dataPtr->links.push_back(_link);
+}
+
+//////////////////////////////////////////////////
+void DARTPhysics::RemoveDARTLink(DARTLink *_link)
+{
+  auto linkIter = std::find(this->dataPtr->links.begin(),
+      this->dataPtr->links.end(), _link);
+  if (linkIter == this->dataPtr->links.end())
+    return;
+
+  this->dataPtr->links.erase(linkIter);
+  this->dataPtr->linksByBodyNode.erase(_link->DARTBodyNode());
+}
+
 //////////////////////////////////////////////////
 DARTLinkPtr DARTPhysics::FindDARTLink(
     const dart::dynamics::BodyNode *_dtBodyNode)
 {
-  return StaticFindDARTLink(this, _dtBodyNode);
+  return StaticFindDARTLink(this, this->dataPtr->linksByBodyNode,
+      _dtBodyNode);
 }
@@ -154,6 +154,16 @@ namespace gazebo
       /// \return The pointer to DART World.
       public: dart::simulation::WorldPtr DARTWorld() const;
 
+      /// \brief Add a link whose pose is synchronized from DART after every
+      /// step. Called by DARTLink::Init().
+      /// \param[in] _link The initialized link.
+      public: void AddDARTLink(DARTLink *_link);
+
+      /// \brief Remove a link added with AddDARTLink(). Called by
+      /// DARTLink::Fini().
+      /// \param[in] _link The link to remove.
+      public: void RemoveDARTLink(DARTLink *_link);
+
       /// \brief Returns a string with the name of the used collision detector.
       /// \return the name of the collision detector, or if no collision
       /// detector has been loaded yet, the empty string is returned.
@@ -18,7 +18,11 @@
 #ifndef _GAZEBO_DARTPHYSICS_PRIVATE_HH_
 #define _GAZEBO_DARTPHYSICS_PRIVATE_HH_
 
+#include <unordered_map>
+#include <vector>
+
 #include "gazebo/physics/dart/dart_inc.h"
+#include "gazebo/physics/dart/DARTTypes.hh"
 
 namespace gazebo
 {
@@ -50,6 +54,15 @@ namespace gazebo
       /// and torques (both internal and external) after completing a simulation
       /// step. Default value is true.
       public: bool resetAllForcesAfterSimulationStep;
+
+      /// \brief Initialized links, in the order their poses are
+      /// synchronized after a step.
+      public: std::vector<DARTLink *> links;
+
+      /// \brief Initialized links by their DART BodyNode, to find the links
+      /// of the contacts.
+      public: std::unordered_map<const dart::dynamics::BodyNode *, DARTLink *>
+              linksByBodyNode;
     };
   }
 }
@@ -24,6 +24,7 @@
 #include "gazebo/common/Assert.hh"
 #include "gazebo/common/Console.hh"
 
+#include "gazebo/physics/World.hh"
 #include "gazebo/physics/ode/ODESurfaceParams.hh"
 #include "gazebo/physics/ode/ODEPhysics.hh"
 #include "gazebo/physics/ode/ODELink.hh"
@@ -49,6 +50,10 @@ ODECollision::ODECollision(LinkPtr _link)
 //////////////////////////////////////////////////
 ODECollision::~ODECollision()
 {
+  for (auto hullId : this->convexHullIds)
+    dGeomDestroy(hullId);
+  this->convexHullIds.clear();
+
   if (this->collisionId)
     dGeomDestroy(this->collisionId);
   this->collisionId = nullptr;
@@ -254,6 +259,27 @@ dGeomID ODECollision::GetCollisionId() const
   return this->collisionId;
 }
 
+//////////////////////////////////////////////////
+void ODECollision::AddConvexHull(dGeomID _hullId)
+{
+  if (!_hullId)
+    return;
+
+  dGeomSetData(_hullId, this);
+  if (this->collisionId)
+  {
+    dGeomSetCategoryBits(_hullId, dGeomGetCategoryBits(this->collisionId));
+    dGeomSetCollideBits(_hullId, dGeomGetCollideBits(this->collisionId));
+  }
+  this->convexHullIds.push_back(_hullId);
+}
+
+//////////////////////////////////////////////////
+const std::vector<dGeomID> &ODECollision::ConvexHullIds() const
+{
+  return this->convexHullIds;
+}
+
 //////////////////////////////////////////////////
 int ODECollision::GetCollisionClass() const
 {
@@ -272,7 +298,9 @@ void ODECollision::SetCategoryBits(unsigned int _bits)
 {
   if (this->collisionId)
     dGeomSetCategoryBits(this->collisionId, _bits);
-  if (this->spaceId)
+  for (auto hullId : this->convexHullIds)
+    dGeomSetCategoryBits(hullId, _bits);
+  if (this->spaceId && !this->InStaticSpace())
     dGeomSetCategoryBits((dGeomID)this->spaceId, _bits);
 }
 
@@ -281,7 +309,9 @@ void ODECollision::SetCollideBits(unsigned int _bits)
 {
   if (this->collisionId)
     dGeomSetCollideBits(this->collisionId, _bits);
-  if (this->spaceId)
+  for (auto hullId : this->convexHullIds)
+    dGeomSetCollideBits(hullId, _bits);
+  if (this->spaceId && !this->InStaticSpace())
     dGeomSetCollideBits((dGeomID)this->spaceId, _bits);
 }
 
@@ -301,6 +331,17 @@ ignition::math::AxisAlignedBox ODECollision::BoundingBox() const
   return box;
 }
 
+//////////////////////////////////////////////////
+bool ODECollision::InStaticSpace() const
+{
+  if (!this->GetWorld())
+    return false;
+
+  ODEPhysicsPtr physics =
+    boost::dynamic_pointer_cast<ODEPhysics>(this->GetWorld()->Physics());
+  return physics && this->spaceId == physics->GetStaticSpaceId();
+}
+
 //////////////////////////////////////////////////
 dSpaceID ODECollision::GetSpaceId() const
 {
@@ -343,6 +384,13 @@ void ODECollision::OnPoseChangeGlobal()
   dGeomSetPosition(this->collisionId, localPose.Pos().X(),
       localPose.Pos().Y(), localPose.Pos().Z());
   dGeomSetQuaternion(this->collisionId, q);
+
+  for (auto hullId : this->convexHullIds)
+  {
+    dGeomSetPosition(hullId, localPose.Pos().X(),
+        localPose.Pos().Y(), localPose.Pos().Z());
+    dGeomSetQuaternion(hullId, q);
+  }
 }
 
 /////////////////////////////////////////////////
@@ -370,6 +418,15 @@ void ODECollision::OnPoseChangeRelative()
   dGeomSetOffsetPosition(this->collisionId,
       localPose.Pos().X(), localPose.Pos().Y(), localPose.Pos().Z());
   dGeomSetOffsetQuaternion(this->collisionId, q);
+
+  for (auto hullId : this->convexHullIds)
+  {
+    if (!dGeomGetBody(hullId))
+      continue;
+    dGeomSetOffsetPosition(hullId,
+        localPose.Pos().X(), localPose.Pos().Y(), localPose.Pos().Z());
+    dGeomSetOffsetQuaternion(hullId, q);
+  }
 }
 
 /////////////////////////////////////////////////
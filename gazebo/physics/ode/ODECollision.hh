@@ -22,6 +22,8 @@
 #ifndef _ODECOLLISION_HH_
 #define _ODECOLLISION_HH_
 
+#include <vector>
+
 #include "gazebo/physics/ode/ode_inc.h"
 
 #include "gazebo/physics/PhysicsTypes.hh"
@@ -80,6 +82,19 @@ namespace gazebo
       /// \return The ODE collision class.
       public: int GetCollisionClass() const;
 
+      /// \brief Add a convex hull that approximates this collision. When a
+      /// collision has convex hulls, contacts are generated against the
+      /// hulls and the collision geom is only used for broadphase, so it
+      /// must enclose every hull. The hull follows the collision geom and
+      /// is destroyed with this collision.
+      /// \param[in] _hullId ODE convex geom, not inserted in any space.
+      public: void AddConvexHull(dGeomID _hullId);
+
+      /// \brief Get the convex hulls that approximate this collision.
+      /// \return Convex geoms, empty when the collision geom is used for
+      /// contacts.
+      public: const std::vector<dGeomID> &ConvexHullIds() const;
+
       // Documentation inherited.
       public: virtual void OnPoseChange();
 
@@ -130,12 +145,20 @@ namespace gazebo
       /// \brief Empty pose change callback.
       private: void OnPoseChangeNull();
 
+      /// \brief Check if the collision is directly in the space shared by
+      /// all static models, whose collide bits must not be changed.
+      /// \return True if spaceId is the static space of the physics engine.
+      private: bool InStaticSpace() const;
+
       /// \brief Collision space for this.
       protected: dSpaceID spaceId;
 
       /// \brief ID for the collision.
       protected: dGeomID collisionId;
 
+      /// \brief Convex hulls used for contacts instead of collisionId.
+      private: std::vector<dGeomID> convexHullIds;
+
       /// \brief Function used to set the pose of the ODE object.
       private: void (ODECollision::*onPoseChangeFunc)();
     };
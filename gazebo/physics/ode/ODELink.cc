@@ -101,6 +101,8 @@ void ODELink::Init()
         if (g->IsPlaceable() && g->GetCollisionId())
         {
           dGeomSetBody(g->GetCollisionId(), this->linkId);
+          for (auto hullId : g->ConvexHullIds())
+            dGeomSetBody(hullId, this->linkId);
         }
       }
     }
@@ -228,6 +230,74 @@ void ODELink::SetSelfCollide(bool _collide)
     this->spaceId = dSimpleSpaceCreate(this->odePhysics->GetSpaceId());
 }
 
+//////////////////////////////////////////////////
+void ODELink::SetStatic(const bool &_static)
+{
+  Link::SetStatic(_static);
+
+  // Links are placed in a space when they are created. Once they are
+  // initialized, their collisions follow the static state.
+  if (!this->initialized || !this->odePhysics)
+    return;
+
+  const dSpaceID staticSpaceId =
+      this->odePhysics->ModelSpaceId(this->GetModel(), true);
+  const dSpaceID modelSpaceId =
+      this->odePhysics->ModelSpaceId(this->GetModel(), false);
+
+  // A dynamic link that collides with itself has a space of its own
+  const dSpaceID oldSpaceId = this->spaceId;
+  const bool ownSpace = oldSpaceId && oldSpaceId != staticSpaceId &&
+      oldSpaceId != modelSpaceId;
+
+  dSpaceID newSpaceId;
+  if (_static)
+    newSpaceId = staticSpaceId;
+  else if (!this->GetSelfCollide())
+    newSpaceId = modelSpaceId;
+  else if (ownSpace)
+    newSpaceId = oldSpaceId;
+  else
+    newSpaceId = dSimpleSpaceCreate(this->odePhysics->GetSpaceId());
+
+  if (newSpaceId == oldSpaceId)
+    return;
+
+  for (auto const &child : this->children)
+  {
+    if (!child->HasType(Base::COLLISION))
+      continue;
+
+    ODECollisionPtr g = boost::static_pointer_cast<ODECollision>(child);
+    dGeomID geomId = g->GetCollisionId();
+    if (geomId)
+    {
+      dSpaceID geomSpaceId = dGeomGetSpace(geomId);
+      if (geomSpaceId)
+        dSpaceRemove(geomSpaceId, geomId);
+      dSpaceAdd(newSpaceId, geomId);
+    }
+    g->SetSpaceId(newSpaceId);
+
+    // The bits of a dynamic space follow the bits of its collisions
+    if (geomId)
+    {
+      g->SetCategoryBits(dGeomGetCategoryBits(geomId));
+      g->SetCollideBits(dGeomGetCollideBits(geomId));
+    }
+  }
+
+  this->spaceId = newSpaceId;
+
+  // The collisions have moved out of the link's own space, which would
+  // otherwise stay empty in the world space.
+  if (ownSpace)
+  {
+    dSpaceSetCleanup(oldSpaceId, 0);
+    dSpaceDestroy(oldSpaceId);
+  }
+}
+
 //////////////////////////////////////////////////
 void ODELink::OnPoseChange()
 {
@@ -336,6 +406,12 @@ void ODELink::UpdateCollisionOffsets()
           dGeomSetOffsetPosition(g->GetCollisionId(),
               localPose.Pos().X(), localPose.Pos().Y(), localPose.Pos().Z());
           dGeomSetOffsetQuaternion(g->GetCollisionId(), q);
+          for (auto hullId : g->ConvexHullIds())
+          {
+            dGeomSetOffsetPosition(hullId,
+                localPose.Pos().X(), localPose.Pos().Y(), localPose.Pos().Z());
+            dGeomSetOffsetQuaternion(hullId, q);
+          }
         }
       }
     }
@@ -143,6 +143,12 @@ namespace gazebo
       // Documentation inherited
       public: void SetSelfCollide(bool _collide);
 
+      /// \brief Set whether this link is static. Once the link is
+      /// initialized, its collisions are moved between the static space
+      /// and the space of its model.
+      /// \param[in] _static True to make the link static.
+      public: virtual void SetStatic(const bool &_static);
+
       // Documentation inherited
       public: virtual void SetLinearDamping(double _damping);
 
@@ -14,6 +14,8 @@
  * limitations under the License.
  *
 */
+#include <utility>
+
 #include "gazebo/common/Mesh.hh"
 #include "gazebo/common/Assert.hh"
 #include "gazebo/common/Console.hh"
@@ -155,3 +157,84 @@ void ODEMesh::CreateMesh(unsigned int _numVertices, unsigned int _numIndices,
   memset(this->transform, 0, 32*sizeof(dReal));
   this->transformIndex = 0;
 }
+
+//////////////////////////////////////////////////
+void ODEMesh::InitConvexHulls(const common::Mesh *_hulls,
+    ODECollisionPtr _collision, const ignition::math::Vector3d &_scale)
+{
+  if (!_hulls || !_collision->GetCollisionId())
+    return;
+
+  if (!this->hullPoints.empty())
+  {
+    gzwarn << "Convex hulls of collision[" << _collision->GetScopedName()
+           << "] can not be changed once created." << std::endl;
+    return;
+  }
+
+  // A mirroring scale turns the faces inside out
+  bool flip = _scale.X() * _scale.Y() * _scale.Z() < 0;
+
+  // ODE keeps pointers to the hull data, reserve so that it never moves
+  this->hullPoints.reserve(_hulls->GetSubMeshCount());
+  this->hullPlanes.reserve(_hulls->GetSubMeshCount());
+  this->hullPolygons.reserve(_hulls->GetSubMeshCount());
+
+  for (unsigned int h = 0; h < _hulls->GetSubMeshCount(); ++h)
+  {
+    const common::SubMesh *hull = _hulls->GetSubMesh(h);
+    if (hull->GetVertexCount() < 4 || hull->GetIndexCount() < 12)
+      continue;
+
+    std::vector<dReal> points;
+    points.reserve(hull->GetVertexCount() * 3);
+    for (unsigned int i = 0; i < hull->GetVertexCount(); ++i)
+    {
+      ignition::math::Vector3d v = hull->Vertex(i) * _scale;
+      points.push_back(v.X());
+      points.push_back(v.Y());
+      points.push_back(v.Z());
+    }
+
+    std::vector<dReal> planes;
+    std::vector<unsigned int> polygons;
+    for (unsigned int i = 0; i + 2 < hull->GetIndexCount(); i += 3)
+    {
+      unsigned int a = hull->GetIndex(i);
+      unsigned int b = hull->GetIndex(i + (flip ? 2 : 1));
+      unsigned int c = hull->GetIndex(i + (flip ? 1 : 2));
+
+      ignition::math::Vector3d pa(points[a*3], points[a*3+1], points[a*3+2]);
+      ignition::math::Vector3d pb(points[b*3], points[b*3+1], points[b*3+2]);
+      ignition::math::Vector3d pc(points[c*3], points[c*3+1], points[c*3+2]);
+      ignition::math::Vector3d normal = (pb - pa).Cross(pc - pa);
+      if (normal.Length() <= 0)
+        continue;
+      normal.Normalize();
+
+      planes.push_back(normal.X());
+      planes.push_back(normal.Y());
+      planes.push_back(normal.Z());
+      planes.push_back(normal.Dot(pa));
+
+      polygons.push_back(3);
+      polygons.push_back(a);
+      polygons.push_back(b);
+      polygons.push_back(c);
+    }
+
+    this->hullPoints.push_back(std::move(points));
+    this->hullPlanes.push_back(std::move(planes));
+    this->hullPolygons.push_back(std::move(polygons));
+
+    // The hull is not inserted in a space: the trimesh geom of the
+    // collision handles broadphase.
+    dGeomID hullId = dCreateConvex(nullptr,
+        this->hullPlanes.back().data(),
+        this->hullPlanes.back().size() / 4,
+        this->hullPoints.back().data(),
+        this->hullPoints.back().size() / 3,
+        this->hullPolygons.back().data());
+    _collision->AddConvexHull(hullId);
+  }
+}
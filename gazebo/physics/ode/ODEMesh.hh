@@ -18,6 +18,8 @@
 #ifndef GAZEBO_PHYSICS_ODE_ODEMESH_HH_
 #define GAZEBO_PHYSICS_ODE_ODEMESH_HH_
 
+#include <vector>
+
 #include <ignition/math/Vector3.hh>
 
 #include "gazebo/physics/ode/ODETypes.hh"
@@ -57,6 +59,17 @@ namespace gazebo
                       ODECollisionPtr _collision,
                       const ignition::math::Vector3d &_scale);
 
+      /// \brief Add convex hulls to a collision that was initialized with
+      /// Init. Contacts of the collision are then generated against the
+      /// hulls, while its triangle mesh is kept for broadphase and rays.
+      /// \param[in] _hulls Mesh with one closed convex submesh per hull.
+      /// \param[in] _collision Pointer to the collision object.
+      /// \param[in] _scale Scaling factor.
+      /// \sa common::MeshSimplifier::ConvexDecomposition
+      public: void InitConvexHulls(const common::Mesh *_hulls,
+                      ODECollisionPtr _collision,
+                      const ignition::math::Vector3d &_scale);
+
       /// \brief Update the collision mesh.
       public: virtual void Update();
 
@@ -85,6 +98,16 @@ namespace gazebo
 
       /// \brief The collision id that this mesh is attached to.
       private: dGeomID collisionId;
+
+      /// \brief Plane data of each convex hull, 4 values per face.
+      private: std::vector<std::vector<dReal>> hullPlanes;
+
+      /// \brief Vertex data of each convex hull, 3 values per vertex.
+      private: std::vector<std::vector<dReal>> hullPoints;
+
+      /// \brief Polygon data of each convex hull, as a vertex count
+      /// followed by the vertex indices of every face.
+      private: std::vector<std::vector<unsigned int>> hullPolygons;
     };
     /// \}
   }
@@ -69,4 +69,11 @@ void ODEMeshShape::Init()
         boost::static_pointer_cast<ODECollision>(this->collisionParent),
         this->sdf->Get<ignition::math::Vector3d>("scale"));
   }
+
+  if (this->convexHulls)
+  {
+    this->odeMesh->InitConvexHulls(this->convexHulls,
+        boost::static_pointer_cast<ODECollision>(this->collisionParent),
+        this->sdf->Get<ignition::math::Vector3d>("scale"));
+  }
 }
@@ -130,6 +130,28 @@ class Colliders_TBB
   private: dContactGeom* contactCollisions;
 };
 
+//////////////////////////////////////////////////
+/// \brief Check whether ODE can collide a convex geom against a geom.
+/// Cylinders are left out, since ODE only collides them with convex geoms
+/// when it is built with libccd.
+/// \param[in] _geom The other geom.
+/// \return True if dCollide generates contacts for a convex and _geom.
+static bool ConvexCollides(const dGeomID _geom)
+{
+  switch (dGeomGetClass(_geom))
+  {
+    case dSphereClass:
+    case dBoxClass:
+    case dCapsuleClass:
+    case dPlaneClass:
+    case dConvexClass:
+    case dHeightfieldClass:
+      return true;
+    default:
+      return false;
+  }
+}
+
 //////////////////////////////////////////////////
 extern "C" void dMessageQuiet(int, const char *, va_list)
 {
@@ -152,6 +174,14 @@ ODEPhysics::ODEPhysics(WorldPtr _world)
   this->dataPtr->spaceId = dHashSpaceCreate(0);
   dHashSpaceSetLevels(this->dataPtr->spaceId, -2, 8);
 
+  // Static collisions never move: they are kept in a single quadtree
+  // space, on the XY plane, instead of one space per model. Collisions
+  // outside of the quadtree extents are kept in its root block.
+  dVector3 staticCenter = {0, 0, 0, 0};
+  dVector3 staticExtents = {1024, 1024, 1024, 0};
+  this->dataPtr->staticSpaceId = dQuadTreeSpaceCreate(
+      this->dataPtr->spaceId, staticCenter, staticExtents, 7);
+
   this->dataPtr->contactGroup = dJointGroupCreate(0);
 
   this->dataPtr->colliders.resize(100);
@@ -478,6 +508,13 @@ void ODEPhysics::Fini()
   }
   this->dataPtr->jointFeedbacks.clear();
 
+  if (this->dataPtr->staticSpaceId)
+  {
+    dSpaceSetCleanup(this->dataPtr->staticSpaceId, 0);
+    dSpaceDestroy(this->dataPtr->staticSpaceId);
+  }
+  this->dataPtr->staticSpaceId = nullptr;
+
   if (this->dataPtr->spaceId)
   {
     dSpaceSetCleanup(this->dataPtr->spaceId, 0);
@@ -507,21 +544,32 @@ LinkPtr ODEPhysics::CreateLink(ModelPtr _parent)
   if (_parent == nullptr)
     gzthrow("Link must have a parent\n");
 
-  std::map<std::string, dSpaceID>::iterator iter;
-  iter = this->dataPtr->spaces.find(_parent->GetName());
-
-  if (iter == this->dataPtr->spaces.end())
-    this->dataPtr->spaces[_parent->GetName()] =
-      dSimpleSpaceCreate(this->dataPtr->spaceId);
-
   ODELinkPtr link(new ODELink(_parent));
 
-  link->SetSpaceId(this->dataPtr->spaces[_parent->GetName()]);
+  link->SetSpaceId(this->ModelSpaceId(_parent, _parent->IsStatic()));
   link->SetWorld(_parent->GetWorld());
 
   return link;
 }
 
+//////////////////////////////////////////////////
+dSpaceID ODEPhysics::ModelSpaceId(const ModelPtr &_model, const bool _static)
+{
+  // Links of static models share the static space, so that static
+  // collisions are never tested against each other.
+  if (_static)
+    return this->dataPtr->staticSpaceId;
+
+  std::map<std::string, dSpaceID>::iterator iter;
+  iter = this->dataPtr->spaces.find(_model->GetName());
+
+  if (iter == this->dataPtr->spaces.end())
+    this->dataPtr->spaces[_model->GetName()] =
+      dSimpleSpaceCreate(this->dataPtr->spaceId);
+
+  return this->dataPtr->spaces[_model->GetName()];
+}
+
 //////////////////////////////////////////////////
 CollisionPtr ODEPhysics::CreateCollision(const std::string &_type,
                                          LinkPtr _body)
@@ -917,6 +965,12 @@ dSpaceID ODEPhysics::GetSpaceId() const
   return this->dataPtr->spaceId;
 }
 
+//////////////////////////////////////////////////
+dSpaceID ODEPhysics::GetStaticSpaceId() const
+{
+  return this->dataPtr->staticSpaceId;
+}
+
 //////////////////////////////////////////////////
 std::string ODEPhysics::GetStepType() const
 {
@@ -1067,9 +1121,41 @@ void ODEPhysics::Collide(ODECollision *_collision1, ODECollision *_collision2,
   if (_collision2->GetMaxContacts() < maxCollide)
     maxCollide = _collision2->GetMaxContacts();
 
-  // Generate the contacts
-  numc = dCollide(_collision1->GetCollisionId(), _collision2->GetCollisionId(),
-      MAX_COLLIDE_RETURNS, _contactCollisions, sizeof(_contactCollisions[0]));
+  // Generate the contacts. Collisions approximated by convex hulls are
+  // tested hull by hull. ODE has no convex collider for geoms such as
+  // triangle meshes, so the hulls are only used when the other side is a
+  // shape that convex geoms collide with, or has hulls of its own.
+  // Otherwise the original triangle mesh is collided.
+  const dGeomID id1 = _collision1->GetCollisionId();
+  const dGeomID id2 = _collision2->GetCollisionId();
+  const std::vector<dGeomID> &hulls1 = _collision1->ConvexHullIds();
+  const std::vector<dGeomID> &hulls2 = _collision2->ConvexHullIds();
+  const bool useHulls1 = !hulls1.empty() &&
+      (!hulls2.empty() || ConvexCollides(id2));
+  const bool useHulls2 = !hulls2.empty() &&
+      (!hulls1.empty() || ConvexCollides(id1));
+  if (!useHulls1 && !useHulls2)
+  {
+    numc = dCollide(id1, id2, MAX_COLLIDE_RETURNS, _contactCollisions,
+        sizeof(_contactCollisions[0]));
+  }
+  else
+  {
+    const dGeomID *geoms1 = useHulls1 ? hulls1.data() : &id1;
+    const dGeomID *geoms2 = useHulls2 ? hulls2.data() : &id2;
+    const size_t count1 = useHulls1 ? hulls1.size() : 1u;
+    const size_t count2 = useHulls2 ? hulls2.size() : 1u;
+    const unsigned int maxReturns = MAX_COLLIDE_RETURNS;
+
+    for (size_t i = 0; i < count1 && numc < maxReturns; ++i)
+    {
+      for (size_t j = 0; j < count2 && numc < maxReturns; ++j)
+      {
+        numc += dCollide(geoms1[i], geoms2[j], maxReturns - numc,
+            _contactCollisions + numc, sizeof(_contactCollisions[0]));
+      }
+    }
+  }
 
   // Return if no contacts.
   if (numc == 0)
@@ -228,6 +228,21 @@ namespace gazebo
       /// \return The space id for the world.
       public: dSpaceID GetSpaceId() const;
 
+      /// \brief Return the space that holds the collisions of all static
+      /// models. It is a child of the world space.
+      /// \return The space id for static collisions.
+      public: dSpaceID GetStaticSpaceId() const;
+
+      /// \brief Return the space that holds the collisions of a model's
+      /// links. Static models use the static space, dynamic models have a
+      /// space of their own, which is created on first use.
+      /// \param[in] _model The model.
+      /// \param[in] _static True to get the space of the model when it is
+      /// static.
+      /// \return The space id for the collisions of the model.
+      public: dSpaceID ModelSpaceId(const ModelPtr &_model,
+                  const bool _static);
+
       /// \brief Get the world id.
       /// \return The world id.
       public: dWorldID GetWorldId();
@@ -53,6 +53,11 @@ namespace gazebo
       /// \brief Top-level space for all sub-spaces/collisions
       public: dSpaceID spaceId;
 
+      /// \brief Quadtree space shared by the collisions of all static
+      /// models. It is a child of spaceId, so it is only tested against
+      /// the dynamic spaces and never against itself.
+      public: dSpaceID staticSpaceId;
+
       /// \brief Collision attributes
       public: dJointGroupID contactGroup;
 
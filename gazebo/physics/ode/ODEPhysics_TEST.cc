@@ -19,6 +19,7 @@
 
 #include "gazebo/physics/physics.hh"
 #include "gazebo/physics/PhysicsEngine.hh"
+#include "gazebo/physics/ode/ODECollision.hh"
 #include "gazebo/physics/ode/ODEPhysics.hh"
 #include "gazebo/physics/ode/ODETypes.hh"
 #include "gazebo/test/ServerFixture.hh"
@@ -490,6 +491,141 @@ TEST_F(ODEPhysics_TEST, PhysicsMsgParam)
   PhysicsMsgParam();
 }
 
+/////////////////////////////////////////////////
+/// Static models share one space, and dynamic models still collide with it
+TEST_F(ODEPhysics_TEST, StaticSpace)
+{
+  Load("worlds/empty.world", true, "ode");
+  WorldPtr world = get_world("default");
+  ASSERT_TRUE(world != nullptr);
+
+  ODEPhysicsPtr odePhysics =
+    boost::dynamic_pointer_cast<ODEPhysics>(world->Physics());
+  ASSERT_TRUE(odePhysics != nullptr);
+  ASSERT_TRUE(odePhysics->GetStaticSpaceId() != nullptr);
+
+  SpawnBox("static_box", ignition::math::Vector3d(2, 2, 1),
+      ignition::math::Vector3d(5, 5, 0.5), ignition::math::Vector3d::Zero,
+      true);
+  SpawnBox("box", ignition::math::Vector3d::One,
+      ignition::math::Vector3d(5, 5, 2.0));
+
+  ModelPtr staticModel = world->ModelByName("static_box");
+  ModelPtr model = world->ModelByName("box");
+  ASSERT_TRUE(staticModel != nullptr);
+  ASSERT_TRUE(model != nullptr);
+
+  // The ground plane and the static box are in the static space
+  ODECollisionPtr staticCollision = boost::dynamic_pointer_cast<ODECollision>(
+      staticModel->GetLink()->GetCollisions()[0]);
+  ODECollisionPtr collision = boost::dynamic_pointer_cast<ODECollision>(
+      model->GetLink()->GetCollisions()[0]);
+  ASSERT_TRUE(staticCollision != nullptr);
+  ASSERT_TRUE(collision != nullptr);
+  EXPECT_EQ(odePhysics->GetStaticSpaceId(), staticCollision->GetSpaceId());
+  EXPECT_NE(odePhysics->GetStaticSpaceId(), collision->GetSpaceId());
+  EXPECT_EQ(2, dSpaceGetNumGeoms(odePhysics->GetStaticSpaceId()));
+
+  // The dynamic box lands on the static box
+  world->Step(2000);
+  EXPECT_NEAR(1.5, model->WorldPose().Pos().Z(), 0.01);
+}
+
+/////////////////////////////////////////////////
+/// Collisions move between spaces when a model is made static at runtime
+TEST_F(ODEPhysics_TEST, ToggleStaticSpace)
+{
+  Load("worlds/empty.world", true, "ode");
+  WorldPtr world = get_world("default");
+  ASSERT_TRUE(world != nullptr);
+
+  ODEPhysicsPtr odePhysics =
+    boost::dynamic_pointer_cast<ODEPhysics>(world->Physics());
+  ASSERT_TRUE(odePhysics != nullptr);
+  dSpaceID staticSpaceId = odePhysics->GetStaticSpaceId();
+
+  SpawnBox("box", ignition::math::Vector3d::One,
+      ignition::math::Vector3d(5, 5, 0.5));
+  ModelPtr model = world->ModelByName("box");
+  ASSERT_TRUE(model != nullptr);
+
+  ODECollisionPtr collision = boost::dynamic_pointer_cast<ODECollision>(
+      model->GetLink()->GetCollisions()[0]);
+  ASSERT_TRUE(collision != nullptr);
+  dSpaceID modelSpaceId = collision->GetSpaceId();
+  EXPECT_NE(staticSpaceId, modelSpaceId);
+  EXPECT_EQ(1, dSpaceGetNumGeoms(staticSpaceId));
+
+  // Make the box static
+  model->SetStatic(true);
+  EXPECT_EQ(staticSpaceId, collision->GetSpaceId());
+  EXPECT_EQ(staticSpaceId, dGeomGetSpace(collision->GetCollisionId()));
+  EXPECT_EQ(2, dSpaceGetNumGeoms(staticSpaceId));
+  EXPECT_EQ(0, dSpaceGetNumGeoms(modelSpaceId));
+
+  // A dynamic box dropped on it still collides with it
+  SpawnBox("falling_box", ignition::math::Vector3d::One,
+      ignition::math::Vector3d(5, 5, 2.0));
+  ModelPtr fallingModel = world->ModelByName("falling_box");
+  ASSERT_TRUE(fallingModel != nullptr);
+  world->Step(2000);
+  EXPECT_NEAR(1.5, fallingModel->WorldPose().Pos().Z(), 0.01);
+
+  // Make the box dynamic again
+  model->SetStatic(false);
+  EXPECT_EQ(modelSpaceId, collision->GetSpaceId());
+  EXPECT_EQ(modelSpaceId, dGeomGetSpace(collision->GetCollisionId()));
+  EXPECT_EQ(1, dSpaceGetNumGeoms(staticSpaceId));
+  EXPECT_EQ(1, dSpaceGetNumGeoms(modelSpaceId));
+}
+
+/////////////////////////////////////////////////
+/// Toggling a self-colliding link reuses or destroys its own space
+TEST_F(ODEPhysics_TEST, ToggleStaticSelfCollide)
+{
+  Load("worlds/empty.world", true, "ode");
+  WorldPtr world = get_world("default");
+  ASSERT_TRUE(world != nullptr);
+
+  ODEPhysicsPtr odePhysics =
+    boost::dynamic_pointer_cast<ODEPhysics>(world->Physics());
+  ASSERT_TRUE(odePhysics != nullptr);
+  dSpaceID staticSpaceId = odePhysics->GetStaticSpaceId();
+
+  SpawnBox("box", ignition::math::Vector3d::One,
+      ignition::math::Vector3d(5, 5, 0.5));
+  ModelPtr model = world->ModelByName("box");
+  ASSERT_TRUE(model != nullptr);
+  model->GetLink()->SetSelfCollide(true);
+
+  ODECollisionPtr collision = boost::dynamic_pointer_cast<ODECollision>(
+      model->GetLink()->GetCollisions()[0]);
+  ASSERT_TRUE(collision != nullptr);
+
+  model->SetStatic(true);
+  const int spaceCount = dSpaceGetNumGeoms(odePhysics->GetSpaceId());
+
+  for (int i = 0; i < 10; ++i)
+  {
+    model->SetStatic(false);
+    EXPECT_NE(staticSpaceId, collision->GetSpaceId());
+    EXPECT_EQ(collision->GetSpaceId(),
+        dGeomGetSpace(collision->GetCollisionId()));
+    EXPECT_EQ(1, dSpaceGetNumGeoms(collision->GetSpaceId()));
+
+    // Making it dynamic again keeps the same space
+    const dSpaceID ownSpaceId = collision->GetSpaceId();
+    model->SetStatic(false);
+    EXPECT_EQ(ownSpaceId, collision->GetSpaceId());
+
+    model->SetStatic(true);
+    EXPECT_EQ(staticSpaceId, collision->GetSpaceId());
+  }
+
+  // The spaces of the previous toggles were destroyed
+  EXPECT_EQ(spaceCount, dSpaceGetNumGeoms(odePhysics->GetSpaceId()));
+}
+
 /////////////////////////////////////////////////
 /// Main
 int main(int argc, char **argv)
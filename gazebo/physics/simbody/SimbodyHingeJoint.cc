@@ -66,8 +66,7 @@ void SimbodyHingeJoint::SetVelocity(unsigned int _index, double _rate)
     this->mobod.setOneU(
       this->simbodyPhysics->integ->updAdvancedState(),
       SimTK::MobilizerUIndex(_index), _rate);
-    this->simbodyPhysics->system.realize(
-      this->simbodyPhysics->integ->getAdvancedState(), SimTK::Stage::Velocity);
+    this->simbodyPhysics->InvalidateState(SimTK::Stage::Velocity);
   }
   else
     gzerr << "SetVelocity _index too large.\n";
@@ -81,7 +80,7 @@ double SimbodyHingeJoint::GetVelocity(unsigned int _index) const
     if (this->physicsInitialized &&
         this->simbodyPhysics->simbodyPhysicsInitialized)
       return this->mobod.getOneU(
-        this->simbodyPhysics->integ->getState(),
+        this->simbodyPhysics->RealizedState(),
         SimTK::MobilizerUIndex(_index));
     else
     {
@@ -118,11 +117,11 @@ ignition::math::Vector3d SimbodyHingeJoint::GlobalAxis(
     if (!this->mobod.isEmptyHandle())
     {
       const SimTK::Transform &X_OM = this->mobod.getOutboardFrame(
-        this->simbodyPhysics->integ->getState());
+        this->simbodyPhysics->RealizedState());
 
       // express Z-axis of X_OM in world frame
       SimTK::Vec3 z_W(this->mobod.expressVectorInGroundFrame(
-        this->simbodyPhysics->integ->getState(), X_OM.z()));
+        this->simbodyPhysics->RealizedState(), X_OM.z()));
 
       return SimbodyPhysics::Vec3ToVector3Ign(z_W);
     }
@@ -167,7 +166,7 @@ double SimbodyHingeJoint::PositionImpl(const unsigned int _index) const
       if (!this->mobod.isEmptyHandle())
       {
         return this->mobod.getOneQ(
-          this->simbodyPhysics->integ->getState(), _index);
+          this->simbodyPhysics->RealizedState(), _index);
       }
       else
       {
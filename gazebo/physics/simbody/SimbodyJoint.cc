@@ -159,16 +159,23 @@ void SimbodyJoint::CacheForceTorque()
 {
   const SimTK::State &state = this->simbodyPhysics->integ->getAdvancedState();
 
-  // force calculation of reaction forces
-  this->simbodyPhysics->system.realize(state);
-
   // In simbody, parent is always inboard (closer to ground in the tree),
   //   child is always outboard (further away from ground in the tree).
-  SimTK::SpatialVec spatialForceOnInboardBodyInGround =
-    this->mobod.findMobilizerReactionOnParentAtFInGround(state);
-
+  // The reactions of all mobilizers are computed once per step by
+  // SimbodyPhysics, instead of once per joint by
+  // MobilizedBody::findMobilizerReactionOnBodyAtMInGround().
   SimTK::SpatialVec spatialForceOnOutboardBodyInGround =
-    this->mobod.findMobilizerReactionOnBodyAtMInGround(state);
+    this->simbodyPhysics->MobilizerReaction(this->mobod);
+
+  // The reaction on the parent is equal and opposite, acting at F
+  const SimTK::Transform X_GF =
+    this->mobod.getParentMobilizedBody().getBodyTransform(state) *
+    this->mobod.getInboardFrame(state);
+  const SimTK::Transform X_GM =
+    this->mobod.getBodyTransform(state) * this->mobod.getOutboardFrame(state);
+  SimTK::SpatialVec spatialForceOnInboardBodyInGround =
+    -SimTK::shiftForceFromTo(spatialForceOnOutboardBodyInGround,
+        X_GM.p(), X_GF.p());
 
   // determine if outboard body is parent or child based on isReversed flag.
   // determine if inboard body is parent or child based on isReversed flag.
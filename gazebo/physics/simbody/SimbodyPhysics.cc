@@ -16,6 +16,7 @@
 */
 
 #include <string>
+#include <vector>
 
 #include <ignition/common/Profiler.hh>
 
@@ -69,6 +70,48 @@ using namespace SimTK;
 
 GZ_REGISTER_PHYSICS_ENGINE("simbody", SimbodyPhysics)
 
+namespace
+{
+  /// \brief Updates the pose of a link or the reaction force of a joint
+  /// after a step. The first indices are the links, followed by the joints.
+  class PostStepTask : public SimTK::ParallelExecutor::Task
+  {
+    /// \brief Constructor.
+    /// \param[in] _state Realized state after the step.
+    /// \param[in] _links Links to update.
+    /// \param[in] _joints Joints to update.
+    public: PostStepTask(const SimTK::State &_state,
+                const std::vector<SimbodyLink *> &_links,
+                const std::vector<SimbodyJoint *> &_joints)
+            : state(_state), links(_links), joints(_joints)
+            {
+            }
+
+    // Documentation inherited
+    public: void execute(int _index) override
+            {
+              const size_t index = static_cast<size_t>(_index);
+              if (index < this->links.size())
+              {
+                SimbodyLink *link = this->links[index];
+                link->SetDirtyPose(SimbodyPhysics::Transform2PoseIgn(
+                    link->masterMobod.getBodyTransform(this->state)));
+              }
+              else
+                this->joints[index - this->links.size()]->CacheForceTorque();
+            }
+
+    /// \brief Realized state after the step.
+    private: const SimTK::State &state;
+
+    /// \brief Links to update.
+    private: const std::vector<SimbodyLink *> &links;
+
+    /// \brief Joints to update.
+    private: const std::vector<SimbodyJoint *> &joints;
+  };
+}
+
 //////////////////////////////////////////////////
 SimbodyPhysics::SimbodyPhysics(WorldPtr _world)
     : PhysicsEngine(_world), system(), matter(system), forces(system),
@@ -372,6 +415,8 @@ void SimbodyPhysics::InitModel(const physics::ModelPtr _model)
 
   // initialize integrator from state
   this->integ->initialize(state);
+  this->invalidStage = SimTK::Stage::Empty;
+  this->mobilizerReactionsValid = false;
 
   // mark links as initialized
   Link_V links = _model->GetLinks();
@@ -418,8 +463,15 @@ void SimbodyPhysics::UpdateCollision()
 
   this->contactManager->ResetCount();
 
+  // NewContact() would return NULL for every pair
+  if (!this->contactManager->ContactsRequested())
+  {
+    IGN_PROFILE_END();
+    return;
+  }
+
   // Get all contacts from Simbody
-  const SimTK::State &state = this->integ->getState();
+  const SimTK::State &state = this->RealizedState();
 
   // The tracker cannot generate a snapshot without a subsystem
   if (state.getNumSubsystems() == 0)
@@ -651,8 +703,9 @@ void SimbodyPhysics::UpdatePhysics()
 
   common::Time currTime =  this->world->RealTime();
 
-  // Simbody cannot step the integrator without a subsystem
-  const SimTK::State &s = this->integ->getState();
+  // Simbody cannot step the integrator without a subsystem, and the
+  // commands since the last step have to be realized before stepping.
+  const SimTK::State &s = this->RealizedState();
   if (s.getNumSubsystems() == 0)
     return;
 
@@ -673,6 +726,7 @@ void SimbodyPhysics::UpdatePhysics()
   }
 
   this->simbodyPhysicsStepped = true;
+  this->mobilizerReactionsValid = false;
 
   // debug
   // gzerr << "time [" << s.getTime()
@@ -683,40 +737,91 @@ void SimbodyPhysics::UpdatePhysics()
   //       << "]\n";
   // this->lastUpdateTime = currTime;
 
-  // pushing new entity pose into dirtyPoses for visualization
-  physics::Model_V models = this->world->Models();
-  for (physics::Model_V::iterator mi = models.begin();
-       mi != models.end(); ++mi)
+  std::vector<SimbodyLink *> links;
+  std::vector<SimbodyJoint *> joints;
+  for (auto const &model : this->world->Models())
   {
-    physics::Link_V links = (*mi)->GetLinks();
-    for (physics::Link_V::iterator lx = links.begin();
-         lx != links.end(); ++lx)
-    {
-      physics::SimbodyLinkPtr simbodyLink =
-        boost::dynamic_pointer_cast<physics::SimbodyLink>(*lx);
-      auto pose = SimbodyPhysics::Transform2PoseIgn(
-        simbodyLink->masterMobod.getBodyTransform(s));
-      simbodyLink->SetDirtyPose(pose);
-      this->world->dataPtr->dirtyPoses.push_back(
-        boost::static_pointer_cast<Entity>(*lx).get());
-    }
+    for (auto const &link : model->GetLinks())
+      links.push_back(boost::static_pointer_cast<SimbodyLink>(link).get());
+    for (auto const &joint : model->GetJoints())
+      joints.push_back(boost::static_pointer_cast<SimbodyJoint>(joint).get());
+  }
 
-    physics::Joint_V joints = (*mi)->GetJoints();
-    for (physics::Joint_V::iterator jx = joints.begin();
-         jx != joints.end(); ++jx)
-    {
-      SimbodyJointPtr simbodyJoint =
-        boost::dynamic_pointer_cast<physics::SimbodyJoint>(*jx);
-      simbodyJoint->CacheForceTorque();
-    }
+  // The reactions are computed for all joints at once, before the joints
+  // read them from the worker threads.
+  if (!joints.empty())
+  {
+    this->MobilizerReaction(
+        this->matter.getMobilizedBody(SimTK::GroundIndex));
   }
 
+  // Update the link poses and joint forces, in parallel if enabled
+  PostStepTask task(this->integ->getState(), links, joints);
+  const int taskCount = static_cast<int>(links.size() + joints.size());
+  if (this->executor && taskCount > 1)
+    this->executor->execute(task, taskCount);
+  else
+  {
+    for (int i = 0; i < taskCount; ++i)
+      task.execute(i);
+  }
+
+  // pushing new entity pose into dirtyPoses for visualization
+  for (auto const &link : links)
+    this->world->dataPtr->dirtyPoses.push_back(link);
+
   // FIXME:  this needs to happen before forces are applied for the next step
   // FIXME:  but after we've gotten everything from current state
   this->discreteForces.clearAllForces(this->integ->updAdvancedState());
   IGN_PROFILE_END();
 }
 
+//////////////////////////////////////////////////
+void SimbodyPhysics::InvalidateState(const SimTK::Stage &_stage)
+{
+  boost::recursive_mutex::scoped_lock lock(*this->physicsUpdateMutex);
+  if (_stage > this->invalidStage)
+    this->invalidStage = _stage;
+  this->mobilizerReactionsValid = false;
+}
+
+//////////////////////////////////////////////////
+const SimTK::State &SimbodyPhysics::RealizedState()
+{
+  // Link and joint getters call this from other threads than the world
+  // update, which steps the same state.
+  boost::recursive_mutex::scoped_lock lock(*this->physicsUpdateMutex);
+  if (this->invalidStage > SimTK::Stage::Empty)
+  {
+    this->system.realize(this->integ->getAdvancedState(), this->invalidStage);
+    this->invalidStage = SimTK::Stage::Empty;
+  }
+  return this->integ->getState();
+}
+
+//////////////////////////////////////////////////
+const SimTK::SpatialVec &SimbodyPhysics::MobilizerReaction(
+    const SimTK::MobilizedBody &_mobod)
+{
+  // The post step workers only read the reactions, which UpdatePhysics
+  // computed while holding the lock they would wait on.
+  if (!this->mobilizerReactionsValid)
+  {
+    boost::recursive_mutex::scoped_lock lock(*this->physicsUpdateMutex);
+    if (!this->mobilizerReactionsValid)
+    {
+      // Finding the reaction of a single mobilizer computes the reactions
+      // of all of them, so keep them for the other joints.
+      const SimTK::State &state = this->integ->getAdvancedState();
+      this->system.realize(state, SimTK::Stage::Acceleration);
+      this->matter.calcMobilizerReactionForces(state,
+          this->mobilizerReactions);
+      this->mobilizerReactionsValid = true;
+    }
+  }
+  return this->mobilizerReactions[_mobod.getMobilizedBodyIndex()];
+}
+
 //////////////////////////////////////////////////
 void SimbodyPhysics::Fini()
 {
@@ -1652,6 +1757,10 @@ bool SimbodyPhysics::GetParam(const std::string &_key, boost::any &_value) const
   {
     _value = this->contact.getTransitionVelocity();
   }
+  else if (_key == "threads")
+  {
+    _value = this->threads;
+  }
   else
   {
     return PhysicsEngine::GetParam(_key, _value);
@@ -1711,6 +1820,24 @@ bool SimbodyPhysics::SetParam(const std::string &_key, const boost::any &_value)
     {
       this->contactImpactCaptureVelocity = any_cast<double>(_value);
     }
+    else if (_key == "threads")
+    {
+      int value = any_cast<int>(_value);
+      if (value < 1)
+      {
+        gzerr << "Number of threads must be positive, got [" << value
+              << "]" << std::endl;
+        return false;
+      }
+
+      // Don't replace the executor while a step uses it
+      boost::recursive_mutex::scoped_lock lock(*this->physicsUpdateMutex);
+      this->threads = value;
+      if (value > 1)
+        this->executor.reset(new SimTK::ParallelExecutor(value));
+      else
+        this->executor.reset();
+    }
     else
     {
       return PhysicsEngine::SetParam(_key, _value);
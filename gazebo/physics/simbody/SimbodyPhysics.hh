@@ -17,6 +17,8 @@
 
 #ifndef GAZEBO_PHYSICS_SIMBODY_SIMBODYPHYSICS_HH
 #define GAZEBO_PHYSICS_SIMBODY_SIMBODYPHYSICS_HH
+#include <atomic>
+#include <memory>
 #include <string>
 
 #include <boost/thread/thread.hpp>
@@ -216,6 +218,27 @@ namespace gazebo
       public: SimTK::CompliantContactSubsystem contact;
       public: SimTK:: Integrator *integ;
 
+      /// \brief Record that a command changed the advanced state of the
+      /// integrator, so that it has to be realized to a stage again before
+      /// it is read. The realization is deferred to RealizedState(), so
+      /// several commands in one world update realize the state once.
+      /// \param[in] _stage Stage the state has to be realized to.
+      public: void InvalidateState(const SimTK::Stage &_stage);
+
+      /// \brief Get the state of the integrator, after realizing it to the
+      /// highest stage passed to InvalidateState() since the last call.
+      /// The realization locks the physics update mutex, so this can be
+      /// called from any thread.
+      /// \return The realized state.
+      public: const SimTK::State &RealizedState();
+
+      /// \brief Get the reaction force of the mobilizer of a body. The
+      /// reactions of all mobilizers are computed together once per step.
+      /// \param[in] _mobod The mobilized body.
+      /// \return Reaction on the body at its M frame, expressed in ground.
+      public: const SimTK::SpatialVec &MobilizerReaction(
+                  const SimTK::MobilizedBody &_mobod);
+
       /// \brief true if initialized
       public: bool simbodyPhysicsInitialized;
 
@@ -268,6 +291,27 @@ namespace gazebo
 
       private: SimTK::MultibodySystem *dynamicsWorld;
 
+      /// \brief Highest stage the commands since the last realization
+      /// need the advanced state to be realized to.
+      private: SimTK::Stage invalidStage = SimTK::Stage::Empty;
+
+      /// \brief Reactions of all mobilizers at their M frames in ground,
+      /// indexed by mobilized body.
+      private: SimTK::Vector_<SimTK::SpatialVec> mobilizerReactions;
+
+      /// \brief True if mobilizerReactions belong to the current state.
+      /// Written under physicsUpdateMutex, read without it by the post step
+      /// workers.
+      private: std::atomic<bool> mobilizerReactionsValid{false};
+
+      /// \brief Number of threads updating the links and joints after a
+      /// step.
+      private: int threads = 1;
+
+      /// \brief Runs the link and joint updates after a step, null if
+      /// single threaded.
+      private: std::unique_ptr<SimTK::ParallelExecutor> executor;
+
       private: common::Time lastUpdateTime;
 
       private: double stepTimeDouble;
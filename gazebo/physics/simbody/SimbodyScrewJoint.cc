@@ -57,7 +57,7 @@ double SimbodyScrewJoint::GetVelocity(unsigned int _index) const
     if (this->physicsInitialized &&
         this->simbodyPhysics->simbodyPhysicsInitialized)
       return this->mobod.getOneU(
-        this->simbodyPhysics->integ->getState(),
+        this->simbodyPhysics->RealizedState(),
         SimTK::MobilizerUIndex(_index));
     else
     {
@@ -152,11 +152,11 @@ ignition::math::Vector3d SimbodyScrewJoint::GlobalAxis(
     if (!this->mobod.isEmptyHandle())
     {
       const SimTK::Transform &X_OM = this->mobod.getOutboardFrame(
-        this->simbodyPhysics->integ->getState());
+        this->simbodyPhysics->RealizedState());
 
       // express Z-axis of X_OM in world frame
       SimTK::Vec3 z_W(this->mobod.expressVectorInGroundFrame(
-        this->simbodyPhysics->integ->getState(), X_OM.z()));
+        this->simbodyPhysics->RealizedState(), X_OM.z()));
 
       return SimbodyPhysics::Vec3ToVector3Ign(z_W);
     }
@@ -205,7 +205,7 @@ double SimbodyScrewJoint::PositionImpl(const unsigned int _index) const
         // _index=0: angular dof
         // _index=1: linear dof
         double position = this->mobod.getOneQ(
-          this->simbodyPhysics->integ->getState(), 0);
+          this->simbodyPhysics->RealizedState(), 0);
         if (_index == 1)
         {
           // return linear position
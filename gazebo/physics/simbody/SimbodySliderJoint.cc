@@ -65,8 +65,7 @@ void SimbodySliderJoint::SetVelocity(unsigned int _index, double _rate)
     this->mobod.setOneU(
       this->simbodyPhysics->integ->updAdvancedState(),
       SimTK::MobilizerUIndex(_index), _rate);
-    this->simbodyPhysics->system.realize(
-      this->simbodyPhysics->integ->getAdvancedState(), SimTK::Stage::Velocity);
+    this->simbodyPhysics->InvalidateState(SimTK::Stage::Velocity);
   }
   else
     gzerr << "SetVelocity _index too large.\n";
@@ -79,7 +78,7 @@ double SimbodySliderJoint::GetVelocity(unsigned int _index) const
   {
     if (this->simbodyPhysics->simbodyPhysicsInitialized)
       return this->mobod.getOneU(
-        this->simbodyPhysics->integ->getState(),
+        this->simbodyPhysics->RealizedState(),
         SimTK::MobilizerUIndex(_index));
     else
     {
@@ -115,11 +114,11 @@ ignition::math::Vector3d SimbodySliderJoint::GlobalAxis(
     if (!this->mobod.isEmptyHandle())
     {
       const SimTK::Transform &X_OM = this->mobod.getOutboardFrame(
-        this->simbodyPhysics->integ->getState());
+        this->simbodyPhysics->RealizedState());
 
       // express X-axis of X_OM in world frame
       SimTK::Vec3 x_W(this->mobod.expressVectorInGroundFrame(
-        this->simbodyPhysics->integ->getState(), X_OM.x()));
+        this->simbodyPhysics->RealizedState(), X_OM.x()));
 
       return SimbodyPhysics::Vec3ToVector3Ign(x_W);
     }
@@ -165,7 +164,7 @@ double SimbodySliderJoint::PositionImpl(const unsigned int _index) const
       if (!this->mobod.isEmptyHandle())
       {
         return this->mobod.getOneQ(
-          this->simbodyPhysics->integ->getState(), _index);
+          this->simbodyPhysics->RealizedState(), _index);
       }
       else
       {
@@ -15,6 +15,7 @@
  *
 */
 
+#include <chrono>
 #include <sstream>
 
 #include <boost/algorithm/string.hpp>
@@ -43,6 +44,7 @@
 #include "gazebo/common/Events.hh"
 #include "gazebo/common/Console.hh"
 #include "gazebo/common/Exception.hh"
+#include "gazebo/common/ScopeProfiler.hh"
 #include "gazebo/common/VideoEncoder.hh"
 
 #include "gazebo/rendering/ogre_gazebo.h"
@@ -62,6 +64,15 @@ using namespace rendering;
 
 unsigned int CameraPrivate::cameraCounter = 0;
 
+namespace
+{
+  /// \brief Number of captured frames that can wait to be saved or encoded.
+  const size_t kCaptureQueueSize = 8;
+
+  /// \brief Number of threads that save captured frames to disk.
+  const unsigned int kSaveThreadCount = 2;
+}
+
 //////////////////////////////////////////////////
 Camera::Camera(const std::string &_name, ScenePtr _scene,
                bool _autoRender)
@@ -385,6 +396,21 @@ void Camera::Init()
 //////////////////////////////////////////////////
 void Camera::Fini()
 {
+  // Save and encode the frames that are still queued
+  this->FinishVideoQueue();
+  if (this->dataPtr->saveQueue)
+  {
+    this->dataPtr->saveQueue->Flush();
+    const uint64_t dropped = this->dataPtr->saveQueue->DroppedCount();
+    if (dropped > 0)
+    {
+      gzwarn << "Camera [" << this->scopedName << "] dropped [" << dropped
+             << "] frames that were to be saved to disk" << std::endl;
+    }
+    this->dataPtr->droppedFrames += dropped;
+    this->dataPtr->saveQueue.reset();
+  }
+
   this->dataPtr->videoEncoder.Reset();
 
   if (this->saveFrameBuffer)
@@ -600,6 +626,7 @@ void Camera::Render(const bool _force)
 //////////////////////////////////////////////////
 void Camera::RenderImpl()
 {
+  GZ_PROFILE("Camera::RenderImpl");
   if (this->renderTarget)
   {
     {
@@ -697,6 +724,7 @@ common::Time Camera::LastRenderWallTime() const
 void Camera::PostRender()
 {
   IGN_PROFILE("rendering::Camera::PostRender");
+  GZ_PROFILE("Camera::PostRender");
   this->ReadPixelBuffer();
 
   // Only record last render time if data was actually generated
@@ -713,18 +741,35 @@ void Camera::PostRender()
 
     if (this->captureDataOnce)
     {
-      this->SaveFrame(this->FrameFilename());
+      this->QueueSaveFrame(this->FrameFilename());
       this->captureDataOnce = false;
     }
     else if (this->dataPtr->videoEncoder.IsEncoding())
     {
-      this->dataPtr->videoEncoder.AddFrame(buffer, width, height);
+      if (!this->dataPtr->videoQueue)
+      {
+        // A single worker, so that the frames are encoded in order
+        this->dataPtr->videoQueue.reset(new common::FrameQueue(
+            kCaptureQueueSize, 1, this->dataPtr->capturePolicy));
+      }
+
+      // Time stamp the frame now, the encoder skips frames by time stamp
+      const auto timestamp = std::chrono::steady_clock::now();
+      this->dataPtr->videoQueue->Push(buffer,
+          Ogre::PixelUtil::getMemorySize(width, height, 1,
+            static_cast<Ogre::PixelFormat>(this->imageFormat)),
+          [this, width, height, timestamp](const unsigned char *_data,
+            const size_t /*_size*/)
+          {
+            this->dataPtr->videoEncoder.AddFrame(_data, width, height,
+                timestamp);
+          });
     }
 
     if (this->sdf->HasElement("save") &&
         this->sdf->GetElement("save")->Get<bool>("enabled"))
     {
-      this->SaveFrame(this->FrameFilename());
+      this->QueueSaveFrame(this->FrameFilename());
     }
 
     // do last minute conversion if Bayer pattern is requested, go from R8G8B8
@@ -1235,6 +1280,70 @@ std::string Camera::ScopedName() const
   return this->scopedName;
 }
 
+//////////////////////////////////////////////////
+void Camera::QueueSaveFrame(const std::string &_filename)
+{
+  if (!this->dataPtr->saveQueue)
+  {
+    this->dataPtr->saveQueue.reset(new common::FrameQueue(
+        kCaptureQueueSize, kSaveThreadCount, this->dataPtr->capturePolicy));
+  }
+
+  const unsigned int width = this->ImageWidth();
+  const unsigned int height = this->ImageHeight();
+  const int depth = this->ImageDepth();
+  const std::string format = this->ImageFormat();
+
+  this->dataPtr->saveQueue->Push(this->saveFrameBuffer,
+      Ogre::PixelUtil::getMemorySize(width, height, 1,
+        static_cast<Ogre::PixelFormat>(this->imageFormat)),
+      [width, height, depth, format, _filename](const unsigned char *_data,
+        const size_t /*_size*/)
+      {
+        Camera::SaveFrame(_data, width, height, depth, format, _filename);
+      });
+}
+
+//////////////////////////////////////////////////
+void Camera::FinishVideoQueue()
+{
+  if (!this->dataPtr->videoQueue)
+    return;
+
+  this->dataPtr->videoQueue->Flush();
+  const uint64_t dropped = this->dataPtr->videoQueue->DroppedCount();
+  if (dropped > 0)
+  {
+    gzwarn << "Camera [" << this->scopedName << "] dropped [" << dropped
+           << "] video frames because the encoder couldn't keep up"
+           << std::endl;
+  }
+  this->dataPtr->droppedFrames += dropped;
+  this->dataPtr->videoQueue.reset();
+}
+
+//////////////////////////////////////////////////
+void Camera::SetCaptureOverflowPolicy(
+    const common::FrameQueue::OverflowPolicy _policy)
+{
+  this->dataPtr->capturePolicy = _policy;
+  if (this->dataPtr->saveQueue)
+    this->dataPtr->saveQueue->SetPolicy(_policy);
+  if (this->dataPtr->videoQueue)
+    this->dataPtr->videoQueue->SetPolicy(_policy);
+}
+
+//////////////////////////////////////////////////
+uint64_t Camera::DroppedCaptureFrameCount() const
+{
+  uint64_t dropped = this->dataPtr->droppedFrames;
+  if (this->dataPtr->saveQueue)
+    dropped += this->dataPtr->saveQueue->DroppedCount();
+  if (this->dataPtr->videoQueue)
+    dropped += this->dataPtr->videoQueue->DroppedCount();
+  return dropped;
+}
+
 //////////////////////////////////////////////////
 bool Camera::SaveFrame(const std::string &_filename)
 {
@@ -1297,9 +1406,36 @@ bool Camera::SaveFrame(const unsigned char *_image,
   }
 
   Ogre::ImageCodec::ImageData *imgData;
-  Ogre::Codec * pCodec;
+  Ogre::Codec * pCodec = nullptr;
   size_t size, pos;
 
+  // Find the file extension
+  Ogre::String filename = _filename;
+  pos = filename.find_last_of(".");
+  Ogre::String extension;
+
+  while (pos != filename.length() - 1)
+    extension += filename[++pos];
+
+  // Get the codec
+  try
+  {
+    pCodec = Ogre::Codec::getCodec(extension);
+  }
+  catch(Ogre::Exception &_e)
+  {
+    gzerr << "Unable to save frame [" << _filename << "]: "
+          << _e.getDescription() << std::endl;
+    return false;
+  }
+
+  if (!pCodec)
+  {
+    gzerr << "No image codec for extension [" << extension
+          << "], unable to save frame [" << _filename << "]\n";
+    return false;
+  }
+
   // Create image data structure
   imgData  = new Ogre::ImageCodec::ImageData();
   imgData->width  =  _width;
@@ -1313,17 +1449,6 @@ bool Camera::SaveFrame(const unsigned char *_image,
       new Ogre::MemoryDataStream(const_cast<unsigned char*>(_image),
         size, false));
 
-  // Get codec
-  Ogre::String filename = _filename;
-  pos = filename.find_last_of(".");
-  Ogre::String extension;
-
-  while (pos != filename.length() - 1)
-    extension += filename[++pos];
-
-  // Get the codec
-  pCodec = Ogre::Codec::getCodec(extension);
-
   // Write out
   Ogre::Codec::CodecDataPtr codecDataPtr(imgData);
 
@@ -1507,6 +1632,7 @@ bool Camera::StartVideo(const std::string &_format,
 //////////////////////////////////////////////////
 bool Camera::StopVideo()
 {
+  this->FinishVideoQueue();
   return this->dataPtr->videoEncoder.Stop();
 }
 
@@ -1515,12 +1641,14 @@ bool Camera::SaveVideo(const std::string &_filename)
 {
   // This will stop video encoding, save the video file, and reset
   // video encoding.
+  this->FinishVideoQueue();
   return this->dataPtr->videoEncoder.SaveToFile(_filename);
 }
 
 //////////////////////////////////////////////////
 bool Camera::ResetVideo()
 {
+  this->FinishVideoQueue();
   this->dataPtr->videoEncoder.Reset();
   return true;
 }
@@ -41,6 +41,7 @@
 #include "gazebo/transport/Subscriber.hh"
 
 #include "gazebo/common/Event.hh"
+#include "gazebo/common/FrameQueue.hh"
 #include "gazebo/common/PID.hh"
 #include "gazebo/common/Time.hh"
 
@@ -545,6 +546,22 @@ namespace gazebo
       /// always return true.
       public: bool ResetVideo();
 
+      /// \brief Set what happens when frames are captured faster than they
+      /// can be saved to disk or encoded into a video. Captured frames are
+      /// copied into a bounded queue, and saved or encoded on worker threads
+      /// so that the render thread doesn't wait for the encoders. The
+      /// default is to block until there is room in the queue, so that no
+      /// frame is lost.
+      /// \param[in] _policy What to do when the queue is full.
+      public: void SetCaptureOverflowPolicy(
+                  const common::FrameQueue::OverflowPolicy _policy);
+
+      /// \brief Get the number of captured frames that were not saved or
+      /// encoded because the capture queue was full.
+      /// \return Number of dropped frames.
+      /// \sa SetCaptureOverflowPolicy
+      public: uint64_t DroppedCaptureFrameCount() const;
+
       /// \brief Set the render target
       /// \param[in] _textureName Name of the new render texture
       public: void CreateRenderTexture(const std::string &_textureName);
@@ -890,6 +907,15 @@ namespace gazebo
       /// the entire class.
       friend class WideAngleCamera;
 
+      /// \brief Queue the last captured frame to be saved to disk by a worker
+      /// thread.
+      /// \param[in] _filename Name of the file to save the frame to.
+      private: void QueueSaveFrame(const std::string &_filename);
+
+      /// \brief Wait until the queued video frames are encoded, then stop the
+      /// video queue and report the frames it dropped.
+      private: void FinishVideoQueue();
+
       /// \brief Receive command message.
       /// \param[in] _msg Camera Command message.
       private: void OnCmdMsg(ConstCameraCmdPtr &_msg);
@@ -18,11 +18,13 @@
 #define GAZEBO_RENDERING_CAMERAPRIVATE_HH_
 
 #include <deque>
+#include <memory>
 #include <mutex>
 #include <utility>
 #include <list>
 #include <ignition/math/Pose3.hh>
 
+#include "gazebo/common/FrameQueue.hh"
 #include "gazebo/common/PID.hh"
 #include "gazebo/common/VideoEncoder.hh"
 #include "gazebo/msgs/msgs.hh"
@@ -112,6 +114,20 @@ namespace gazebo
       /// \brief Video encoder.
       public: common::VideoEncoder videoEncoder;
 
+      /// \brief Queue of frames to save to disk, created on first use.
+      /// Declared after the encoder, so it is destroyed first.
+      public: std::unique_ptr<common::FrameQueue> saveQueue;
+
+      /// \brief Queue of frames to add to the video, created on first use.
+      public: std::unique_ptr<common::FrameQueue> videoQueue;
+
+      /// \brief What the frame queues do when they are full.
+      public: common::FrameQueue::OverflowPolicy capturePolicy =
+                  common::FrameQueue::OverflowPolicy::BLOCK;
+
+      /// \brief Frames dropped by frame queues that were destroyed.
+      public: uint64_t droppedFrames = 0;
+
       /// \brief If set to true, the camera yaws around a fixed axis.
       public: bool yawFixed;
 
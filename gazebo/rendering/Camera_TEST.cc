@@ -16,6 +16,7 @@
 */
 
 #include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
 #include "gazebo/rendering/Camera.hh"
 #include "gazebo/rendering/RenderingIface.hh"
 #include "gazebo/rendering/RenderTypes.hh"
@@ -281,6 +282,73 @@ TEST_F(Camera_TEST, Create)
   }
 }
 
+/////////////////////////////////////////////////
+TEST_F(Camera_TEST, SaveFrames)
+{
+  Load("worlds/empty.world");
+
+  rendering::ScenePtr scene = rendering::get_scene("default");
+  if (!scene)
+    scene = rendering::create_scene("default", false);
+  ASSERT_TRUE(scene != nullptr);
+
+  boost::filesystem::path path = boost::filesystem::temp_directory_path() /
+      boost::filesystem::unique_path("gazebo_camera_%%%%%%");
+
+  rendering::CameraPtr camera = scene->CreateCamera("test_camera_save", false);
+  ASSERT_TRUE(camera != nullptr);
+
+  std::stringstream ss;
+  ss << "<sdf version='" << SDF_VERSION << "'>"
+     << "  <camera>"
+     << "    <horizontal_fov>0.78</horizontal_fov>"
+     << "    <image>"
+     << "      <width>320</width>"
+     << "      <height>240</height>"
+     << "      <format>R8G8B8</format>"
+     << "    </image>"
+     << "    <clip>"
+     << "      <near>0.1</near><far>100</far>"
+     << "    </clip>"
+     << "    <save enabled='true'>"
+     << "      <path>" << path.string() << "</path>"
+     << "    </save>"
+     << "  </camera>"
+     << "</sdf>";
+  sdf::ElementPtr cameraSDF(new sdf::Element);
+  sdf::initFile("camera.sdf", cameraSDF);
+  sdf::readString(ss.str(), cameraSDF);
+  camera->Load(cameraSDF);
+  camera->Init();
+  camera->SetCaptureData(true);
+  camera->CreateRenderTexture("test_camera_save_rtt");
+  EXPECT_EQ(0u, camera->DroppedCaptureFrameCount());
+
+  // The frames are saved on worker threads while rendering continues
+  const unsigned int frameCount = 10;
+  for (unsigned int i = 0; i < frameCount; ++i)
+  {
+    camera->Update();
+    camera->Render(true);
+    camera->PostRender();
+  }
+
+  // Fini waits for the queued frames to be saved
+  camera->Fini();
+  EXPECT_EQ(0u, camera->DroppedCaptureFrameCount());
+
+  unsigned int fileCount = 0;
+  for (boost::filesystem::directory_iterator iter(path);
+       iter != boost::filesystem::directory_iterator(); ++iter)
+  {
+    ++fileCount;
+  }
+  EXPECT_EQ(frameCount, fileCount);
+
+  boost::filesystem::remove_all(path);
+  scene->RemoveCamera(camera->Name());
+}
+
 /////////////////////////////////////////////////
 int main(int argc, char **argv)
 {
@@ -160,17 +160,11 @@ DepthCamera::DepthCamera(const std::string &_namePrefix, ScenePtr _scene,
 //////////////////////////////////////////////////
 DepthCamera::~DepthCamera()
 {
-  if (this->dataPtr->depthBuffer)
-    delete [] this->dataPtr->depthBuffer;
-
   if (this->dataPtr->reflectanceBuffer)
     delete [] this->dataPtr->reflectanceBuffer;
 
   if (this->dataPtr->normalsBuffer)
     delete [] this->dataPtr->normalsBuffer;
-
-  if (this->dataPtr->pcdBuffer)
-    delete [] this->dataPtr->pcdBuffer;
 }
 
 //////////////////////////////////////////////////
@@ -279,10 +273,11 @@ void DepthCamera::CreateDepthTexture(const std::string &_textureName)
         this->dataPtr->pcdTarget->addViewport(this->camera);
     this->dataPtr->pcdViewport->setClearEveryFrame(true);
 
-    auto const &ignBG = this->scene->BackgroundColor();
-    this->dataPtr->pcdViewport->setBackgroundColour(
-        Conversions::Convert(ignBG));
+    // Pixels that hit nothing keep the clear colour, see UpdateRenderTarget
+    this->dataPtr->pcdViewport->setBackgroundColour(Ogre::ColourValue(
+        this->FarClip(), this->FarClip(), this->FarClip(), -1.0f));
     this->dataPtr->pcdViewport->setOverlaysEnabled(false);
+    this->dataPtr->pcdViewport->setSkiesEnabled(false);
     this->dataPtr->pcdViewport->setShadowsEnabled(false);
     this->dataPtr->pcdViewport->setVisibilityMask(
         GZ_VISIBILITY_ALL & ~(GZ_VISIBILITY_GUI | GZ_VISIBILITY_SELECTABLE));
@@ -410,53 +405,64 @@ void DepthCamera::PostRender()
     unsigned int width = this->ImageWidth();
     unsigned int height = this->ImageHeight();
 
+    this->dataPtr->bytesReadBack = 0;
+
+    // Read the frame back into a pooled buffer, and share that buffer with
+    // the subscribers instead of copying it. The pool reuses a buffer once
+    // every subscriber has released it.
     if (!this->dataPtr->outputPoints)
     {
-      Ogre::HardwarePixelBufferSharedPtr pixelBuffer;
-
-      // Get access to the buffer and make an image and write it to file
-      pixelBuffer = this->depthTexture->getBuffer();
-
       size_t size = Ogre::PixelUtil::getMemorySize(width, height, 1,
           Ogre::PF_FLOAT32_R);
 
-      // Blit the depth buffer if needed
-      if (!this->dataPtr->depthBuffer)
-        this->dataPtr->depthBuffer = new float[size];
+      auto buffer = this->dataPtr->depthPool.Acquire(width * height);
 
       Ogre::PixelBox dstBox(width, height,
-          1, Ogre::PF_FLOAT32_R, this->dataPtr->depthBuffer);
+          1, Ogre::PF_FLOAT32_R, buffer->data());
 
+      // Get access to the buffer and make an image and write it to file
+      Ogre::HardwarePixelBufferSharedPtr pixelBuffer =
+          this->depthTexture->getBuffer();
       pixelBuffer->lock(Ogre::HardwarePixelBuffer::HBL_NORMAL);
       pixelBuffer->blitToMemory(dstBox);
       pixelBuffer->unlock();  // FIXME: do we need to lock/unlock still?
+      this->dataPtr->bytesReadBack += size;
+
+      {
+        std::lock_guard<std::mutex> lock(this->dataPtr->bufferMutex);
+        this->dataPtr->depthBuffer = buffer;
+        if (this->dataPtr->depthDataUsed)
+          this->dataPtr->depthData.assign(buffer->begin(), buffer->end());
+      }
 
       this->dataPtr->newDepthFrame(
-          this->dataPtr->depthBuffer, width, height, 1, "FLOAT32");
+          buffer->data(), width, height, 1, "FLOAT32");
+      this->dataPtr->newDepthBuffer(buffer, width, height);
     }
     else
     {
-      Ogre::HardwarePixelBufferSharedPtr pcdPixelBuffer;
-
-      // Get access to the buffer and make an image and write it to file
-      pcdPixelBuffer = this->dataPtr->pcdTexture->getBuffer();
-
-      // Blit the depth buffer if needed
-      if (!this->dataPtr->pcdBuffer)
-        this->dataPtr->pcdBuffer = new float[width * height * 4];
-
-      memset(this->dataPtr->pcdBuffer, 0, width * height * 4);
+      auto buffer = this->dataPtr->pcdPool.Acquire(width * height * 4);
 
       Ogre::Box pcd_src_box(0, 0, width, height);
       Ogre::PixelBox pcd_dst_box(width, height,
-          1, Ogre::PF_FLOAT32_RGBA, this->dataPtr->pcdBuffer);
+          1, Ogre::PF_FLOAT32_RGBA, buffer->data());
 
+      // Get access to the buffer and make an image and write it to file
+      Ogre::HardwarePixelBufferSharedPtr pcdPixelBuffer =
+          this->dataPtr->pcdTexture->getBuffer();
       pcdPixelBuffer->lock(Ogre::HardwarePixelBuffer::HBL_NORMAL);
       pcdPixelBuffer->blitToMemory(pcd_src_box, pcd_dst_box);
       pcdPixelBuffer->unlock();
+      this->dataPtr->bytesReadBack += buffer->size() * sizeof(float);
+
+      {
+        std::lock_guard<std::mutex> lock(this->dataPtr->bufferMutex);
+        this->dataPtr->pcdBuffer = buffer;
+      }
 
       this->dataPtr->newRGBPointCloud(
-          this->dataPtr->pcdBuffer, width, height, 1, "RGBPOINTS");
+          buffer->data(), width, height, 1, "RGBPOINTS");
+      this->dataPtr->newPointCloudBuffer(buffer, width, height);
     }
 
     if (this->dataPtr->outputReflectance)
@@ -479,6 +485,7 @@ void DepthCamera::PostRender()
      reflectancePixelBuffer->blitToMemory(reflectance_src_box,
                                           reflectance_dst_box);
      reflectancePixelBuffer->unlock();
+     this->dataPtr->bytesReadBack += width * height * sizeof(float);
 
      this->dataPtr->newReflectanceFrame(
          this->dataPtr->reflectanceBuffer, width, height, 1, "REFLECTANCE");
@@ -503,6 +510,7 @@ void DepthCamera::PostRender()
       normalsPixelBuffer->lock(Ogre::HardwarePixelBuffer::HBL_NORMAL);
       normalsPixelBuffer->blitToMemory(normals_src_box, normals_dst_box);
       normalsPixelBuffer->unlock();
+      this->dataPtr->bytesReadBack += width * height * 4 * sizeof(float);
 
       this->dataPtr->newNormalsPointCloud(
           this->dataPtr->normalsBuffer, width, height, 1, "NORMALS");
@@ -540,6 +548,13 @@ void DepthCamera::UpdateRenderTarget(Ogre::RenderTarget *_target,
   // return farClip in case no renderable object is inside frustrum
   if (_target == this->dataPtr->normalsTarget)
     vp->setBackgroundColour(Ogre::ColourValue(0, 0, 0));
+  else if (_target == this->dataPtr->pcdTarget)
+  {
+    // Points that hit nothing also get a negative color, which the
+    // XYZPoints material never writes
+    vp->setBackgroundColour(Ogre::ColourValue(this->FarClip(),
+        this->FarClip(), this->FarClip(), -1.0f));
+  }
   else
     vp->setBackgroundColour(Ogre::ColourValue(this->FarClip(),
         this->FarClip(), this->FarClip()));
@@ -651,9 +666,40 @@ void DepthCamera::RenderImpl()
 //////////////////////////////////////////////////
 const float* DepthCamera::DepthData() const
 {
+  std::lock_guard<std::mutex> lock(this->dataPtr->bufferMutex);
+
+  // Pooled buffers are reused once released, so callers that keep the raw
+  // pointer get a copy that belongs to the camera. From now on, PostRender
+  // refreshes it with every frame.
+  this->dataPtr->depthDataUsed = true;
+  if (this->dataPtr->depthData.empty() && this->dataPtr->depthBuffer)
+    this->dataPtr->depthData = *this->dataPtr->depthBuffer;
+
+  if (this->dataPtr->depthData.empty())
+    return nullptr;
+  return this->dataPtr->depthData.data();
+}
+
+//////////////////////////////////////////////////
+DepthCameraBufferPtr DepthCamera::DepthBuffer() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->bufferMutex);
   return this->dataPtr->depthBuffer;
 }
 
+//////////////////////////////////////////////////
+DepthCameraBufferPtr DepthCamera::PointCloudBuffer() const
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->bufferMutex);
+  return this->dataPtr->pcdBuffer;
+}
+
+//////////////////////////////////////////////////
+size_t DepthCamera::BytesReadBack() const
+{
+  return this->dataPtr->bytesReadBack;
+}
+
 //////////////////////////////////////////////////
 void DepthCamera::SetDepthTarget(Ogre::RenderTarget *_target)
 {
@@ -696,6 +742,22 @@ event::ConnectionPtr DepthCamera::ConnectNewRGBPointCloud(
   return this->dataPtr->newRGBPointCloud.Connect(_subscriber);
 }
 
+//////////////////////////////////////////////////
+event::ConnectionPtr DepthCamera::ConnectNewDepthBuffer(
+    std::function<void (const DepthCameraBufferPtr &, unsigned int,
+    unsigned int)> _subscriber)
+{
+  return this->dataPtr->newDepthBuffer.Connect(_subscriber);
+}
+
+//////////////////////////////////////////////////
+event::ConnectionPtr DepthCamera::ConnectNewPointCloudBuffer(
+    std::function<void (const DepthCameraBufferPtr &, unsigned int,
+    unsigned int)> _subscriber)
+{
+  return this->dataPtr->newPointCloudBuffer.Connect(_subscriber);
+}
+
 //////////////////////////////////////////////////
 event::ConnectionPtr DepthCamera::ConnectNewReflectanceFrame(
     std::function<void (const float*, unsigned int, unsigned int, unsigned int,
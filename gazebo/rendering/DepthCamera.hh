@@ -18,8 +18,10 @@
 #ifndef _GAZEBO_RENDERING_DEPTHCAMERA_HH_
 #define _GAZEBO_RENDERING_DEPTHCAMERA_HH_
 
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <sdf/sdf.hh>
 
@@ -43,6 +45,11 @@ namespace gazebo
     // Forward declare private data.
     class DepthCameraPrivate;
 
+    /// \brief Shared, read only buffer of a depth camera frame. Consumers
+    /// may keep it as long as they need the frame. The camera reuses the
+    /// buffer once it is released.
+    using DepthCameraBufferPtr = std::shared_ptr<const std::vector<float>>;
+
     /// \addtogroup gazebo_rendering Rendering
     /// \{
 
@@ -88,10 +95,32 @@ namespace gazebo
       /// \brief Render the camera
       public: virtual void PostRender();
 
-      /// \brief All things needed to get back z buffer for depth data
+      /// \brief All things needed to get back z buffer for depth data.
+      /// The array belongs to the camera, and keeps its address while the
+      /// image size doesn't change. Once this function was called, every
+      /// new frame is copied into it. Use DepthBuffer() or
+      /// ConnectNewDepthBuffer() to get frames without a copy.
       /// \return The z-buffer as a float array
       public: virtual const float *DepthData() const;
 
+      /// \brief Get the buffer of the last depth frame. Unlike DepthData(),
+      /// the frame is not overwritten while the pointer is held.
+      /// \return The depth buffer, or null before the first frame or when
+      /// the camera outputs points.
+      public: DepthCameraBufferPtr DepthBuffer() const;
+
+      /// \brief Get the buffer of the last point cloud, in the layout of
+      /// ConnectNewRGBPointCloud().
+      /// \return The point cloud buffer, or null before the first frame or
+      /// when the camera does not output points.
+      public: DepthCameraBufferPtr PointCloudBuffer() const;
+
+      /// \brief Get the number of bytes read back from the GPU for the last
+      /// captured frame, for the depth, point cloud, reflectance and
+      /// normals outputs.
+      /// \return Number of bytes.
+      public: size_t BytesReadBack() const;
+
       /// \brief Set the render target, which renders the depth data
       /// \param[in] _target Pointer to the render target
       public: virtual void SetDepthTarget(Ogre::RenderTarget *_target);
@@ -120,6 +149,26 @@ namespace gazebo
           std::function<void (const float *, unsigned int, unsigned int,
           unsigned int, const std::string &)>  _subscriber);
 
+      /// \brief Connect to the new depth buffer signal. The callback receives
+      /// the same data as ConnectNewDepthFrame(), in a buffer that it may
+      /// keep past the callback instead of copying it.
+      /// \param[in] _subscriber Subscriber callback function, that receives
+      /// the buffer, the width and the height of the frame.
+      /// \return Pointer to the new Connection. This must be kept in scope
+      public: event::ConnectionPtr ConnectNewDepthBuffer(
+          std::function<void (const DepthCameraBufferPtr &, unsigned int,
+          unsigned int)> _subscriber);
+
+      /// \brief Connect to the new point cloud buffer signal. The callback
+      /// receives the same data as ConnectNewRGBPointCloud(), in a buffer
+      /// that it may keep past the callback instead of copying it.
+      /// \param[in] _subscriber Subscriber callback function, that receives
+      /// the buffer, the width and the height of the point cloud.
+      /// \return Pointer to the new Connection. This must be kept in scope
+      public: event::ConnectionPtr ConnectNewPointCloudBuffer(
+          std::function<void (const DepthCameraBufferPtr &, unsigned int,
+          unsigned int)> _subscriber);
+
       /// \brief Connect a to the new reflectance data
       /// \param[in] _subscriber Subscriber callback function
       /// \return Pointer to the new Connection. This must be kept in scope
@@ -18,11 +18,16 @@
 #ifndef _GAZEBO_RENDERING_DEPTHCAMERA_PRIVATE_HH_
 #define _GAZEBO_RENDERING_DEPTHCAMERA_PRIVATE_HH_
 
+#include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
+#include "gazebo/common/BufferPool.hh"
 #include "gazebo/common/Event.hh"
 
 #include "gazebo/rendering/Camera.hh"
+#include "gazebo/rendering/DepthCamera.hh"
 
 namespace Ogre
 {
@@ -54,8 +59,11 @@ namespace gazebo
     /// \brief Private data for the DepthCameraPrivate class
     class DepthCameraPrivate
     {
-      /// \brief The depth buffer
-      public: float *depthBuffer = nullptr;
+      /// \brief Buffers that depth frames are read back into.
+      public: common::BufferPool<float> depthPool;
+
+      /// \brief Buffer of the last depth frame.
+      public: DepthCameraBufferPtr depthBuffer;
 
       /// \brief The depth material
       public: Ogre::Material *depthMaterial = nullptr;
@@ -69,8 +77,27 @@ namespace gazebo
       /// \brief True to generate normals
       public: bool outputNormals;
 
-      /// \brief Point cloud data buffer
-      public: float *pcdBuffer = nullptr;
+      /// \brief Buffers that point clouds are read back into.
+      public: common::BufferPool<float> pcdPool;
+
+      /// \brief Buffer of the last point cloud.
+      public: DepthCameraBufferPtr pcdBuffer;
+
+      /// \brief Copy of the last depth frame that DepthData() points to.
+      /// Unlike the pooled buffers, it keeps its address from frame to frame.
+      public: std::vector<float> depthData;
+
+      /// \brief True once DepthData() was called. Until then, frames are
+      /// not copied into depthData.
+      public: bool depthDataUsed = false;
+
+      /// \brief Protects depthBuffer, pcdBuffer, depthData and
+      /// depthDataUsed.
+      public: mutable std::mutex bufferMutex;
+
+      /// \brief Number of bytes read back from the GPU by the last
+      /// PostRender() that captured data.
+      public: size_t bytesReadBack = 0;
 
       /// \brief reflectance data buffer
       public: float *reflectanceBuffer = nullptr;
@@ -129,6 +156,14 @@ namespace gazebo
       public: event::EventT<void(const float *, unsigned int, unsigned int,
                   unsigned int, const std::string &)> newReflectanceFrame;
 
+      /// \brief Event used to share the buffer of a depth frame
+      public: event::EventT<void(const DepthCameraBufferPtr &, unsigned int,
+                  unsigned int)> newDepthBuffer;
+
+      /// \brief Event used to share the buffer of a point cloud
+      public: event::EventT<void(const DepthCameraBufferPtr &, unsigned int,
+                  unsigned int)> newPointCloudBuffer;
+
       /// \brief Event used to signal normals point cloud data
       public: event::EventT<void(const float *, unsigned int, unsigned int,
                   unsigned int, const std::string &)> newNormalsPointCloud;
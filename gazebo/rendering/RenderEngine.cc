@@ -14,9 +14,12 @@
  * limitations under the License.
  *
 */
+#include <cstdlib>
 #include <string>
+#include <sstream>
 #include <iostream>
 #include <functional>
+#include <vector>
 #include <boost/filesystem.hpp>
 #include <sys/types.h>
 
@@ -35,6 +38,14 @@
 
 #include "gazebo/gazebo_config.h"
 
+#ifdef HAVE_EGL
+# include <EGL/egl.h>
+# include <EGL/eglext.h>
+# ifndef EGL_PLATFORM_SURFACELESS_MESA
+#  define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+# endif
+#endif
+
 #include <ignition/common/Profiler.hh>
 
 #include "gazebo/common/CommonIface.hh"
@@ -56,6 +67,92 @@
 using namespace gazebo;
 using namespace rendering;
 
+#if defined(HAVE_EGL) && !defined(__APPLE__) && !defined(_WIN32)
+/////////////////////////////////////////////////
+/// \brief Check if an EGL extension string lists an extension.
+/// \param[in] _extensions Space separated extensions, or null.
+/// \param[in] _name Name of the extension.
+/// \return True if the extension is listed.
+static bool HasEGLExtension(const char *_extensions, const std::string &_name)
+{
+  if (!_extensions)
+    return false;
+
+  std::istringstream stream(_extensions);
+  std::string extension;
+  while (stream >> extension)
+  {
+    if (extension == _name)
+      return true;
+  }
+  return false;
+}
+
+/////////////////////////////////////////////////
+/// \brief Get an EGL display that needs no display server. Mesa's
+/// surfaceless platform is used when it is available. In software, the
+/// display of Mesa's software device is used, so no GPU is touched.
+/// \param[in] _software True to render in software.
+/// \return The display, or EGL_NO_DISPLAY.
+static EGLDisplay OffscreenEGLDisplay(const bool _software)
+{
+  const char *clientExtensions =
+      eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+  auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(
+      eglGetProcAddress("eglGetPlatformDisplayEXT"));
+
+  if (!getPlatformDisplay ||
+      !HasEGLExtension(clientExtensions, "EGL_EXT_platform_base"))
+  {
+    if (_software)
+    {
+      gzerr << "EGL doesn't support platform displays, so the software "
+            << "device can't be selected\n";
+      return EGL_NO_DISPLAY;
+    }
+    return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+  }
+
+  if (_software)
+  {
+    auto queryDevices = reinterpret_cast<PFNEGLQUERYDEVICESEXTPROC>(
+        eglGetProcAddress("eglQueryDevicesEXT"));
+    auto queryDeviceString = reinterpret_cast<PFNEGLQUERYDEVICESTRINGEXTPROC>(
+        eglGetProcAddress("eglQueryDeviceStringEXT"));
+
+    EGLint count = 0;
+    if (queryDevices && queryDeviceString &&
+        queryDevices(0, nullptr, &count) && count > 0)
+    {
+      std::vector<EGLDeviceEXT> devices(count);
+      if (queryDevices(count, devices.data(), &count))
+      {
+        for (EGLint i = 0; i < count; ++i)
+        {
+          if (HasEGLExtension(queryDeviceString(devices[i], EGL_EXTENSIONS),
+                "EGL_MESA_device_software"))
+          {
+            return getPlatformDisplay(EGL_PLATFORM_DEVICE_EXT, devices[i],
+                nullptr);
+          }
+        }
+      }
+    }
+
+    gzerr << "Unable to find Mesa's software EGL device\n";
+    return EGL_NO_DISPLAY;
+  }
+
+  if (HasEGLExtension(clientExtensions, "EGL_MESA_platform_surfaceless"))
+  {
+    return getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA,
+        EGL_DEFAULT_DISPLAY, nullptr);
+  }
+
+  return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+}
+#endif
+
 //////////////////////////////////////////////////
 RenderEngine::RenderEngine()
   : dataPtr(new RenderEnginePrivate)
@@ -73,6 +170,31 @@ RenderEngine::RenderEngine()
 
   this->dataPtr->renderPathType = NONE;
   this->dataPtr->windowManager.reset(new WindowManager);
+
+  this->dataPtr->contextType = GLX;
+  const char *contextEnv = std::getenv("GAZEBO_RENDER_CONTEXT");
+  if (contextEnv)
+  {
+    const std::string context = contextEnv;
+    if (context == "egl")
+      this->dataPtr->contextType = EGL;
+    else if (context == "egl_software")
+      this->dataPtr->contextType = EGL_SOFTWARE;
+    else if (context != "glx")
+    {
+      gzwarn << "Unknown GAZEBO_RENDER_CONTEXT [" << context << "]. "
+             << "Use glx, egl or egl_software. Using glx.\n";
+    }
+  }
+#if defined(HAVE_EGL) && !defined(__APPLE__) && !defined(_WIN32)
+  else if (!std::getenv("DISPLAY"))
+  {
+    // Try to render offscreen instead of disabling rendering. There may
+    // be no usable EGL device, so Load disables rendering if this fails.
+    this->dataPtr->contextType = EGL;
+    this->dataPtr->contextAutoSelected = true;
+  }
+#endif
 }
 
 //////////////////////////////////////////////////
@@ -86,7 +208,10 @@ void RenderEngine::Load()
 {
   if (!this->CreateContext())
   {
-    gzwarn << "Unable to create X window. Rendering will be disabled\n";
+    if (this->dataPtr->contextType == GLX)
+      gzwarn << "Unable to create X window. Rendering will be disabled\n";
+    else
+      gzwarn << "Unable to create EGL context. Rendering will be disabled\n";
     return;
   }
 
@@ -127,14 +252,31 @@ void RenderEngine::Load()
       this->dataPtr->overlaySystem = new Ogre::OverlaySystem();
 #endif
 
-    // Load all the plugins
-    this->LoadPlugins();
+    try
+    {
+      // Load all the plugins
+      this->LoadPlugins();
 
-    // Setup the rendering system, and create the context
-    this->SetupRenderSystem();
+      // Setup the rendering system, and create the context
+      this->SetupRenderSystem();
 
-    // Initialize the root node, and don't create a window
-    this->dataPtr->root->initialise(false);
+      // Initialize the root node, and don't create a window
+      this->dataPtr->root->initialise(false);
+    }
+    catch(common::Exception &_e)
+    {
+      if (this->dataPtr->contextType == GLX)
+        throw;
+      this->DisableEGLContext(_e.GetErrorStr());
+      return;
+    }
+    catch(Ogre::Exception &_e)
+    {
+      if (this->dataPtr->contextType == GLX)
+        throw;
+      this->DisableEGLContext(_e.getDescription());
+      return;
+    }
 
     // Setup the available resources
     this->SetupResources();
@@ -144,8 +286,30 @@ void RenderEngine::Load()
   // testing, this is a hard requirement by Apple. We also need it to
   // properly initialize GLWidget and UserCameras. See the GLWidget
   // constructor.
-  this->dataPtr->windowManager->CreateWindow(
-      std::to_string(this->dummyWindowId), 1, 1);
+  if (this->dataPtr->contextType == GLX)
+  {
+    this->dataPtr->windowManager->CreateWindow(
+        std::to_string(this->dummyWindowId), 1, 1);
+  }
+  else
+  {
+    // Without a parent window, the window manager asks OGRE to render
+    // with the current EGL context created by CreateEGLContext.
+    try
+    {
+      this->dataPtr->windowManager->CreateWindow("", 1, 1);
+    }
+    catch(common::Exception &_e)
+    {
+      this->DisableEGLContext(_e.GetErrorStr());
+      return;
+    }
+    catch(Ogre::Exception &_e)
+    {
+      this->DisableEGLContext(_e.getDescription());
+      return;
+    }
+  }
 
   this->CheckSystemCapabilities();
 }
@@ -391,6 +555,8 @@ void RenderEngine::Fini()
   }
 # endif
 
+  this->ReleaseEGLContext();
+
   this->dataPtr->initialized = false;
 }
 
@@ -736,6 +902,9 @@ void RenderEngine::SetupRenderSystem()
 /////////////////////////////////////////////////
 bool RenderEngine::CreateContext()
 {
+  if (this->dataPtr->contextType != GLX)
+    return this->CreateEGLContext();
+
   bool result = true;
 
 #if defined __APPLE__ || _WIN32
@@ -792,6 +961,163 @@ bool RenderEngine::CreateContext()
   return result;
 }
 
+/////////////////////////////////////////////////
+bool RenderEngine::CreateEGLContext()
+{
+  this->dummyDisplay = NULL;
+  this->dummyWindowId = 0;
+
+#if defined(HAVE_EGL) && !defined(__APPLE__) && !defined(_WIN32)
+  const bool software = this->dataPtr->contextType == EGL_SOFTWARE;
+  EGLDisplay display = OffscreenEGLDisplay(software);
+  EGLint major = 0;
+  EGLint minor = 0;
+  if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor))
+  {
+    gzerr << "Unable to initialize an EGL display\n";
+    return false;
+  }
+  this->dataPtr->eglDisplay = display;
+
+  // OGRE's GL render system needs desktop OpenGL, not OpenGL ES
+  if (!eglBindAPI(EGL_OPENGL_API))
+  {
+    gzerr << "EGL display doesn't support OpenGL\n";
+    this->ReleaseEGLContext();
+    return false;
+  }
+
+  const EGLint configAttribs[] = {
+    EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+    EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+    EGL_RED_SIZE, 8,
+    EGL_GREEN_SIZE, 8,
+    EGL_BLUE_SIZE, 8,
+    EGL_DEPTH_SIZE, 16,
+    EGL_STENCIL_SIZE, 8,
+    EGL_NONE};
+  EGLConfig config;
+  EGLint configCount = 0;
+  if (!eglChooseConfig(display, configAttribs, &config, 1, &configCount) ||
+      configCount < 1)
+  {
+    gzerr << "Unable to find an EGL config for offscreen rendering\n";
+    this->ReleaseEGLContext();
+    return false;
+  }
+
+  // Sensors render into their own targets, so a 1x1 pbuffer is enough to
+  // make the context current.
+  const EGLint surfaceAttribs[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE};
+  EGLSurface surface = eglCreatePbufferSurface(display, config,
+      surfaceAttribs);
+  if (surface == EGL_NO_SURFACE)
+  {
+    gzerr << "Unable to create an EGL pbuffer surface\n";
+    this->ReleaseEGLContext();
+    return false;
+  }
+  this->dataPtr->eglSurface = surface;
+
+  EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT,
+      nullptr);
+  if (context == EGL_NO_CONTEXT)
+  {
+    gzerr << "Unable to create an EGL context\n";
+    this->ReleaseEGLContext();
+    return false;
+  }
+  this->dataPtr->eglContext = context;
+
+  if (!eglMakeCurrent(display, surface, surface, context))
+  {
+    gzerr << "Unable to make the EGL context current\n";
+    this->ReleaseEGLContext();
+    return false;
+  }
+
+  const char *vendor = eglQueryString(display, EGL_VENDOR);
+  gzmsg << "Rendering offscreen with EGL " << major << "." << minor
+        << " [" << (vendor ? vendor : "unknown vendor") << "]"
+        << (software ? " in software" : "") << std::endl;
+
+  return true;
+#else
+  gzerr << "Gazebo was built without EGL, or OGRE without EGL support, "
+        << "and can't render without an X server\n";
+  return false;
+#endif
+}
+
+/////////////////////////////////////////////////
+void RenderEngine::ReleaseEGLContext()
+{
+#ifdef HAVE_EGL
+  if (!this->dataPtr->eglDisplay)
+    return;
+
+  EGLDisplay display = static_cast<EGLDisplay>(this->dataPtr->eglDisplay);
+  eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+  if (this->dataPtr->eglContext)
+  {
+    eglDestroyContext(display,
+        static_cast<EGLContext>(this->dataPtr->eglContext));
+    this->dataPtr->eglContext = nullptr;
+  }
+
+  if (this->dataPtr->eglSurface)
+  {
+    eglDestroySurface(display,
+        static_cast<EGLSurface>(this->dataPtr->eglSurface));
+    this->dataPtr->eglSurface = nullptr;
+  }
+
+  eglTerminate(display);
+  this->dataPtr->eglDisplay = nullptr;
+#endif
+}
+
+/////////////////////////////////////////////////
+void RenderEngine::DisableEGLContext(const std::string &_reason)
+{
+  if (this->dataPtr->contextAutoSelected)
+  {
+    gzwarn << "Unable to render offscreen with EGL without an X display: "
+           << _reason << "\nOGRE may only support GLX. Rendering will be "
+           << "disabled. Set DISPLAY or GAZEBO_RENDER_CONTEXT to choose a "
+           << "context.\n";
+  }
+  else
+  {
+    gzerr << "Unable to render offscreen with EGL: " << _reason
+          << "\nMake sure OGRE is built with EGL support. Rendering will be "
+          << "disabled\n";
+  }
+
+  // Nothing may render with the partly loaded root
+  this->dataPtr->connections.clear();
+  this->dataPtr->windowManager->Fini();
+
+#if (OGRE_VERSION >= ((1 << 16) | (9 << 8) | 0))
+  delete this->dataPtr->overlaySystem;
+  this->dataPtr->overlaySystem = NULL;
+#endif
+
+  try
+  {
+    delete this->dataPtr->root;
+  }
+  catch(...)
+  {
+  }
+  this->dataPtr->root = NULL;
+
+  this->ReleaseEGLContext();
+
+  this->dataPtr->renderPathType = NONE;
+}
+
 /////////////////////////////////////////////////
 void RenderEngine::CheckSystemCapabilities()
 {
@@ -858,6 +1184,25 @@ void RenderEngine::CheckSystemCapabilities()
   //  this->dataPtr->renderPathType = RenderEngine::DEFERRED;
 }
 
+/////////////////////////////////////////////////
+void RenderEngine::SetContextType(const ContextType _type)
+{
+  if (this->dataPtr->root)
+  {
+    gzwarn << "The context type must be set before the render engine is "
+           << "loaded\n";
+    return;
+  }
+  this->dataPtr->contextType = _type;
+  this->dataPtr->contextAutoSelected = false;
+}
+
+/////////////////////////////////////////////////
+RenderEngine::ContextType RenderEngine::GetContextType() const
+{
+  return this->dataPtr->contextType;
+}
+
 /////////////////////////////////////////////////
 WindowManagerPtr RenderEngine::GetWindowManager() const
 {
@@ -70,6 +70,20 @@ namespace gazebo
                 RENDER_PATH_COUNT
               };
 
+      /// \enum ContextType
+      /// \brief How the GL context of the rendering engine is created.
+      public: enum ContextType
+              {
+                /// \brief A hidden window on an X display, through GLX.
+                GLX = 0,
+                /// \brief An offscreen EGL context, which doesn't need a
+                /// display server.
+                EGL = 1,
+                /// \brief An offscreen EGL context rendered in software by
+                /// Mesa, for machines without a GPU.
+                EGL_SOFTWARE = 2
+              };
+
       /// \brief Constructor. This is a singleton, use
       /// RenderEngine::Instance() to access the render engine.
       private: RenderEngine();
@@ -124,6 +138,18 @@ namespace gazebo
       /// \return The RenderPathType
       public: RenderPathType GetRenderPathType() const;
 
+      /// \brief Set how the GL context is created. Must be called before
+      /// Load. The default is read from the GAZEBO_RENDER_CONTEXT
+      /// environment variable, which can be "glx", "egl" or "egl_software".
+      /// If it is not set, EGL is used when there is no X display, and
+      /// rendering is disabled if that fails.
+      /// \param[in] _type The type of context.
+      public: void SetContextType(const ContextType _type);
+
+      /// \brief Get how the GL context is created.
+      /// \return The type of context.
+      public: ContextType GetContextType() const;
+
       /// \brief Get a pointer to the window manager.
       /// \return Pointer to the window manager.
       public: WindowManagerPtr GetWindowManager() const;
@@ -147,6 +173,19 @@ namespace gazebo
       /// \return True if the context was created.
       private: bool CreateContext();
 
+      /// \brief Create an offscreen EGL context and make it current, so
+      /// that OGRE renders with it.
+      /// \return True if the context was created.
+      private: bool CreateEGLContext();
+
+      /// \brief Destroy the EGL context and release its display.
+      private: void ReleaseEGLContext();
+
+      /// \brief Release what Load created after an EGL context failed, so
+      /// that the server keeps running with rendering disabled.
+      /// \param[in] _reason Why the context failed.
+      private: void DisableEGLContext(const std::string &_reason);
+
       /// \brief Load all OGRE plugins.
       private: void LoadPlugins();
 
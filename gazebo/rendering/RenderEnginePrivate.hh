@@ -61,6 +61,22 @@ namespace gazebo
       /// \brief The type of render path used.
       public: RenderEngine::RenderPathType renderPathType;
 
+      /// \brief How the GL context is created.
+      public: RenderEngine::ContextType contextType;
+
+      /// \brief True if EGL was picked because there is no X display,
+      /// instead of being asked for.
+      public: bool contextAutoSelected = false;
+
+      /// \brief EGL display used for offscreen rendering, or null.
+      public: void *eglDisplay = nullptr;
+
+      /// \brief 1x1 EGL pbuffer surface the context is current on, or null.
+      public: void *eglSurface = nullptr;
+
+      /// \brief EGL context that OGRE renders with, or null.
+      public: void *eglContext = nullptr;
+
       /// \brief Pointer to the window manager.
       public: WindowManagerPtr windowManager;
 
@@ -31,6 +31,7 @@
 #include "gazebo/common/Exception.hh"
 #include "gazebo/common/Assert.hh"
 #include "gazebo/common/Console.hh"
+#include "gazebo/common/ScopeProfiler.hh"
 #include "gazebo/rendering/Road2d.hh"
 #include "gazebo/rendering/Projector.hh"
 #include "gazebo/rendering/Heightmap.hh"
@@ -293,7 +294,12 @@ void Scene::Clear()
 
   {
     std::lock_guard<std::recursive_mutex> lock(this->dataPtr->poseMsgMutex);
-    this->dataPtr->poseMsgs.clear();
+    this->dataPtr->poseWriteBuffer.Clear();
+    this->dataPtr->poseReadBuffer.Clear();
+    this->dataPtr->poseSlots.clear();
+    this->dataPtr->freePoseSlots.clear();
+    this->dataPtr->poseSlotVisuals.clear();
+    this->dataPtr->pendingPoseSlots.clear();
   }
 
   this->dataPtr->joints.clear();
@@ -306,6 +312,7 @@ void Scene::Clear()
     this->RemoveVisual(this->dataPtr->visuals.begin()->first);
 
   this->dataPtr->visuals.clear();
+  this->dataPtr->visualNames.clear();
 
   if (this->dataPtr->originVisual)
   {
@@ -404,7 +411,7 @@ void Scene::Init()
   this->dataPtr->worldVisual.reset(new Visual("__world_node__",
       shared_from_this()));
   this->dataPtr->worldVisual->SetId(0);
-  this->dataPtr->visuals[0] = this->dataPtr->worldVisual;
+  this->dataPtr->InsertVisual(0, this->dataPtr->worldVisual);
 
   // RTShader system self-enables if the render path type is FORWARD,
   RTShaderSystem::Instance()->AddScene(shared_from_this());
@@ -847,32 +854,228 @@ VisualPtr Scene::GetVisual(const uint32_t _id) const
 //////////////////////////////////////////////////
 VisualPtr Scene::GetVisual(const std::string &_name) const
 {
-  VisualPtr result;
+  Visual_M::const_iterator iter = this->dataPtr->FindVisual(_name);
+  if (iter == this->dataPtr->visuals.end())
+    iter = this->dataPtr->FindVisual(this->Name() + "::" + _name);
+
+  if (iter != this->dataPtr->visuals.end())
+    return iter->second;
+  return VisualPtr();
+}
+
+//////////////////////////////////////////////////
+void ScenePrivate::InsertVisual(const uint32_t _id, VisualPtr _vis)
+{
+  auto iter = this->visuals.find(_id);
+  if (iter != this->visuals.end())
+    this->EraseVisual(iter);
 
-  Visual_M::const_iterator iter;
-  for (iter = this->dataPtr->visuals.begin();
-      iter != this->dataPtr->visuals.end(); ++iter)
+  this->visuals[_id] = _vis;
+  if (_vis)
+    this->visualNames.emplace(_vis->Name(), _id);
+}
+
+//////////////////////////////////////////////////
+Visual_M::iterator ScenePrivate::EraseVisual(Visual_M::iterator _iter)
+{
+  auto erase = [this, _iter](VisualNames_M::iterator _begin,
+      VisualNames_M::iterator _end)
   {
-    if (iter->second->Name() == _name)
-      break;
+    for (auto nameIter = _begin; nameIter != _end; ++nameIter)
+    {
+      if (nameIter->second == _iter->first)
+      {
+        this->visualNames.erase(nameIter);
+        return true;
+      }
+    }
+    return false;
+  };
+
+  // A visual renamed since it was indexed is only found by a full scan
+  bool erased = false;
+  if (_iter->second)
+  {
+    auto range = this->visualNames.equal_range(_iter->second->Name());
+    erased = erase(range.first, range.second);
   }
+  if (!erased)
+    erase(this->visualNames.begin(), this->visualNames.end());
 
-  if (iter != this->dataPtr->visuals.end())
-    result = iter->second;
+  this->ReleasePoseSlot(_iter->first);
+  return this->visuals.erase(_iter);
+}
+
+//////////////////////////////////////////////////
+void ScenePoseBuffer::Set(const uint32_t _slot, const uint32_t _id,
+    const ignition::math::Pose3d &_pose)
+{
+  if (_slot >= this->poses.size())
+  {
+    this->ids.resize(_slot + 1);
+    this->poses.resize(_slot + 1);
+    this->updated.resize(_slot + 1, 0);
+  }
+
+  this->ids[_slot] = _id;
+  this->poses[_slot] = _pose;
+  if (!this->updated[_slot])
+  {
+    this->updated[_slot] = 1;
+    this->slots.push_back(_slot);
+  }
+}
+
+//////////////////////////////////////////////////
+void ScenePoseBuffer::Clear()
+{
+  for (auto const slot : this->slots)
+    this->updated[slot] = 0;
+  this->slots.clear();
+}
+
+//////////////////////////////////////////////////
+void ScenePrivate::WritePose(const uint32_t _id,
+    const ignition::math::Pose3d &_pose)
+{
+  uint32_t slot;
+  auto iter = this->poseSlots.find(_id);
+  if (iter != this->poseSlots.end())
+  {
+    slot = iter->second;
+  }
   else
   {
-    std::string otherName = this->Name() + "::" + _name;
-    for (iter = this->dataPtr->visuals.begin();
-        iter != this->dataPtr->visuals.end(); ++iter)
+    if (!this->freePoseSlots.empty())
+    {
+      slot = this->freePoseSlots.back();
+      this->freePoseSlots.pop_back();
+    }
+    else
     {
-      if (iter->second->Name() == otherName)
-        break;
+      slot = static_cast<uint32_t>(
+          this->poseSlots.size() + this->freePoseSlots.size());
     }
+    this->poseSlots[_id] = slot;
+  }
 
-    if (iter != this->dataPtr->visuals.end())
-      result = iter->second;
+  this->poseWriteBuffer.Set(slot, _id, _pose);
+}
+
+//////////////////////////////////////////////////
+void ScenePrivate::ApplyPoses()
+{
+  GZ_PROFILE("Scene::ApplyPoses");
+
+  common::Time received;
+  {
+    std::lock_guard<std::recursive_mutex> lock(this->poseMsgMutex);
+    std::swap(this->poseWriteBuffer, this->poseReadBuffer);
+    received = this->sceneSimTimePosesReceived;
+  }
+
+  // If an object is selected, don't let the physics engine move it.
+  VisualPtr moving;
+  if (this->selectedVis && this->selectionMode == "move")
+    moving = this->selectedVis;
+
+  ScenePoseBuffer &buffer = this->poseReadBuffer;
+  if (this->poseSlotVisuals.size() < buffer.poses.size())
+    this->poseSlotVisuals.resize(buffer.poses.size(), nullptr);
+
+  for (auto const slot : buffer.slots)
+  {
+    const uint32_t id = buffer.ids[slot];
+    const ignition::math::Pose3d &pose = buffer.poses[slot];
+
+    Visual *vis = this->poseSlotVisuals[slot];
+    if (!vis || vis->GetId() != id)
+    {
+      auto iter = this->visuals.find(id);
+      vis = iter != this->visuals.end() ? iter->second.get() : nullptr;
+      this->poseSlotVisuals[slot] = vis;
+    }
+
+    if (vis)
+    {
+      if (!moving || (id != moving->GetId() &&
+          !moving->IsAncestorOf(vis->shared_from_this())))
+      {
+        vis->SetPose(pose);
+      }
+      else
+        this->pendingPoseSlots.push_back(slot);
+      continue;
+    }
+
+    // process light poses
+    auto lIter = this->lights.find(id);
+    if (lIter != this->lights.end())
+    {
+      lIter->second->SetPosition(pose.Pos());
+      lIter->second->SetRotation(pose.Rot());
+    }
+    else
+    {
+      // We may receive pose updates over the wire before we receive the
+      // visual, so keep the pose until the visual exists
+      this->pendingPoseSlots.push_back(slot);
+    }
+  }
+
+  std::lock_guard<std::recursive_mutex> lock(this->poseMsgMutex);
+
+  // Keep the poses that were not applied, unless a newer pose arrived or
+  // the visual was removed
+  for (auto const slot : this->pendingPoseSlots)
+  {
+    const uint32_t id = buffer.ids[slot];
+    auto iter = this->poseSlots.find(id);
+    if (iter != this->poseSlots.end() && iter->second == slot &&
+        (slot >= this->poseWriteBuffer.updated.size() ||
+         !this->poseWriteBuffer.updated[slot]))
+    {
+      this->poseWriteBuffer.Set(slot, id, buffer.poses[slot]);
+    }
   }
+  this->pendingPoseSlots.clear();
+  buffer.Clear();
+
+  // official time stamp of approval
+  this->sceneSimTimePosesApplied = received;
+}
+
+//////////////////////////////////////////////////
+void ScenePrivate::ReleasePoseSlot(const uint32_t _id)
+{
+  std::lock_guard<std::recursive_mutex> lock(this->poseMsgMutex);
+  auto iter = this->poseSlots.find(_id);
+  if (iter == this->poseSlots.end())
+    return;
+
+  if (iter->second < this->poseSlotVisuals.size())
+    this->poseSlotVisuals[iter->second] = nullptr;
+  this->freePoseSlots.push_back(iter->second);
+  this->poseSlots.erase(iter);
+}
 
+//////////////////////////////////////////////////
+Visual_M::const_iterator ScenePrivate::FindVisual(
+    const std::string &_name) const
+{
+  // Match the order of the visuals map when names are not unique
+  Visual_M::const_iterator result = this->visuals.end();
+  auto range = this->visualNames.equal_range(_name);
+  for (auto nameIter = range.first; nameIter != range.second; ++nameIter)
+  {
+    auto iter = this->visuals.find(nameIter->second);
+    if (iter != this->visuals.end() && iter->second &&
+        iter->second->Name() == _name &&
+        (result == this->visuals.end() || iter->first < result->first))
+    {
+      result = iter;
+    }
+  }
   return result;
 }
 
@@ -1590,17 +1793,8 @@ bool Scene::ProcessSceneMsg(ConstScenePtr &_msg)
     std::lock_guard<std::recursive_mutex> lock(this->dataPtr->poseMsgMutex);
     for (int i = 0; i < _msg->model_size(); ++i)
     {
-      PoseMsgs_M::iterator iter =
-          this->dataPtr->poseMsgs.find(_msg->model(i).id());
-      if (iter != this->dataPtr->poseMsgs.end())
-        iter->second.CopyFrom(_msg->model(i).pose());
-      else
-        this->dataPtr->poseMsgs.insert(
-            std::make_pair(_msg->model(i).id(), _msg->model(i).pose()));
-
-      this->dataPtr->poseMsgs[_msg->model(i).id()].set_name(
-          _msg->model(i).name());
-      this->dataPtr->poseMsgs[_msg->model(i).id()].set_id(_msg->model(i).id());
+      this->dataPtr->WritePose(_msg->model(i).id(),
+          msgs::ConvertIgn(_msg->model(i).pose()));
 
       this->ProcessModelMsg(_msg->model(i));
     }
@@ -1684,9 +1878,6 @@ bool Scene::ProcessSceneMsg(ConstScenePtr &_msg)
 //////////////////////////////////////////////////
 bool Scene::ProcessModelMsg(const msgs::Model &_msg)
 {
-  std::string modelName, linkName;
-
-  modelName = _msg.name() + "::";
   for (int j = 0; j < _msg.visual_size(); ++j)
   {
     boost::shared_ptr<msgs::Visual> vm(new msgs::Visual(
@@ -1725,22 +1916,12 @@ bool Scene::ProcessModelMsg(const msgs::Model &_msg)
 
   for (int j = 0; j < _msg.link_size(); ++j)
   {
-    linkName = modelName + _msg.link(j).name();
-
     {
       std::lock_guard<std::recursive_mutex> lock(this->dataPtr->poseMsgMutex);
       if (_msg.link(j).has_pose())
       {
-        PoseMsgs_M::iterator iter =
-            this->dataPtr->poseMsgs.find(_msg.link(j).id());
-        if (iter != this->dataPtr->poseMsgs.end())
-          iter->second.CopyFrom(_msg.link(j).pose());
-        else
-          this->dataPtr->poseMsgs.insert(
-              std::make_pair(_msg.link(j).id(), _msg.link(j).pose()));
-
-        this->dataPtr->poseMsgs[_msg.link(j).id()].set_name(linkName);
-        this->dataPtr->poseMsgs[_msg.link(j).id()].set_id(_msg.link(j).id());
+        this->dataPtr->WritePose(_msg.link(j).id(),
+            msgs::ConvertIgn(_msg.link(j).pose()));
       }
     }
 
@@ -1867,7 +2048,6 @@ void Scene::PreRender()
   static ModelMsgs_L::iterator modelIter;
   static VisualMsgs_L::iterator visualIter;
   static LightMsgs_L::iterator lightIter;
-  static PoseMsgs_M::iterator pIter;
   static SkeletonPoseMsgs_L::iterator spIter;
   static JointMsgs_L::iterator jointIter;
   static SensorMsgs_L::iterator sensorIter;
@@ -1890,61 +2070,22 @@ void Scene::PreRender()
   {
     std::lock_guard<std::mutex> lock(*this->dataPtr->receiveMutex);
 
-    std::copy(this->dataPtr->sceneMsgs.begin(), this->dataPtr->sceneMsgs.end(),
-              std::back_inserter(sceneMsgsCopy));
-    this->dataPtr->sceneMsgs.clear();
-
-    std::copy(this->dataPtr->modelMsgs.begin(), this->dataPtr->modelMsgs.end(),
-              std::back_inserter(modelMsgsCopy));
-    this->dataPtr->modelMsgs.clear();
-
-    std::copy(this->dataPtr->sensorMsgs.begin(),
-              this->dataPtr->sensorMsgs.end(),
-              std::back_inserter(sensorMsgsCopy));
-    this->dataPtr->sensorMsgs.clear();
-
-    std::copy(this->dataPtr->lightFactoryMsgs.begin(),
-              this->dataPtr->lightFactoryMsgs.end(),
-              std::back_inserter(lightFactoryMsgsCopy));
-    this->dataPtr->lightFactoryMsgs.clear();
-
-    std::copy(this->dataPtr->lightModifyMsgs.begin(),
-              this->dataPtr->lightModifyMsgs.end(),
-              std::back_inserter(lightModifyMsgsCopy));
-    this->dataPtr->lightModifyMsgs.clear();
-
-    std::copy(this->dataPtr->modelVisualMsgs.begin(),
-              this->dataPtr->modelVisualMsgs.end(),
-              std::back_inserter(modelVisualMsgsCopy));
-    this->dataPtr->modelVisualMsgs.clear();
-
-    std::copy(this->dataPtr->linkVisualMsgs.begin(),
-              this->dataPtr->linkVisualMsgs.end(),
-              std::back_inserter(linkVisualMsgsCopy));
-    this->dataPtr->linkVisualMsgs.clear();
+    // Take the messages without copying them
+    sceneMsgsCopy.swap(this->dataPtr->sceneMsgs);
+    modelMsgsCopy.swap(this->dataPtr->modelMsgs);
+    sensorMsgsCopy.swap(this->dataPtr->sensorMsgs);
+    lightFactoryMsgsCopy.swap(this->dataPtr->lightFactoryMsgs);
+    lightModifyMsgsCopy.swap(this->dataPtr->lightModifyMsgs);
+    modelVisualMsgsCopy.swap(this->dataPtr->modelVisualMsgs);
+    linkVisualMsgsCopy.swap(this->dataPtr->linkVisualMsgs);
 
     this->dataPtr->visualMsgs.sort(VisualMessageLessOp);
-    std::copy(this->dataPtr->visualMsgs.begin(),
-              this->dataPtr->visualMsgs.end(),
-              std::back_inserter(visualMsgsCopy));
-    this->dataPtr->visualMsgs.clear();
-
-    std::copy(this->dataPtr->collisionVisualMsgs.begin(),
-              this->dataPtr->collisionVisualMsgs.end(),
-              std::back_inserter(collisionVisualMsgsCopy));
-    this->dataPtr->collisionVisualMsgs.clear();
-
-    std::copy(this->dataPtr->jointMsgs.begin(), this->dataPtr->jointMsgs.end(),
-              std::back_inserter(jointMsgsCopy));
-    this->dataPtr->jointMsgs.clear();
+    visualMsgsCopy.swap(this->dataPtr->visualMsgs);
 
-    std::copy(this->dataPtr->linkMsgs.begin(), this->dataPtr->linkMsgs.end(),
-              std::back_inserter(linkMsgsCopy));
-    this->dataPtr->linkMsgs.clear();
-
-    std::copy(this->dataPtr->roadMsgs.begin(), this->dataPtr->roadMsgs.end(),
-              std::back_inserter(roadMsgsCopy));
-    this->dataPtr->roadMsgs.clear();
+    collisionVisualMsgsCopy.swap(this->dataPtr->collisionVisualMsgs);
+    jointMsgsCopy.swap(this->dataPtr->jointMsgs);
+    linkMsgsCopy.swap(this->dataPtr->linkMsgs);
+    roadMsgsCopy.swap(this->dataPtr->roadMsgs);
   }
   IGN_PROFILE_END();
 
@@ -2118,54 +2259,15 @@ void Scene::PreRender()
   RTShaderSystem::Instance()->Update();
   IGN_PROFILE_END();
 
+  IGN_PROFILE_BEGIN("poses");
+  this->dataPtr->ApplyPoses();
+  IGN_PROFILE_END();
+
   {
     IGN_PROFILE_BEGIN("poseMsgMutex");
     std::lock_guard<std::recursive_mutex> lock(this->dataPtr->poseMsgMutex);
     IGN_PROFILE_END();
 
-    // Process all the model messages last. Remove pose message from the list
-    // only when a corresponding visual exits. We may receive pose updates
-    // over the wire before  we recieve the visual
-    IGN_PROFILE_BEGIN("poseMsgs");
-    pIter = this->dataPtr->poseMsgs.begin();
-    while (pIter != this->dataPtr->poseMsgs.end())
-    {
-      Visual_M::iterator iter = this->dataPtr->visuals.find(pIter->first);
-      if (iter != this->dataPtr->visuals.end() && iter->second)
-      {
-        // If an object is selected, don't let the physics engine move it.
-        if (!this->dataPtr->selectedVis
-            || this->dataPtr->selectionMode != "move" ||
-            (iter->first != this->dataPtr->selectedVis->GetId() &&
-            !this->dataPtr->selectedVis->IsAncestorOf(iter->second)))
-        {
-          ignition::math::Pose3d pose = msgs::ConvertIgn(pIter->second);
-          GZ_ASSERT(iter->second, "Visual pointer is NULL");
-          iter->second->SetPose(pose);
-          PoseMsgs_M::iterator prev = pIter++;
-          this->dataPtr->poseMsgs.erase(prev);
-        }
-        else
-          ++pIter;
-      }
-      else
-      {
-        // process light pose messages
-        auto lIter = this->dataPtr->lights.find(pIter->first);
-        if (lIter != this->dataPtr->lights.end())
-        {
-          ignition::math::Pose3d pose = msgs::ConvertIgn(pIter->second);
-          lIter->second->SetPosition(pose.Pos());
-          lIter->second->SetRotation(pose.Rot());
-          auto prev = pIter++;
-          this->dataPtr->poseMsgs.erase(prev);
-        }
-        else
-          ++pIter;
-      }
-    }
-    IGN_PROFILE_END();
-
     // process skeleton pose msgs
     IGN_PROFILE_BEGIN("skeletonPoseMsgs");
     spIter = this->dataPtr->skeletonPoseMsgs.begin();
@@ -2211,26 +2313,20 @@ void Scene::PreRender()
     {
       // do not add road if it already exists
       bool addRoad = true;
-      for (const auto &it : this->dataPtr->visuals)
+      auto range = this->dataPtr->visualNames.equal_range(msg->name());
+      for (auto it = range.first; it != range.second && addRoad; ++it)
       {
-        Road2dPtr road = std::dynamic_pointer_cast<Road2d>(it.second);
-        if (road && road->Name() == msg->name())
-        {
-          addRoad = false;
-          break;
-        }
+        Road2dPtr road = std::dynamic_pointer_cast<Road2d>(
+            this->GetVisual(it->second));
+        addRoad = !road || road->Name() != msg->name();
       }
       if (addRoad)
       {
         Road2dPtr road(new Road2d(msg->name(), this->dataPtr->worldVisual));
         road->Load(*msg);
-        this->dataPtr->visuals[road->GetId()] = road;
+        this->dataPtr->InsertVisual(road->GetId(), road);
       }
     }
-
-    // official time stamp of approval
-    this->dataPtr->sceneSimTimePosesApplied =
-        this->dataPtr->sceneSimTimePosesReceived;
     IGN_PROFILE_END();
   }
 }
@@ -2263,7 +2359,7 @@ bool Scene::ProcessSensorMsg(ConstSensorPtr &_msg)
             rayVisualName+"_GUIONLY_laser_vis", parentVis, _msg->topic()));
       laserVis->Load();
       laserVis->SetId(_msg->id());
-      this->dataPtr->visuals[_msg->id()] = laserVis;
+      this->dataPtr->InsertVisual(_msg->id(), laserVis);
     }
   }
   else if ((_msg->type() == "sonar") && _msg->visualize()
@@ -2280,7 +2376,7 @@ bool Scene::ProcessSensorMsg(ConstSensorPtr &_msg)
             sonarVisualName+"_GUIONLY_sonar_vis", parentVis, _msg->topic()));
       sonarVis->Load();
       sonarVis->SetId(_msg->id());
-      this->dataPtr->visuals[_msg->id()] = sonarVis;
+      this->dataPtr->InsertVisual(_msg->id(), sonarVis);
     }
   }
   else if ((_msg->type() == "force_torque") && _msg->visualize()
@@ -2310,7 +2406,7 @@ bool Scene::ProcessSensorMsg(ConstSensorPtr &_msg)
             _msg->topic()));
       wrenchVis->Load(jointMsg);
       wrenchVis->SetId(_msg->id());
-      this->dataPtr->visuals[_msg->id()] = wrenchVis;
+      this->dataPtr->InsertVisual(_msg->id(), wrenchVis);
     }
   }
   else if (_msg->type() == "camera" && _msg->visualize())
@@ -2336,7 +2432,7 @@ bool Scene::ProcessSensorMsg(ConstSensorPtr &_msg)
         cameraVis->SetPose(msgs::ConvertIgn(_msg->pose()));
         cameraVis->SetId(_msg->id());
         cameraVis->Load(_msg->camera());
-        this->dataPtr->visuals[cameraVis->GetId()] = cameraVis;
+        this->dataPtr->InsertVisual(cameraVis->GetId(), cameraVis);
       }
     }
   }
@@ -2359,7 +2455,7 @@ bool Scene::ProcessSensorMsg(ConstSensorPtr &_msg)
       cameraVis->SetPose(msgs::ConvertIgn(_msg->pose()));
       cameraVis->SetId(_msg->id());
       cameraVis->Load(_msg->logical_camera());
-      this->dataPtr->visuals[cameraVis->GetId()] = cameraVis;
+      this->dataPtr->InsertVisual(cameraVis->GetId(), cameraVis);
     }
     else if (_msg->has_pose())
     {
@@ -2375,7 +2471,7 @@ bool Scene::ProcessSensorMsg(ConstSensorPtr &_msg)
     contactVis->SetId(_msg->id());
 
     this->dataPtr->contactVisId = _msg->id();
-    this->dataPtr->visuals[contactVis->GetId()] = contactVis;
+    this->dataPtr->InsertVisual(contactVis->GetId(), contactVis);
   }
   else if (_msg->type() == "rfidtag" && _msg->visualize() &&
            !_msg->topic().empty())
@@ -2388,7 +2484,7 @@ bool Scene::ProcessSensorMsg(ConstSensorPtr &_msg)
           _msg->name() + "_GUIONLY_rfidtag_vis", parentVis, _msg->topic()));
     rfidVis->SetId(_msg->id());
 
-    this->dataPtr->visuals[rfidVis->GetId()] = rfidVis;
+    this->dataPtr->InsertVisual(rfidVis->GetId(), rfidVis);
   }
   else if (_msg->type() == "rfid" && _msg->visualize() &&
            !_msg->topic().empty())
@@ -2400,7 +2496,7 @@ bool Scene::ProcessSensorMsg(ConstSensorPtr &_msg)
     RFIDVisualPtr rfidVis(new RFIDVisual(
           _msg->name() + "_GUIONLY_rfid_vis", parentVis, _msg->topic()));
     rfidVis->SetId(_msg->id());
-    this->dataPtr->visuals[rfidVis->GetId()] = rfidVis;
+    this->dataPtr->InsertVisual(rfidVis->GetId(), rfidVis);
   }
   else if (_msg->type() == "wireless_transmitter" && _msg->visualize() &&
            !_msg->topic().empty())
@@ -2411,7 +2507,7 @@ bool Scene::ProcessSensorMsg(ConstSensorPtr &_msg)
 
     VisualPtr transmitterVis(new TransmitterVisual(
           _msg->name() + "_GUIONLY_transmitter_vis", parentVis, _msg->topic()));
-    this->dataPtr->visuals[transmitterVis->GetId()] = transmitterVis;
+    this->dataPtr->InsertVisual(transmitterVis->GetId(), transmitterVis);
     transmitterVis->Load();
   }
 
@@ -2796,6 +2892,8 @@ void Scene::ProcessRequestMsg(ConstRequestPtr &_msg)
 /////////////////////////////////////////////////
 bool Scene::ProcessVisualMsg(ConstVisualPtr &_msg, Visual::VisualType _type)
 {
+  GZ_PROFILE("Scene::ProcessVisualMsg");
+
   Visual_M::iterator iter = this->dataPtr->visuals.end();
 
   if (_msg->has_id())
@@ -2812,7 +2910,7 @@ bool Scene::ProcessVisualMsg(ConstVisualPtr &_msg, Visual::VisualType _type)
   {
     if (iter != this->dataPtr->visuals.end())
     {
-      this->dataPtr->visuals.erase(iter);
+      this->dataPtr->EraseVisual(iter);
       return true;
     }
     else
@@ -2938,7 +3036,7 @@ bool Scene::ProcessVisualMsg(ConstVisualPtr &_msg, Visual::VisualType _type)
   }
   visual->SetType(_type);
 
-  this->dataPtr->visuals[visual->GetId()] = visual;
+  this->dataPtr->InsertVisual(visual->GetId(), visual);
   if (visual->Name().find("__SKELETON_VISUAL__") != std::string::npos)
   {
     visual->SetVisible(false);
@@ -2968,13 +3066,8 @@ void Scene::OnPoseMsg(ConstPosesStampedPtr &_msg)
 
   for (int i = 0; i < _msg->pose_size(); ++i)
   {
-    auto p = _msg->pose(i);
-    PoseMsgs_M::iterator iter =
-        this->dataPtr->poseMsgs.find(p.id());
-    if (iter != this->dataPtr->poseMsgs.end())
-      iter->second.CopyFrom(p);
-    else
-      this->dataPtr->poseMsgs.insert(std::make_pair(p.id(), p));
+    const msgs::Pose &pose = _msg->pose(i);
+    this->dataPtr->WritePose(pose.id(), msgs::ConvertIgn(pose));
   }
 }
 
@@ -3407,7 +3500,7 @@ void Scene::AddVisual(VisualPtr _vis)
     gzwarn << "Duplicate visuals detected[" << _vis->Name() << "]\n";
   }
 
-  this->dataPtr->visuals[_vis->GetId()] = _vis;
+  this->dataPtr->InsertVisual(_vis->GetId(), _vis);
 }
 
 /////////////////////////////////////////////////
@@ -3441,7 +3534,7 @@ void Scene::RemoveVisual(uint32_t _id)
       else
         ++piter;
     }
-    this->dataPtr->visuals.erase(iter);
+    this->dataPtr->EraseVisual(iter);
 
     this->RemoveVisualizations(vis);
     vis->Fini();
@@ -3467,9 +3560,9 @@ void Scene::SetVisualId(VisualPtr _vis, uint32_t _id)
   auto iter = this->dataPtr->visuals.find(_vis->GetId());
   if (iter != this->dataPtr->visuals.end())
   {
-    this->dataPtr->visuals.erase(_vis->GetId());
-    this->dataPtr->visuals[_id] = _vis;
+    this->dataPtr->EraseVisual(iter);
     _vis->SetId(_id);
+    this->dataPtr->InsertVisual(_id, _vis);
   }
 }
 
@@ -3490,6 +3583,7 @@ void Scene::RemoveLight(LightPtr _light)
   {
     // Delete the light
     this->dataPtr->lights.erase(_light->Id());
+    this->dataPtr->ReleasePoseSlot(_light->Id());
   }
 }
 
@@ -3575,7 +3669,7 @@ void Scene::CreateCOMVisual(ConstLinkPtr &_msg, VisualPtr _linkVisual)
                                     _linkVisual));
   comVis->Load(_msg);
   comVis->SetVisible(this->dataPtr->showCOMs);
-  this->dataPtr->visuals[comVis->GetId()] = comVis;
+  this->dataPtr->InsertVisual(comVis->GetId(), comVis);
 }
 
 /////////////////////////////////////////////////
@@ -3585,7 +3679,7 @@ void Scene::CreateCOMVisual(sdf::ElementPtr _elem, VisualPtr _linkVisual)
                                     _linkVisual));
   comVis->Load(_elem);
   comVis->SetVisible(false);
-  this->dataPtr->visuals[comVis->GetId()] = comVis;
+  this->dataPtr->InsertVisual(comVis->GetId(), comVis);
 }
 
 /////////////////////////////////////////////////
@@ -3595,7 +3689,7 @@ void Scene::CreateInertiaVisual(ConstLinkPtr &_msg, VisualPtr _linkVisual)
       "_INERTIA_VISUAL__", _linkVisual));
   inertiaVis->Load(_msg);
   inertiaVis->SetVisible(this->dataPtr->showInertias);
-  this->dataPtr->visuals[inertiaVis->GetId()] = inertiaVis;
+  this->dataPtr->InsertVisual(inertiaVis->GetId(), inertiaVis);
 }
 
 /////////////////////////////////////////////////
@@ -3605,7 +3699,7 @@ void Scene::CreateInertiaVisual(sdf::ElementPtr _elem, VisualPtr _linkVisual)
       "_INERTIA_VISUAL__", _linkVisual));
   inertiaVis->Load(_elem);
   inertiaVis->SetVisible(false);
-  this->dataPtr->visuals[inertiaVis->GetId()] = inertiaVis;
+  this->dataPtr->InsertVisual(inertiaVis->GetId(), inertiaVis);
 }
 
 /////////////////////////////////////////////////
@@ -3615,7 +3709,7 @@ void Scene::CreateLinkFrameVisual(ConstLinkPtr &/*_msg*/, VisualPtr _linkVisual)
       "_LINK_FRAME_VISUAL__", _linkVisual));
   linkFrameVis->Load();
   linkFrameVis->SetVisible(this->dataPtr->showLinkFrames);
-  this->dataPtr->visuals[linkFrameVis->GetId()] = linkFrameVis;
+  this->dataPtr->InsertVisual(linkFrameVis->GetId(), linkFrameVis);
 }
 
 /////////////////////////////////////////////////
@@ -3735,11 +3829,11 @@ void Scene::ShowContacts(const bool _show)
               this->dataPtr->worldVisual, "~/physics/contacts"));
     vis->SetEnabled(_show);
     this->dataPtr->contactVisId = vis->GetId();
-    this->dataPtr->visuals[this->dataPtr->contactVisId] = vis;
+    this->dataPtr->InsertVisual(this->dataPtr->contactVisId, vis);
   }
   else
     vis = std::dynamic_pointer_cast<ContactVisual>(
-        this->dataPtr->visuals[this->dataPtr->contactVisId]);
+        this->GetVisual(this->dataPtr->contactVisId));
 
   if (vis)
     vis->SetEnabled(_show);
@@ -24,9 +24,11 @@
 #include <mutex>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <boost/unordered/unordered_map.hpp>
+#include <ignition/math/Pose3.hh>
 
 #include <sdf/sdf.hh>
 
@@ -62,6 +64,11 @@ namespace gazebo
     /// \brief Map of visuals and their names.
     typedef std::map<uint32_t, VisualPtr> Visual_M;
 
+    /// \def VisualNames_M
+    /// \brief Map of visual names to visual ids. Names are not guaranteed to
+    /// be unique, so one name can map to several ids.
+    typedef std::unordered_multimap<std::string, uint32_t> VisualNames_M;
+
     /// \def VisualMsgs_L
     /// \brief List of visual messages.
     typedef std::list<boost::shared_ptr<msgs::Visual const> > VisualMsgs_L;
@@ -70,10 +77,6 @@ namespace gazebo
     /// \brief List of light messages.
     typedef std::list<boost::shared_ptr<msgs::Light const> > LightMsgs_L;
 
-    /// \typedef PoseMsgs_M.
-    /// \brief List of messages.
-    typedef std::map<uint32_t, msgs::Pose> PoseMsgs_M;
-
     /// \typedef LightPoseMsgs_M.
     /// \brief List of messages.
     typedef std::map<std::string, msgs::Pose> LightPoseMsgs_M;
@@ -120,6 +123,33 @@ namespace gazebo
     /// \brief List of road messages
     typedef std::list<boost::shared_ptr<msgs::Road const> > RoadMsgs_L;
 
+    /// \brief A flat table of the latest poses received for visuals and
+    /// lights, indexed by a dense slot per id.
+    class ScenePoseBuffer
+    {
+      /// \brief Store a pose, replacing the pose already in the slot.
+      /// \param[in] _slot Slot of the id.
+      /// \param[in] _id Id of the visual or light.
+      /// \param[in] _pose The pose.
+      public: void Set(const uint32_t _slot, const uint32_t _id,
+                  const ignition::math::Pose3d &_pose);
+
+      /// \brief Remove all the poses.
+      public: void Clear();
+
+      /// \brief Ids of the poses, indexed by slot.
+      public: std::vector<uint32_t> ids;
+
+      /// \brief Poses, indexed by slot.
+      public: std::vector<ignition::math::Pose3d> poses;
+
+      /// \brief True if the slot holds a pose, indexed by slot.
+      public: std::vector<char> updated;
+
+      /// \brief Slots that hold a pose, in the order they were set.
+      public: std::vector<uint32_t> slots;
+    };
+
     /// \brief Private data for the Visual class
     class ScenePrivate
     {
@@ -183,8 +213,44 @@ namespace gazebo
       /// \brief List of light modify message to process.
       public: LightMsgs_L lightModifyMsgs;
 
-      /// \brief List of pose message to process.
-      public: PoseMsgs_M poseMsgs;
+      /// \brief Store a pose received for a visual or light, to be applied
+      /// by the next PreRender. Lock poseMsgMutex before calling.
+      /// \param[in] _id Id of the visual or light.
+      /// \param[in] _pose The pose.
+      public: void WritePose(const uint32_t _id,
+                  const ignition::math::Pose3d &_pose);
+
+      /// \brief Swap the pose buffers and apply the poses to the visuals and
+      /// lights. Called by the render thread.
+      public: void ApplyPoses();
+
+      /// \brief Release the pose slot of an id that was removed.
+      /// \param[in] _id Id of the visual.
+      public: void ReleasePoseSlot(const uint32_t _id);
+
+      /// \brief Poses written by the transport thread. Protected by
+      /// poseMsgMutex.
+      public: ScenePoseBuffer poseWriteBuffer;
+
+      /// \brief Poses being applied by the render thread, swapped with
+      /// poseWriteBuffer once per PreRender.
+      public: ScenePoseBuffer poseReadBuffer;
+
+      /// \brief Slot of each id in the pose buffers. Protected by
+      /// poseMsgMutex.
+      public: std::unordered_map<uint32_t, uint32_t> poseSlots;
+
+      /// \brief Slots that were released and can be reused. Protected by
+      /// poseMsgMutex.
+      public: std::vector<uint32_t> freePoseSlots;
+
+      /// \brief Visual that receives the poses of each slot, indexed by
+      /// slot. Only used by the render thread, and reset when the visual is
+      /// removed from visuals.
+      public: std::vector<Visual *> poseSlotVisuals;
+
+      /// \brief Slots whose pose could not be applied yet.
+      public: std::vector<uint32_t> pendingPoseSlots;
 
       /// \brief List of pose message to process.
       public: LightPoseMsgs_M lightPoseMsgs;
@@ -207,9 +273,31 @@ namespace gazebo
       /// \brief List of request message to process.
       public: RequestMsgs_L requestMsgs;
 
-      /// \brief Map of all the visuals in this scene.
+      /// \brief Add a visual to the visuals map and the name index.
+      /// Replaces the visual that had the same id, if any.
+      /// \param[in] _id Id of the visual.
+      /// \param[in] _vis The visual.
+      public: void InsertVisual(const uint32_t _id, VisualPtr _vis);
+
+      /// \brief Remove a visual from the visuals map and the name index.
+      /// \param[in] _iter Iterator to the visual in the visuals map.
+      /// \return Iterator to the next visual.
+      public: Visual_M::iterator EraseVisual(Visual_M::iterator _iter);
+
+      /// \brief Find a visual by name using the name index.
+      /// \param[in] _name Full name of the visual.
+      /// \return The visual with the lowest id among the visuals with this
+      /// name, or iterator to the end of the visuals map if not found.
+      public: Visual_M::const_iterator FindVisual(
+                  const std::string &_name) const;
+
+      /// \brief Map of all the visuals in this scene. Modify it through
+      /// InsertVisual and EraseVisual to keep visualNames in sync.
       public: Visual_M visuals;
 
+      /// \brief Index of the visuals by name, maintained alongside visuals.
+      public: VisualNames_M visualNames;
+
       /// \brief Map of all the lights in this scene.
       public: Light_M lights;
 
@@ -403,6 +403,98 @@ TEST_F(Scene_TEST, AddRemoveLights)
   EXPECT_FALSE(scene->LightByName("light1"));
 }
 
+/////////////////////////////////////////////////
+TEST_F(Scene_TEST, VisualNameIndex)
+{
+  Load("worlds/empty.world");
+
+  gazebo::rendering::ScenePtr scene = gazebo::rendering::get_scene();
+  ASSERT_TRUE(scene != nullptr);
+
+  rendering::VisualPtr visual1;
+  visual1.reset(new rendering::Visual("index_visual", scene));
+  scene->AddVisual(visual1);
+  EXPECT_EQ(visual1, scene->GetVisual("index_visual"));
+
+  // Names are also found relative to the scene
+  rendering::VisualPtr visual2;
+  visual2.reset(new rendering::Visual(scene->Name() + "::scoped", scene));
+  scene->AddVisual(visual2);
+  EXPECT_EQ(visual2, scene->GetVisual("scoped"));
+
+  // A renamed visual is only found by its new name
+  visual1->SetName("renamed_visual");
+  EXPECT_FALSE(scene->GetVisual("index_visual"));
+  EXPECT_EQ(visual1, scene->GetVisual("renamed_visual"));
+
+  // Changing the id keeps the name
+  const uint32_t id = visual1->GetId() - 1000;
+  scene->SetVisualId(visual1, id);
+  EXPECT_EQ(visual1, scene->GetVisual(id));
+  EXPECT_EQ(visual1, scene->GetVisual("renamed_visual"));
+
+  scene->RemoveVisual(visual1);
+  scene->RemoveVisual(visual2);
+  EXPECT_FALSE(scene->GetVisual("renamed_visual"));
+  EXPECT_FALSE(scene->GetVisual("scoped"));
+}
+
+/////////////////////////////////////////////////
+TEST_F(Scene_TEST, UpdatePoses)
+{
+  Load("worlds/empty.world");
+
+  gazebo::rendering::ScenePtr scene = gazebo::rendering::get_scene();
+  ASSERT_TRUE(scene != nullptr);
+
+  rendering::VisualPtr visual1;
+  visual1.reset(new rendering::Visual("pose_visual1", scene));
+  scene->AddVisual(visual1);
+
+  // The second visual is added after its pose is received
+  rendering::VisualPtr visual2;
+  visual2.reset(new rendering::Visual("pose_visual2", scene));
+
+  const ignition::math::Pose3d pose1(1, 2, 3, 0, 0, 0);
+  const ignition::math::Pose3d pose2(-1, 0, 2, 0, 0, 0);
+
+  // Only the latest pose of a visual is applied
+  msgs::PosesStamped msg;
+  msgs::Set(msg.mutable_time(), common::Time(1, 0));
+  msgs::Pose *poseMsg = msg.add_pose();
+  poseMsg->set_id(visual1->GetId());
+  msgs::Set(poseMsg, ignition::math::Pose3d(5, 5, 5, 0, 0, 0));
+  poseMsg = msg.add_pose();
+  poseMsg->set_id(visual2->GetId());
+  msgs::Set(poseMsg, pose2);
+  scene->UpdatePoses(msg);
+
+  msg.clear_pose();
+  msgs::Set(msg.mutable_time(), common::Time(2, 0));
+  poseMsg = msg.add_pose();
+  poseMsg->set_id(visual1->GetId());
+  msgs::Set(poseMsg, pose1);
+  scene->UpdatePoses(msg);
+
+  int sleep = 0;
+  int maxSleep = 50;
+  while ((visual1->Pose() != pose1 || scene->SimTime() != common::Time(2, 0))
+      && sleep++ < maxSleep)
+  {
+    common::Time::MSleep(100);
+  }
+  EXPECT_EQ(pose1, visual1->Pose());
+  EXPECT_EQ(common::Time(2, 0), scene->SimTime());
+
+  scene->AddVisual(visual2);
+  sleep = 0;
+  while (visual2->Pose() != pose2 && sleep++ < maxSleep)
+    common::Time::MSleep(100);
+  EXPECT_EQ(pose2, visual2->Pose());
+
+  scene->RemoveVisual(visual1);
+  scene->RemoveVisual(visual2);
+}
 
 /////////////////////////////////////////////////
 int main(int argc, char **argv)
@@ -645,6 +645,13 @@ void Visual::SetName(const std::string &_name)
 {
   this->dataPtr->name = _name;
   this->dataPtr->sdf->GetAttribute("name")->Set(_name);
+
+  // Update the scene's name index if this visual is in the scene
+  if (this->dataPtr->scene &&
+      this->dataPtr->scene->GetVisual(this->dataPtr->id).get() == this)
+  {
+    this->dataPtr->scene->SetVisualId(shared_from_this(), this->dataPtr->id);
+  }
 }
 
 //////////////////////////////////////////////////
@@ -3521,6 +3528,10 @@ void Visual::LoadPlugin(const std::string &_filename,
             << "Plugin filename[" << _filename << "] name[" << _name << "]\n";
       return;
     }
+
+    // Attribute the event callbacks of the plugin to it
+    event::ConnectionOwner owner(_filename, this->Name() + "::" + _name);
+
     plugin->Load(shared_from_this(), _sdf);
     this->dataPtr->plugins.push_back(plugin);
 
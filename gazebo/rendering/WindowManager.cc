@@ -97,11 +97,25 @@ int WindowManager::CreateWindow(const std::string &_ogreHandle,
   Ogre::RenderWindow *window = NULL;
 
   // Mac and Windows *must* use externalWindow handle.
+  if (_ogreHandle.empty())
+  {
+    // No window to render into. OGRE renders with the current offscreen
+    // EGL context, and nothing is ever swapped to a screen.
+    params["hidden"] = "true";
+    if (RenderEngine::Instance()->GetContextType() != RenderEngine::GLX)
+    {
+      params["currentGLContext"] = "true";
+      params["externalGLControl"] = "true";
+    }
+  }
+  else
+  {
 #if defined(__APPLE__) || defined(_MSC_VER)
-  params["externalWindowHandle"] = _ogreHandle;
+    params["externalWindowHandle"] = _ogreHandle;
 #else
-  params["parentWindowHandle"] = _ogreHandle;
+    params["parentWindowHandle"] = _ogreHandle;
 #endif
+  }
   params["FSAA"] = "4";
   params["stereoMode"] = "Frame Sequential";
 
@@ -58,6 +58,7 @@ namespace gazebo
 
       /// \brief Create a window.
       /// \param[in] _ogreHandle String representing the ogre window handle.
+      /// An empty handle creates a hidden window, for offscreen rendering.
       /// \param[in] _width With of the window in pixels.
       /// \param[in] _height Height of the window in pixels.
       /// \param[in] _devicePixelRatio Screen point to pixel ratio
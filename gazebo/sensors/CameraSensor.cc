@@ -109,6 +109,8 @@ void CameraSensor::Load(const std::string &_worldName)
   }
 
   this->imagePub = this->node->Advertise<msgs::ImageStamped>(this->Topic(), 50);
+  // Slow subscribers only get the newest image, stale ones are dropped
+  this->imagePub->SetQoS(transport::QoS::LatestOnly());
 
   ignition::transport::AdvertiseMessageOptions opts;
   opts.SetMsgsPerSec(50);
@@ -449,6 +451,14 @@ bool CameraSensor::IsActive() const
     this->imagePubIgn.HasConnections();
 }
 
+//////////////////////////////////////////////////
+uint64_t CameraSensor::DroppedMessageCount() const
+{
+  if (!this->imagePub)
+    return 0u;
+  return this->imagePub->DroppedCount() + this->imagePub->ExpiredCount();
+}
+
 //////////////////////////////////////////////////
 rendering::CameraPtr CameraSensor::Camera() const
 {
@@ -17,6 +17,7 @@
 #ifndef GAZEBO_SENSORS_CAMERASENSOR_HH_
 #define GAZEBO_SENSORS_CAMERASENSOR_HH_
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <ignition/transport/Node.hh>
@@ -112,6 +113,11 @@ namespace gazebo
       // Documentation inherited
       public: virtual bool IsActive() const override;
 
+      /// \brief Get the number of messages the publishers of this sensor
+      /// dropped, because their queue was full or the messages expired.
+      /// \return Number of dropped messages.
+      public: virtual uint64_t DroppedMessageCount() const;
+
       // Documentation inherited
       protected: virtual bool UpdateImpl(const bool _force) override;
 
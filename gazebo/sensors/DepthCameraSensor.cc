@@ -14,10 +14,15 @@
  * limitations under the License.
  *
 */
+#include <cstdint>
+#include <cstring>
 #include <functional>
+#include <limits>
+#include <string>
 
 #include "ignition/common/Profiler.hh"
 
+#include "gazebo/common/CommonIface.hh"
 #include "gazebo/physics/World.hh"
 
 #include "gazebo/rendering/DepthCamera.hh"
@@ -37,6 +42,28 @@ using namespace sensors;
 
 GZ_REGISTER_STATIC_SENSOR("depth", DepthCameraSensor)
 
+//////////////////////////////////////////////////
+/// \brief Copy depth samples, masking ranges outside of the clip distances
+/// to +/- inf, as per REP 117.
+/// \param[in] _src Depth samples.
+/// \param[out] _dst Masked ranges.
+/// \param[in] _count Number of samples.
+/// \param[in] _nearClip Near clip distance.
+/// \param[in] _farClip Far clip distance.
+static void CopyRanges(const float *_src, float *_dst, const size_t _count,
+    const float _nearClip, const float _farClip)
+{
+  for (size_t i = 0; i < _count; ++i)
+  {
+    if (_src[i] >= _farClip)
+      _dst[i] = ignition::math::INF_F;
+    else if (_src[i] <= _nearClip)
+      _dst[i] = -ignition::math::INF_F;
+    else
+      _dst[i] = _src[i];
+  }
+}
+
 //////////////////////////////////////////////////
 DepthCameraSensor::DepthCameraSensor()
     : CameraSensor(),
@@ -47,14 +74,30 @@ DepthCameraSensor::DepthCameraSensor()
 //////////////////////////////////////////////////
 DepthCameraSensor::~DepthCameraSensor()
 {
-  if (this->dataPtr->depthBuffer)
-    delete [] this->dataPtr->depthBuffer;
 }
 
 //////////////////////////////////////////////////
 void DepthCameraSensor::Load(const std::string &_worldName)
 {
   CameraSensor::Load(_worldName);
+
+  std::string outputs = this->sdf->GetElement("camera")->
+      GetElement("depth_camera")->Get<std::string>("output");
+  if (outputs.find("points") != std::string::npos)
+  {
+    this->dataPtr->pointCloudPub =
+        this->node->Advertise<msgs::PointCloudPacked>(
+        this->PointCloudTopic(), 50);
+    // Slow subscribers only get the newest point cloud
+    this->dataPtr->pointCloudPub->SetQoS(transport::QoS::LatestOnly());
+  }
+}
+
+//////////////////////////////////////////////////
+void DepthCameraSensor::Fini()
+{
+  this->dataPtr->pointCloudPub.reset();
+  CameraSensor::Fini();
 }
 
 //////////////////////////////////////////////////
@@ -146,57 +189,234 @@ bool DepthCameraSensor::UpdateImpl(const bool /*_force*/)
 
   IGN_PROFILE_BEGIN("fillarray");
 
-  if (this->imagePub && this->imagePub->HasConnections() &&
-      // check if depth data is available. If not, the depth camera could be
-      // generating point clouds instead
-      this->dataPtr->depthCamera->DepthData())
+  this->dataPtr->bytesCopied = this->dataPtr->depthCamera->BytesReadBack();
+
+  if (this->imagePub && this->imagePub->HasConnections())
+    this->PublishDepthImage();
+
+  this->UpdateDepthData();
+
+  if (this->dataPtr->pointCloudPub &&
+      this->dataPtr->pointCloudPub->HasConnections())
   {
-    msgs::ImageStamped msg;
-    msgs::Set(msg.mutable_time(), this->scene->SimTime());
-    msg.mutable_image()->set_width(this->camera->ImageWidth());
-    msg.mutable_image()->set_height(this->camera->ImageHeight());
-    msg.mutable_image()->set_pixel_format(common::Image::R_FLOAT32);
+    this->PublishPointCloud();
+  }
 
+  this->SetRendered(false);
+  IGN_PROFILE_END();
+  return true;
+}
 
-    msg.mutable_image()->set_step(this->camera->ImageWidth() *
-        this->camera->ImageDepth());
+//////////////////////////////////////////////////
+void DepthCameraSensor::PublishDepthImage()
+{
+  // The depth camera could be generating point clouds instead
+  rendering::DepthCameraBufferPtr depth =
+      this->dataPtr->depthCamera->DepthBuffer();
+  if (!depth)
+    return;
 
-    unsigned int depthSamples = msg.image().width() * msg.image().height();
-    float f;
-    // cppchecker recommends using sizeof(varname)
-    unsigned int depthBufferSize = depthSamples * sizeof(f);
+  const unsigned int width = this->camera->ImageWidth();
+  const unsigned int height = this->camera->ImageHeight();
+  const size_t depthSamples = width * height;
+  if (depth->size() < depthSamples)
+    return;
 
-    if (!this->dataPtr->depthBuffer)
-      this->dataPtr->depthBuffer = new float[depthSamples];
+  // The message is shared with the publisher instead of copied, so a new
+  // one is built for every frame.
+  boost::shared_ptr<msgs::ImageStamped> msg(new msgs::ImageStamped);
+  msgs::Set(msg->mutable_time(), this->scene->SimTime());
+  msg->mutable_image()->set_width(width);
+  msg->mutable_image()->set_height(height);
+  msg->mutable_image()->set_pixel_format(common::Image::R_FLOAT32);
+  msg->mutable_image()->set_step(width * this->camera->ImageDepth());
+
+  // Mask the ranges while copying the frame into the message
+  std::string *data = msg->mutable_image()->mutable_data();
+  data->resize(depthSamples * sizeof(float));
+  CopyRanges(depth->data(), reinterpret_cast<float *>(&(*data)[0]),
+      depthSamples, this->camera->NearClip(), this->camera->FarClip());
+  this->dataPtr->bytesCopied += data->size();
+
+  this->imagePub->Publish(msg);
+}
 
-    memcpy(this->dataPtr->depthBuffer, this->dataPtr->depthCamera->DepthData(),
-        depthBufferSize);
+//////////////////////////////////////////////////
+void DepthCameraSensor::UpdateDepthData()
+{
+  std::lock_guard<std::mutex> lock(this->dataPtr->depthDataMutex);
+  if (!this->dataPtr->depthDataUsed)
+    return;
+
+  rendering::DepthCameraBufferPtr depth =
+      this->dataPtr->depthCamera->DepthBuffer();
+  if (!depth)
+    return;
+
+  const size_t depthSamples =
+      this->camera->ImageWidth() * this->camera->ImageHeight();
+  if (depth->size() < depthSamples)
+    return;
 
-    for (unsigned int i = 0; i < depthSamples; ++i)
+  // The vector keeps its address while the image size doesn't change
+  this->dataPtr->depthData.resize(depthSamples);
+  CopyRanges(depth->data(), this->dataPtr->depthData.data(), depthSamples,
+      this->camera->NearClip(), this->camera->FarClip());
+  this->dataPtr->bytesCopied += depthSamples * sizeof(float);
+}
+
+//////////////////////////////////////////////////
+void DepthCameraSensor::PublishPointCloud()
+{
+  rendering::DepthCameraBufferPtr cloud =
+      this->dataPtr->depthCamera->PointCloudBuffer();
+  if (!cloud)
+    return;
+
+  const unsigned int width = this->camera->ImageWidth();
+  const unsigned int height = this->camera->ImageHeight();
+  const size_t pointCount = width * height;
+  if (cloud->size() < pointCount * 4)
+    return;
+
+  boost::shared_ptr<msgs::PointCloudPacked> msg(new msgs::PointCloudPacked);
+  msgs::Set(msg->mutable_time(), this->scene->SimTime());
+
+  // Same layout as the rendered points: XYZ, then the color in a fourth
+  // float, so every point is written with a single pass over the frame.
+  const char *names[] = {"x", "y", "z", "rgb"};
+  for (unsigned int i = 0; i < 4; ++i)
+  {
+    msgs::PointCloudPacked::Field *field = msg->add_field();
+    field->set_name(names[i]);
+    field->set_offset(i * sizeof(float));
+    field->set_datatype(msgs::PointCloudPacked::Field::FLOAT32);
+    field->set_count(1);
+  }
+  const uint16_t endianTest = 1;
+  msg->set_is_bigendian(*reinterpret_cast<const uint8_t *>(&endianTest) == 0);
+  msg->set_point_step(4 * sizeof(float));
+
+  const bool organized = this->dataPtr->organizedPointCloud;
+  const float farClip = this->camera->FarClip();
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+
+  std::string *data = msg->mutable_data();
+  data->resize(pointCount * msg->point_step());
+  float *dst = reinterpret_cast<float *>(&(*data)[0]);
+  const float *src = cloud->data();
+  size_t written = 0;
+  size_t invalid = 0;
+  for (size_t i = 0; i < pointCount; ++i, src += 4)
+  {
+    // Pixels that hit nothing keep the clear colour of the point cloud
+    // pass: the far clip distance, and a negative color that the XYZPoints
+    // material never writes
+    const bool valid = src[3] >= 0.0f && src[2] < farClip;
+    if (!valid)
     {
-      // Mask ranges outside of min/max to +/- inf, as per REP 117
-      if (this->dataPtr->depthBuffer[i] >= this->camera->FarClip())
-      {
-        this->dataPtr->depthBuffer[i] = ignition::math::INF_D;
-      }
-      else if (this->dataPtr->depthBuffer[i] <= this->camera->NearClip())
-      {
-        this->dataPtr->depthBuffer[i] = -ignition::math::INF_D;
-      }
+      ++invalid;
+      if (!organized)
+        continue;
     }
-    msg.mutable_image()->set_data(this->dataPtr->depthBuffer, depthBufferSize);
-    this->imagePub->Publish(msg);
+
+    dst[0] = valid ? src[0] : nan;
+    dst[1] = valid ? src[1] : nan;
+    dst[2] = valid ? src[2] : nan;
+
+    // The XYZPoints material encodes the color as the number
+    // r * 2^16 + g * 2^8 + b. PCL and ROS expect these bits instead.
+    uint32_t rgb = 0;
+    if (valid && src[3] > 0.0f && src[3] < 16777216.0f)
+      rgb = static_cast<uint32_t>(src[3]);
+    std::memcpy(dst + 3, &rgb, sizeof(rgb));
+
+    dst += 4;
+    ++written;
   }
+  data->resize(written * msg->point_step());
 
-  this->SetRendered(false);
-  IGN_PROFILE_END();
-  return true;
+  msg->set_height(organized ? height : 1u);
+  msg->set_width(organized ? width : static_cast<uint32_t>(written));
+  msg->set_row_step(msg->width() * msg->point_step());
+  msg->set_is_dense(!organized || invalid == 0);
+  this->dataPtr->bytesCopied += data->size();
+
+  this->dataPtr->pointCloudPub->Publish(msg);
 }
 
 //////////////////////////////////////////////////
 const float *DepthCameraSensor::DepthData() const
 {
-  return this->dataPtr->depthBuffer;
+  std::lock_guard<std::mutex> lock(this->dataPtr->depthDataMutex);
+
+  // From now on, every update copies the depth frame into depthData
+  this->dataPtr->depthDataUsed = true;
+  if (this->dataPtr->depthData.empty() && this->dataPtr->depthCamera)
+  {
+    rendering::DepthCameraBufferPtr depth =
+        this->dataPtr->depthCamera->DepthBuffer();
+    const size_t depthSamples =
+        this->camera->ImageWidth() * this->camera->ImageHeight();
+    if (depth && depth->size() >= depthSamples)
+    {
+      this->dataPtr->depthData.resize(depthSamples);
+      CopyRanges(depth->data(), this->dataPtr->depthData.data(),
+          depthSamples, this->camera->NearClip(), this->camera->FarClip());
+    }
+  }
+
+  if (this->dataPtr->depthData.empty())
+    return nullptr;
+  return this->dataPtr->depthData.data();
+}
+
+//////////////////////////////////////////////////
+std::string DepthCameraSensor::PointCloudTopic() const
+{
+  std::string topicName = "~/";
+  topicName += this->ParentName() + "/" + this->Name() + "/points";
+  common::replaceAll(topicName, topicName, "::", "/");
+
+  return topicName;
+}
+
+//////////////////////////////////////////////////
+void DepthCameraSensor::SetPointCloudOrganized(const bool _organized)
+{
+  this->dataPtr->organizedPointCloud = _organized;
+}
+
+//////////////////////////////////////////////////
+bool DepthCameraSensor::PointCloudOrganized() const
+{
+  return this->dataPtr->organizedPointCloud;
+}
+
+//////////////////////////////////////////////////
+size_t DepthCameraSensor::BytesCopiedPerFrame() const
+{
+  return this->dataPtr->bytesCopied;
+}
+
+//////////////////////////////////////////////////
+bool DepthCameraSensor::IsActive() const
+{
+  return CameraSensor::IsActive() ||
+    (this->dataPtr->pointCloudPub &&
+     this->dataPtr->pointCloudPub->HasConnections());
+}
+
+//////////////////////////////////////////////////
+uint64_t DepthCameraSensor::DroppedMessageCount() const
+{
+  uint64_t count = CameraSensor::DroppedMessageCount();
+  if (this->dataPtr->pointCloudPub)
+  {
+    count += this->dataPtr->pointCloudPub->DroppedCount() +
+      this->dataPtr->pointCloudPub->ExpiredCount();
+  }
+  return count;
 }
 
 //////////////////////////////////////////////////
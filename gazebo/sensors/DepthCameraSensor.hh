@@ -51,14 +51,49 @@ namespace gazebo
       /// \brief Initialize the camera
       public: virtual void Init();
 
-      /// \brief Gets the raw depth data from the sensor.
-      /// \return The pointer to the depth data array.
+      /// \brief Gets the raw depth data from the sensor, with ranges
+      /// outside of the clip distances set to +/- inf. The array belongs to
+      /// the sensor, and keeps its address while the image size doesn't
+      /// change. Once this function was called, every update of the sensor
+      /// copies the depth frame into it. To get frames without this copy,
+      /// use DepthCamera()->DepthBuffer() or
+      /// DepthCamera()->ConnectNewDepthBuffer().
+      /// \return The pointer to the depth data array, or null before the
+      /// first frame.
       public: virtual const float *DepthData() const;
 
       /// \brief Returns a pointer to the rendering::DepthCamera
       /// \return Depth Camera pointer
       public: virtual rendering::DepthCameraPtr DepthCamera() const;
 
+      /// \brief Get the topic on which point clouds are published, when the
+      /// camera outputs points.
+      /// \return The point cloud topic.
+      public: std::string PointCloudTopic() const;
+
+      /// \brief Set whether point clouds are published organized, with one
+      /// point per pixel and NaN coordinates for pixels that hit nothing, or
+      /// unorganized, with only the valid points in a single row. Organized
+      /// clouds are published by default.
+      /// \param[in] _organized True to publish organized point clouds.
+      public: void SetPointCloudOrganized(const bool _organized);
+
+      /// \brief Get whether point clouds are published organized.
+      /// \return True if point clouds are published organized.
+      /// \sa SetPointCloudOrganized
+      public: bool PointCloudOrganized() const;
+
+      /// \brief Get the number of bytes the last update copied, from the
+      /// GPU read back of the camera to the published messages.
+      /// \return Number of bytes.
+      public: size_t BytesCopiedPerFrame() const;
+
+      // Documentation inherited
+      public: virtual bool IsActive() const override;
+
+      // Documentation inherited
+      public: virtual uint64_t DroppedMessageCount() const override;
+
       /// \brief Load the sensor with default parameters
       /// \param[in] _worldName Name of world to load from
       protected: virtual void Load(const std::string &_worldName);
@@ -66,6 +101,20 @@ namespace gazebo
       // Documentation inherited
       protected: virtual bool UpdateImpl(const bool _force);
 
+      // Documentation inherited
+      protected: virtual void Fini() override;
+
+      /// \brief Publish the depth frame of the last update as an image,
+      /// with the ranges out of the clip distances masked.
+      private: void PublishDepthImage();
+
+      /// \brief Publish the point cloud of the last update.
+      private: void PublishPointCloud();
+
+      /// \brief Copy the depth frame of the last update into the array
+      /// returned by DepthData(), once DepthData() was called.
+      private: void UpdateDepthData();
+
       /// \internal
       /// \brief Private data pointer
       private: std::unique_ptr<DepthCameraSensorPrivate> dataPtr;
@@ -17,7 +17,12 @@
 #ifndef _GAZEBO_SENSORS_DEPTHCAMERASENSOR_PRIVATE_HH_
 #define _GAZEBO_SENSORS_DEPTHCAMERASENSOR_PRIVATE_HH_
 
+#include <mutex>
+#include <vector>
+
+#include "gazebo/msgs/msgs.hh"
 #include "gazebo/rendering/RenderTypes.hh"
+#include "gazebo/transport/TransportTypes.hh"
 
 namespace gazebo
 {
@@ -27,11 +32,29 @@ namespace gazebo
     /// \brief Depth camera sensor private data.
     class DepthCameraSensorPrivate
     {
-      /// \brief Depth data buffer.
-      public: float *depthBuffer = nullptr;
+      /// \brief Masked copy of the last depth frame that DepthData()
+      /// points to. It belongs to the sensor, so the pointer stays valid
+      /// when the camera reuses its frame buffers.
+      public: std::vector<float> depthData;
+
+      /// \brief True once DepthData() was called. Until then, updates don't
+      /// copy the depth frame into depthData.
+      public: bool depthDataUsed = false;
+
+      /// \brief Protects depthData and depthDataUsed.
+      public: std::mutex depthDataMutex;
 
       /// \brief Local pointer to the depthCamera.
       public: rendering::DepthCameraPtr depthCamera;
+
+      /// \brief Publisher of point clouds.
+      public: transport::PublisherPtr pointCloudPub;
+
+      /// \brief True to publish organized point clouds.
+      public: bool organizedPointCloud = true;
+
+      /// \brief Number of bytes copied by the last update.
+      public: size_t bytesCopied = 0;
     };
   }
 }
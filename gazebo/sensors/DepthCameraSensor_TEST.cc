@@ -15,6 +15,7 @@
  *
 */
 
+#include <cmath>
 #include <functional>
 #include <mutex>
 
@@ -273,6 +274,146 @@ TEST_F(DepthCameraSensor_normals_TEST, CreateDepthCamera)
   depthCamera.reset();
 }
 
+class DepthCameraSensor_points_TEST : public ServerFixture
+{
+};
+
+std::mutex g_pointCloudMutex;
+ConstPointCloudPackedPtr g_pointCloudMsg;
+
+/////////////////////////////////////////////////
+void OnPointCloud(ConstPointCloudPackedPtr &_msg)
+{
+  std::lock_guard<std::mutex> lock(g_pointCloudMutex);
+  g_pointCloudMsg = _msg;
+}
+
+/////////////////////////////////////////////////
+/// \brief Wait for a point cloud message of the given height.
+ConstPointCloudPackedPtr WaitForPointCloud(const unsigned int _height)
+{
+  for (int i = 0; i < 300; ++i)
+  {
+    {
+      std::lock_guard<std::mutex> lock(g_pointCloudMutex);
+      if (g_pointCloudMsg && g_pointCloudMsg->height() == _height)
+        return g_pointCloudMsg;
+    }
+    common::Time::MSleep(20);
+  }
+  return ConstPointCloudPackedPtr();
+}
+
+/////////////////////////////////////////////////
+/// \brief Read a float field of a point of a packed point cloud.
+float PointField(ConstPointCloudPackedPtr _msg, const unsigned int _index,
+    const unsigned int _field)
+{
+  float value;
+  memcpy(&value, _msg->data().data() + _index * _msg->point_step() +
+      _field * sizeof(float), sizeof(value));
+  return value;
+}
+
+/////////////////////////////////////////////////
+/// \brief Test the point clouds published by a depth camera sensor
+TEST_F(DepthCameraSensor_points_TEST, PublishPointCloud)
+{
+  Load("worlds/depth_camera2.world");
+  sensors::SensorManager *mgr = sensors::SensorManager::Instance();
+
+  std::string sensorName = "default::camera_model::my_link::camera";
+  sensors::DepthCameraSensorPtr sensor =
+     std::dynamic_pointer_cast<sensors::DepthCameraSensor>
+     (mgr->GetSensor(sensorName));
+  ASSERT_NE(nullptr, sensor);
+
+  const unsigned int width = sensor->ImageWidth();
+  const unsigned int height = sensor->ImageHeight();
+  EXPECT_EQ("~/camera_model/my_link/camera/points", sensor->PointCloudTopic());
+  EXPECT_TRUE(sensor->PointCloudOrganized());
+
+  rendering::DepthCameraPtr depthCamera = sensor->DepthCamera();
+  ASSERT_NE(nullptr, depthCamera);
+
+  transport::NodePtr node(new transport::Node());
+  node->Init();
+  transport::SubscriberPtr sub =
+      node->Subscribe(sensor->PointCloudTopic(), &OnPointCloud);
+
+  // Organized cloud, with one point per pixel
+  ConstPointCloudPackedPtr msg = WaitForPointCloud(height);
+  ASSERT_NE(nullptr, msg);
+  EXPECT_EQ(width, msg->width());
+  EXPECT_EQ(16u, msg->point_step());
+  EXPECT_EQ(width * 16u, msg->row_step());
+  EXPECT_EQ(width * height * 16u, msg->data().size());
+  ASSERT_EQ(4, msg->field_size());
+  EXPECT_EQ("x", msg->field(0).name());
+  EXPECT_EQ("rgb", msg->field(3).name());
+  EXPECT_EQ(12u, msg->field(3).offset());
+  EXPECT_EQ(msgs::PointCloudPacked::Field::FLOAT32, msg->field(3).datatype());
+
+  // The box is in front of the camera, the sky above it hits nothing
+  EXPECT_FALSE(msg->is_dense());
+  const unsigned int center = (height / 2) * width + width / 2;
+  EXPECT_NEAR(0.0, PointField(msg, center, 0), 0.05);
+  EXPECT_NEAR(0.0, PointField(msg, center, 1), 0.05);
+  EXPECT_NEAR(2.5, PointField(msg, center, 2), 0.05);
+  EXPECT_TRUE(std::isnan(PointField(msg, width / 2, 2)));
+
+  // The green box is packed as 0x00RRGGBB
+  float rgbFloat = PointField(msg, center, 3);
+  uint32_t rgb;
+  memcpy(&rgb, &rgbFloat, sizeof(rgb));
+  EXPECT_GT((rgb >> 8) & 0xff, (rgb >> 16) & 0xff);
+
+  // The pipeline reads the cloud back once, then fills the message once
+  EXPECT_GE(sensor->BytesCopiedPerFrame(), width * height * 16u * 2u);
+  EXPECT_GE(depthCamera->BytesReadBack(), width * height * 16u);
+
+  // A buffer that is held is not overwritten by the next frames
+  rendering::DepthCameraBufferPtr held = depthCamera->PointCloudBuffer();
+  ASSERT_NE(nullptr, held);
+  EXPECT_EQ(width * height * 4u, held->size());
+  int sleep = 0;
+  while (depthCamera->PointCloudBuffer() == held && sleep++ < 300)
+    common::Time::MSleep(20);
+  EXPECT_NE(held, depthCamera->PointCloudBuffer());
+
+  // The depth data belongs to the sensor and keeps its address
+  const float *depthData = sensor->DepthData();
+  sleep = 0;
+  while (!depthData && sleep++ < 300)
+  {
+    common::Time::MSleep(20);
+    depthData = sensor->DepthData();
+  }
+  ASSERT_NE(nullptr, depthData);
+  const rendering::DepthCameraBufferPtr depth = depthCamera->DepthBuffer();
+  sleep = 0;
+  while (depthCamera->DepthBuffer() == depth && sleep++ < 300)
+    common::Time::MSleep(20);
+  EXPECT_EQ(depthData, sensor->DepthData());
+  EXPECT_NEAR(2.5, depthData[center], 0.05);
+  EXPECT_TRUE(std::isinf(depthData[width / 2]));
+
+  // Unorganized cloud, with the valid points only
+  sensor->SetPointCloudOrganized(false);
+  EXPECT_FALSE(sensor->PointCloudOrganized());
+  msg = WaitForPointCloud(1u);
+  ASSERT_NE(nullptr, msg);
+  EXPECT_TRUE(msg->is_dense());
+  EXPECT_GT(msg->width(), 0u);
+  EXPECT_LT(msg->width(), width * height);
+  EXPECT_EQ(msg->width() * 16u, msg->data().size());
+  for (unsigned int i = 0; i < msg->width(); ++i)
+  {
+    EXPECT_FALSE(std::isnan(PointField(msg, i, 2)));
+    EXPECT_LT(PointField(msg, i, 2), depthCamera->FarClip());
+  }
+}
+
 /////////////////////////////////////////////////
 int main(int argc, char **argv)
 {
@@ -147,10 +147,18 @@ void GaussianNoiseModel::Fini()
 //////////////////////////////////////////////////
 double GaussianNoiseModel::ApplyImpl(double _in, double _dt)
 {
-  // Add independent (uncorrelated) Gaussian noise to each input value.
-  double whiteNoise = ignition::math::Rand::DblNormal(this->mean, this->stdDev);
+  this->ApplyImpl(&_in, 1, _dt);
+  return _in;
+}
+
+//////////////////////////////////////////////////
+void GaussianNoiseModel::ApplyImpl(double *_data, const size_t _count,
+    const double _dt)
+{
+  if (_count == 0)
+    return;
 
-  // Generate varying (correlated) bias for each input value.
+  // Generate varying (correlated) bias, shared by all the input values.
   // This implementation is based on the one available in Rotors:
   // https://github.com/ethz-asl/rotors_simulator/blob/master/rotors_gazebo_plugins/src/gazebo_imu_plugin.cpp
   //
@@ -168,20 +176,25 @@ double GaussianNoiseModel::ApplyImpl(double _in, double _dt)
         tau / 2 * expm1(-2 * _dt / tau));
 
     const double phiD = exp(-_dt / tau);
-    this->bias = phiD * this->bias +
-      ignition::math::Rand::DblNormal(0, sigmaBD);
+    this->bias = phiD * this->bias + sigmaBD * this->SampleNormal();
   }
 
-  double output = _in + this->bias + whiteNoise;
-  if (this->quantized)
+  // Add independent (uncorrelated) Gaussian noise to each input value.
+  if (this->samples.size() < _count)
+    this->samples.resize(_count);
+  this->SampleNormal(this->samples.data(), _count);
+
+  const double offset = this->mean + this->bias;
+  for (size_t i = 0; i < _count; ++i)
+    _data[i] += offset + this->stdDev * this->samples[i];
+
+  // Apply this->precision
+  if (this->quantized &&
+      !ignition::math::equal(this->precision, 0.0, 1e-6))
   {
-    // Apply this->precision
-    if (!ignition::math::equal(this->precision, 0.0, 1e-6))
-    {
-      output = std::round(output / this->precision) * this->precision;
-    }
+    for (size_t i = 0; i < _count; ++i)
+      _data[i] = std::round(_data[i] / this->precision) * this->precision;
   }
-  return output;
 }
 
 //////////////////////////////////////////////////
@@ -57,6 +57,10 @@ namespace gazebo
         // Documentation inherited.
         public: double ApplyImpl(double _in, double _dt);
 
+        // Documentation inherited.
+        public: virtual void ApplyImpl(double *_data, const size_t _count,
+                    const double _dt);
+
         /// \brief Accessor for mean.
         /// \return Mean of Gaussian noise.
         public: double GetMean() const;
@@ -132,6 +136,9 @@ namespace gazebo
         /// \biref If type starts with GAUSSIAN, the correlation time of the
         /// process from which the dynamic bias will be driven.
         private: double dynamicBiasCorrTime;
+
+        /// \brief Buffer of normal samples, reused between applications.
+        private: std::vector<double> samples;
     };
 
     /// \class GaussianNoiseModel
@@ -750,6 +750,12 @@ bool GpuRaySensor::UpdateImpl(const bool /*_force*/)
     }
   }
 
+  auto noiseIter = this->noises.find(GPU_RAY_NOISE);
+  NoisePtr noise = noiseIter != this->noises.end() ? noiseIter->second :
+      NoisePtr();
+  this->dataPtr->noisyRanges.clear();
+  this->dataPtr->noisyIndices.clear();
+
   auto dataIter = this->dataPtr->laserCam->LaserDataBegin();
   auto dataEnd = this->dataPtr->laserCam->LaserDataEnd();
   for (int i = 0; dataIter != dataEnd; ++dataIter, ++i)
@@ -767,11 +773,10 @@ bool GpuRaySensor::UpdateImpl(const bool /*_force*/)
     {
       range = -ignition::math::INF_D;
     }
-    else if (this->noises.find(GPU_RAY_NOISE) != this->noises.end())
+    else if (noise)
     {
-      range = this->noises[GPU_RAY_NOISE]->Apply(range);
-      range = ignition::math::clamp(range,
-          this->dataPtr->rangeMin, this->dataPtr->rangeMax);
+      this->dataPtr->noisyIndices.push_back(i);
+      this->dataPtr->noisyRanges.push_back(range);
     }
 
     range = ignition::math::isnan(range) ? this->dataPtr->rangeMax : range;
@@ -779,6 +784,19 @@ bool GpuRaySensor::UpdateImpl(const bool /*_force*/)
     scan->set_intensities(i, intensity);
   }
 
+  // Apply the noise to all the ranges within the limits at once
+  if (noise && !this->dataPtr->noisyRanges.empty())
+  {
+    std::vector<double> &ranges = this->dataPtr->noisyRanges;
+    noise->Apply(ranges.data(), ranges.size());
+    for (size_t k = 0; k < ranges.size(); ++k)
+    {
+      scan->set_ranges(this->dataPtr->noisyIndices[k],
+          ignition::math::clamp(ranges[k],
+            this->dataPtr->rangeMin, this->dataPtr->rangeMax));
+    }
+  }
+
   if (this->dataPtr->scanPub && this->dataPtr->scanPub->HasConnections())
     this->dataPtr->scanPub->Publish(this->dataPtr->laserMsg);
 
@@ -19,6 +19,7 @@
 
 #include <limits>
 #include <mutex>
+#include <vector>
 #include <sdf/sdf.hh>
 
 #include "gazebo/rendering/RenderTypes.hh"
@@ -94,6 +95,13 @@ namespace gazebo
       /// \brief Timestamp of the forthcoming rendering
       public: double nextRenderingTime
                            = std::numeric_limits<double>::quiet_NaN();
+
+      /// \brief Ranges within the range limits, to which the noise is
+      /// applied at once after the scan is filled.
+      public: std::vector<double> noisyRanges;
+
+      /// \brief Index in the scan of each of the noisyRanges.
+      public: std::vector<int> noisyIndices;
     };
   }
 }
@@ -92,6 +92,8 @@ void MultiCameraSensor::Load(const std::string &_worldName)
   // Create the publisher of image data.
   this->dataPtr->imagePub =
     this->node->Advertise<msgs::ImagesStamped>(this->Topic(), 50);
+  // Slow subscribers only get the newest image, stale ones are dropped
+  this->dataPtr->imagePub->SetQoS(transport::QoS::LatestOnly());
 }
 
 //////////////////////////////////////////////////
@@ -465,6 +467,15 @@ bool MultiCameraSensor::IsActive() const
     (this->dataPtr->imagePub && this->dataPtr->imagePub->HasConnections());
 }
 
+//////////////////////////////////////////////////
+uint64_t MultiCameraSensor::DroppedMessageCount() const
+{
+  if (!this->dataPtr->imagePub)
+    return 0u;
+  return this->dataPtr->imagePub->DroppedCount() +
+    this->dataPtr->imagePub->ExpiredCount();
+}
+
 //////////////////////////////////////////////////
 double MultiCameraSensor::NextRequiredTimestamp() const
 {
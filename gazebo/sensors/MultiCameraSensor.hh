@@ -17,6 +17,7 @@
 #ifndef _GAZEBO_SENSORS_MULTICAMERASENSOR_HH_
 #define _GAZEBO_SENSORS_MULTICAMERASENSOR_HH_
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -111,6 +112,11 @@ namespace gazebo
       // Documentation inherited.
       public: virtual bool IsActive() const override;
 
+      /// \brief Get the number of messages the image publisher dropped,
+      /// because its queue was full or the messages expired.
+      /// \return Number of dropped messages.
+      public: uint64_t DroppedMessageCount() const;
+
       // Documentation inherited.
       protected: virtual bool UpdateImpl(const bool _force) override;
 
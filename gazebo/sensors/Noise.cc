@@ -15,7 +15,14 @@
  *
 */
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
 #include <boost/function.hpp>
+#include <ignition/math/Helpers.hh>
+#include <ignition/math/Rand.hh>
+
 #include "gazebo/common/Assert.hh"
 #include "gazebo/common/Console.hh"
 
@@ -25,6 +32,46 @@
 using namespace gazebo;
 using namespace sensors;
 
+namespace
+{
+  /// \brief Number of pairs of normal samples drawn per block.
+  const size_t kBlockPairs = 64;
+
+  /// \brief Number of noise models created, used to give every noise model
+  /// a different stream until it is seeded.
+  std::atomic<uint64_t> g_noiseCount(0);
+
+  /// \brief Mix the bits of a 64 bit value, the finalizer of SplitMix64.
+  /// \param[in] _x Value to mix.
+  /// \return Mixed value.
+  inline uint64_t Mix64(uint64_t _x)
+  {
+    _x = (_x ^ (_x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    _x = (_x ^ (_x >> 27)) * 0x94d049bb133111ebULL;
+    return _x ^ (_x >> 31);
+  }
+
+  /// \brief Counter based random generator. The bits at a position of a
+  /// stream depend only on the seed of the stream and on the position, so
+  /// there is no state shared between streams.
+  /// \param[in] _seed Seed of the stream.
+  /// \param[in] _counter Position in the stream.
+  /// \return Random bits.
+  inline uint64_t RandomBits(const uint64_t _seed, const uint64_t _counter)
+  {
+    return Mix64(Mix64((_counter + 1) * 0x9e3779b97f4a7c15ULL) ^ _seed);
+  }
+
+  /// \brief Convert random bits to a uniform sample in (0, 1].
+  /// \param[in] _bits Random bits.
+  /// \return Uniform sample.
+  inline double Uniform(const uint64_t _bits)
+  {
+    return (static_cast<double>(_bits >> 11) + 1.0) *
+        (1.0 / 9007199254740992.0);
+  }
+}
+
 //////////////////////////////////////////////////
 NoisePtr NoiseFactory::NewNoiseModel(sdf::ElementPtr _sdf,
     const std::string &_sensorType)
@@ -73,7 +120,9 @@ NoisePtr NoiseFactory::NewNoiseModel(sdf::ElementPtr _sdf,
 
 //////////////////////////////////////////////////
 Noise::Noise(NoiseType _type)
-  : type(_type)
+  : type(_type),
+    seed(StreamSeed(ignition::math::Rand::Seed(),
+          "noise" + std::to_string(g_noiseCount++)))
 {
 }
 
@@ -124,6 +173,105 @@ double Noise::ApplyImpl(double _in, double /*_dt*/)
   return _in;
 }
 
+//////////////////////////////////////////////////
+void Noise::Apply(double *_data, const size_t _count, const double _dt)
+{
+  if (this->type == NONE || _count == 0)
+    return;
+  else if (this->type == CUSTOM)
+  {
+    if (this->customNoiseCallbackTime)
+    {
+      for (size_t i = 0; i < _count; ++i)
+        _data[i] = this->customNoiseCallbackTime(_data[i], _dt);
+    }
+    else if (this->customNoiseCallback)
+    {
+      for (size_t i = 0; i < _count; ++i)
+        _data[i] = this->customNoiseCallback(_data[i]);
+    }
+    else
+    {
+      gzerr << "Custom noise callback function not set!"
+          << " Please call SetCustomNoiseCallback within a sensor plugin."
+          << std::endl;
+    }
+  }
+  else
+    this->ApplyImpl(_data, _count, _dt);
+}
+
+//////////////////////////////////////////////////
+void Noise::ApplyImpl(double *_data, const size_t _count, const double _dt)
+{
+  // Only the first value advances the time dependent state
+  for (size_t i = 0; i < _count; ++i)
+    _data[i] = this->ApplyImpl(_data[i], i == 0 ? _dt : 0.0);
+}
+
+//////////////////////////////////////////////////
+void Noise::SetSeed(const uint64_t _seed)
+{
+  this->seed = _seed;
+  this->counter = 0;
+}
+
+//////////////////////////////////////////////////
+uint64_t Noise::StreamSeed(const uint32_t _seed, const std::string &_name)
+{
+  // FNV-1a, so that the seed is the same on every platform
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const char c : _name)
+  {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 0x100000001b3ULL;
+  }
+  return Mix64(hash ^ Mix64(_seed));
+}
+
+//////////////////////////////////////////////////
+void Noise::SampleNormal(double *_samples, const size_t _count)
+{
+  double radius[kBlockPairs];
+  double angle[kBlockPairs];
+
+  for (size_t start = 0; start < _count; start += 2 * kBlockPairs)
+  {
+    const size_t pairs = std::min(kBlockPairs, (_count - start + 1) / 2);
+
+    // Box-Muller transform. The iterations of the loops are independent of
+    // each other, so that the compiler can vectorize them.
+    for (size_t i = 0; i < pairs; ++i)
+    {
+      const uint64_t c = this->counter + 2 * i;
+      radius[i] = std::sqrt(-2.0 * std::log(
+          Uniform(RandomBits(this->seed, c))));
+      angle[i] = 2.0 * IGN_PI * Uniform(RandomBits(this->seed, c + 1));
+    }
+    this->counter += 2 * pairs;
+
+    double *out = _samples + start;
+    const size_t fullPairs = std::min(pairs, (_count - start) / 2);
+    for (size_t i = 0; i < fullPairs; ++i)
+    {
+      out[2 * i] = radius[i] * std::cos(angle[i]);
+      out[2 * i + 1] = radius[i] * std::sin(angle[i]);
+    }
+
+    // An odd count leaves one sample of the last pair unused
+    if (fullPairs < pairs)
+      out[2 * fullPairs] = radius[fullPairs] * std::cos(angle[fullPairs]);
+  }
+}
+
+//////////////////////////////////////////////////
+double Noise::SampleNormal()
+{
+  double sample;
+  this->SampleNormal(&sample, 1);
+  return sample;
+}
+
 //////////////////////////////////////////////////
 Noise::NoiseType Noise::GetNoiseType() const
 {
@@ -18,6 +18,8 @@
 #ifndef _GAZEBO_NOISE_HH_
 #define _GAZEBO_NOISE_HH_
 
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <string>
 
@@ -88,6 +90,41 @@ namespace gazebo
       /// \return Data with noise applied.
       public: virtual double ApplyImpl(double _in, double _dt = 0.0);
 
+      /// \brief Apply noise to a buffer of data values in place. The values
+      /// are treated as samples taken at the same time, so time dependent
+      /// state such as a dynamic bias advances by _dt once for the whole
+      /// buffer.
+      /// \param[in,out] _data Data values, replaced by the noisy values.
+      /// \param[in] _count Number of values in _data.
+      /// \param[in] _dt Time since the last application of the noise.
+      public: void Apply(double *_data, const size_t _count,
+                  const double _dt = 0.0);
+
+      /// \brief Apply noise to a buffer of data values in place. This gets
+      /// overriden by derived classes, and called by Apply. The default
+      /// implementation calls ApplyImpl on each value.
+      /// \param[in,out] _data Data values, replaced by the noisy values.
+      /// \param[in] _count Number of values in _data.
+      /// \param[in] _dt Time since the last application of the noise.
+      public: virtual void ApplyImpl(double *_data, const size_t _count,
+                  const double _dt);
+
+      /// \brief Set the seed of the random stream of this noise model.
+      /// Every sample is a function of the seed and of the number of samples
+      /// drawn before it, so noise models with different seeds are
+      /// independent and can be applied from different threads.
+      /// \param[in] _seed Seed of the stream.
+      /// \sa StreamSeed
+      public: void SetSeed(const uint64_t _seed);
+
+      /// \brief Derive the seed of a random stream from a global seed and
+      /// the name of the stream, e.g. the scoped name of a sensor.
+      /// \param[in] _seed Global seed, e.g. ignition::math::Rand::Seed().
+      /// \param[in] _name Name of the stream.
+      /// \return Seed of the stream.
+      public: static uint64_t StreamSeed(const uint32_t _seed,
+                  const std::string &_name);
+
       /// \brief Finalize the noise model
       public: virtual void Fini();
 
@@ -123,6 +160,17 @@ namespace gazebo
       /// \param[in] _out Output stream
       public: virtual void Print(std::ostream &_out) const;
 
+      /// \brief Draw samples of the standard normal distribution from the
+      /// random stream of this noise model.
+      /// \param[out] _samples Buffer of at least _count values.
+      /// \param[in] _count Number of samples to draw.
+      protected: void SampleNormal(double *_samples, const size_t _count);
+
+      /// \brief Draw a sample of the standard normal distribution from the
+      /// random stream of this noise model.
+      /// \return The sample.
+      protected: double SampleNormal();
+
       /// \brief Which type of noise we're applying
       private: NoiseType type;
 
@@ -134,6 +182,12 @@ namespace gazebo
 
       /// \brief Callback function for applying custom noise to sensor data.
       private: std::function<double (double, double)> customNoiseCallbackTime;
+
+      /// \brief Seed of the random stream.
+      private: uint64_t seed;
+
+      /// \brief Number of random values drawn from the stream.
+      private: uint64_t counter = 0;
     };
     /// \}
   }
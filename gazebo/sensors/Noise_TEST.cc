@@ -23,6 +23,9 @@
 #include <boost/accumulators/statistics/variance.hpp>
 #include <boost/bind/bind.hpp>
 
+#include <cmath>
+#include <vector>
+
 #include <ignition/math/Rand.hh>
 
 #include "gazebo/sensors/Noise.hh"
@@ -374,6 +377,93 @@ TEST_F(NoiseTest, OnApplyNoise)
   }
 }
 
+//////////////////////////////////////////////////
+TEST_F(NoiseTest, ApplyBatch)
+{
+  const double mean = 10.0;
+  const double stddev = 5.0;
+  const size_t count = 10000;
+
+  sensors::NoisePtr noise = sensors::NoiseFactory::NewNoiseModel(
+      NoiseSdf("gaussian", mean, stddev, 0, 0, 0));
+  ASSERT_TRUE(noise != nullptr);
+
+  std::vector<double> values(count, 42.0);
+  noise->Apply(values.data(), values.size());
+
+  boost::accumulators::accumulator_set<double,
+    boost::accumulators::stats<boost::accumulators::tag::mean,
+                               boost::accumulators::tag::variance > > acc;
+  for (auto const &value : values)
+    acc(value);
+
+  // See comments in GaussianNoise function to explain these calculations.
+  double sampleStdDev = g_sigma*stddev / sqrt(count);
+  EXPECT_NEAR(boost::accumulators::mean(acc), 42.0 + mean, sampleStdDev);
+
+  double variance = stddev*stddev;
+  double sampleVariance2 = 2 * variance*variance / (count - 1);
+  EXPECT_NEAR(boost::accumulators::variance(acc),
+              variance, g_sigma*sqrt(sampleVariance2));
+
+  // Odd counts and counts larger than a block are filled completely
+  for (size_t size : {1u, 3u, 127u, 129u, 1001u})
+  {
+    std::vector<double> odd(size, 0.0);
+    noise->Apply(odd.data(), odd.size());
+    for (auto const &value : odd)
+    {
+      EXPECT_TRUE(std::isfinite(value));
+      EXPECT_GT(std::abs(value), 0.0);
+    }
+  }
+
+  // No noise leaves the values untouched
+  sensors::NoisePtr none = sensors::NoiseFactory::NewNoiseModel(
+      NoiseSdf("none", 0, 0, 0, 0, 0));
+  std::vector<double> same(10, 3.0);
+  none->Apply(same.data(), same.size());
+  for (auto const &value : same)
+    EXPECT_DOUBLE_EQ(3.0, value);
+
+  // Custom noise calls the callback on every value
+  sensors::NoisePtr custom(new sensors::Noise(sensors::Noise::CUSTOM));
+  custom->SetCustomNoiseCallback([](double _in) {return _in * 2;});
+  custom->Apply(same.data(), same.size());
+  for (auto const &value : same)
+    EXPECT_DOUBLE_EQ(6.0, value);
+}
+
+//////////////////////////////////////////////////
+TEST_F(NoiseTest, Seed)
+{
+  sensors::NoisePtr noise1 = sensors::NoiseFactory::NewNoiseModel(
+      NoiseSdf("gaussian", 0, 1, 0, 0, 0));
+  sensors::NoisePtr noise2 = sensors::NoiseFactory::NewNoiseModel(
+      NoiseSdf("gaussian", 0, 1, 0, 0, 0));
+
+  const uint64_t seed = sensors::Noise::StreamSeed(42, "model::link::laser");
+  EXPECT_EQ(seed, sensors::Noise::StreamSeed(42, "model::link::laser"));
+  EXPECT_NE(seed, sensors::Noise::StreamSeed(43, "model::link::laser"));
+  EXPECT_NE(seed, sensors::Noise::StreamSeed(42, "model::link::laser2"));
+
+  // The same seed gives the same noise, in batches or one value at a time
+  noise1->SetSeed(seed);
+  noise2->SetSeed(seed);
+  std::vector<double> values1(100, 0.0);
+  std::vector<double> values2(100, 0.0);
+  noise1->Apply(values1.data(), values1.size());
+  noise2->Apply(values2.data(), values2.size());
+  EXPECT_EQ(values1, values2);
+  EXPECT_DOUBLE_EQ(noise1->Apply(0.0), noise2->Apply(0.0));
+
+  // A different seed gives different noise
+  noise2->SetSeed(sensors::Noise::StreamSeed(42, "model::link::laser2"));
+  noise1->Apply(values1.data(), values1.size());
+  noise2->Apply(values2.data(), values2.size());
+  EXPECT_NE(values1, values2);
+}
+
 /////////////////////////////////////////////////
 int main(int argc, char **argv)
 {
@@ -14,6 +14,7 @@
  * limitations under the License.
  *
 */
+#include <algorithm>
 #include <boost/algorithm/string.hpp>
 
 #include <ignition/common/Profiler.hh>
@@ -274,9 +275,8 @@ void RaySensor::Ranges(std::vector<double> &_ranges) const
 {
   std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
 
-  _ranges.resize(this->dataPtr->laserMsg.scan().ranges_size());
-  memcpy(&_ranges[0], this->dataPtr->laserMsg.scan().ranges().data(),
-         sizeof(_ranges[0]) * this->dataPtr->laserMsg.scan().ranges_size());
+  _ranges.assign(this->dataPtr->ranges.begin(),
+      this->dataPtr->ranges.end());
 }
 
 //////////////////////////////////////////////////
@@ -354,7 +354,7 @@ bool RaySensor::UpdateImpl(const bool /*_force*/)
   this->lastMeasurementTime = this->world->SimTime();
 
   // moving this behind laserShape update
-  std::lock_guard<std::mutex> lock(this->dataPtr->mutex);
+  std::unique_lock<std::mutex> lock(this->dataPtr->mutex);
 
   msgs::Set(this->dataPtr->laserMsg.mutable_time(),
             this->lastMeasurementTime);
@@ -377,37 +377,20 @@ bool RaySensor::UpdateImpl(const bool /*_force*/)
   scan->set_range_min(this->RangeMin());
   scan->set_range_max(this->RangeMax());
 
-  scan->clear_ranges();
-  scan->clear_intensities();
-
   unsigned int rayCount = this->RayCount();
   unsigned int rangeCount = this->RangeCount();
   unsigned int verticalRayCount = this->VerticalRayCount();
   unsigned int verticalRangeCount = this->VerticalRangeCount();
+  const size_t count = rangeCount * verticalRangeCount;
+
+  // Read the results of all the rays into contiguous buffers
+  this->dataPtr->laserShape->Ranges(
+      this->dataPtr->rayRanges, this->dataPtr->rayRetros);
+  const std::vector<double> &rayRanges = this->dataPtr->rayRanges;
+  const std::vector<double> &rayRetros = this->dataPtr->rayRetros;
 
-  // Interpolation: for every point in range count, compute interpolated value
-  // using four bounding ray samples.
-  // (vja, hja)   (vja, hjb)
-  //       x---------x
-  //       |         |
-  //       |    o    |
-  //       |         |
-  //       x---------x
-  // (vjb, hja)   (vjb, hjb)
-  // where o: is the range to be interpolated
-  //       x: ray sample
-  //       vja: is the previous index of ray in vertical direction
-  //       vjb: is the next index of ray in vertical direction
-  //       hja: is the previous index of ray in horizontal direction
-  //       hjb: is the next index of ray in horizontal direction
-  unsigned int hja, hjb;
-  unsigned int vja = 0, vjb = 0;
-  // percentage of interpolation between rays
-  double vb = 0, hb;
-  // indices of ray samples
-  int j1, j2, j3, j4;
-  // range values of ray samples
-  double r1, r2, r3, r4;
+  std::vector<double> &ranges = this->dataPtr->ranges;
+  std::vector<double> &intensities = this->dataPtr->intensities;
 
   // Check for the common case of vertical and horizontal resolution being 1,
   // which means that ray count == range count and we can do simple lookup
@@ -417,89 +400,146 @@ bool RaySensor::UpdateImpl(const bool /*_force*/)
   bool interp =
     ((rayCount != rangeCount) || (verticalRayCount != verticalRangeCount));
 
-  // interpolate in vertical direction
-  for (unsigned int j = 0; j < verticalRangeCount; ++j)
+  if (!interp)
+  {
+    ranges.assign(rayRanges.begin(), rayRanges.end());
+    intensities.assign(rayRetros.begin(), rayRetros.end());
+  }
+  else
   {
-    if (interp)
+    ranges.resize(count);
+    intensities.resize(count);
+
+    // Interpolation: for every point in range count, compute interpolated
+    // value using four bounding ray samples.
+    // (vja, hja)   (vja, hjb)
+    //       x---------x
+    //       |         |
+    //       |    o    |
+    //       |         |
+    //       x---------x
+    // (vjb, hja)   (vjb, hjb)
+    // where o: is the range to be interpolated
+    //       x: ray sample
+    //       vja: is the previous index of ray in vertical direction
+    //       vjb: is the next index of ray in vertical direction
+    //       hja: is the previous index of ray in horizontal direction
+    //       hjb: is the next index of ray in horizontal direction
+    //
+    // The horizontal indices and weights are the same for every row, so
+    // they are computed once for each pair of ray and range counts.
+    std::vector<unsigned int> &hja = this->dataPtr->horizontalPrev;
+    std::vector<unsigned int> &hjb = this->dataPtr->horizontalNext;
+    std::vector<double> &hb = this->dataPtr->horizontalWeight;
+    if (hb.size() != rangeCount ||
+        this->dataPtr->horizontalRayCount != rayCount)
+    {
+      this->dataPtr->horizontalRayCount = rayCount;
+      hja.resize(rangeCount);
+      hjb.resize(rangeCount);
+      hb.resize(rangeCount);
+      for (unsigned int i = 0; i < rangeCount; ++i)
+      {
+        double b = (rangeCount == 1) ? 0 :
+            static_cast<double>(i * (rayCount - 1)) / (rangeCount - 1);
+        hja[i] = static_cast<unsigned int>(floor(b));
+        hjb[i] = std::min(hja[i] + 1, rayCount - 1);
+        hb[i] = b - floor(b);
+
+        GZ_ASSERT(hja[i] < rayCount,
+            "Invalid horizontal ray index used for interpolation");
+        GZ_ASSERT(hjb[i] < rayCount,
+            "Invalid horizontal ray index used for interpolation");
+      }
+    }
+
+    // interpolate in vertical direction
+    for (unsigned int j = 0; j < verticalRangeCount; ++j)
     {
-      vb = (verticalRangeCount == 1) ? 0 :
+      double vb = (verticalRangeCount == 1) ? 0 :
           static_cast<double>(j * (verticalRayCount - 1))
           / (verticalRangeCount - 1);
-      vja = static_cast<int>(floor(vb));
-      vjb = std::min(vja + 1, verticalRayCount - 1);
+      unsigned int vja = static_cast<unsigned int>(floor(vb));
+      unsigned int vjb = std::min(vja + 1, verticalRayCount - 1);
       vb = vb - floor(vb);
 
       GZ_ASSERT(vja < verticalRayCount,
           "Invalid vertical ray index used for interpolation");
       GZ_ASSERT(vjb < verticalRayCount,
           "Invalid vertical ray index used for interpolation");
-    }
-    // interpolate in horizontal direction
-    for (unsigned int i = 0; i < rangeCount; ++i)
-    {
-      double range, intensity;
-      if (interp)
-      {
-        hb = (rangeCount == 1)? 0 : static_cast<double>(i * (rayCount - 1))
-            / (rangeCount - 1);
-        hja = static_cast<int>(floor(hb));
-        hjb = std::min(hja + 1, rayCount - 1);
-        hb = hb - floor(hb);
-
-        GZ_ASSERT(hja < rayCount,
-            "Invalid horizontal ray index used for interpolation");
-        GZ_ASSERT(hjb < rayCount,
-            "Invalid horizontal ray index used for interpolation");
-
-        // indices of 4 corners
-        j1 = hja + vja * rayCount;
-        j2 = hjb + vja * rayCount;
-        j3 = hja + vjb * rayCount;
-        j4 = hjb + vjb * rayCount;
 
-        // range readings of 4 corners
-        r1 = this->LaserShape()->GetRange(j1);
-        r2 = this->LaserShape()->GetRange(j2);
-        r3 = this->LaserShape()->GetRange(j3);
-        r4 = this->LaserShape()->GetRange(j4);
-        range = (1-vb)*((1 - hb) * r1 + hb * r2)
-            + vb *((1 - hb) * r3 + hb * r4);
+      // rows of ray samples above and below, and row of range samples
+      const double *rangeA = rayRanges.data() + vja * rayCount;
+      const double *rangeB = rayRanges.data() + vjb * rayCount;
+      const double *retroA = rayRetros.data() + vja * rayCount;
+      const double *retroB = rayRetros.data() + vjb * rayCount;
+      double *rangeRow = ranges.data() + j * rangeCount;
+      double *intensityRow = intensities.data() + j * rangeCount;
+
+      // interpolate in horizontal direction. The iterations are independent
+      // of each other, so that the compiler can vectorize the loop.
+      for (unsigned int i = 0; i < rangeCount; ++i)
+      {
+        const unsigned int a = hja[i];
+        const unsigned int b = hjb[i];
+        const double w = hb[i];
+        rangeRow[i] = (1 - vb) * ((1 - w) * rangeA[a] + w * rangeA[b])
+            + vb * ((1 - w) * rangeB[a] + w * rangeB[b]);
 
         // intensity is averaged
-        intensity = 0.25 * (this->LaserShape()->GetRetro(j1)
-            + this->LaserShape()->GetRetro(j2)
-            + this->LaserShape()->GetRetro(j3)
-            + this->LaserShape()->GetRetro(j4));
-      }
-      else
-      {
-        range = this->dataPtr->laserShape->GetRange(j * this->RayCount() + i);
-        intensity = this->dataPtr->laserShape->GetRetro(j *
-            this->RayCount() + i);
+        intensityRow[i] = 0.25 *
+            (retroA[a] + retroA[b] + retroB[a] + retroB[b]);
       }
+    }
+  }
 
-      // Mask ranges outside of min/max to +/- inf, as per REP 117
-      if (range >= this->RangeMax())
-      {
-        range = ignition::math::INF_D;
-      }
-      else if (range <= this->RangeMin())
-      {
-        range = -ignition::math::INF_D;
-      }
-      else if (this->noises.find(RAY_NOISE) !=
-               this->noises.end())
-      {
-        // currently supports only one noise model per laser sensor
-        range = this->noises[RAY_NOISE]->Apply(range);
-        range = ignition::math::clamp(range,
-            this->RangeMin(), this->RangeMax());
-      }
+  // currently supports only one noise model per laser sensor
+  auto noiseIter = this->noises.find(RAY_NOISE);
+  NoisePtr noise = noiseIter != this->noises.end() ? noiseIter->second :
+      NoisePtr();
+  std::vector<double> &noisyRanges = this->dataPtr->noisyRanges;
+  std::vector<int> &noisyIndices = this->dataPtr->noisyIndices;
+  noisyRanges.clear();
+  noisyIndices.clear();
+
+  // Mask ranges outside of min/max to +/- inf, as per REP 117
+  const double rangeMin = this->RangeMin();
+  const double rangeMax = this->RangeMax();
+  for (size_t k = 0; k < count; ++k)
+  {
+    if (ranges[k] >= rangeMax)
+    {
+      ranges[k] = ignition::math::INF_D;
+    }
+    else if (ranges[k] <= rangeMin)
+    {
+      ranges[k] = -ignition::math::INF_D;
+    }
+    else if (noise)
+    {
+      noisyIndices.push_back(static_cast<int>(k));
+      noisyRanges.push_back(ranges[k]);
+    }
+  }
 
-      scan->add_ranges(range);
-      scan->add_intensities(intensity);
+  // Apply the noise to all the ranges within the limits at once
+  if (!noisyRanges.empty())
+  {
+    noise->Apply(noisyRanges.data(), noisyRanges.size());
+    for (size_t k = 0; k < noisyRanges.size(); ++k)
+    {
+      ranges[noisyIndices[k]] =
+          ignition::math::clamp(noisyRanges[k], rangeMin, rangeMax);
     }
   }
+
+  // Fill the message with one copy per field
+  scan->mutable_ranges()->Resize(static_cast<int>(count), 0.0);
+  std::copy(ranges.begin(), ranges.end(),
+      scan->mutable_ranges()->mutable_data());
+  scan->mutable_intensities()->Resize(static_cast<int>(count), 0.0);
+  std::copy(intensities.begin(), intensities.end(),
+      scan->mutable_intensities()->mutable_data());
   IGN_PROFILE_END();
 
   IGN_PROFILE_BEGIN("Publish");
@@ -507,6 +547,12 @@ bool RaySensor::UpdateImpl(const bool /*_force*/)
     this->dataPtr->scanPub->Publish(this->dataPtr->laserMsg);
   IGN_PROFILE_END();
 
+  // The buffers are only written by this function, so the subscribers can
+  // read them without holding the lock, and call the accessors.
+  lock.unlock();
+  this->dataPtr->newScan(ranges.data(), intensities.data(), rangeCount,
+      verticalRangeCount);
+
   return true;
 }
 
@@ -517,6 +563,14 @@ bool RaySensor::IsActive() const
     (this->dataPtr->scanPub && this->dataPtr->scanPub->HasConnections());
 }
 
+//////////////////////////////////////////////////
+event::ConnectionPtr RaySensor::ConnectNewLaserScan(
+    std::function<void(const double *, const double *, unsigned int,
+    unsigned int)> _subscriber)
+{
+  return this->dataPtr->newScan.Connect(_subscriber);
+}
+
 //////////////////////////////////////////////////
 physics::MultiRayShapePtr RaySensor::LaserShape() const
 {
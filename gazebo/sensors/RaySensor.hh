@@ -17,6 +17,7 @@
 #ifndef _GAZEBO_SENSORS_RAYSENSOR_HH_
 #define _GAZEBO_SENSORS_RAYSENSOR_HH_
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -160,6 +161,18 @@ namespace gazebo
       /// \return Fiducial value
       public: int Fiducial(const unsigned int _index) const;
 
+      /// \brief Connect to the new laser scan event. The callback receives
+      /// the ranges and intensities of the scan in contiguous buffers, row
+      /// by row, without going through a message. The buffers are only
+      /// valid during the callback.
+      /// \param[in] _subscriber Callback that receives the ranges, the
+      /// intensities, the number of ranges per row and the number of rows.
+      /// \return A pointer to the connection. This must be kept in scope.
+      public: event::ConnectionPtr ConnectNewLaserScan(
+                  std::function<void(const double *_ranges,
+                  const double *_intensities, unsigned int _rangeCount,
+                  unsigned int _verticalRangeCount)> _subscriber);
+
       /// \brief Returns a pointer to the internal physics::MultiRayShape
       /// \return Pointer to ray shape
       public: physics::MultiRayShapePtr LaserShape() const;
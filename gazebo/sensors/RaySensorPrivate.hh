@@ -18,7 +18,9 @@
 #define _GAZEBO_SENSORS_RAYSENSOR_PRIVATE_HH_
 
 #include <mutex>
+#include <vector>
 
+#include "gazebo/common/Event.hh"
 #include "gazebo/msgs/msgs.hh"
 #include "gazebo/physics/PhysicsTypes.hh"
 #include "gazebo/transport/TransportTypes.hh"
@@ -48,6 +50,44 @@ namespace gazebo
 
       /// \brief Laser message.
       public: msgs::LaserScanStamped laserMsg;
+
+      /// \brief Range of every ray of the last update, in ray order.
+      public: std::vector<double> rayRanges;
+
+      /// \brief Retro value of every ray of the last update, in ray order.
+      public: std::vector<double> rayRetros;
+
+      /// \brief Index of the previous ray of every horizontal range sample,
+      /// used to interpolate between rays.
+      public: std::vector<unsigned int> horizontalPrev;
+
+      /// \brief Index of the next ray of every horizontal range sample.
+      public: std::vector<unsigned int> horizontalNext;
+
+      /// \brief Interpolation weight of the next ray of every horizontal
+      /// range sample.
+      public: std::vector<double> horizontalWeight;
+
+      /// \brief Ray count the horizontal interpolation tables were built
+      /// for. The tables are rebuilt when it or the range count changes.
+      public: unsigned int horizontalRayCount = 0;
+
+      /// \brief Ranges of the last scan, row by row.
+      public: std::vector<double> ranges;
+
+      /// \brief Intensities of the last scan, row by row.
+      public: std::vector<double> intensities;
+
+      /// \brief Event triggered when a new scan is available.
+      public: event::EventT<void(const double *, const double *,
+                  unsigned int, unsigned int)> newScan;
+
+      /// \brief Ranges within the range limits, to which the noise is
+      /// applied at once after the scan is filled.
+      public: std::vector<double> noisyRanges;
+
+      /// \brief Index in the scan of each of the noisyRanges.
+      public: std::vector<int> noisyIndices;
     };
   }
 }
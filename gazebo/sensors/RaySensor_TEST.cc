@@ -180,6 +180,21 @@ TEST_F(RaySensor_TEST, LaserScanResolution)
 
   EXPECT_TRUE(sensor->IsActive());
 
+  // Receive the scan buffers directly
+  std::vector<double> scanRanges;
+  std::vector<double> scanIntensities;
+  unsigned int scanWidth = 0;
+  unsigned int scanHeight = 0;
+  event::ConnectionPtr connection = sensor->ConnectNewLaserScan(
+      [&](const double *_ranges, const double *_intensities,
+          unsigned int _width, unsigned int _height)
+      {
+        scanRanges.assign(_ranges, _ranges + _width * _height);
+        scanIntensities.assign(_intensities, _intensities + _width * _height);
+        scanWidth = _width;
+        scanHeight = _height;
+      });
+
   // Update the sensor
   sensor->Update(true);
 
@@ -188,6 +203,14 @@ TEST_F(RaySensor_TEST, LaserScanResolution)
   sensor->Ranges(ranges);
   EXPECT_EQ(ranges.size(), static_cast<size_t>(240 * 6));
 
+  // The buffers hold the same scan as the accessors
+  EXPECT_EQ(240u, scanWidth);
+  EXPECT_EQ(6u, scanHeight);
+  EXPECT_EQ(ranges, scanRanges);
+  ASSERT_EQ(ranges.size(), scanIntensities.size());
+  for (unsigned int i = 0; i < scanIntensities.size(); ++i)
+    EXPECT_DOUBLE_EQ(sensor->Retro(i), scanIntensities[i]);
+
   // Check that all the range values
   for (unsigned int i = 0; i < ranges.size(); ++i)
   {
@@ -15,6 +15,7 @@
  *
 */
 #include "ignition/common/Profiler.hh"
+#include "ignition/math/Rand.hh"
 
 #include "gazebo/transport/transport.hh"
 
@@ -28,6 +29,7 @@
 #include "gazebo/common/Console.hh"
 #include "gazebo/common/Exception.hh"
 #include "gazebo/common/Plugin.hh"
+#include "gazebo/common/ScopeProfiler.hh"
 #include "gazebo/common/SdfFrameSemantics.hh"
 
 #include "gazebo/rendering/Camera.hh"
@@ -51,7 +53,7 @@ bool Sensor::useStrictRate = false;
 
 //////////////////////////////////////////////////
 Sensor::Sensor(SensorCategory _cat)
-: dataPtr(new SensorPrivate)
+: updated("sensorUpdated"), dataPtr(new SensorPrivate)
 {
   if (!this->dataPtr->sdfSensor)
   {
@@ -162,6 +164,21 @@ void Sensor::Init()
 {
   this->SetUpdateRate(this->sdf->Get<double>("update_rate"));
 
+  this->dataPtr->profileScope = common::ScopeProfiler::RegisterScope(
+      "Sensor::Update::" + this->ScopedName());
+
+  // Give every noise model its own random stream derived from the world
+  // seed, so that the noise doesn't depend on the order in which sensors
+  // update, or on the thread they update on.
+  for (auto &noise : this->noises)
+  {
+    if (noise.second)
+    {
+      noise.second->SetSeed(Noise::StreamSeed(ignition::math::Rand::Seed(),
+          this->ScopedName() + "::" + std::to_string(noise.first)));
+    }
+  }
+
   // Load the plugins
   if (this->sdf->HasElement("plugin"))
   {
@@ -238,6 +255,7 @@ void Sensor::Update(const bool _force)
   {
     if (this->useStrictRate)
     {
+      common::ProfileScope scope(this->dataPtr->profileScope);
       if (this->UpdateImpl(_force))
         this->updated();
     }
@@ -276,6 +294,7 @@ void Sensor::Update(const bool _force)
           this->dataPtr->updateDelay = common::Time::Zero;
       }
 
+      common::ProfileScope scope(this->dataPtr->profileScope);
       if (this->UpdateImpl(_force))
       {
         std::lock_guard<std::mutex> lock(this->dataPtr->mutexLastUpdateTime);
@@ -343,6 +362,9 @@ void Sensor::LoadPlugin(sdf::ElementPtr _sdf)
       return;
     }
 
+    // Attribute the event callbacks of the plugin to it
+    event::ConnectionOwner owner(filename, this->ScopedName() + "::" + name);
+
     SensorPtr myself = shared_from_this();
     plugin->Load(myself, _sdf);
     plugin->Init();
@@ -256,7 +256,8 @@ namespace gazebo
       /// \brief Noise added to sensor data
       protected: std::map<SensorNoiseType, NoisePtr> noises;
 
-      /// \brief Event triggered when a sensor is updated.
+      /// \brief Event triggered when a sensor is updated. Plugin callbacks
+      /// are profiled under the event name "sensorUpdated".
       protected: event::EventT<void()> updated;
 
       /// \brief Ignition transport node
@@ -26,6 +26,8 @@
 #include "gazebo/physics/World.hh"
 #include "gazebo/rendering/Camera.hh"
 #include "gazebo/sensors/CameraSensor.hh"
+#include "gazebo/sensors/DepthCameraSensor.hh"
+#include "gazebo/sensors/MultiCameraSensor.hh"
 #include "gazebo/sensors/Sensor.hh"
 #include "gazebo/sensors/SensorFactory.hh"
 #include "gazebo/sensors/SensorManager.hh"
@@ -68,6 +70,14 @@ struct sensorPerformanceMetricsType
   /// window size, whereas the sensorSimUpdateRate stores the instantaneous
   /// update rate and it is filled by all sensors.
   double sensorAvgFPS;
+
+  /// \brief Number of bytes a sensor that reads frames back from the GPU
+  /// copied for its last frame, or -1 for other sensors.
+  int64_t sensorBytesCopied = -1;
+
+  /// \brief Number of messages the publishers of a sensor dropped because
+  /// of their quality of service, or -1 for sensors that do not report it.
+  int64_t sensorDroppedMessages = -1;
 };
 
 /// \brief A map of sensor name to its performance metrics data
@@ -261,10 +271,33 @@ void PublishPerformanceMetrics()
               {
                 ret2.first->second.sensorAvgFPS =
                     cameraSensor->Camera()->AvgFPS();
+                ret2.first->second.sensorDroppedMessages =
+                    cameraSensor->DroppedMessageCount();
               }
               else
               {
                 ret2.first->second.sensorAvgFPS = -1;
+                ret2.first->second.sensorDroppedMessages = -1;
+              }
+
+              sensors::MultiCameraSensorPtr multiCameraSensor =
+                std::dynamic_pointer_cast<sensors::MultiCameraSensor>(sensor);
+              if (nullptr != multiCameraSensor)
+              {
+                ret2.first->second.sensorDroppedMessages =
+                    multiCameraSensor->DroppedMessageCount();
+              }
+
+              sensors::DepthCameraSensorPtr depthSensor =
+                std::dynamic_pointer_cast<sensors::DepthCameraSensor>(sensor);
+              if (nullptr != depthSensor)
+              {
+                ret2.first->second.sensorBytesCopied =
+                    depthSensor->BytesCopiedPerFrame();
+              }
+              else
+              {
+                ret2.first->second.sensorBytesCopied = -1;
               }
             }
           }
@@ -287,6 +320,16 @@ void PublishPerformanceMetrics()
       performanceSensorMetricsMsg->set_fps(
         sensorPerformanceMetric.second.sensorAvgFPS);
     }
+    if (sensorPerformanceMetric.second.sensorBytesCopied >= 0)
+    {
+      performanceSensorMetricsMsg->set_bytes_copied_per_frame(
+        sensorPerformanceMetric.second.sensorBytesCopied);
+    }
+    if (sensorPerformanceMetric.second.sensorDroppedMessages >= 0)
+    {
+      performanceSensorMetricsMsg->set_dropped_messages(
+        sensorPerformanceMetric.second.sensorDroppedMessages);
+    }
   }
 
   // Publish data
@@ -145,6 +145,8 @@ void WideAngleCameraSensor::Load(const std::string &_worldName)
   CameraSensor::Load(_worldName);
   this->imagePub = this->node->Advertise<msgs::ImageStamped>(
       this->Topic(), 50);
+  // Slow subscribers only get the newest image, stale ones are dropped
+  this->imagePub->SetQoS(transport::QoS::LatestOnly());
 
   std::string lensTopicName = "~/";
   lensTopicName += this->ParentName() + "/" + this->Name() + "/lens/";
@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#ifndef _HELPER_PROFILER_HH_
+#define _HELPER_PROFILER_HH_
+
+#include <string>
+
+#include "gazebo/common/ScopeProfiler.hh"
+
+namespace gazebo
+{
+  namespace testing
+  {
+    /// \brief Find the statistics of a scope collected by the built-in
+    /// profiler.
+    /// \param[in] _name Name of the scope.
+    /// \return Statistics of the scope, with a zero count if the scope
+    /// was not collected.
+    inline common::ProfileStats FindProfileStats(const std::string &_name)
+    {
+      for (auto const &stats : common::ScopeProfiler::Stats())
+      {
+        if (stats.name == _name)
+          return stats;
+      }
+      return common::ProfileStats();
+    }
+  }
+}
+#endif
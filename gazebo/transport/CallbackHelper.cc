@@ -39,6 +39,18 @@ std::string CallbackHelper::GetMsgType() const
   return std::string();
 }
 
+/////////////////////////////////////////////////
+MessagePtr CallbackHelper::Parse(const std::string &/*_data*/) const
+{
+  return MessagePtr();
+}
+
+/////////////////////////////////////////////////
+bool CallbackHelper::Accepts(const MessagePtr &/*_msg*/) const
+{
+  return false;
+}
+
 /////////////////////////////////////////////////
 bool CallbackHelper::GetLatching() const
 {
@@ -58,3 +70,75 @@ unsigned int CallbackHelper::GetId() const
 {
   return this->id;
 }
+
+/////////////////////////////////////////////////
+QoS CallbackHelper::GetQoS() const
+{
+  std::lock_guard<std::mutex> lock(this->latchingMutex);
+  return this->qos;
+}
+
+/////////////////////////////////////////////////
+void CallbackHelper::SetQoS(const QoS &_qos)
+{
+  std::lock_guard<std::mutex> lock(this->latchingMutex);
+  this->qos = _qos;
+}
+
+/////////////////////////////////////////////////
+uint64_t CallbackHelper::DroppedCount() const
+{
+  std::lock_guard<std::mutex> lock(this->latchingMutex);
+  return this->droppedCount;
+}
+
+/////////////////////////////////////////////////
+void CallbackHelper::AddDropped(const uint64_t _count)
+{
+  std::lock_guard<std::mutex> lock(this->latchingMutex);
+  this->droppedCount += _count;
+}
+
+/////////////////////////////////////////////////
+IncomingMsg::IncomingMsg(const std::string &_data)
+  : data(_data)
+{
+}
+
+/////////////////////////////////////////////////
+const std::string &IncomingMsg::Data() const
+{
+  return this->data;
+}
+
+/////////////////////////////////////////////////
+bool IncomingMsg::Dispatch(CallbackHelper &_helper,
+    boost::function<void(uint32_t)> _cb, uint32_t _id)
+{
+  MessagePtr parsed;
+  {
+    std::lock_guard<std::mutex> lock(this->mutex);
+    if (this->msg && _helper.Accepts(this->msg))
+    {
+      parsed = this->msg;
+    }
+    else
+    {
+      parsed = _helper.Parse(this->data);
+
+      // Keep the first decoded message. A callback subscribed with a
+      // different message type gets its own copy.
+      if (parsed && !this->msg)
+        this->msg = parsed;
+    }
+  }
+
+  // Raw callbacks
+  if (!parsed)
+    return _helper.HandleData(this->data, _cb, _id);
+
+  bool result = _helper.HandleMessage(parsed);
+  if (!_cb.empty())
+    _cb(_id);
+  return result;
+}
@@ -29,6 +29,7 @@
 #include "gazebo/msgs/msgs.hh"
 #include "gazebo/common/Exception.hh"
 
+#include "gazebo/transport/QoS.hh"
 #include "gazebo/transport/TransportTypes.hh"
 #include "gazebo/util/system.hh"
 
@@ -69,6 +70,19 @@ namespace gazebo
       /// \return true if successfully processed; false otherwise
       public: virtual bool HandleMessage(MessagePtr _newMsg) = 0;
 
+      /// \brief Decode serialized data into the message type handled by
+      /// this callback.
+      /// \param[in] _data Serialized message.
+      /// \return The new message, or nullptr if the callback takes the
+      /// serialized data as is.
+      public: virtual MessagePtr Parse(const std::string &_data) const;
+
+      /// \brief Check whether a decoded message can be passed to
+      /// HandleMessage.
+      /// \param[in] _msg Decoded message.
+      /// \return True if _msg has the message type of this callback.
+      public: virtual bool Accepts(const MessagePtr &_msg) const;
+
       /// \brief Is the callback local?
       /// \return true if the callback is local, false if the callback
       ///         is tied to a remote connection
@@ -87,13 +101,39 @@ namespace gazebo
       /// \return The unique ID of this callback.
       public: unsigned int GetId() const;
 
+      /// \brief Get the quality of service of this callback.
+      /// \return Which incoming messages are delivered when the callback
+      /// falls behind.
+      public: QoS GetQoS() const;
+
+      /// \brief Set the quality of service of this callback.
+      /// \param[in] _qos Which incoming messages to deliver when the
+      /// callback falls behind.
+      public: void SetQoS(const QoS &_qos);
+
+      /// \brief Get the number of incoming messages that were dropped
+      /// because of the quality of service.
+      /// \return Number of dropped messages.
+      public: uint64_t DroppedCount() const;
+
+      /// \brief Count incoming messages that were dropped.
+      /// \param[in] _count Number of dropped messages.
+      public: void AddDropped(const uint64_t _count);
+
       /// \brief True means that the callback helper will get the last
       /// published message on the topic.
       protected: bool latching;
 
-      /// \brief Mutex to protect the latching variable.
+      /// \brief Mutex to protect the latching, qos and droppedCount
+      /// variables.
       protected: mutable std::mutex latchingMutex;
 
+      /// \brief Quality of service, protected by latchingMutex.
+      private: QoS qos;
+
+      /// \brief Number of dropped messages, protected by latchingMutex.
+      private: uint64_t droppedCount = 0;
+
       /// \brief A counter to generate the unique id of this callback.
       private: static unsigned int idCounter;
 
@@ -160,6 +200,20 @@ namespace gazebo
                 return true;
               }
 
+      // documentation inherited
+      public: virtual MessagePtr Parse(const std::string &_data) const
+              {
+                boost::shared_ptr<M> m(new M);
+                m->ParseFromString(_data);
+                return m;
+              }
+
+      // documentation inherited
+      public: virtual bool Accepts(const MessagePtr &_msg) const
+              {
+                return dynamic_cast<const M *>(_msg.get()) != nullptr;
+              }
+
       // documentation inherited
       public: virtual bool IsLocal() const
               {
@@ -223,6 +277,44 @@ namespace gazebo
 
       private: boost::function<void (const std::string &)> callback;
     };
+
+    /// \class IncomingMsg CallbackHelper.hh transport/transport.hh
+    /// \brief Serialized message received on a topic, shared by all the
+    /// callbacks that subscribe to the topic in this process. The message
+    /// is decoded at most once, by the first callback that needs it, and
+    /// the decoded message is handed to every callback of the same type.
+    class GZ_TRANSPORT_VISIBLE IncomingMsg
+    {
+      /// \brief Constructor
+      /// \param[in] _data Serialized message.
+      public: explicit IncomingMsg(const std::string &_data);
+
+      /// \brief Get the serialized message.
+      /// \return The serialized message.
+      public: const std::string &Data() const;
+
+      /// \brief Pass the message to a callback, decoding it if needed.
+      /// \param[in] _helper Callback to pass the message to.
+      /// \param[in] _cb If non-null, callback to be invoked which signals
+      /// that transmission is complete.
+      /// \param[in] _id ID associated with the message data.
+      /// \return The value returned by the callback helper.
+      public: bool Dispatch(CallbackHelper &_helper,
+                  boost::function<void(uint32_t)> _cb, uint32_t _id);
+
+      /// \brief Serialized message.
+      private: const std::string data;
+
+      /// \brief Decoded message, null until a typed callback needs it.
+      private: MessagePtr msg;
+
+      /// \brief Protects msg. Publications and nodes dispatch the same
+      /// message from different threads.
+      private: std::mutex mutex;
+    };
+
+    /// \brief boost shared pointer to transport::IncomingMsg
+    typedef boost::shared_ptr<IncomingMsg> IncomingMsgPtr;
     /// \}
   }
 }
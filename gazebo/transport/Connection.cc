@@ -94,6 +94,7 @@ Connection::Connection()
     iomanager = new IOManager();
 
   this->socket = new boost::asio::ip::tcp::socket(iomanager->GetIO());
+  this->strand = new boost::asio::io_service::strand(iomanager->GetIO());
 
   iomanager->IncCount();
   this->id = idCounter++;
@@ -126,6 +127,9 @@ Connection::~Connection()
 {
   this->Shutdown();
 
+  delete this->strand;
+  this->strand = NULL;
+
   if (iomanager)
   {
     iomanager->DecCount();
@@ -186,8 +190,9 @@ bool Connection::Connect(const std::string &_host, unsigned int _port)
   // Use async connect so that we can use a custom timeout. This is useful
   // when trying to detect network errors.
   this->socket->async_connect(*endpointIter++,
-      common::weakBind(&Connection::OnConnect, this->shared_from_this(),
-        boost::asio::placeholders::error, endpointIter));
+      this->strand->wrap(common::weakBind(&Connection::OnConnect,
+        this->shared_from_this(), boost::asio::placeholders::error,
+        endpointIter)));
 
   // Wait for at most 60 seconds for a connection to be established.
   // The connectionCondition notification occurs in ::OnConnect.
@@ -233,8 +238,8 @@ void Connection::Listen(unsigned int port, const AcceptCallback &_acceptCB)
   this->acceptConn = ConnectionPtr(new Connection());
 
   this->acceptor->async_accept(*this->acceptConn->socket,
-      common::weakBind(&Connection::OnAccept, this->shared_from_this(),
-                  boost::asio::placeholders::error));
+      this->strand->wrap(common::weakBind(&Connection::OnAccept,
+        this->shared_from_this(), boost::asio::placeholders::error)));
 }
 
 //////////////////////////////////////////////////
@@ -262,8 +267,8 @@ void Connection::OnAccept(const boost::system::error_code &e)
     this->acceptConn = ConnectionPtr(new Connection());
 
     this->acceptor->async_accept(*this->acceptConn->socket,
-        common::weakBind(&Connection::OnAccept, this->shared_from_this(),
-          boost::asio::placeholders::error));
+        this->strand->wrap(common::weakBind(&Connection::OnAccept,
+          this->shared_from_this(), boost::asio::placeholders::error)));
   }
   else
   {
@@ -363,8 +368,8 @@ void Connection::ProcessWriteQueue(bool _blocking)
     boost::asio::async_write(*this->socket,
         boost::asio::buffer(this->writeQueue.front().c_str(),
           this->writeQueue.front().size()),
-          common::weakBind(&Connection::OnWrite, this->shared_from_this(),
-            boost::asio::placeholders::error));
+          this->strand->wrap(common::weakBind(&Connection::OnWrite,
+            this->shared_from_this(), boost::asio::placeholders::error)));
   }
   else
   {
@@ -383,6 +388,14 @@ void Connection::ProcessWriteQueue(bool _blocking)
   }
 }
 
+//////////////////////////////////////////////////
+std::vector<double> Connection::IOThreadUtilization()
+{
+  if (!iomanager)
+    return std::vector<double>();
+  return iomanager->ThreadUtilization();
+}
+
 //////////////////////////////////////////////////
 std::string Connection::GetLocalURI() const
 {
@@ -419,6 +432,11 @@ void Connection::OnWrite(const boost::system::error_code &_e)
     boost::recursive_mutex::scoped_lock lock(this->writeMutex);
 
     this->PostWrite();
+
+    // Flush the messages queued during the write right away, instead of
+    // waiting for the next connection manager update.
+    if (!_e)
+      this->ProcessWriteQueue();
   }
 
   if (_e)
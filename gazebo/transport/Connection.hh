@@ -225,6 +225,13 @@ namespace gazebo
       /// \return The local hostname
       public: static std::string GetLocalHostname();
 
+      /// \brief Get the utilization of the threads that run the handlers
+      /// of all connections.
+      /// \return One value in [0, 1] per IO thread, empty if there is no
+      /// connection.
+      /// \sa IOManager::ThreadUtilization
+      public: static std::vector<double> IOThreadUtilization();
+
       /// \brief Peform an asyncronous read
       /// param[in] _handler Callback to invoke on received data
       public: template<typename Handler>
@@ -243,9 +250,10 @@ namespace gazebo
                 this->inboundHeader.resize(HEADER_LENGTH);
                 boost::asio::async_read(*this->socket,
                     boost::asio::buffer(this->inboundHeader),
-                    common::weakBind(f, this->shared_from_this(),
-                                boost::asio::placeholders::error,
-                                boost::make_tuple(_handler)));
+                    this->strand->wrap(
+                      common::weakBind(f, this->shared_from_this(),
+                                  boost::asio::placeholders::error,
+                                  boost::make_tuple(_handler))));
               }
 
       /// \brief Handle a completed read of a message header.
@@ -284,9 +292,10 @@ namespace gazebo
 
                     boost::asio::async_read(*this->socket,
                         boost::asio::buffer(this->inboundData),
-                        common::weakBind(f, this->shared_from_this(),
-                                    boost::asio::placeholders::error,
-                                    _handler));
+                        this->strand->wrap(
+                          common::weakBind(f, this->shared_from_this(),
+                                      boost::asio::placeholders::error,
+                                      _handler)));
                   }
                   else
                   {
@@ -468,6 +477,10 @@ namespace gazebo
       /// \brief Pointer to the IO manager
       private: static IOManager *iomanager;
 
+      /// \brief Strand that runs the asio handlers of this connection, so
+      /// that they never run concurrently on the IO threads.
+      private: boost::asio::io_service::strand *strand;
+
       /// \brief Number of writes that are being processed.
       private: unsigned int writeCount;
 
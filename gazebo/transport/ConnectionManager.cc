@@ -257,6 +257,7 @@ void ConnectionManager::Fini()
 void ConnectionManager::Stop()
 {
   this->stop = true;
+  this->updateCondition.notify_all();
 }
 
 //////////////////////////////////////////////////
@@ -307,15 +308,25 @@ void ConnectionManager::RunUpdate()
 //////////////////////////////////////////////////
 void ConnectionManager::Run()
 {
-  boost::mutex::scoped_lock lock(this->updateMutex);
-
   this->stopped = false;
 
   while (!this->stop && this->masterConn && this->masterConn->IsOpen())
   {
+    {
+      boost::mutex::scoped_lock lock(this->updateMutex);
+      this->updatePending = false;
+    }
+
+    // The mutex is not held here, so that publishers and connections can
+    // request another update while this one runs.
     this->RunUpdate();
+
+    // Sleep until an update is requested. The timeout only serves to
+    // prune closed connections when nothing is published.
+    boost::mutex::scoped_lock lock(this->updateMutex);
     this->updateCondition.timed_wait(lock,
-       boost::posix_time::milliseconds(100));
+        boost::posix_time::milliseconds(100),
+        [this] {return this->updatePending || this->stop;});
   }
   this->RunUpdate();
 
@@ -333,6 +344,7 @@ bool ConnectionManager::IsRunning() const
 //////////////////////////////////////////////////
 void ConnectionManager::OnMasterRead(const std::string &_data)
 {
+  boost::recursive_mutex::scoped_lock handlerLock(this->handlerMutex);
   using namespace boost::placeholders;
   if (this->masterConn && this->masterConn->IsOpen())
     this->masterConn->AsyncRead(
@@ -460,6 +472,7 @@ void ConnectionManager::ProcessMessage(const std::string &_data)
 //////////////////////////////////////////////////
 void ConnectionManager::OnAccept(ConnectionPtr _newConnection)
 {
+  boost::recursive_mutex::scoped_lock handlerLock(this->handlerMutex);
   using namespace boost::placeholders;
   _newConnection->AsyncRead(
       boost::bind(&ConnectionManager::OnRead, this, _newConnection, _1));
@@ -473,6 +486,7 @@ void ConnectionManager::OnAccept(ConnectionPtr _newConnection)
 void ConnectionManager::OnRead(ConnectionPtr _connection,
                                const std::string &_data)
 {
+  boost::recursive_mutex::scoped_lock handlerLock(this->handlerMutex);
   if (_data.empty())
   {
     gzerr << "Data was empty, try again\n";
@@ -710,5 +724,9 @@ ConnectionPtr ConnectionManager::FindConnection(const std::string &_host,
 //////////////////////////////////////////////////
 void ConnectionManager::TriggerUpdate()
 {
+  {
+    boost::mutex::scoped_lock lock(this->updateMutex);
+    this->updatePending = true;
+  }
   this->updateCondition.notify_all();
 }
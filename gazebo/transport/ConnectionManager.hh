@@ -143,6 +143,8 @@ namespace gazebo
                                                   unsigned int _port);
 
       /// \brief Inform the connection manager that it needs an update.
+      /// The update loop wakes up immediately, and a request made while an
+      /// update is running triggers another update right after it.
       public: void TriggerUpdate();
 
       /// \brief Callback function called when we have read data from the
@@ -173,6 +175,15 @@ namespace gazebo
       /// \brief Mutex for updateCondition
       private: boost::mutex updateMutex;
 
+      /// \brief True when TriggerUpdate was called since the last update
+      /// started. Protected by updateMutex.
+      private: bool updatePending = false;
+
+      /// \brief Serializes OnMasterRead, OnAccept and OnRead. The IO
+      /// threads run the handlers of different connections concurrently,
+      /// while these handlers were written for a single IO thread.
+      private: boost::recursive_mutex handlerMutex;
+
       private: ConnectionPtr masterConn;
       private: ConnectionPtr serverConn;
 
@@ -14,11 +14,19 @@
  * limitations under the License.
  *
 */
+#include <time.h>
+
+#include <algorithm>
 #include <atomic>
 #include <boost/bind/bind.hpp>
 #include <boost/thread/thread.hpp>
+#include <chrono>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
 #include "gazebo/transport/IOManager.hh"
+#include "gazebo/transport/TransportIface.hh"
 
 namespace gazebo
 {
@@ -27,6 +35,10 @@ namespace transport
 /////////////////////////////////////////////////
 class IOManagerPrivate
 {
+  /// \brief Run handlers of the IO service until it is stopped.
+  /// \param[in] _index Index of the calling thread.
+  public: void Run(const unsigned int _index);
+
   /// \brief IO service.
   public: boost::asio::io_service *io_service = nullptr;
 
@@ -36,10 +48,41 @@ class IOManagerPrivate
   /// \brief Reference count of connections using this IOManager.
   public: std::atomic_int count;
 
-  /// \brief Thread for IOManager.
-  public: boost::thread *thread = nullptr;
+  /// \brief Threads for IOManager.
+  public: std::vector<boost::thread *> threads;
+
+  /// \brief CPU time used by each thread, in nanoseconds.
+  public: std::unique_ptr<std::atomic<uint64_t>[]> busyTimes;
+
+  /// \brief CPU time of each thread at the previous utilization query.
+  public: std::vector<uint64_t> lastBusyTimes;
+
+  /// \brief Wall time of the previous utilization query.
+  public: std::chrono::steady_clock::time_point lastQueryTime;
+
+  /// \brief Protects lastBusyTimes and lastQueryTime.
+  public: std::mutex utilizationMutex;
 };
 
+/////////////////////////////////////////////////
+void IOManagerPrivate::Run(const unsigned int _index)
+{
+  // run_one returns 0 once the io_service is stopped
+  while (this->io_service->run_one() > 0)
+  {
+#ifndef _WIN32
+    // The CPU clock of the thread does not advance while it waits for
+    // work, so it measures the time spent in handlers.
+    struct timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0)
+    {
+      this->busyTimes[_index] =
+          static_cast<uint64_t>(ts.tv_sec) * 1000000000u + ts.tv_nsec;
+    }
+#endif
+  }
+}
+
 /////////////////////////////////////////////////
 IOManager::IOManager()
   : dataPtr(new IOManagerPrivate)
@@ -48,8 +91,18 @@ IOManager::IOManager()
   this->dataPtr->work = new boost::asio::io_service::work(
       *this->dataPtr->io_service);
   this->dataPtr->count = 0;
-  this->dataPtr->thread = new boost::thread(boost::bind(
-      &boost::asio::io_service::run, this->dataPtr->io_service));
+
+  unsigned int threadCount = getIOThreads();
+  this->dataPtr->busyTimes.reset(new std::atomic<uint64_t>[threadCount]);
+  this->dataPtr->lastBusyTimes.resize(threadCount, 0);
+  this->dataPtr->lastQueryTime = std::chrono::steady_clock::now();
+
+  for (unsigned int i = 0; i < threadCount; ++i)
+  {
+    this->dataPtr->busyTimes[i] = 0;
+    this->dataPtr->threads.push_back(new boost::thread(boost::bind(
+        &IOManagerPrivate::Run, this->dataPtr, i)));
+  }
 }
 
 /////////////////////////////////////////////////
@@ -72,12 +125,12 @@ void IOManager::Stop()
 {
   this->dataPtr->io_service->reset();
   this->dataPtr->io_service->stop();
-  if (this->dataPtr->thread)
+  for (auto &thread : this->dataPtr->threads)
   {
-    this->dataPtr->thread->join();
-    delete this->dataPtr->thread;
-    this->dataPtr->thread = nullptr;
+    thread->join();
+    delete thread;
   }
+  this->dataPtr->threads.clear();
 }
 
 /////////////////////////////////////////////////
@@ -103,5 +156,34 @@ unsigned int IOManager::GetCount() const
 {
   return this->dataPtr->count;
 }
+
+/////////////////////////////////////////////////
+unsigned int IOManager::ThreadCount() const
+{
+  return this->dataPtr->lastBusyTimes.size();
+}
+
+/////////////////////////////////////////////////
+std::vector<double> IOManager::ThreadUtilization()
+{
+  std::vector<double> result;
+#ifndef _WIN32
+  std::lock_guard<std::mutex> lock(this->dataPtr->utilizationMutex);
+  auto now = std::chrono::steady_clock::now();
+  double elapsed = std::chrono::duration<double, std::nano>(
+      now - this->dataPtr->lastQueryTime).count();
+  this->dataPtr->lastQueryTime = now;
+
+  for (unsigned int i = 0; i < this->dataPtr->lastBusyTimes.size(); ++i)
+  {
+    uint64_t busy = this->dataPtr->busyTimes[i];
+    double used = static_cast<double>(
+        busy - this->dataPtr->lastBusyTimes[i]);
+    this->dataPtr->lastBusyTimes[i] = busy;
+    result.push_back(elapsed > 0 ? std::min(1.0, used / elapsed) : 0.0);
+  }
+#endif
+  return result;
+}
 }
 }
@@ -17,6 +17,7 @@
 #ifndef GAZEBO_TRANSPORT_IOMANAGER_HH_
 #define GAZEBO_TRANSPORT_IOMANAGER_HH_
 
+#include <vector>
 #include <boost/asio.hpp>
 #include "gazebo/util/system.hh"
 
@@ -32,6 +33,14 @@ namespace gazebo
 
     /// \class IOManager IOManager.hh transport/transport.hh
     /// \brief Manages boost::asio IO
+    ///
+    /// The IO service is run by a pool of threads. Handlers of a
+    /// connection must be wrapped in a strand of the IO service, so that
+    /// they never run concurrently. Handlers of different connections do
+    /// run concurrently: ConnectionManager serializes its own handlers,
+    /// and the message callbacks of publications lock their node and
+    /// callback lists, as they already did for publishers on other
+    /// threads.
     class GZ_TRANSPORT_VISIBLE IOManager
     {
       /// \brief Constructor
@@ -57,6 +66,20 @@ namespace gazebo
       /// \brief Stop the IO service
       public: void Stop();
 
+      /// \brief Get the number of threads that run the IO service. It is
+      /// set when the IOManager is created.
+      /// \return Number of IO threads.
+      /// \sa transport::setIOThreads
+      public: unsigned int ThreadCount() const;
+
+      /// \brief Get the fraction of time each IO thread spent running
+      /// handlers since the previous call, or since the IOManager was
+      /// created. Callers share the measurement window, so there should be
+      /// a single periodic caller, such as the world statistics.
+      /// \return One value in [0, 1] per IO thread. Empty on platforms
+      /// without per-thread CPU clocks.
+      public: std::vector<double> ThreadUtilization();
+
       /// \internal
       /// \brief Pointer to private data.
       private: IOManagerPrivate *dataPtr;
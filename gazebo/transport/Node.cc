@@ -16,6 +16,7 @@
 */
 #include <boost/algorithm/string.hpp>
 #include <boost/bind/bind.hpp>
+#include <vector>
 #include "gazebo/transport/TransportIface.hh"
 #include "gazebo/transport/Node.hh"
 
@@ -26,6 +27,24 @@ unsigned int Node::idCounter = 0;
 
 extern void dummy_callback_fn(uint32_t);
 
+/////////////////////////////////////////////////
+/// \brief Count the messages that the quality of service of each
+/// callback dropped during one update.
+/// \param[in] _callbacks Callbacks of a topic.
+/// \param[in] _dropped Dropped message count for each callback, in the
+/// same order as _callbacks.
+static void AddDropped(const std::list<CallbackHelperPtr> &_callbacks,
+    const std::vector<uint64_t> &_dropped)
+{
+  size_t i = 0;
+  for (auto iter = _callbacks.begin();
+      iter != _callbacks.end() && i < _dropped.size(); ++iter, ++i)
+  {
+    if (_dropped[i] > 0)
+      (*iter)->AddDropped(_dropped[i]);
+  }
+}
+
 /////////////////////////////////////////////////
 Node::Node()
 {
@@ -193,6 +212,12 @@ void Node::ProcessPublishers()
 
 /////////////////////////////////////////////////
 bool Node::HandleData(const std::string &_topic, const std::string &_msg)
+{
+  return this->HandleData(_topic, IncomingMsgPtr(new IncomingMsg(_msg)));
+}
+
+/////////////////////////////////////////////////
+bool Node::HandleData(const std::string &_topic, IncomingMsgPtr _msg)
 {
   boost::recursive_mutex::scoped_lock lock(this->incomingMutex);
   this->incomingMsgs[_topic].push_back(_msg);
@@ -223,9 +248,9 @@ void Node::ProcessIncoming()
 
   // For each topic
   {
-    std::list<std::string>::iterator msgIter;
-    std::map<std::string, std::list<std::string> >::iterator inIter;
-    std::map<std::string, std::list<std::string> >::iterator endIter;
+    std::list<IncomingMsgPtr>::iterator msgIter;
+    std::map<std::string, std::list<IncomingMsgPtr> >::iterator inIter;
+    std::map<std::string, std::list<IncomingMsgPtr> >::iterator endIter;
 
     boost::recursive_mutex::scoped_lock lock2(this->incomingMutex);
     inIter = this->incomingMsgs.begin();
@@ -237,24 +262,47 @@ void Node::ProcessIncoming()
       cbIter = this->callbacks.find(inIter->first);
       if (cbIter != this->callbacks.end())
       {
-        std::list<std::string>::iterator msgInIter;
-        std::list<std::string>::iterator msgEndIter;
+        std::list<IncomingMsgPtr>::iterator msgInIter;
+        std::list<IncomingMsgPtr>::iterator msgEndIter;
 
         msgInIter = inIter->second.begin();
         msgEndIter = inIter->second.end();
 
+        size_t count = inIter->second.size();
+        size_t index = 0;
+
+        // Read the quality of service of each callback once per update
+        std::vector<QoS> qos;
+        std::vector<uint64_t> dropped(cbIter->second.size(), 0);
+        qos.reserve(cbIter->second.size());
+        for (liter = cbIter->second.begin();
+            liter != cbIter->second.end(); ++liter)
+        {
+          qos.push_back((*liter)->GetQoS());
+        }
+
         // For each message in the buffer
-        for (msgIter = msgInIter; msgIter != msgEndIter; ++msgIter)
+        for (msgIter = msgInIter; msgIter != msgEndIter; ++msgIter, ++index)
         {
-          // Send the message to all callbacks
+          // Send the message to all callbacks that keep it. Typed
+          // callbacks share a single decoded message.
+          size_t cbIndex = 0;
           for (liter = cbIter->second.begin();
-              liter != cbIter->second.end(); ++liter)
+              liter != cbIter->second.end(); ++liter, ++cbIndex)
           {
+            if (!qos[cbIndex].Keep(index, count))
+            {
+              ++dropped[cbIndex];
+              continue;
+            }
+
             using namespace boost::placeholders;
-            (*liter)->HandleData(*msgIter,
+            (*msgIter)->Dispatch(**liter,
                 boost::bind(&dummy_callback_fn, _1), 0);
           }
         }
+
+        AddDropped(cbIter->second, dropped);
       }
     }
 
@@ -282,16 +330,38 @@ void Node::ProcessIncoming()
         msgInIter = inIter->second.begin();
         msgEndIter = inIter->second.end();
 
+        size_t count = inIter->second.size();
+        size_t index = 0;
+
+        // Read the quality of service of each callback once per update
+        std::vector<QoS> qos;
+        std::vector<uint64_t> dropped(cbIter->second.size(), 0);
+        qos.reserve(cbIter->second.size());
+        for (liter = cbIter->second.begin();
+            liter != cbIter->second.end(); ++liter)
+        {
+          qos.push_back((*liter)->GetQoS());
+        }
+
         // For each message in the buffer
-        for (msgIter = msgInIter; msgIter != msgEndIter; ++msgIter)
+        for (msgIter = msgInIter; msgIter != msgEndIter; ++msgIter, ++index)
         {
-          // Send the message to all callbacks
+          // Send the message to all callbacks that keep it
+          size_t cbIndex = 0;
           for (liter = cbIter->second.begin();
-              liter != cbIter->second.end(); ++liter)
+              liter != cbIter->second.end(); ++liter, ++cbIndex)
           {
+            if (!qos[cbIndex].Keep(index, count))
+            {
+              ++dropped[cbIndex];
+              continue;
+            }
+
             (*liter)->HandleMessage(*msgIter);
           }
         }
+
+        AddDropped(cbIter->second, dropped);
       }
     }
 
@@ -362,6 +432,25 @@ bool Node::HasLatchedSubscriber(const std::string &_topic) const
   return false;
 }
 
+/////////////////////////////////////////////////
+CallbackHelperPtr Node::GetCallback(const std::string &_topic,
+    unsigned int _id)
+{
+  boost::recursive_mutex::scoped_lock lock(this->incomingMutex);
+
+  Callback_M::iterator iter = this->callbacks.find(_topic);
+  if (iter != this->callbacks.end())
+  {
+    for (auto const &cb : iter->second)
+    {
+      if (cb->GetId() == _id)
+        return cb;
+    }
+  }
+
+  return CallbackHelperPtr();
+}
+
 /////////////////////////////////////////////////
 void Node::RemoveCallback(const std::string &_topic, unsigned int _id)
 {
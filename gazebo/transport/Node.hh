@@ -384,6 +384,14 @@ namespace gazebo
       public: bool HandleData(const std::string &_topic,
                               const std::string &_msg);
 
+      /// \brief Handle incoming data shared with other nodes. The message
+      /// is decoded only once for all the nodes that receive it.
+      /// \param[in] _topic Topic for which the data was received
+      /// \param[in] _msg The message that was received
+      /// \return true if the message was handled successfully, false otherwise
+      public: bool HandleData(const std::string &_topic,
+                              IncomingMsgPtr _msg);
+
       /// \brief Handle incoming msg.
       /// \param[in] _topic Topic for which the data was received
       /// \param[in] _msg The message that was received
@@ -413,6 +421,15 @@ namespace gazebo
       /// \return The message type
       public: std::string GetMsgType(const std::string &_topic) const;
 
+      /// \internal
+      /// \brief Get a callback. This should only be called by
+      /// Subscriber.cc
+      /// \param[in] _topic Name of the topic.
+      /// \param[in] _id Id of the callback.
+      /// \return The callback, or nullptr if it was not found.
+      public: CallbackHelperPtr GetCallback(const std::string &_topic,
+                  unsigned int _id);
+
       /// \internal
       /// \brief Remove a callback. This should only be called by
       /// Subscriber.cc
@@ -444,7 +461,7 @@ namespace gazebo
       private: typedef std::list<CallbackHelperPtr> Callback_L;
       private: typedef std::map<std::string, Callback_L> Callback_M;
       private: Callback_M callbacks;
-      private: std::map<std::string, std::list<std::string> > incomingMsgs;
+      private: std::map<std::string, std::list<IncomingMsgPtr> > incomingMsgs;
 
       /// \brief List of newly arrive messages
       private: std::map<std::string, std::list<MessagePtr> > incomingMsgsLocal;
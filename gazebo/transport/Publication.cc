@@ -250,6 +250,9 @@ void Publication::LocalPublish(const std::string &_data)
 {
   std::list<NodePtr>::iterator iter, endIter;
 
+  // Shared by all the subscribers, so that the data is decoded only once
+  IncomingMsgPtr msg(new IncomingMsg(_data));
+
   {
     boost::mutex::scoped_lock lock(this->nodeMutex);
 
@@ -257,7 +260,7 @@ void Publication::LocalPublish(const std::string &_data)
     endIter = this->nodes.end();
     while (iter != endIter)
     {
-      if ((*iter)->HandleData(this->topic, _data))
+      if ((*iter)->HandleData(this->topic, msg))
         ++iter;
       else
         this->nodes.erase(iter++);
@@ -278,8 +281,7 @@ void Publication::LocalPublish(const std::string &_data)
       if ((*cbIter)->IsLocal())
       {
         using namespace boost::placeholders;
-        if ((*cbIter)->HandleData(_data,
-              boost::bind(&dummy_callback_fn, _1), 0))
+        if (msg->Dispatch(**cbIter, boost::bind(&dummy_callback_fn, _1), 0))
           ++cbIter;
         else
           cbIter = this->callbacks.erase(cbIter);
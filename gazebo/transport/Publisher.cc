@@ -18,6 +18,9 @@
  * Author: Nate Koenig
  */
 
+#include <map>
+#include <mutex>
+
 #include <ignition/math/Helpers.hh>
 
 #include "gazebo/common/Exception.hh"
@@ -31,12 +34,64 @@ using namespace transport;
 
 uint32_t Publisher::idCounter = 0;
 
+/// \brief Quality of service state of a publisher. Publisher is created by
+/// inline code in TopicManager.hh, so this state is kept outside of the
+/// class to leave its layout unchanged.
+struct PublisherQoS
+{
+  /// \brief Quality of service of the outgoing queue.
+  QoS qos;
+
+  /// \brief Wall time at which each queued message was published.
+  std::list<common::Time> messageTimes;
+
+  /// \brief Number of messages dropped because the queue was full.
+  uint64_t droppedCount = 0;
+
+  /// \brief Number of messages dropped because of the deadline.
+  uint64_t expiredCount = 0;
+};
+
+/// \brief Quality of service state of every publisher.
+struct PublisherQoSTable
+{
+  /// \brief State of each publisher.
+  std::map<const Publisher *, PublisherQoS> states;
+
+  /// \brief Protects states. Each entry is protected by the mutex of its
+  /// publisher.
+  std::mutex mutex;
+};
+
+//////////////////////////////////////////////////
+/// \brief Get the quality of service state table. It is never destroyed,
+/// because publishers held by singletons can outlive static objects.
+/// \return The table.
+static PublisherQoSTable &QoSTable()
+{
+  static PublisherQoSTable *table = new PublisherQoSTable;
+  return *table;
+}
+
+//////////////////////////////////////////////////
+/// \brief Get the quality of service state of a publisher.
+/// \param[in] _pub The publisher.
+/// \return State of _pub. Map entries are stable until the publisher is
+/// destroyed.
+static PublisherQoS &QoSState(const Publisher *_pub)
+{
+  PublisherQoSTable &table = QoSTable();
+  std::lock_guard<std::mutex> lock(table.mutex);
+  return table.states[_pub];
+}
+
 //////////////////////////////////////////////////
 Publisher::Publisher(const std::string &_topic, const std::string &_msgType,
                      unsigned int _limit, double _hzRate)
-  : topic(_topic), msgType(_msgType), queueLimit(_limit),
-    updatePeriod(0)
+  : topic(_topic), msgType(_msgType), queueLimit(_limit), updatePeriod(0)
 {
+  QoSState(this).qos = QoS::KeepLast(_limit);
+
   if (!ignition::math::equal(_hzRate, 0.0))
     this->updatePeriod = 1.0 / _hzRate;
 
@@ -49,6 +104,10 @@ Publisher::Publisher(const std::string &_topic, const std::string &_msgType,
 Publisher::~Publisher()
 {
   this->Fini();
+
+  PublisherQoSTable &table = QoSTable();
+  std::lock_guard<std::mutex> lock(table.mutex);
+  table.states.erase(this);
 }
 
 //////////////////////////////////////////////////
@@ -85,6 +144,28 @@ bool Publisher::WaitForConnection(const common::Time &_timeout) const
 //////////////////////////////////////////////////
 void Publisher::PublishImpl(const google::protobuf::Message &_message,
                             bool _block)
+{
+  if (!this->AcceptMessage(_message))
+    return;
+
+  // Save the latest message
+  MessagePtr msgPtr(_message.New());
+  msgPtr->CopyFrom(_message);
+
+  this->Enqueue(msgPtr, _block);
+}
+
+//////////////////////////////////////////////////
+void Publisher::PublishImpl(const MessagePtr &_message, bool _block)
+{
+  if (!_message || !this->AcceptMessage(*_message))
+    return;
+
+  this->Enqueue(_message, _block);
+}
+
+//////////////////////////////////////////////////
+bool Publisher::AcceptMessage(const google::protobuf::Message &_message)
 {
   if (_message.GetTypeName() != this->msgType)
     gzthrow("Invalid message type\n");
@@ -94,7 +175,7 @@ void Publisher::PublishImpl(const google::protobuf::Message &_message,
     gzerr << "Publishing an uninitialized message on topic[" <<
       this->topic << "]. Required field [" <<
       _message.InitializationErrorString() << "] missing.\n";
-    return;
+    return false;
   }
 
   // Check if a throttling rate has been set
@@ -108,29 +189,33 @@ void Publisher::PublishImpl(const google::protobuf::Message &_message,
         (this->currentTime - this->prevPublishTime).Double() <
         this->updatePeriod)
     {
-      return;
+      return false;
     }
 
     // Set the previous time a message was published
     this->prevPublishTime = this->currentTime;
   }
 
-  // Save the latest message
-  MessagePtr msgPtr(_message.New());
-  msgPtr->CopyFrom(_message);
+  return true;
+}
 
-  this->publication->SetPrevMsg(this->id, msgPtr);
+//////////////////////////////////////////////////
+void Publisher::Enqueue(MessagePtr _msgPtr, bool _block)
+{
+  this->publication->SetPrevMsg(this->id, _msgPtr);
 
   {
+    PublisherQoS &state = QoSState(this);
     boost::mutex::scoped_lock lock(this->mutex);
 
-    this->messages.push_back(msgPtr);
-
-    if (this->messages.size() > this->queueLimit)
+    size_t depth = this->queueLimit;
+    if (depth > 0 && this->messages.size() >= depth)
     {
-      this->messages.pop_front();
+      ++state.droppedCount;
 
-      if (!queueLimitWarned)
+      // A depth of one conflates messages on purpose, so only warn about
+      // deeper queues.
+      if (depth > 1 && !queueLimitWarned)
       {
         gzwarn << "Queue limit reached for topic "
           << this->topic
@@ -138,6 +223,22 @@ void Publisher::PublishImpl(const google::protobuf::Message &_message,
           << "This warning is printed only once." << std::endl;
         queueLimitWarned = true;
       }
+
+      if (state.qos.Policy() == QoS::DROP_OLDEST)
+      {
+        this->messages.pop_front();
+        state.messageTimes.pop_front();
+      }
+      else
+      {
+        _msgPtr.reset();
+      }
+    }
+
+    if (_msgPtr)
+    {
+      this->messages.push_back(_msgPtr);
+      state.messageTimes.push_back(common::Time::GetWallTime());
     }
   }
 
@@ -161,12 +262,26 @@ void Publisher::SendMessage()
   std::list<uint32_t> localIds;
 
   {
+    PublisherQoS &state = QoSState(this);
     boost::mutex::scoped_lock lock(this->mutex);
     if (!this->pubIds.empty() || this->messages.empty())
     {
       return;
     }
 
+    // Drop the messages that waited too long for a slow subscriber
+    if (state.qos.Deadline() > common::Time::Zero)
+    {
+      common::Time now = common::Time::GetWallTime();
+      while (!this->messages.empty() &&
+          state.qos.Expired(now - state.messageTimes.front()))
+      {
+        this->messages.pop_front();
+        state.messageTimes.pop_front();
+        ++state.expiredCount;
+      }
+    }
+
     for (unsigned int i = 0; i < this->messages.size(); ++i)
     {
       this->pubId = (this->pubId + 1) % 10000;
@@ -177,6 +292,7 @@ void Publisher::SendMessage()
     std::copy(this->messages.begin(), this->messages.end(),
         std::back_inserter(localBuffer));
     this->messages.clear();
+    state.messageTimes.clear();
   }
 
   // Only send messages if there is something to send
@@ -319,6 +435,11 @@ void Publisher::Fini()
   if (!this->messages.empty())
     this->SendMessage();
   this->messages.clear();
+  {
+    PublisherQoS &state = QoSState(this);
+    boost::mutex::scoped_lock lock(this->mutex);
+    state.messageTimes.clear();
+  }
 
   if (!this->topic.empty())
     TopicManager::Instance()->Unadvertise(this->topic, this->id);
@@ -354,3 +475,53 @@ uint32_t Publisher::Id() const
 {
   return this->id;
 }
+
+//////////////////////////////////////////////////
+void Publisher::SetQoS(const QoS &_qos)
+{
+  PublisherQoS &state = QoSState(this);
+  boost::mutex::scoped_lock lock(this->mutex);
+  state.qos = _qos;
+  this->queueLimit = static_cast<unsigned int>(_qos.Depth());
+
+  // Apply a smaller depth to the messages already queued
+  size_t depth = this->queueLimit;
+  while (depth > 0 && this->messages.size() > depth)
+  {
+    if (state.qos.Policy() == QoS::DROP_OLDEST)
+    {
+      this->messages.pop_front();
+      state.messageTimes.pop_front();
+    }
+    else
+    {
+      this->messages.pop_back();
+      state.messageTimes.pop_back();
+    }
+    ++state.droppedCount;
+  }
+}
+
+//////////////////////////////////////////////////
+QoS Publisher::GetQoS() const
+{
+  const PublisherQoS &state = QoSState(this);
+  boost::mutex::scoped_lock lock(this->mutex);
+  return state.qos;
+}
+
+//////////////////////////////////////////////////
+uint64_t Publisher::DroppedCount() const
+{
+  const PublisherQoS &state = QoSState(this);
+  boost::mutex::scoped_lock lock(this->mutex);
+  return state.droppedCount;
+}
+
+//////////////////////////////////////////////////
+uint64_t Publisher::ExpiredCount() const
+{
+  const PublisherQoS &state = QoSState(this);
+  boost::mutex::scoped_lock lock(this->mutex);
+  return state.expiredCount;
+}
@@ -29,6 +29,7 @@
 #include <map>
 
 #include "gazebo/common/Time.hh"
+#include "gazebo/transport/QoS.hh"
 #include "gazebo/transport/TransportTypes.hh"
 #include "gazebo/util/system.hh"
 
@@ -98,9 +99,22 @@ namespace gazebo
       /// not be sent out immediately. Check with  GetOutgoingCount() if
       /// there are still messages in the queue which need to be sent out.
       public: template< typename M>
-              void Publish(M _message, bool _block = false)
+              void Publish(const M &_message, bool _block = false)
               { this->PublishImpl(_message, _block); }
 
+      /// \brief Publish a message without copying it. The publisher keeps
+      /// a reference to the message until it is sent, and as the latest
+      /// message of the topic, so the message must not be modified after
+      /// this call. Use this for large messages such as images and point
+      /// clouds that are built for a single publication.
+      /// \param[in] _message Message to be published
+      /// \param[in] _block Whether to block until the message is actually
+      /// written into the local message buffer, and SendMessage() is called.
+      public: template< typename M>
+              void Publish(const boost::shared_ptr<M> &_message,
+                  bool _block = false)
+              { this->PublishImpl(MessagePtr(_message), _block); }
+
       /// \brief Get the number of outgoing messages
       /// \return The number of outgoing messages
       public: unsigned int GetOutgoingCount() const;
@@ -140,6 +154,27 @@ namespace gazebo
       /// \return Unique id of this publisher.
       public: uint32_t Id() const;
 
+      /// \brief Set the quality of service of the outgoing queue. The
+      /// queue limit given to the constructor is the depth of a
+      /// QoS::KeepLast queue. Use QoS::LatestOnly() for large messages such
+      /// as images, so that a slow subscriber only gets the newest one.
+      /// \param[in] _qos Quality of service.
+      public: void SetQoS(const QoS &_qos);
+
+      /// \brief Get the quality of service of the outgoing queue.
+      /// \return Quality of service.
+      public: QoS GetQoS() const;
+
+      /// \brief Get the number of messages dropped because the outgoing
+      /// queue was full.
+      /// \return Number of dropped messages.
+      public: uint64_t DroppedCount() const;
+
+      /// \brief Get the number of messages dropped because they waited
+      /// longer than the deadline of the quality of service.
+      /// \return Number of expired messages.
+      public: uint64_t ExpiredCount() const;
+
       /// \brief Implementation of Publish.
       /// \param[in] _message Message to be published.
       /// \param[in] _block Whether to block until the message is actually
@@ -147,6 +182,25 @@ namespace gazebo
       private: void PublishImpl(const google::protobuf::Message &_message,
                                 bool _block);
 
+      /// \brief Implementation of Publish for a message that is shared with
+      /// the caller instead of copied.
+      /// \param[in] _message Message to be published.
+      /// \param[in] _block Whether to block until the message is actually
+      /// written out.
+      private: void PublishImpl(const MessagePtr &_message, bool _block);
+
+      /// \brief Check that a message can be published, and apply the
+      /// throttling rate.
+      /// \param[in] _message Message to be published.
+      /// \return True if the message should be published now.
+      private: bool AcceptMessage(const google::protobuf::Message &_message);
+
+      /// \brief Queue a message that was accepted for publication.
+      /// \param[in] _msgPtr Message owned by the publisher.
+      /// \param[in] _block Whether to block until the message is actually
+      /// written out.
+      private: void Enqueue(MessagePtr _msgPtr, bool _block);
+
       /// \brief Callback when a publish is completed
       /// \param[in] _id ID associated with the publication.
       private: void OnPublishComplete(uint32_t _id);
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include "gazebo/transport/QoS.hh"
+
+using namespace gazebo;
+using namespace transport;
+
+//////////////////////////////////////////////////
+QoS::QoS(const size_t _depth, const DropPolicy _policy,
+    const common::Time &_deadline)
+  : depth(_depth), policy(_policy), deadline(_deadline)
+{
+}
+
+//////////////////////////////////////////////////
+QoS QoS::KeepLast(const size_t _depth)
+{
+  return QoS(_depth, DROP_OLDEST);
+}
+
+//////////////////////////////////////////////////
+QoS QoS::LatestOnly()
+{
+  return QoS(1, DROP_OLDEST);
+}
+
+//////////////////////////////////////////////////
+size_t QoS::Depth() const
+{
+  return this->depth;
+}
+
+//////////////////////////////////////////////////
+void QoS::SetDepth(const size_t _depth)
+{
+  this->depth = _depth;
+}
+
+//////////////////////////////////////////////////
+QoS::DropPolicy QoS::Policy() const
+{
+  return this->policy;
+}
+
+//////////////////////////////////////////////////
+void QoS::SetPolicy(const DropPolicy _policy)
+{
+  this->policy = _policy;
+}
+
+//////////////////////////////////////////////////
+common::Time QoS::Deadline() const
+{
+  return this->deadline;
+}
+
+//////////////////////////////////////////////////
+void QoS::SetDeadline(const common::Time &_deadline)
+{
+  this->deadline = _deadline;
+}
+
+//////////////////////////////////////////////////
+bool QoS::Keep(const size_t _index, const size_t _count) const
+{
+  if (this->depth == 0 || _count <= this->depth)
+    return true;
+
+  if (this->policy == DROP_NEWEST)
+    return _index < this->depth;
+
+  return _index >= _count - this->depth;
+}
+
+//////////////////////////////////////////////////
+bool QoS::Expired(const common::Time &_age) const
+{
+  return this->deadline > common::Time::Zero && _age > this->deadline;
+}
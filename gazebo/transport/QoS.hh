@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#ifndef GAZEBO_TRANSPORT_QOS_HH_
+#define GAZEBO_TRANSPORT_QOS_HH_
+
+#include <cstddef>
+
+#include "gazebo/common/Time.hh"
+#include "gazebo/util/system.hh"
+
+namespace gazebo
+{
+  namespace transport
+  {
+    /// \addtogroup gazebo_transport
+    /// \{
+
+    /// \class QoS QoS.hh transport/transport.hh
+    /// \brief Quality of service of a publisher or subscriber queue. It
+    /// bounds the number of messages waiting for delivery, and chooses
+    /// which messages are dropped when a reader falls behind.
+    ///
+    /// The default is an unbounded queue, which delivers every message.
+    class GZ_TRANSPORT_VISIBLE QoS
+    {
+      /// \brief Which messages to drop when the queue is full.
+      public: enum DropPolicy
+              {
+                /// \brief Drop the oldest queued message, so that the
+                /// queue keeps the last messages.
+                DROP_OLDEST,
+
+                /// \brief Drop the new message, so that the queue keeps
+                /// the first messages.
+                DROP_NEWEST
+              };
+
+      /// \brief Constructor.
+      /// \param[in] _depth Maximum number of queued messages, 0 for no
+      /// limit.
+      /// \param[in] _policy Which messages to drop when the queue is full.
+      /// \param[in] _deadline Maximum time a message may wait in a
+      /// publisher queue before it is dropped, 0 for no limit.
+      public: explicit QoS(const size_t _depth = 0,
+                  const DropPolicy _policy = DROP_OLDEST,
+                  const common::Time &_deadline = common::Time::Zero);
+
+      /// \brief Keep the last messages.
+      /// \param[in] _depth Number of messages to keep.
+      /// \return The quality of service.
+      public: static QoS KeepLast(const size_t _depth);
+
+      /// \brief Only deliver the latest message. Older messages that have
+      /// not been delivered yet are replaced, which suits large messages
+      /// such as images and point clouds.
+      /// \return The quality of service.
+      public: static QoS LatestOnly();
+
+      /// \brief Get the maximum number of queued messages.
+      /// \return Queue depth, 0 for no limit.
+      public: size_t Depth() const;
+
+      /// \brief Set the maximum number of queued messages.
+      /// \param[in] _depth Queue depth, 0 for no limit.
+      public: void SetDepth(const size_t _depth);
+
+      /// \brief Get the drop policy.
+      /// \return Which messages are dropped when the queue is full.
+      public: DropPolicy Policy() const;
+
+      /// \brief Set the drop policy.
+      /// \param[in] _policy Which messages to drop when the queue is full.
+      public: void SetPolicy(const DropPolicy _policy);
+
+      /// \brief Get the deadline of queued messages.
+      /// \return Maximum time a message may wait, 0 for no limit.
+      public: common::Time Deadline() const;
+
+      /// \brief Set the deadline of queued messages.
+      /// \param[in] _deadline Maximum time a message may wait, 0 for no
+      /// limit.
+      public: void SetDeadline(const common::Time &_deadline);
+
+      /// \brief Check whether a queued message is delivered.
+      /// \param[in] _index Position of the message in the queue, 0 being
+      /// the oldest.
+      /// \param[in] _count Number of queued messages.
+      /// \return True if the message is kept, false if it is dropped.
+      public: bool Keep(const size_t _index, const size_t _count) const;
+
+      /// \brief Check whether a message has waited longer than the deadline.
+      /// \param[in] _age Time the message has waited.
+      /// \return True if the message is expired.
+      public: bool Expired(const common::Time &_age) const;
+
+      /// \brief Maximum number of queued messages.
+      private: size_t depth;
+
+      /// \brief Which messages to drop when the queue is full.
+      private: DropPolicy policy;
+
+      /// \brief Maximum time a message may wait.
+      private: common::Time deadline;
+    };
+    /// \}
+  }
+}
+#endif
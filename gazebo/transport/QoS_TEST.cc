@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <gtest/gtest.h>
+
+#include "gazebo/transport/QoS.hh"
+#include "test/util.hh"
+
+using namespace gazebo;
+
+class QoSTest : public gazebo::testing::AutoLogFixture { };
+
+/////////////////////////////////////////////////
+TEST_F(QoSTest, Default)
+{
+  transport::QoS qos;
+  EXPECT_EQ(0u, qos.Depth());
+  EXPECT_EQ(transport::QoS::DROP_OLDEST, qos.Policy());
+  EXPECT_EQ(common::Time::Zero, qos.Deadline());
+
+  // Everything is kept
+  for (size_t i = 0; i < 100; ++i)
+    EXPECT_TRUE(qos.Keep(i, 100));
+  EXPECT_FALSE(qos.Expired(common::Time(1000, 0)));
+}
+
+/////////////////////////////////////////////////
+TEST_F(QoSTest, KeepLast)
+{
+  transport::QoS qos = transport::QoS::KeepLast(3);
+  EXPECT_EQ(3u, qos.Depth());
+  EXPECT_EQ(transport::QoS::DROP_OLDEST, qos.Policy());
+
+  EXPECT_TRUE(qos.Keep(0, 2));
+  EXPECT_TRUE(qos.Keep(1, 2));
+
+  EXPECT_FALSE(qos.Keep(0, 5));
+  EXPECT_FALSE(qos.Keep(1, 5));
+  EXPECT_TRUE(qos.Keep(2, 5));
+  EXPECT_TRUE(qos.Keep(4, 5));
+}
+
+/////////////////////////////////////////////////
+TEST_F(QoSTest, LatestOnly)
+{
+  transport::QoS qos = transport::QoS::LatestOnly();
+  EXPECT_EQ(1u, qos.Depth());
+
+  EXPECT_TRUE(qos.Keep(0, 1));
+  EXPECT_FALSE(qos.Keep(0, 10));
+  EXPECT_FALSE(qos.Keep(8, 10));
+  EXPECT_TRUE(qos.Keep(9, 10));
+}
+
+/////////////////////////////////////////////////
+TEST_F(QoSTest, DropNewest)
+{
+  transport::QoS qos(2, transport::QoS::DROP_NEWEST);
+  EXPECT_TRUE(qos.Keep(0, 5));
+  EXPECT_TRUE(qos.Keep(1, 5));
+  EXPECT_FALSE(qos.Keep(2, 5));
+  EXPECT_FALSE(qos.Keep(4, 5));
+
+  qos.SetDepth(0);
+  EXPECT_TRUE(qos.Keep(4, 5));
+
+  qos.SetPolicy(transport::QoS::DROP_OLDEST);
+  EXPECT_EQ(transport::QoS::DROP_OLDEST, qos.Policy());
+}
+
+/////////////////////////////////////////////////
+TEST_F(QoSTest, Deadline)
+{
+  transport::QoS qos;
+  qos.SetDeadline(common::Time(0, 100000000));
+  EXPECT_EQ(common::Time(0, 100000000), qos.Deadline());
+
+  EXPECT_FALSE(qos.Expired(common::Time::Zero));
+  EXPECT_FALSE(qos.Expired(common::Time(0, 50000000)));
+  EXPECT_TRUE(qos.Expired(common::Time(0, 200000000)));
+}
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
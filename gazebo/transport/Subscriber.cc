@@ -64,3 +64,43 @@ unsigned int Subscriber::GetCallbackId() const
 {
   return this->callbackId;
 }
+
+//////////////////////////////////////////////////
+void Subscriber::SetQoS(const QoS &_qos)
+{
+  if (!this->node)
+    return;
+
+  CallbackHelperPtr cb = this->node->GetCallback(this->topic,
+      this->callbackId);
+  if (cb)
+    cb->SetQoS(_qos);
+}
+
+//////////////////////////////////////////////////
+QoS Subscriber::GetQoS() const
+{
+  if (this->node)
+  {
+    CallbackHelperPtr cb = this->node->GetCallback(this->topic,
+        this->callbackId);
+    if (cb)
+      return cb->GetQoS();
+  }
+
+  return QoS();
+}
+
+//////////////////////////////////////////////////
+uint64_t Subscriber::DroppedCount() const
+{
+  if (this->node)
+  {
+    CallbackHelperPtr cb = this->node->GetCallback(this->topic,
+        this->callbackId);
+    if (cb)
+      return cb->DroppedCount();
+  }
+
+  return 0;
+}
@@ -65,6 +65,21 @@ namespace gazebo
       /// \brief Unsubscribe from the topic
       public: void Unsubscribe() const;
 
+      /// \brief Set the quality of service of this subscriber. It chooses
+      /// which messages are delivered when the callback falls behind, for
+      /// example QoS::LatestOnly() to only receive the newest message.
+      /// \param[in] _qos Quality of service.
+      public: void SetQoS(const QoS &_qos);
+
+      /// \brief Get the quality of service of this subscriber.
+      /// \return Quality of service.
+      public: QoS GetQoS() const;
+
+      /// \brief Get the number of messages that were not delivered to
+      /// this subscriber because of its quality of service.
+      /// \return Number of dropped messages.
+      public: uint64_t DroppedCount() const;
+
       /// \brief Topic this object is subscribe to.
       private: std::string topic;
 
@@ -19,10 +19,15 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/lexical_cast.hpp>
 #include <string>
+#include <vector>
+
+#include "gazebo/common/CommonIface.hh"
+#include "gazebo/common/Console.hh"
 
 #include "gazebo/transport/Node.hh"
 #include "gazebo/transport/Publisher.hh"
 #include "gazebo/transport/Subscriber.hh"
+#include "gazebo/transport/Connection.hh"
 #include "gazebo/transport/ConnectionManager.hh"
 #include "gazebo/transport/TransportIface.hh"
 
@@ -33,6 +38,7 @@ std::condition_variable g_responseCondition;
 std::mutex requestMutex;
 bool g_stopped = true;
 bool g_minimalComms = false;
+unsigned int g_ioThreads = 0;
 
 std::list<msgs::Request *> g_requests;
 std::list<boost::shared_ptr<msgs::Response> > g_responses;
@@ -358,6 +364,44 @@ bool transport::getMinimalComms()
   return g_minimalComms;
 }
 
+/////////////////////////////////////////////////
+void transport::setIOThreads(const unsigned int _threads)
+{
+  g_ioThreads = _threads;
+}
+
+/////////////////////////////////////////////////
+unsigned int transport::getIOThreads()
+{
+  if (g_ioThreads > 0)
+    return g_ioThreads;
+
+  const char *envValue = common::getEnv("GAZEBO_IO_THREADS");
+  std::string env = envValue ? envValue : "";
+  if (!env.empty())
+  {
+    try
+    {
+      int threads = boost::lexical_cast<int>(env);
+      if (threads > 0)
+        return threads;
+    }
+    catch(boost::bad_lexical_cast &)
+    {
+    }
+    gzwarn << "Invalid GAZEBO_IO_THREADS [" << env << "], using 1 thread."
+           << std::endl;
+  }
+
+  return 1;
+}
+
+/////////////////////////////////////////////////
+std::vector<double> transport::getIOThreadUtilization()
+{
+  return Connection::IOThreadUtilization();
+}
+
 /////////////////////////////////////////////////
 transport::ConnectionPtr transport::connectToMaster()
 {
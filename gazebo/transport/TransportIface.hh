@@ -25,6 +25,7 @@
 #include <string>
 #include <list>
 #include <map>
+#include <vector>
 
 #include "gazebo/transport/TransportTypes.hh"
 #include "gazebo/transport/SubscribeOptions.hh"
@@ -176,6 +177,26 @@ namespace gazebo
     GZ_TRANSPORT_VISIBLE
     bool getMinimalComms();
 
+    /// \brief Set the number of threads that handle socket IO. It must be
+    /// called before the first connection is created.
+    /// \param[in] _threads Number of threads, 0 to use the
+    /// GAZEBO_IO_THREADS environment variable or 1 if it is not set.
+    GZ_TRANSPORT_VISIBLE
+    void setIOThreads(const unsigned int _threads);
+
+    /// \brief Get the number of threads that handle socket IO.
+    /// \return Number of threads, at least 1.
+    /// \sa setIOThreads
+    GZ_TRANSPORT_VISIBLE
+    unsigned int getIOThreads();
+
+    /// \brief Get the fraction of time each socket IO thread spent
+    /// handling IO since the previous call.
+    /// \return One value in [0, 1] per thread, empty if no connection
+    /// exists or if the platform can not measure it.
+    GZ_TRANSPORT_VISIBLE
+    std::vector<double> getIOThreadUtilization();
+
     /// \brief Create a connection to master.
     /// \return Connection to the master, NULL on error.
     GZ_TRANSPORT_VISIBLE
@@ -14,12 +14,16 @@
  * limitations under the License.
  *
  */
+#include <algorithm>
 #include <functional>
 #include <iomanip>
+#include <string>
+#include <vector>
 #include <ignition/math/SignalStats.hh>
 #include "gazebo/common/Assert.hh"
 #include "gazebo/common/CommonIface.hh"
 #include "gazebo/common/Events.hh"
+#include "gazebo/common/ScopeProfiler.hh"
 #include "gazebo/common/SystemPaths.hh"
 #include "gazebo/transport/transport.hh"
 #include "gazebo/util/DiagnosticsPrivate.hh"
@@ -74,6 +78,20 @@ void DiagnosticManager::Fini()
 
   this->dataPtr->timers.clear();
 
+  if (!this->dataPtr->profilerTraceFile.empty())
+  {
+    common::ScopeProfiler::Collect();
+    common::ScopeProfiler::SetTracing(false);
+    if (common::ScopeProfiler::WriteChromeTrace(
+          this->dataPtr->profilerTraceFile))
+    {
+      gzmsg << "Profiler trace written to ["
+            << this->dataPtr->profilerTraceFile << "]\n";
+    }
+    this->dataPtr->profilerTraceFile.clear();
+  }
+
+  this->dataPtr->profilerPub.reset();
   this->dataPtr->pub.reset();
   if (this->dataPtr->node)
     this->dataPtr->node->Fini();
@@ -90,10 +108,49 @@ void DiagnosticManager::Init(const std::string &_worldName)
   this->dataPtr->pub =
     this->dataPtr->node->Advertise<msgs::Diagnostics>("~/diagnostics");
 
+  this->dataPtr->profilerPub =
+    this->dataPtr->node->Advertise<msgs::ProfilerStatistics>("~/profiler");
+  this->dataPtr->profilerPublishTime = common::Time::GetWallTime();
+
+  // Warn about plugins that take too long, in milliseconds
+  const char *budget = common::getEnv("GAZEBO_PLUGIN_BUDGET");
+  if (budget && std::string(budget) != "")
+  {
+    try
+    {
+      this->SetPluginBudget(std::stod(budget) * 1e-3);
+    }
+    catch(...)
+    {
+      gzerr << "Invalid GAZEBO_PLUGIN_BUDGET [" << budget
+            << "], expected a time in milliseconds\n";
+    }
+  }
+
+  // Record a trace of the built-in profiler if requested
+  const char *traceFile = common::getEnv("GAZEBO_PROFILER_TRACE");
+  if (traceFile && std::string(traceFile) != "")
+  {
+    this->dataPtr->profilerTraceFile = traceFile;
+    common::ScopeProfiler::SetTracing(true);
+  }
+
   this->dataPtr->updateConnection = event::Events::ConnectWorldUpdateBegin(
       std::bind(&DiagnosticManager::Update, this, std::placeholders::_1));
 }
 
+//////////////////////////////////////////////////
+void DiagnosticManager::SetPluginBudget(const double _seconds)
+{
+  this->dataPtr->pluginBudget = std::max(0.0, _seconds);
+}
+
+//////////////////////////////////////////////////
+double DiagnosticManager::PluginBudget() const
+{
+  return this->dataPtr->pluginBudget;
+}
+
 //////////////////////////////////////////////////
 boost::filesystem::path DiagnosticManager::LogPath() const
 {
@@ -120,6 +177,71 @@ void DiagnosticManager::Update(const common::UpdateInfo &_info)
     this->dataPtr->pub->Publish(this->dataPtr->msg);
 
   this->dataPtr->msg.clear_time();
+
+  this->UpdateProfiler(_info);
+}
+
+//////////////////////////////////////////////////
+void DiagnosticManager::UpdateProfiler(const common::UpdateInfo &_info)
+{
+  if (!common::ScopeProfiler::Enabled())
+    return;
+
+  // Aggregate the scopes of the previous step
+  common::ScopeProfiler::Collect();
+  ++this->dataPtr->profilerSteps;
+
+  // Publish the statistics once per second
+  common::Time wallTime = common::Time::GetWallTime();
+  common::Time period = wallTime - this->dataPtr->profilerPublishTime;
+  if (period < common::Time(1, 0))
+    return;
+
+  std::vector<common::ProfileStats> allStats = common::ScopeProfiler::Stats();
+  for (auto const &stats : allStats)
+  {
+    this->dataPtr->profilerCumulative[stats.name] += stats.total;
+
+    // Plugin callbacks are in scopes named Plugin::<filename>::...
+    if (this->dataPtr->pluginBudget > 0 &&
+        stats.max > this->dataPtr->pluginBudget &&
+        stats.name.compare(0, 8, "Plugin::") == 0)
+    {
+      gzwarn << "[" << stats.name << "] took up to " << stats.max * 1e3
+             << " ms, over the budget of "
+             << this->dataPtr->pluginBudget * 1e3 << " ms per step\n";
+    }
+  }
+
+  if (this->dataPtr->profilerPub &&
+      this->dataPtr->profilerPub->HasConnections())
+  {
+    msgs::ProfilerStatistics msg;
+    msgs::Set(msg.mutable_sim_time(), _info.simTime);
+    msgs::Set(msg.mutable_real_time(), _info.realTime);
+    msgs::Set(msg.mutable_period(), period);
+    msg.set_dropped(common::ScopeProfiler::DroppedCount());
+    msg.set_steps(this->dataPtr->profilerSteps);
+
+    for (auto const &stats : allStats)
+    {
+      msgs::ProfilerStatistics::Scope *scope = msg.add_scope();
+      scope->set_name(stats.name);
+      scope->set_count(stats.count);
+      scope->set_total(stats.total);
+      scope->set_min(stats.min);
+      scope->set_max(stats.max);
+      scope->set_p50(stats.p50);
+      scope->set_p99(stats.p99);
+      scope->set_cumulative(this->dataPtr->profilerCumulative[stats.name]);
+    }
+
+    this->dataPtr->profilerPub->Publish(msg);
+  }
+
+  this->dataPtr->profilerSteps = 0;
+  common::ScopeProfiler::Reset();
+  this->dataPtr->profilerPublishTime = wallTime;
 }
 
 //////////////////////////////////////////////////
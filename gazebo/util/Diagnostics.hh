@@ -126,6 +126,18 @@ namespace gazebo
       /// \return Label of the specified timer
       public: std::string Label(const int _index) const;
 
+      /// \brief Set the time a plugin event callback may take in one world
+      /// step. A warning naming the plugin is printed, at most once per
+      /// second, when a callback exceeds it. The budget can also be set in
+      /// milliseconds with the GAZEBO_PLUGIN_BUDGET environment variable.
+      /// \param[in] _seconds Budget in seconds, 0 to disable the warning.
+      public: void SetPluginBudget(const double _seconds);
+
+      /// \brief Get the time a plugin event callback may take in one world
+      /// step.
+      /// \return Budget in seconds, 0 if disabled.
+      public: double PluginBudget() const;
+
       /// \brief Get the path in which logs are stored.
       /// \return The path in which logs are stored.
       public: boost::filesystem::path LogPath() const;
@@ -134,6 +146,12 @@ namespace gazebo
       /// \param[in] _info World update information.
       private: void Update(const common::UpdateInfo &_info);
 
+      /// \brief Aggregate the scopes of the built-in profiler, and
+      /// periodically publish their statistics on ~/profiler and check
+      /// the plugin callbacks against the budget.
+      /// \param[in] _info World update information.
+      private: void UpdateProfiler(const common::UpdateInfo &_info);
+
       /// \brief Add a time for publication.
       /// \param[in] _name Name of the diagnostic time.
       /// \param[in] _wallTime Wall clock time stamp.
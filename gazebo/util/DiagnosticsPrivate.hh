@@ -18,6 +18,7 @@
 #define _GAZEBO_UTILS_DIAGNOSTICMANAGER_PRIVATE_HH_
 
 #include <fstream>
+#include <map>
 #include <string>
 #include <boost/filesystem.hpp>
 #include <boost/unordered_map.hpp>
@@ -53,6 +54,27 @@ namespace gazebo
 
       /// \brief Pointer to the update event connection
       public: event::ConnectionPtr updateConnection;
+
+      /// \brief Publisher of the built-in profiler statistics.
+      public: transport::PublisherPtr profilerPub;
+
+      /// \brief Wall time of the last profiler statistics.
+      public: common::Time profilerPublishTime;
+
+      /// \brief File to write the profiler trace to on Fini, empty for
+      /// no trace.
+      public: std::string profilerTraceFile;
+
+      /// \brief Number of world steps since the last profiler statistics.
+      public: uint64_t profilerSteps = 0;
+
+      /// \brief Total time spent in each profiler scope since Init, in
+      /// seconds.
+      public: std::map<std::string, double> profilerCumulative;
+
+      /// \brief Time a plugin callback may take in one step before a
+      /// warning is printed, in seconds. Zero disables the warning.
+      public: double pluginBudget = 0;
     };
 
     /// \brief Private data for the DiagnosticTimer class
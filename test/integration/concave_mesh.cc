@@ -28,6 +28,7 @@ class ConcaveMeshTest : public ServerFixture,
   public: void RayTest(const std::string &_physicsEngine);
   public: void SubmeshNoCollisionTest(const std::string &_physicsEngine);
   public: void SubmeshCollisionTest(const std::string &_physicsEngine);
+  public: void ConvexHullsOnMeshTest(const std::string &_physicsEngine);
 };
 
 /////////////////////////////////////////////////
@@ -121,6 +122,69 @@ void ConcaveMeshTest::RayTest(const std::string &_physicsEngine)
   EXPECT_DOUBLE_EQ(raySensor->Range(19), ignition::math::INF_D);
 }
 
+/////////////////////////////////////////////////
+void ConcaveMeshTest::ConvexHullsOnMeshTest(const std::string &_physicsEngine)
+{
+  Load("worlds/empty.world", true, _physicsEngine);
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != NULL);
+
+  // The mesh is a cube of 2 m, the static slab is 4x4x1 m and its top is
+  // at z = 1.
+  const std::string meshPath = std::string(TEST_PATH) + "/data/box.dae";
+  std::ostringstream slabStr;
+  slabStr << "<sdf version='" << SDF_VERSION << "'>"
+    << "<model name='slab'>"
+    << "  <static>true</static>"
+    << "  <pose>0 0 0.5 0 0 0</pose>"
+    << "  <link name='link'>"
+    << "    <collision name='collision'>"
+    << "      <geometry>"
+    << "        <mesh>"
+    << "          <uri>" << meshPath << "</uri>"
+    << "          <scale>2 2 0.5</scale>"
+    << "        </mesh>"
+    << "      </geometry>"
+    << "    </collision>"
+    << "  </link>"
+    << "</model>"
+    << "</sdf>";
+  SpawnSDF(slabStr.str());
+
+  // A 0.5 m cube whose collision is decomposed into convex hulls, dropped
+  // onto the slab.
+  std::ostringstream cubeStr;
+  cubeStr << "<sdf version='" << SDF_VERSION << "'>"
+    << "<model name='cube'>"
+    << "  <pose>0 0 1.5 0 0 0</pose>"
+    << "  <link name='link'>"
+    << "    <collision name='collision'>"
+    << "      <geometry>"
+    << "        <mesh>"
+    << "          <uri>" << meshPath << "</uri>"
+    << "          <scale>0.25 0.25 0.25</scale>"
+    << "        </mesh>"
+    << "      </geometry>"
+    << "      <gz:mesh_simplification>"
+    << "        <convex_decomposition>true</convex_decomposition>"
+    << "      </gz:mesh_simplification>"
+    << "    </collision>"
+    << "  </link>"
+    << "</model>"
+    << "</sdf>";
+  SpawnSDF(cubeStr.str());
+
+  physics::ModelPtr cube = world->ModelByName("cube");
+  ASSERT_TRUE(cube != NULL);
+
+  world->Step(2000);
+
+  // The cube rests on the slab instead of falling through it to the
+  // ground plane.
+  EXPECT_NEAR(cube->WorldPose().Pos().Z(), 1.25, 0.02);
+  EXPECT_NEAR(cube->WorldLinearVel().Length(), 0.0, 0.01);
+}
+
 /////////////////////////////////////////////////
 TEST_P(ConcaveMeshTest, SubmeshCollisionTest)
 {
@@ -163,6 +227,20 @@ TEST_P(ConcaveMeshTest, RayTest)
   }
 }
 
+/////////////////////////////////////////////////
+TEST_P(ConcaveMeshTest, ConvexHullsOnMeshTest)
+{
+  if (std::string(GetParam()) == "simbody" ||
+      std::string(GetParam()) == "dart")
+  {
+    gzdbg << "ConcaveMeshes not supported in " << GetParam() << "\n";
+  }
+  else
+  {
+    ConvexHullsOnMeshTest(GetParam());
+  }
+}
+
 INSTANTIATE_TEST_CASE_P(PhysicsEngines, ConcaveMeshTest, PHYSICS_ENGINE_VALUES,);  // NOLINT
 
 int main(int argc, char **argv)
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <atomic>
+#include <cstdlib>
+#include <string>
+
+#include "gazebo/common/Timer.hh"
+#include "gazebo/physics/physics.hh"
+#include "gazebo/rendering/Camera.hh"
+#include "gazebo/rendering/RenderEngine.hh"
+#include "gazebo/sensors/sensors.hh"
+#include "gazebo/test/ServerFixture.hh"
+
+using namespace gazebo;
+
+class HeadlessServer : public ServerFixture
+{
+};
+
+/////////////////////////////////////////////////
+// Without an X display, the server renders offscreen with EGL. The test is
+// only built when gazebo and OGRE have EGL support, so rendering must work.
+TEST_F(HeadlessServer, StartWithoutDisplay)
+{
+  Load("worlds/empty.world", true);
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != nullptr);
+
+  world->Step(100);
+  EXPECT_EQ(100u, world->Iterations());
+
+  rendering::RenderEngine *engine = rendering::RenderEngine::Instance();
+  ASSERT_TRUE(engine != nullptr);
+  ASSERT_NE(rendering::RenderEngine::NONE, engine->GetRenderPathType())
+      << "Rendering was disabled without an X display";
+  EXPECT_NE(rendering::RenderEngine::GLX, engine->GetContextType());
+
+  SpawnCamera("camera_model", "camera_sensor",
+      ignition::math::Vector3d(0, 0, 1), ignition::math::Vector3d::Zero,
+      320, 240, 10);
+  sensors::CameraSensorPtr camSensor =
+      std::dynamic_pointer_cast<sensors::CameraSensor>(
+      sensors::get_sensor("camera_sensor"));
+  ASSERT_TRUE(camSensor != nullptr);
+
+  // The camera must produce frames through the EGL context
+  std::atomic<int> imageCount(0);
+  event::ConnectionPtr c = camSensor->Camera()->ConnectNewImageFrame(
+      [&imageCount](const unsigned char *, unsigned int, unsigned int,
+                    unsigned int, const std::string &)
+      {
+        ++imageCount;
+      });
+
+  common::Timer timer;
+  timer.Start();
+  while (imageCount < 5 && timer.GetElapsed().Double() < 10)
+  {
+    world->Step(100);
+    common::Time::MSleep(10);
+  }
+  EXPECT_GE(imageCount.load(), 5);
+}
+
+/////////////////////////////////////////////////
+/// Main
+int main(int argc, char **argv)
+{
+  // The render engine picks its context when it is created, so the display
+  // must be gone before the server loads.
+  unsetenv("DISPLAY");
+  unsetenv("GAZEBO_RENDER_CONTEXT");
+
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -61,6 +61,12 @@ class JointForceTorqueTest : public ServerFixture,
   /// Apply force and check acceleration against analytical solution.
   /// \param[in] _physicsEngine Type of physics engine to use.
   public: void JointTorqueTest(const std::string &_physicsEngine);
+
+  /// \brief Load example world with a few joints, and update the joints
+  /// from several threads after each step.
+  /// Measure / verify static force torques against analytical answers.
+  /// \param[in] _physicsEngine Type of physics engine to use.
+  public: void ForceTorqueThreads(const std::string &_physicsEngine);
 };
 
 /////////////////////////////////////////////////
@@ -622,6 +628,54 @@ void JointForceTorqueTest::JointTorqueTest(const std::string &_physicsEngine)
   }
 }
 
+/////////////////////////////////////////////////
+void JointForceTorqueTest::ForceTorqueThreads(
+    const std::string &_physicsEngine)
+{
+  if (_physicsEngine != "simbody")
+  {
+    gzerr << "Only Simbody updates the joints from several threads"
+          << std::endl;
+    return;
+  }
+
+  Load("worlds/force_torque_test.world", true, _physicsEngine);
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != NULL);
+
+  physics::PhysicsEnginePtr physics = world->Physics();
+  ASSERT_TRUE(physics != NULL);
+
+  EXPECT_FALSE(physics->SetParam("threads", 0));
+  EXPECT_TRUE(physics->SetParam("threads", 4));
+  EXPECT_EQ(4, boost::any_cast<int>(physics->GetParam("threads")));
+
+  physics->SetGravity(ignition::math::Vector3d(0, 0, -50));
+
+  physics::ModelPtr model_1 = world->ModelByName("model_1");
+  ASSERT_TRUE(model_1 != NULL);
+  physics::JointPtr joint_01 = model_1->GetJoint("joint_01");
+  physics::JointPtr joint_12 = model_1->GetJoint("joint_12");
+  ASSERT_TRUE(joint_01 != NULL);
+  ASSERT_TRUE(joint_12 != NULL);
+
+  // Same answers as ForceTorque1
+  for (unsigned int i = 0; i < 10; ++i)
+  {
+    world->Step(1);
+
+    physics::JointWrench wrench_01 = joint_01->GetForceTorque(0u);
+    EXPECT_FLOAT_EQ(wrench_01.body1Force.Z(), 1000.0);
+    EXPECT_FLOAT_EQ(wrench_01.body2Force.Z(), -1000.0);
+
+    physics::JointWrench wrench_12 = joint_12->GetForceTorque(0u);
+    EXPECT_FLOAT_EQ(wrench_12.body1Force.Z(), 500.0);
+    EXPECT_FLOAT_EQ(wrench_12.body2Force.Z(), -500.0);
+  }
+
+  EXPECT_TRUE(physics->SetParam("threads", 1));
+}
+
 TEST_P(JointForceTorqueTest, ForceTorque1)
 {
   ForceTorque1(GetParam());
@@ -647,6 +701,11 @@ TEST_P(JointForceTorqueTest, JointTorqueTest)
   JointTorqueTest(GetParam());
 }
 
+TEST_P(JointForceTorqueTest, ForceTorqueThreads)
+{
+  ForceTorqueThreads(GetParam());
+}
+
 INSTANTIATE_TEST_CASE_P(PhysicsEngines, JointForceTorqueTest,
                         PHYSICS_ENGINE_VALUES,);  // NOLINT
 
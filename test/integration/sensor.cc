@@ -15,7 +15,9 @@
  *
 */
 #include <string.h>
+#include "gazebo/common/ScopeProfiler.hh"
 #include "gazebo/test/ServerFixture.hh"
+#include "gazebo/test/helper_profiler.hh"
 
 using namespace gazebo;
 class SensorTest : public ServerFixture
@@ -153,6 +155,40 @@ TEST_F(SensorTest, MaxUpdateRate)
   EXPECT_NEAR(3.0, elapsed, 0.5);
 }
 
+/////////////////////////////////////////////////
+// Make sure the callbacks that a sensor plugin connects to the sensor
+// update event are attributed to the plugin by the profiler
+TEST_F(SensorTest, PluginProfileScope)
+{
+  common::ScopeProfiler::SetEnabled(true);
+  common::ScopeProfiler::Collect();
+  common::ScopeProfiler::Reset();
+
+  Load("worlds/contact.world");
+
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_NE(nullptr, world);
+
+  sensors::SensorPtr sensor = sensors::get_sensor("my_contact");
+  ASSERT_NE(nullptr, sensor);
+
+  // ContactPlugin connects to Sensor::ConnectUpdated
+  const std::string scope = "Plugin::libContactPlugin.so::" +
+      sensor->ScopedName() + "::my_plugin::sensorUpdated";
+
+  int sleep = 0;
+  int maxSleep = 500;
+  uint64_t count = 0;
+  while (count == 0 && sleep < maxSleep)
+  {
+    common::Time::MSleep(10);
+    common::ScopeProfiler::Collect();
+    count = gazebo::testing::FindProfileStats(scope).count;
+    sleep++;
+  }
+  EXPECT_GT(count, 0u);
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
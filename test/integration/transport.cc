@@ -766,6 +766,126 @@ TEST_F(TransportTest, Errors)
   testNode.reset();
 }
 
+/////////////////////////////////////////////////
+// Test the quality of service of subscribers that fall behind
+std::vector<double> g_qosLatest;
+std::vector<double> g_qosFirst;
+std::vector<double> g_qosAll;
+
+void ReceiveQoSLatest(ConstVector3dPtr &_msg)
+{
+  g_qosLatest.push_back(_msg->x());
+}
+
+void ReceiveQoSFirst(ConstVector3dPtr &_msg)
+{
+  g_qosFirst.push_back(_msg->x());
+}
+
+void ReceiveQoSAll(ConstVector3dPtr &_msg)
+{
+  g_qosAll.push_back(_msg->x());
+}
+
+TEST_F(TransportTest, SubscriberQoS)
+{
+  this->Load("worlds/empty.world");
+
+  std::string topic = "~/test/qos__";
+  transport::NodePtr testNode(new transport::Node());
+  testNode->Init();
+
+  transport::PublisherPtr pub = testNode->Advertise<msgs::Vector3d>(topic);
+  transport::SubscriberPtr latestSub =
+      testNode->Subscribe(topic, &ReceiveQoSLatest);
+  transport::SubscriberPtr firstSub =
+      testNode->Subscribe(topic, &ReceiveQoSFirst);
+  transport::SubscriberPtr allSub = testNode->Subscribe(topic, &ReceiveQoSAll);
+
+  latestSub->SetQoS(transport::QoS::LatestOnly());
+  firstSub->SetQoS(transport::QoS(3, transport::QoS::DROP_NEWEST));
+  EXPECT_EQ(1u, latestSub->GetQoS().Depth());
+  EXPECT_EQ(transport::QoS::DROP_NEWEST, firstSub->GetQoS().Policy());
+  EXPECT_EQ(0u, allSub->GetQoS().Depth());
+
+  // Let the messages pile up as if the subscribers were slow
+  transport::pause_incoming(true);
+  msgs::Vector3d msg;
+  for (unsigned int i = 0; i < 10; ++i)
+  {
+    msgs::Set(&msg, ignition::math::Vector3d(i, 0, 0));
+    pub->Publish(msg, true);
+  }
+  transport::pause_incoming(false);
+
+  int sleep = 0;
+  while (g_qosAll.size() < 10u && sleep < 50)
+  {
+    common::Time::MSleep(100);
+    sleep++;
+  }
+
+  ASSERT_EQ(10u, g_qosAll.size());
+  ASSERT_EQ(1u, g_qosLatest.size());
+  EXPECT_DOUBLE_EQ(9.0, g_qosLatest[0]);
+  ASSERT_EQ(3u, g_qosFirst.size());
+  EXPECT_DOUBLE_EQ(0.0, g_qosFirst[0]);
+  EXPECT_DOUBLE_EQ(2.0, g_qosFirst[2]);
+
+  EXPECT_EQ(9u, latestSub->DroppedCount());
+  EXPECT_EQ(7u, firstSub->DroppedCount());
+  EXPECT_EQ(0u, allSub->DroppedCount());
+  EXPECT_EQ(0u, pub->DroppedCount());
+}
+
+/////////////////////////////////////////////////
+std::vector<std::string> g_sharedMsgs;
+void ReceiveSharedMsg(ConstGzStringPtr &_msg)
+{
+  g_sharedMsgs.push_back(_msg->data());
+}
+
+/////////////////////////////////////////////////
+// Publish messages that the publisher shares instead of copying
+TEST_F(TransportTest, SharedMessage)
+{
+  this->Load("worlds/empty.world");
+
+  std::string topic = "~/test/shared";
+  transport::NodePtr testNode(new transport::Node());
+  testNode->Init();
+
+  transport::PublisherPtr pub = testNode->Advertise<msgs::GzString>(topic);
+  transport::SubscriberPtr sub = testNode->Subscribe(topic, &ReceiveSharedMsg);
+
+  for (unsigned int i = 0; i < 3; ++i)
+  {
+    boost::shared_ptr<msgs::GzString> msg(new msgs::GzString);
+    msg->set_data("shared_" + std::to_string(i));
+    pub->Publish(msg, true);
+  }
+
+  // Uninitialized messages are not published
+  pub->Publish(boost::shared_ptr<msgs::GzString>(new msgs::GzString), true);
+
+  int sleep = 0;
+  while (g_sharedMsgs.size() < 3u && sleep < 50)
+  {
+    common::Time::MSleep(100);
+    sleep++;
+  }
+  common::Time::MSleep(100);
+
+  ASSERT_EQ(3u, g_sharedMsgs.size());
+  EXPECT_EQ("shared_0", g_sharedMsgs[0]);
+  EXPECT_EQ("shared_2", g_sharedMsgs[2]);
+
+  // The message type is checked as for copied messages
+  EXPECT_THROW(pub->Publish(boost::shared_ptr<msgs::Vector3d>(
+      new msgs::Vector3d(msgs::Convert(ignition::math::Vector3d::Zero)))),
+      common::Exception);
+}
+
 /////////////////////////////////////////////////
 TEST_F(TransportTest, TryInit)
 {
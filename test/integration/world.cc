@@ -14,6 +14,9 @@
  * limitations under the License.
  *
 */
+#include <mutex>
+#include <vector>
+
 #include "gazebo/test/ServerFixture.hh"
 #include "gazebo/physics/Light.hh"
 #include "gazebo/physics/physics.hh"
@@ -671,6 +674,146 @@ TEST_F(WorldTest, URI)
       "data://world/default/model/model_00/model/model_01/link/link_01");
 }
 
+/////////////////////////////////////////////////
+/// \brief Update period statistics received on ~/world_stats, one per
+/// report.
+std::vector<msgs::WorldStatistics::StepPeriod> g_stepPeriods;
+
+/// \brief Mutex protecting g_stepPeriods.
+std::mutex g_stepPeriodMutex;
+
+/////////////////////////////////////////////////
+void onWorldStats(ConstWorldStatisticsPtr &_msg)
+{
+  std::lock_guard<std::mutex> lock(g_stepPeriodMutex);
+  if (!_msg->has_step_period())
+    return;
+
+  // The last report is repeated in every message until the next one
+  const msgs::WorldStatistics::StepPeriod &period = _msg->step_period();
+  if (g_stepPeriods.empty() ||
+      g_stepPeriods.back().SerializeAsString() != period.SerializeAsString())
+  {
+    g_stepPeriods.push_back(period);
+  }
+}
+
+/////////////////////////////////////////////////
+TEST_F(WorldTest, PrecisePacing)
+{
+  Load("worlds/empty.world");
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != NULL);
+
+  EXPECT_FALSE(world->PrecisePacing());
+  EXPECT_EQ(-1, world->ThreadAffinity());
+  EXPECT_EQ(0, world->ThreadPriority());
+
+  world->SetPacingSpinTime(common::Time(0, 200000));
+  EXPECT_EQ(common::Time(0, 200000), world->PacingSpinTime());
+
+  world->Physics()->SetRealTimeUpdateRate(1000);
+  world->SetPrecisePacing(true);
+  EXPECT_TRUE(world->PrecisePacing());
+
+  transport::NodePtr node(new transport::Node());
+  node->Init();
+  transport::SubscriberPtr sub =
+    node->Subscribe("~/world_stats", &onWorldStats);
+
+  // Wait for reports that only cover precise pacing
+  common::Time::MSleep(1200);
+  {
+    std::lock_guard<std::mutex> lock(g_stepPeriodMutex);
+    g_stepPeriods.clear();
+  }
+  const size_t reports = 3;
+  for (int i = 0; i < 600; ++i)
+  {
+    {
+      std::lock_guard<std::mutex> lock(g_stepPeriodMutex);
+      if (g_stepPeriods.size() >= reports)
+        break;
+    }
+    common::Time::MSleep(10);
+  }
+
+  std::lock_guard<std::mutex> lock(g_stepPeriodMutex);
+  ASSERT_GE(g_stepPeriods.size(), reports);
+
+  // Loaded machines wake up late now and then, so check the steadiest of
+  // a few one-second reports.
+  const msgs::WorldStatistics::StepPeriod *best = nullptr;
+  for (auto const &period : g_stepPeriods)
+  {
+    gzmsg << "Step period mean [" << period.mean() * 1e6
+          << " us] jitter [" << period.jitter() * 1e6
+          << " us] max [" << period.max() * 1e6 << " us]" << std::endl;
+    if (!best || period.jitter() < best->jitter())
+      best = &period;
+  }
+  ASSERT_TRUE(best != nullptr);
+  EXPECT_DOUBLE_EQ(0.001, best->target());
+  EXPECT_GT(best->count(), 500u);
+  EXPECT_NEAR(0.001, best->mean(), 1e-4);
+  EXPECT_LT(best->jitter(), 2e-4);
+
+  // A paused world waits on the pause condition instead of spinning, and
+  // steps as soon as it is asked to
+  world->SetPaused(true);
+  common::Time::MSleep(100);
+  uint32_t iterations = world->Iterations();
+  world->Step(10);
+  EXPECT_EQ(iterations + 10, world->Iterations());
+}
+
+/////////////////////////////////////////////////
+/// \brief Last IO thread utilization received on ~/world_stats.
+std::vector<double> g_ioThreadUtilization;
+
+/// \brief Mutex protecting g_ioThreadUtilization.
+std::mutex g_ioThreadUtilizationMutex;
+
+/////////////////////////////////////////////////
+void onWorldStatsIO(ConstWorldStatisticsPtr &_msg)
+{
+  std::lock_guard<std::mutex> lock(g_ioThreadUtilizationMutex);
+  g_ioThreadUtilization.assign(_msg->io_thread_utilization().begin(),
+      _msg->io_thread_utilization().end());
+}
+
+/////////////////////////////////////////////////
+TEST_F(WorldTest, IOThreadUtilization)
+{
+  Load("worlds/empty.world");
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != NULL);
+
+  transport::NodePtr node(new transport::Node());
+  node->Init();
+  transport::SubscriberPtr sub =
+    node->Subscribe("~/world_stats", &onWorldStatsIO);
+
+  // The utilization is measured once per second
+  for (int i = 0; i < 300; ++i)
+  {
+    {
+      std::lock_guard<std::mutex> lock(g_ioThreadUtilizationMutex);
+      if (!g_ioThreadUtilization.empty())
+        break;
+    }
+    common::Time::MSleep(10);
+  }
+
+  std::lock_guard<std::mutex> lock(g_ioThreadUtilizationMutex);
+  EXPECT_EQ(transport::getIOThreads(), g_ioThreadUtilization.size());
+  for (auto const utilization : g_ioThreadUtilization)
+  {
+    EXPECT_GE(utilization, 0.0);
+    EXPECT_LE(utilization, 1.0);
+  }
+}
+
 INSTANTIATE_TEST_CASE_P(PhysicsEngines, WorldTest, PHYSICS_ENGINE_VALUES,);  // NOLINT
 
 /////////////////////////////////////////////////
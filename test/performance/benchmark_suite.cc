@@ -0,0 +1,577 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+// Headless end-to-end benchmarks of curated worlds, run with every physics
+// engine. The results are written as JSON to the file named by the
+// GAZEBO_BENCHMARK_OUTPUT environment variable, or benchmark_suite.json in
+// the working directory. Compare two result files with
+// tools/benchmark_compare.py. Set GAZEBO_BENCHMARK_STEPS to change the
+// number of measured steps.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "gazebo/gazebo_config.h"
+#include "gazebo/common/ScopeProfiler.hh"
+#include "gazebo/physics/physics.hh"
+#include "gazebo/util/LogRecord.hh"
+#include "gazebo/test/ServerFixture.hh"
+#include "gazebo/test/helper_physics_generator.hh"
+
+using namespace gazebo;
+
+/// \brief Counts the messages published on a topic.
+class MessageCounter
+{
+  /// \brief Callback for every message.
+  public: void OnMessage(const std::string &/*_msg*/)
+  {
+    ++this->count;
+  }
+
+  /// \brief Topic name.
+  public: std::string topic;
+
+  /// \brief Number of messages received.
+  public: std::atomic<uint64_t> count{0};
+
+  /// \brief Subscriber to the topic.
+  public: transport::SubscriberPtr sub;
+};
+
+/// \brief Results of one benchmark run.
+class BenchmarkResult
+{
+  /// \brief Name of the world.
+  public: std::string world;
+
+  /// \brief Physics engine.
+  public: std::string physics;
+
+  /// \brief Number of measured steps.
+  public: unsigned int steps = 0;
+
+  /// \brief Simulated time of the measured steps, in seconds.
+  public: double simTime = 0;
+
+  /// \brief Wall clock time of the measured steps, in seconds.
+  public: double wallTime = 0;
+
+  /// \brief Peak resident memory during the run, in kB.
+  public: uint64_t peakMemory = 0;
+
+  /// \brief Messages per second of wall clock time, by topic.
+  public: std::vector<std::pair<std::string, double>> messageRates;
+
+  /// \brief Statistics of the profiled scopes.
+  public: std::vector<common::ProfileStats> scopes;
+};
+
+/// \brief Results of all the runs, written when the tests exit.
+static std::vector<BenchmarkResult> g_results;
+
+namespace
+{
+  /////////////////////////////////////////////////
+  /// \brief SDF of a dynamic box model.
+  std::string BoxModel(const std::string &_name,
+      const ignition::math::Vector3d &_pos, const double _size)
+  {
+    const double inertia = _size * _size / 6.0;
+    std::ostringstream sdf;
+    sdf << "<model name='" << _name << "'>"
+        << "<pose>" << _pos << " 0 0 0</pose>"
+        << "<link name='link'>"
+        << "<inertial><mass>1</mass><inertia>"
+        << "<ixx>" << inertia << "</ixx><iyy>" << inertia << "</iyy>"
+        << "<izz>" << inertia << "</izz></inertia></inertial>"
+        << "<collision name='collision'><geometry><box><size>"
+        << _size << " " << _size << " " << _size
+        << "</size></box></geometry></collision>"
+        << "</link></model>";
+    return sdf.str();
+  }
+
+  /////////////////////////////////////////////////
+  /// \brief SDF of a static box model.
+  std::string StaticBoxModel(const std::string &_name,
+      const ignition::math::Vector3d &_pos,
+      const ignition::math::Vector3d &_size)
+  {
+    std::ostringstream sdf;
+    sdf << "<model name='" << _name << "'><static>true</static>"
+        << "<pose>" << _pos << " 0 0 0</pose>"
+        << "<link name='link'><collision name='collision'><geometry><box>"
+        << "<size>" << _size << "</size></box></geometry></collision>"
+        << "</link></model>";
+    return sdf.str();
+  }
+
+  /////////////////////////////////////////////////
+  /// \brief SDF of a two wheeled robot with a caster.
+  std::string RobotModel(const std::string &_name,
+      const ignition::math::Vector3d &_pos)
+  {
+    std::ostringstream sdf;
+    sdf << "<model name='" << _name << "'>"
+        << "<pose>" << _pos << " 0 0 0</pose>"
+        << "<link name='chassis'><pose>0 0 0.1 0 0 0</pose>"
+        << "<inertial><mass>5</mass><inertia><ixx>0.05</ixx><iyy>0.07</iyy>"
+        << "<izz>0.1</izz></inertia></inertial>"
+        << "<collision name='collision'><geometry><box>"
+        << "<size>0.4 0.3 0.1</size></box></geometry></collision>"
+        << "<collision name='caster'><pose>-0.15 0 -0.05 0 0 0</pose>"
+        << "<geometry><sphere><radius>0.05</radius></sphere></geometry>"
+        << "<surface><friction><ode><mu>0</mu><mu2>0</mu2></ode></friction>"
+        << "</surface></collision></link>";
+
+    for (const std::string side : {"left", "right"})
+    {
+      const double y = side == "left" ? 0.2 : -0.2;
+      sdf << "<link name='" << side << "_wheel'>"
+          << "<pose>0.1 " << y << " 0.1 -1.5707 0 0</pose>"
+          << "<inertial><mass>0.5</mass><inertia><ixx>0.0013</ixx>"
+          << "<iyy>0.0013</iyy><izz>0.0025</izz></inertia></inertial>"
+          << "<collision name='collision'><geometry><cylinder>"
+          << "<radius>0.1</radius><length>0.05</length></cylinder>"
+          << "</geometry></collision></link>"
+          << "<joint name='" << side << "_wheel_joint' type='revolute'>"
+          << "<parent>chassis</parent><child>" << side << "_wheel</child>"
+          << "<axis><xyz>0 0 1</xyz></axis></joint>";
+    }
+    sdf << "</model>";
+    return sdf.str();
+  }
+
+  /////////////////////////////////////////////////
+  /// \brief SDF of a static post with a CPU ray sensor.
+  std::string RaySensorModel(const std::string &_name,
+      const ignition::math::Vector3d &_pos)
+  {
+    std::ostringstream sdf;
+    sdf << "<model name='" << _name << "'><static>true</static>"
+        << "<pose>" << _pos << " 0 0 0</pose>"
+        << "<link name='link'>"
+        << "<sensor name='laser' type='ray'><always_on>true</always_on>"
+        << "<update_rate>20</update_rate><ray><scan><horizontal>"
+        << "<samples>640</samples><resolution>1</resolution>"
+        << "<min_angle>-3.14159</min_angle><max_angle>3.14159</max_angle>"
+        << "</horizontal></scan>"
+        << "<range><min>0.1</min><max>10</max><resolution>0.01</resolution>"
+        << "</range></ray></sensor></link></model>";
+    return sdf.str();
+  }
+
+  /////////////////////////////////////////////////
+  /// \brief SDF of a world that steps 1 ms as fast as possible. The
+  /// physics engine is chosen when loading the world.
+  /// \param[in] _models SDF of the models in the world.
+  /// \param[in] _ground True to add a ground plane.
+  std::string WorldSdf(const std::string &_models, const bool _ground = true)
+  {
+    return std::string("<?xml version='1.0' ?><sdf version='1.6'>"
+        "<world name='default'>"
+        "<physics type='ode'><max_step_size>0.001</max_step_size>"
+        "<real_time_update_rate>0</real_time_update_rate></physics>") +
+        (_ground ? "<include><uri>model://ground_plane</uri></include>" : "") +
+        _models + "</world></sdf>";
+  }
+
+  /////////////////////////////////////////////////
+  /// \brief 96 boxes dropped in a pile.
+  std::string ContactPileWorld()
+  {
+    std::string models;
+    for (int z = 0; z < 6; ++z)
+    {
+      for (int x = 0; x < 4; ++x)
+      {
+        for (int y = 0; y < 4; ++y)
+        {
+          // Offset every other layer so that the boxes topple
+          const double offset = (z % 2) * 0.1;
+          models += BoxModel("box_" + std::to_string(z) + "_" +
+              std::to_string(x) + "_" + std::to_string(y),
+              ignition::math::Vector3d(x * 0.21 + offset, y * 0.21 + offset,
+                0.1 + z * 0.25), 0.2);
+        }
+      }
+    }
+    return WorldSdf(models);
+  }
+
+  /////////////////////////////////////////////////
+  /// \brief 16 wheeled robots driving in circles among obstacles.
+  std::string ManyRobotsWorld()
+  {
+    std::string models;
+    for (int x = 0; x < 4; ++x)
+    {
+      for (int y = 0; y < 4; ++y)
+      {
+        models += RobotModel("robot_" + std::to_string(x) + "_" +
+            std::to_string(y), ignition::math::Vector3d(x * 2.0, y * 2.0, 0));
+        models += StaticBoxModel("obstacle_" + std::to_string(x) + "_" +
+            std::to_string(y), ignition::math::Vector3d(
+              x * 2.0 + 1, y * 2.0 + 1, 0.25),
+            ignition::math::Vector3d(0.5, 0.5, 0.5));
+      }
+    }
+    return WorldSdf(models);
+  }
+
+  /////////////////////////////////////////////////
+  /// \brief 16 CPU ray sensors with 640 samples among obstacles.
+  std::string RaySensorsWorld()
+  {
+    std::string models;
+    for (int x = 0; x < 4; ++x)
+    {
+      for (int y = 0; y < 4; ++y)
+      {
+        models += RaySensorModel("ray_sensor_" + std::to_string(x) + "_" +
+            std::to_string(y), ignition::math::Vector3d(x * 3.0, y * 3.0, 0.5));
+        models += StaticBoxModel("obstacle_" + std::to_string(x) + "_" +
+            std::to_string(y), ignition::math::Vector3d(
+              x * 3.0 + 1.5, y * 3.0 + 0.5, 0.5),
+            ignition::math::Vector3d(0.5, 2, 1));
+      }
+    }
+    return WorldSdf(models);
+  }
+
+  /////////////////////////////////////////////////
+  /// \brief A 513x513 heightmap with 16 boxes sliding into it.
+  std::string HeightmapWorld()
+  {
+    std::string models =
+        "<model name='heightmap'><static>true</static><link name='link'>"
+        "<collision name='collision'><geometry><heightmap>"
+        "<uri>file://media/materials/textures/heightmap_bowl.png</uri>"
+        "<size>256 256 20</size><pos>0 0 0</pos><sampling>4</sampling>"
+        "</heightmap></geometry></collision></link></model>";
+    for (int x = 0; x < 4; ++x)
+    {
+      for (int y = 0; y < 4; ++y)
+      {
+        models += BoxModel("box_" + std::to_string(x) + "_" +
+            std::to_string(y), ignition::math::Vector3d(
+              40 + x * 2.0, y * 2.0, 22), 0.5);
+      }
+    }
+    return WorldSdf(models, false);
+  }
+
+  /////////////////////////////////////////////////
+  /// \brief Get the peak resident memory of the process, in kB.
+  uint64_t PeakMemory()
+  {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+      if (line.compare(0, 6, "VmHWM:") == 0)
+        return std::strtoull(line.c_str() + 6, nullptr, 10);
+    }
+    return 0;
+  }
+
+  /////////////////////////////////////////////////
+  /// \brief Reset the peak resident memory of the process to the current
+  /// resident memory, where supported.
+  void ResetPeakMemory()
+  {
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    if (clearRefs)
+      clearRefs << "5";
+  }
+
+  /////////////////////////////////////////////////
+  /// \brief Write a string as a JSON string.
+  std::string JsonString(const std::string &_value)
+  {
+    std::string result = "\"";
+    for (const char c : _value)
+    {
+      if (c == '"' || c == '\\')
+        result += '\\';
+      result += c;
+    }
+    return result + "\"";
+  }
+}
+
+/// \brief Parameters are the physics engine and the world.
+class BenchmarkSuite : public ServerFixture,
+    public ::testing::WithParamInterface<std::tuple<const char *, const char *>>
+{
+  /// \brief Load a world, step it and record the results.
+  /// \param[in] _world Name of the world.
+  /// \param[in] _physics Physics engine.
+  public: void Run(const std::string &_world, const std::string &_physics);
+
+  /// \brief Stop the server, then remove the files of the run.
+  protected: void TearDown() override
+  {
+    ServerFixture::TearDown();
+    if (!this->dir.empty())
+      boost::filesystem::remove_all(this->dir);
+  }
+
+  /// \brief Directory of the world and log files.
+  private: boost::filesystem::path dir;
+};
+
+/////////////////////////////////////////////////
+void BenchmarkSuite::Run(const std::string &_world,
+    const std::string &_physics)
+{
+  unsigned int steps = 2000;
+  const char *stepsEnv = std::getenv("GAZEBO_BENCHMARK_STEPS");
+  if (stepsEnv)
+  {
+    // strtoul returns 0 for a value that is not a number, and wraps
+    // negative values around
+    char *end = nullptr;
+    unsigned long value = std::strtoul(stepsEnv, &end, 10);
+    bool valid = end != stepsEnv && *end == '\0' && stepsEnv[0] != '-' &&
+        value >= 1 && value <= std::numeric_limits<unsigned int>::max();
+    ASSERT_TRUE(valid)
+      << "GAZEBO_BENCHMARK_STEPS must be a positive number of steps, not ["
+      << stepsEnv << "]";
+    steps = static_cast<unsigned int>(value);
+  }
+  const unsigned int warmupSteps = 200;
+
+  std::string sdf;
+  if (_world == "contact_pile" || _world == "logging")
+    sdf = ContactPileWorld();
+  else if (_world == "many_robots")
+    sdf = ManyRobotsWorld();
+  else if (_world == "ray_sensors")
+    sdf = RaySensorsWorld();
+  else if (_world == "heightmap")
+    sdf = HeightmapWorld();
+  ASSERT_FALSE(sdf.empty()) << "Unknown world " << _world;
+
+  if (_world == "heightmap" && _physics == "simbody")
+  {
+    gzerr << "Heightmaps are not supported by simbody, skipping test"
+          << std::endl;
+    return;
+  }
+
+  // Write the world to a file
+  this->dir = boost::filesystem::temp_directory_path() /
+      boost::filesystem::unique_path("gazebo_benchmark_%%%%%%%%");
+  boost::filesystem::create_directories(this->dir);
+  const std::string worldFile = (this->dir / (_world + ".world")).string();
+  {
+    std::ofstream out(worldFile);
+    out << sdf;
+  }
+
+  util::LogRecord *recorder = util::LogRecord::Instance();
+  if (_world == "logging")
+    recorder->Init("benchmark");
+
+  ResetPeakMemory();
+
+  // Same random numbers on every run, and sensors update at their rate
+  LoadArgs(worldFile + " -u -e " + _physics + " --seed 12345 --lockstep");
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != nullptr);
+  ASSERT_EQ(_physics, world->Physics()->GetType());
+
+  // Drive the robots in circles, as a controller plugin would
+  event::ConnectionPtr updateConnection;
+  if (_world == "many_robots")
+  {
+    std::vector<physics::JointPtr> wheels;
+    for (auto const &model : world->Models())
+    {
+      for (auto const &joint : model->GetJoints())
+        wheels.push_back(joint);
+    }
+    updateConnection = event::Events::ConnectWorldUpdateBegin(
+        [wheels](const common::UpdateInfo &)
+        {
+          for (size_t i = 0; i < wheels.size(); ++i)
+            wheels[i]->SetVelocity(0, i % 2 == 0 ? 4.0 : 2.0);
+        });
+  }
+
+  if (_world == "logging")
+  {
+    ASSERT_TRUE(recorder->Start("zlib", (this->dir / "log").string()));
+  }
+
+  std::vector<std::unique_ptr<MessageCounter>> counters;
+  std::vector<std::string> topics = {"~/pose/info", "~/world_stats"};
+  if (_world == "ray_sensors")
+    topics.push_back("~/ray_sensor_0_0/link/laser/scan");
+  for (auto const &topic : topics)
+  {
+    std::unique_ptr<MessageCounter> counter(new MessageCounter);
+    counter->topic = topic;
+    counter->sub = this->node->Subscribe(topic,
+        &MessageCounter::OnMessage, counter.get());
+    counters.push_back(std::move(counter));
+  }
+
+  world->Step(warmupSteps);
+
+  common::ScopeProfiler::SetEnabled(true);
+  common::ScopeProfiler::Collect();
+  common::ScopeProfiler::Reset();
+  for (auto &counter : counters)
+    counter->count = 0;
+
+  const common::Time simStart = world->SimTime();
+  const auto wallStart = std::chrono::steady_clock::now();
+  world->Step(steps);
+  const double wallTime = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - wallStart).count();
+  common::ScopeProfiler::Collect();
+
+  BenchmarkResult result;
+  result.world = _world;
+  result.physics = _physics;
+  result.steps = steps;
+  result.simTime = (world->SimTime() - simStart).Double();
+  result.wallTime = wallTime;
+  result.peakMemory = PeakMemory();
+  for (auto const &counter : counters)
+  {
+    result.messageRates.push_back(std::make_pair(counter->topic,
+          wallTime > 0 ? counter->count / wallTime : 0.0));
+  }
+  result.scopes = common::ScopeProfiler::Stats();
+
+  EXPECT_EQ(steps, world->Iterations() - warmupSteps);
+  EXPECT_GT(result.simTime, 0.0);
+
+  // Output the results for human testing purposes
+  gzmsg << _world << " [" << _physics << "]: RTF ["
+        << result.simTime / std::max(wallTime, 1e-9) << "] step ["
+        << wallTime / steps * 1e6 << " us] peak memory ["
+        << result.peakMemory << " kB]" << std::endl;
+
+  g_results.push_back(result);
+
+  if (_world == "logging")
+  {
+    EXPECT_GT(recorder->FileSize(), 0u);
+    recorder->Stop();
+  }
+}
+
+/////////////////////////////////////////////////
+TEST_P(BenchmarkSuite, World)
+{
+  this->Run(std::get<1>(GetParam()), std::get<0>(GetParam()));
+}
+
+INSTANTIATE_TEST_CASE_P(PhysicsEngines, BenchmarkSuite,
+    ::testing::Combine(PHYSICS_ENGINE_VALUES,
+      ::testing::Values("contact_pile", "many_robots", "ray_sensors",
+        "heightmap", "logging")));
+
+/////////////////////////////////////////////////
+/// \brief Write the results of all the runs as JSON.
+/// \param[in] _filename Path of the JSON file.
+/// \return True if the file was written.
+bool WriteResults(const std::string &_filename)
+{
+  std::ofstream out(_filename);
+  if (!out)
+  {
+    gzerr << "Unable to write benchmark results to [" << _filename << "]\n";
+    return false;
+  }
+
+  out << "{\n  \"gazebo_version\": " << JsonString(GAZEBO_VERSION_FULL)
+      << ",\n  \"results\": [";
+  for (size_t i = 0; i < g_results.size(); ++i)
+  {
+    const BenchmarkResult &result = g_results[i];
+    out << (i > 0 ? "," : "") << "\n    {\n"
+        << "      \"world\": " << JsonString(result.world) << ",\n"
+        << "      \"physics\": " << JsonString(result.physics) << ",\n"
+        << "      \"steps\": " << result.steps << ",\n"
+        << "      \"sim_time\": " << result.simTime << ",\n"
+        << "      \"wall_time\": " << result.wallTime << ",\n"
+        << "      \"rtf\": "
+        << (result.wallTime > 0 ? result.simTime / result.wallTime : 0.0)
+        << ",\n"
+        << "      \"peak_memory_kb\": " << result.peakMemory << ",\n"
+        << "      \"message_rates\": {";
+    for (size_t j = 0; j < result.messageRates.size(); ++j)
+    {
+      out << (j > 0 ? "," : "") << "\n        "
+          << JsonString(result.messageRates[j].first) << ": "
+          << result.messageRates[j].second;
+    }
+    out << "\n      },\n      \"scopes\": {";
+
+    // Durations in microseconds, per_step is the time spent in the scope
+    // divided by the number of steps
+    for (size_t j = 0; j < result.scopes.size(); ++j)
+    {
+      const common::ProfileStats &stats = result.scopes[j];
+      out << (j > 0 ? "," : "") << "\n        "
+          << JsonString(stats.name) << ": {"
+          << "\"count\": " << stats.count
+          << ", \"per_step_us\": " << stats.total / result.steps * 1e6
+          << ", \"mean_us\": "
+          << (stats.count > 0 ? stats.total / stats.count * 1e6 : 0.0)
+          << ", \"p50_us\": " << stats.p50 * 1e6
+          << ", \"p99_us\": " << stats.p99 * 1e6
+          << ", \"max_us\": " << stats.max * 1e6 << "}";
+    }
+    out << "\n      }\n    }";
+  }
+  out << "\n  ]\n}\n";
+
+  gzmsg << "Wrote benchmark results to [" << _filename << "]" << std::endl;
+  return true;
+}
+
+/////////////////////////////////////////////////
+/// Main
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  const int result = RUN_ALL_TESTS();
+
+  const char *output = std::getenv("GAZEBO_BENCHMARK_OUTPUT");
+  if (!WriteResults(output ? output : "benchmark_suite.json"))
+    return 1;
+  return result;
+}
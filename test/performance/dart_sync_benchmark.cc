@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <string>
+
+// required for HAVE_DART define
+#include <gazebo/gazebo_config.h>
+
+#include "gazebo/common/ScopeProfiler.hh"
+#include "gazebo/physics/ContactManager.hh"
+#include "gazebo/test/ServerFixture.hh"
+#include "gazebo/test/helper_profiler.hh"
+
+using namespace gazebo;
+
+class DARTSyncBenchmark : public ServerFixture {};
+
+/////////////////////////////////////////////////
+/// \brief Step the world and output the time spent in
+/// dart::simulation::World::step() and in the synchronization after it.
+/// \param[in] _world World to step.
+/// \param[in] _label Label of the output.
+void MeasureOverhead(physics::WorldPtr _world, const std::string &_label)
+{
+  const unsigned int steps = 2000;
+
+  common::ScopeProfiler::Collect();
+  common::ScopeProfiler::Reset();
+  _world->Step(steps);
+  common::ScopeProfiler::Collect();
+
+  common::ProfileStats step = gazebo::testing::FindProfileStats(
+      "DARTPhysics::Step");
+  common::ProfileStats sync = gazebo::testing::FindProfileStats(
+      "DARTPhysics::Sync");
+  EXPECT_EQ(steps, step.count);
+  EXPECT_EQ(steps, sync.count);
+
+  // Output the overhead for human testing purposes
+  gzmsg << _label << ": step [" << step.total / steps * 1e6
+        << " us] sync [" << sync.total / steps * 1e6 << " us] p99 ["
+        << sync.p99 * 1e6 << " us]" << std::endl;
+}
+
+/////////////////////////////////////////////////
+// Measure the per step overhead outside of dart::simulation::World::step()
+// in a world where most links don't move.
+TEST_F(DARTSyncBenchmark, Overhead)
+{
+#ifndef HAVE_DART
+  gzerr << "DART is not available, skipping test" << std::endl;
+  return;
+#endif
+
+  Load("test/worlds/dart_sync_benchmark.world", true);
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != nullptr);
+  ASSERT_EQ("dart", world->Physics()->GetType());
+
+  physics::ContactManager *manager = world->Physics()->GetContactManager();
+  ASSERT_TRUE(manager != nullptr);
+
+  common::ScopeProfiler::SetEnabled(true);
+
+  // Let the dynamic boxes settle
+  world->Step(500);
+
+  // No one listens to the contacts, so only the moving links are synced
+  EXPECT_FALSE(manager->ContactsRequested());
+  MeasureOverhead(world, "Contacts not requested");
+
+  // Convert the contacts every step, as was always done before
+  manager->SetNeverDropContacts(true);
+  MeasureOverhead(world, "Contacts requested");
+  EXPECT_GT(manager->GetContactCount(), 0u);
+  manager->SetNeverDropContacts(false);
+}
+
+/////////////////////////////////////////////////
+/// Main
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
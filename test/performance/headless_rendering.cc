@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+
+#include "gazebo/common/ScopeProfiler.hh"
+#include "gazebo/rendering/RenderEngine.hh"
+#include "gazebo/sensors/sensors.hh"
+#include "gazebo/test/ServerFixture.hh"
+
+using namespace gazebo;
+
+class HeadlessRendering : public ServerFixture
+{
+};
+
+/////////////////////////////////////////////////
+/// \brief Name of a render context type.
+std::string ContextName(const rendering::RenderEngine::ContextType _type)
+{
+  switch (_type)
+  {
+    case rendering::RenderEngine::EGL:
+      return "egl";
+    case rendering::RenderEngine::EGL_SOFTWARE:
+      return "egl_software";
+    default:
+      return "glx";
+  }
+}
+
+/////////////////////////////////////////////////
+// Measure the startup time of a world with camera, depth camera and GPU ray
+// sensors, and the time spent per frame rendering the camera and reading
+// back its image. Run once under Xvfb, and once with
+// GAZEBO_RENDER_CONTEXT=egl or egl_software and no DISPLAY, to compare the
+// two.
+TEST_F(HeadlessRendering, CameraSensors)
+{
+  const auto loadStart = std::chrono::steady_clock::now();
+  Load("worlds/empty.world");
+  const double loadTime = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - loadStart).count();
+
+  // Make sure the render engine is available.
+  rendering::RenderEngine *engine = rendering::RenderEngine::Instance();
+  if (engine->GetRenderPathType() == rendering::RenderEngine::NONE)
+  {
+    gzerr << "No rendering engine, unable to run headless rendering test\n";
+    return;
+  }
+
+  const auto spawnStart = std::chrono::steady_clock::now();
+  SpawnCamera("camera_model", "camera_sensor",
+      ignition::math::Vector3d(0, 0, 1), ignition::math::Vector3d::Zero,
+      640, 480, 0);
+  SpawnDepthCameraSensor("depth_model", "depth_sensor",
+      ignition::math::Vector3d(0, 1, 1), ignition::math::Vector3d::Zero,
+      640, 480, 0);
+  SpawnGpuRaySensor("gpu_ray_model", "gpu_ray_sensor",
+      ignition::math::Vector3d(0, 2, 1));
+  SpawnBox("box", ignition::math::Vector3d(1, 1, 1),
+      ignition::math::Vector3d(2, 0, 0.5), ignition::math::Vector3d::Zero);
+
+  sensors::CameraSensorPtr camSensor =
+      std::dynamic_pointer_cast<sensors::CameraSensor>(
+      sensors::get_sensor("camera_sensor"));
+  ASSERT_TRUE(camSensor != nullptr);
+  const double spawnTime = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - spawnStart).count();
+
+  std::atomic<unsigned int> frames(0);
+  event::ConnectionPtr c = camSensor->Camera()->ConnectNewImageFrame(
+      [&frames](const unsigned char *, unsigned int, unsigned int,
+          unsigned int, const std::string &)
+      {
+        ++frames;
+      });
+
+  common::ScopeProfiler::SetEnabled(true);
+  common::ScopeProfiler::Collect();
+  common::ScopeProfiler::Reset();
+
+  const auto start = std::chrono::steady_clock::now();
+  const unsigned int targetFrames = 200;
+  int sleep = 0;
+  while (frames < targetFrames && sleep++ < 3000)
+    common::Time::MSleep(10);
+  const double elapsed = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+  EXPECT_GE(frames, targetFrames);
+
+  common::ScopeProfiler::Collect();
+  common::ProfileStats render;
+  common::ProfileStats readBack;
+  for (auto const &stats : common::ScopeProfiler::Stats())
+  {
+    if (stats.name == "Camera::RenderImpl")
+      render = stats;
+    else if (stats.name == "Camera::PostRender")
+      readBack = stats;
+  }
+
+  // Output the results for human testing purposes
+  gzmsg << "Context [" << ContextName(engine->GetContextType()) << "]"
+        << " load [" << loadTime << " s]"
+        << " sensors [" << spawnTime << " s]"
+        << " camera fps [" << frames / elapsed << "]"
+        << " render mean [" << render.total /
+           std::max<uint64_t>(render.count, 1) * 1e3 << " ms]"
+        << " read back mean [" << readBack.total /
+           std::max<uint64_t>(readBack.count, 1) * 1e3 << " ms]"
+        << std::endl;
+}
+
+/////////////////////////////////////////////////
+/// Main
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
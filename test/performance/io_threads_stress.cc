@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gazebo/common/Time.hh>
+#include <gazebo/transport/transport.hh>
+
+#include "test/util.hh"
+
+using namespace gazebo;
+
+class IOThreadsStressTest : public gazebo::testing::AutoLogFixture,
+                            public ::testing::WithParamInterface<unsigned int>
+{
+};
+
+/// \brief Counts the bytes received on a connection.
+class Reader
+{
+  /// \brief Constructor.
+  /// \param[in] _conn Connection to read from.
+  /// \param[in] _bytes Counter of received bytes.
+  public: Reader(transport::ConnectionPtr _conn,
+                 std::atomic<uint64_t> &_bytes)
+          : conn(_conn), bytes(_bytes)
+  {
+  }
+
+  /// \brief Start reading.
+  public: void Start()
+  {
+    this->conn->AsyncRead(boost::bind(&Reader::OnRead, this,
+        boost::placeholders::_1));
+  }
+
+  /// \brief Count a message and read the next one.
+  /// \param[in] _data Message data.
+  private: void OnRead(const std::string &_data)
+  {
+    if (_data.empty())
+      return;
+
+    this->bytes += _data.size();
+    this->Start();
+  }
+
+  /// \brief Connection to read from.
+  public: transport::ConnectionPtr conn;
+
+  /// \brief Counter of received bytes.
+  private: std::atomic<uint64_t> &bytes;
+};
+
+/////////////////////////////////////////////////
+// Send data over many local connections, and measure the aggregate
+// throughput for a number of IO threads.
+TEST_P(IOThreadsStressTest, Throughput)
+{
+  const unsigned int threads = GetParam();
+  const unsigned int connectionCount = 32;
+  const unsigned int messageCount = 500;
+  const std::string payload(8192, 'x');
+
+  transport::setIOThreads(threads);
+
+  std::atomic<uint64_t> bytes(0);
+  std::mutex readersMutex;
+  std::vector<std::unique_ptr<Reader>> readers;
+
+  transport::ConnectionPtr server(new transport::Connection());
+  server->Listen(0, [&](const transport::ConnectionPtr &_conn)
+      {
+        std::lock_guard<std::mutex> lock(readersMutex);
+        readers.emplace_back(new Reader(_conn, bytes));
+        readers.back()->Start();
+      });
+
+  std::vector<transport::ConnectionPtr> clients;
+  for (unsigned int i = 0; i < connectionCount; ++i)
+  {
+    clients.emplace_back(new transport::Connection());
+    ASSERT_TRUE(clients.back()->Connect("127.0.0.1", server->GetLocalPort()));
+  }
+
+  for (int i = 0; i < 100; ++i)
+  {
+    {
+      std::lock_guard<std::mutex> lock(readersMutex);
+      if (readers.size() == connectionCount)
+        break;
+    }
+    common::Time::MSleep(10);
+  }
+  {
+    std::lock_guard<std::mutex> lock(readersMutex);
+    ASSERT_EQ(connectionCount, readers.size());
+  }
+
+  // Reset the utilization measurement
+  transport::getIOThreadUtilization();
+
+  const uint64_t expected =
+      static_cast<uint64_t>(connectionCount) * messageCount * payload.size();
+  common::Time startTime = common::Time::GetWallTime();
+
+  for (unsigned int m = 0; m < messageCount; ++m)
+  {
+    for (auto &client : clients)
+      client->EnqueueMsg(payload, true);
+  }
+
+  int waitCount = 0;
+  while (bytes < expected && waitCount < 6000)
+  {
+    common::Time::MSleep(10);
+    ++waitCount;
+  }
+  common::Time elapsed = common::Time::GetWallTime() - startTime;
+  std::vector<double> utilization = transport::getIOThreadUtilization();
+
+  EXPECT_EQ(expected, bytes);
+  EXPECT_EQ(threads, utilization.size());
+
+  std::ostringstream stream;
+  for (auto const &u : utilization)
+    stream << " " << static_cast<int>(u * 100) << "%";
+
+  // Output the throughput for human testing purposes
+  gzmsg << "IO threads [" << threads << "] connections [" << connectionCount
+        << "]: " << expected / (elapsed.Double() * 1e6) << " MB/s, "
+        << "thread utilization [" << stream.str() << " ]" << std::endl;
+
+  for (auto &client : clients)
+    client->Shutdown();
+  clients.clear();
+  server->Shutdown();
+  server.reset();
+  {
+    std::lock_guard<std::mutex> lock(readersMutex);
+    for (auto &reader : readers)
+      reader->conn->Shutdown();
+    readers.clear();
+  }
+
+  transport::setIOThreads(0);
+}
+
+INSTANTIATE_TEST_CASE_P(Threads, IOThreadsStressTest,
+    ::testing::Values(1u, 2u, 4u));
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <algorithm>
+#include <string>
+#include <thread>
+
+#include "gazebo/common/Console.hh"
+#include "gazebo/gui/GuiEvents.hh"
+#include "gazebo/gui/ModelListWidget.hh"
+
+#include "model_list_stress.hh"
+
+/////////////////////////////////////////////////
+void ModelListStressTest::SpawnModels()
+{
+  this->resMaxPercentChange = 50.0;
+  this->shareMaxPercentChange = 10.0;
+
+  const int modelCount = 5000;
+
+  gazebo::gui::ModelListWidget *modelListWidget =
+      new gazebo::gui::ModelListWidget;
+  modelListWidget->show();
+  modelListWidget->setGeometry(0, 0, 400, 800);
+  QCoreApplication::processEvents();
+
+  this->Load("worlds/empty.world");
+
+  QTreeWidget *modelTreeWidget = modelListWidget->findChild<QTreeWidget *>(
+      "modelTreeWidget");
+  QVERIFY(modelTreeWidget != nullptr);
+  QList<QTreeWidgetItem *> treeModelItems =
+      modelTreeWidget->findItems(tr("Models"), Qt::MatchExactly);
+  QCOMPARE(treeModelItems.size(), 1);
+  QTreeWidgetItem *modelsItem = treeModelItems.front();
+  modelsItem->setExpanded(true);
+  const int startCount = modelsItem->childCount();
+
+  // Measure the longest time between two ticks of a timer on the GUI
+  // thread, which is how long the GUI doesn't respond to the user.
+  QElapsedTimer tickTimer;
+  qint64 maxStall = 0;
+  QTimer heartbeat;
+  QObject::connect(&heartbeat, &QTimer::timeout, [&]()
+      {
+        maxStall = std::max(maxStall, tickTimer.restart());
+      });
+  tickTimer.start();
+  heartbeat.start(1);
+
+  // Send the model messages from another thread, as the transport does.
+  // Every model is sent twice, the second message updates the first.
+  QElapsedTimer elapsed;
+  elapsed.start();
+  std::thread producer([modelCount]()
+      {
+        for (int round = 0; round < 2; ++round)
+        {
+          for (int i = 0; i < modelCount; ++i)
+          {
+            const std::string name = "stress_model_" + std::to_string(i);
+            gazebo::msgs::Model msg;
+            msg.set_name(name);
+            msg.set_id(100000 + i);
+            for (int j = 0; j < 3; ++j)
+            {
+              auto link = msg.add_link();
+              link->set_name(name + "::link_" + std::to_string(j));
+              link->set_id(200000 + i * 10 + j);
+            }
+            for (int j = 0; j < 2; ++j)
+            {
+              auto joint = msg.add_joint();
+              joint->set_name(name + "::joint_" + std::to_string(j));
+              joint->set_id(200000 + i * 10 + 3 + j);
+            }
+            gazebo::gui::Events::modelUpdate(msg);
+          }
+        }
+      });
+
+  int sleep = 0;
+  const int maxSleep = 12000;
+  while (modelsItem->childCount() < startCount + modelCount &&
+      sleep++ < maxSleep)
+  {
+    QTest::qWait(10);
+  }
+  const qint64 loadTime = elapsed.elapsed();
+  producer.join();
+  heartbeat.stop();
+
+  QVERIFY(sleep < maxSleep);
+  QCOMPARE(modelsItem->childCount(), startCount + modelCount);
+
+  // Children are added when a model is expanded: a header and the items
+  // of the links and of the joints
+  QTreeWidgetItem *modelItem = modelsItem->child(startCount);
+  QVERIFY(modelItem != nullptr);
+  QCOMPARE(modelItem->childCount(), 0);
+  modelItem->setExpanded(true);
+  QCOMPARE(modelItem->childCount(), 7);
+  QCOMPARE(modelItem->child(1)->text(0), QString("link_0"));
+
+  // Output the results for human testing purposes
+  gzmsg << modelCount << " models: added in [" << loadTime << " ms]"
+        << " longest GUI thread stall [" << maxStall << " ms]" << std::endl;
+
+  delete modelListWidget;
+}
+
+/////////////////////////////////////////////////
+int main(int _argc, char **_argv)
+{
+  // Run without a display
+  qputenv("QT_QPA_PLATFORM", "offscreen");
+
+  QApplication app(_argc, _argv);
+  ModelListStressTest test;
+  return QTest::qExec(&test, _argc, _argv);
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+
+#include <algorithm>
+#include <chrono>
+
+#include "gazebo/common/ScopeProfiler.hh"
+#include "gazebo/test/ServerFixture.hh"
+#include "gazebo/test/helper_profiler.hh"
+
+using namespace gazebo;
+
+class ProfilerOverhead : public ServerFixture {};
+
+/////////////////////////////////////////////////
+/// \brief Step the world and get the wall time of the fastest step block.
+/// Taking the minimum over blocks filters out scheduling noise.
+/// \param[in] _world World to step.
+/// \param[in] _blocks Number of step blocks.
+/// \param[in] _steps Steps in each block.
+/// \return Wall time of a step in seconds.
+double StepTime(physics::WorldPtr _world, const unsigned int _blocks,
+    const unsigned int _steps)
+{
+  double best = 0;
+  for (unsigned int i = 0; i < _blocks; ++i)
+  {
+    auto start = std::chrono::steady_clock::now();
+    _world->Step(_steps);
+    double elapsed = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count() / _steps;
+    best = i == 0 ? elapsed : std::min(best, elapsed);
+
+    // Keep the thread buffers from filling up
+    common::ScopeProfiler::Collect();
+  }
+  return best;
+}
+
+/////////////////////////////////////////////////
+/// \brief Measure the cost of a single profiled scope.
+/// \return Cost of a scope in seconds.
+double ScopeCost()
+{
+  const unsigned int scopes = 100000;
+  common::ScopeProfiler::Collect();
+
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < scopes; ++i)
+  {
+    GZ_PROFILE("ProfilerOverhead::Scope");
+
+    // Drain the buffer before it is full. The time of the drain is
+    // counted, so this overestimates the cost of a scope.
+    if (i % 4096 == 4095)
+      common::ScopeProfiler::Collect();
+  }
+  double elapsed = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+
+  common::ScopeProfiler::Collect();
+  return elapsed / scopes;
+}
+
+/////////////////////////////////////////////////
+// Measure the overhead of the built-in profiler on the world update. The
+// overhead target is 1% of a step.
+TEST_F(ProfilerOverhead, WorldStep)
+{
+  Load("worlds/shapes.world", true);
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != nullptr);
+
+  const unsigned int blocks = 10;
+  const unsigned int steps = 500;
+
+  // Warm up
+  common::ScopeProfiler::SetEnabled(true);
+  world->Step(steps);
+  common::ScopeProfiler::Collect();
+  common::ScopeProfiler::Reset();
+
+  // Count the scopes recorded in one step
+  world->Step(steps);
+  common::ScopeProfiler::Collect();
+  uint64_t scopes = 0;
+  for (auto const &stats : common::ScopeProfiler::Stats())
+    scopes += stats.count;
+  double scopesPerStep = static_cast<double>(scopes) / steps;
+  EXPECT_GT(scopesPerStep, 0.0);
+
+  double scopeCost = ScopeCost();
+  EXPECT_EQ(100000u, gazebo::testing::FindProfileStats(
+      "ProfilerOverhead::Scope").count);
+
+  common::ScopeProfiler::SetEnabled(false);
+  double disabledTime = StepTime(world, blocks, steps);
+  common::ScopeProfiler::SetEnabled(true);
+  double enabledTime = StepTime(world, blocks, steps);
+
+  // The estimate from the cost of a scope does not depend on the noise of
+  // two separate step measurements, so it is the one that is checked.
+  double estimated = scopesPerStep * scopeCost / disabledTime;
+  double measured = (enabledTime - disabledTime) / disabledTime;
+
+  // Output the overhead for human testing purposes
+  gzmsg << "Scopes per step [" << scopesPerStep
+        << "] scope cost [" << scopeCost * 1e9
+        << " ns] step disabled [" << disabledTime * 1e6
+        << " us] step enabled [" << enabledTime * 1e6
+        << " us] estimated overhead [" << estimated * 100
+        << "%] measured overhead [" << measured * 100 << "%]" << std::endl;
+
+  EXPECT_LT(estimated, 0.01);
+
+  // The measured difference includes scheduling noise, so only catch
+  // gross regressions with it.
+  EXPECT_LT(measured, 0.1);
+}
+
+/////////////////////////////////////////////////
+/// Main
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
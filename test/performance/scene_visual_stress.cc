@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "gazebo/common/ScopeProfiler.hh"
+#include "gazebo/rendering/Scene.hh"
+#include "gazebo/test/ServerFixture.hh"
+#include "gazebo/test/helper_profiler.hh"
+
+using namespace gazebo;
+
+class SceneVisualStress : public RenderingFixture,
+                          public ::testing::WithParamInterface<unsigned int>
+{
+};
+
+/////////////////////////////////////////////////
+// Spawn thousands of models, each with a link, into the scene, and output
+// the time the render thread spends in Scene::ProcessVisualMsg. Every link
+// visual looks its parent up by name.
+TEST_P(SceneVisualStress, SpawnModels)
+{
+  const unsigned int modelCount = GetParam();
+
+  Load("worlds/empty.world");
+
+  rendering::ScenePtr scene = rendering::get_scene();
+  ASSERT_TRUE(scene != nullptr);
+
+  transport::PublisherPtr pub =
+    this->node->Advertise<msgs::Visual>("~/visual", modelCount * 2);
+  pub->WaitForConnection();
+
+  common::ScopeProfiler::SetEnabled(true);
+  common::ScopeProfiler::Collect();
+  common::ScopeProfiler::Reset();
+
+  const uint32_t startCount = scene->VisualCount();
+  const uint32_t firstId = 1000000;
+  for (unsigned int i = 0; i < modelCount; ++i)
+  {
+    const std::string modelName = "stress_model_" + std::to_string(i);
+
+    msgs::Visual modelMsg;
+    modelMsg.set_name(modelName);
+    modelMsg.set_id(firstId + i * 2);
+    modelMsg.set_parent_name(scene->Name());
+    modelMsg.set_type(msgs::Visual::MODEL);
+    pub->Publish(modelMsg);
+
+    msgs::Visual linkMsg;
+    linkMsg.set_name(modelName + "::link");
+    linkMsg.set_id(firstId + i * 2 + 1);
+    linkMsg.set_parent_name(modelName);
+    linkMsg.set_parent_id(modelMsg.id());
+    linkMsg.set_type(msgs::Visual::LINK);
+    pub->Publish(linkMsg);
+  }
+
+  // Wait for the render thread to create the visuals
+  const auto start = std::chrono::steady_clock::now();
+  int sleep = 0;
+  const int maxSleep = 1200;
+  while (scene->VisualCount() < startCount + modelCount * 2 &&
+         sleep++ < maxSleep)
+  {
+    common::Time::MSleep(50);
+  }
+  const double elapsed = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+  EXPECT_LT(sleep, maxSleep);
+  EXPECT_EQ(startCount + modelCount * 2, scene->VisualCount());
+
+  common::ScopeProfiler::Collect();
+  common::ProfileStats process = gazebo::testing::FindProfileStats(
+      "Scene::ProcessVisualMsg");
+  EXPECT_GE(process.count, modelCount * 2u);
+
+  // Look every visual up by name, as the GUI and plugins do
+  const auto lookupStart = std::chrono::steady_clock::now();
+  for (unsigned int i = 0; i < modelCount; ++i)
+  {
+    EXPECT_TRUE(scene->GetVisual(
+          "stress_model_" + std::to_string(i) + "::link") != nullptr);
+  }
+  const double lookup = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - lookupStart).count();
+
+  // Output the results for human testing purposes
+  gzmsg << modelCount << " models: wall [" << elapsed << " s]"
+        << " ProcessVisualMsg total [" << process.total << " s]"
+        << " mean [" << process.total / std::max<uint64_t>(process.count, 1)
+        * 1e6 << " us] p99 [" << process.p99 * 1e6 << " us]"
+        << " GetVisual(name) [" << lookup / modelCount * 1e6 << " us]"
+        << std::endl;
+}
+
+/////////////////////////////////////////////////
+// Move tens of thousands of visuals every frame, and output the time the
+// render thread spends applying the poses.
+TEST_P(SceneVisualStress, MoveVisuals)
+{
+  const unsigned int visualCount = GetParam() * 10;
+
+  Load("worlds/empty.world");
+
+  rendering::ScenePtr scene = rendering::get_scene();
+  ASSERT_TRUE(scene != nullptr);
+
+  // Visuals created on this thread are added directly to the scene
+  std::vector<rendering::VisualPtr> visuals;
+  for (unsigned int i = 0; i < visualCount; ++i)
+  {
+    rendering::VisualPtr vis(new rendering::Visual(
+          "moving_visual_" + std::to_string(i), scene->WorldVisual()));
+    scene->AddVisual(vis);
+    visuals.push_back(vis);
+  }
+
+  common::ScopeProfiler::SetEnabled(true);
+  common::ScopeProfiler::Collect();
+  common::ScopeProfiler::Reset();
+
+  const unsigned int frames = 100;
+  msgs::PosesStamped msg;
+  for (unsigned int i = 0; i < visualCount; ++i)
+    msg.add_pose()->set_id(visuals[i]->GetId());
+
+  for (unsigned int f = 1; f <= frames; ++f)
+  {
+    msgs::Set(msg.mutable_time(), common::Time(f, 0));
+    for (unsigned int i = 0; i < visualCount; ++i)
+    {
+      msgs::Set(msg.mutable_pose(i),
+          ignition::math::Pose3d(f, i, 0, 0, 0, 0));
+    }
+    scene->UpdatePoses(msg);
+
+    // Wait for the render thread to apply the poses
+    int sleep = 0;
+    while (scene->SimTime() != common::Time(f, 0) && sleep++ < 1000)
+      common::Time::MSleep(1);
+  }
+  EXPECT_EQ(common::Time(frames, 0), scene->SimTime());
+  EXPECT_EQ(ignition::math::Pose3d(frames, visualCount - 1, 0, 0, 0, 0),
+      visuals.back()->Pose());
+
+  common::ScopeProfiler::Collect();
+  common::ProfileStats apply = gazebo::testing::FindProfileStats(
+      "Scene::ApplyPoses");
+  EXPECT_GE(apply.count, frames);
+
+  // Output the results for human testing purposes
+  gzmsg << visualCount << " moving visuals: ApplyPoses mean ["
+        << apply.total / std::max<uint64_t>(apply.count, 1) * 1e6
+        << " us] p99 [" << apply.p99 * 1e6 << " us] max ["
+        << apply.max * 1e6 << " us]" << std::endl;
+
+  for (auto &vis : visuals)
+    scene->RemoveVisual(vis);
+}
+
+INSTANTIATE_TEST_CASE_P(ModelCount, SceneVisualStress,
+    ::testing::Values(1000u, 5000u));
+
+/////////////////////////////////////////////////
+/// Main
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -16,8 +16,13 @@
 */
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <sstream>
+#include <vector>
+#include <ignition/math/Rand.hh>
 #include "gazebo/physics/PhysicsIface.hh"
 #include "gazebo/common/Time.hh"
+#include "gazebo/sensors/Noise.hh"
 #include "gazebo/test/ServerFixture.hh"
 
 using namespace gazebo;
@@ -100,6 +105,61 @@ TEST_F(SensorStress_TEST, ResetWorldStressTest)
   }
 }
 
+/////////////////////////////////////////////////
+/// \brief Apply Gaussian noise to the ranges of a 64x2048 lidar scan, one
+/// range at a time and in one batch, and output the time per scan.
+TEST_F(SensorStress_TEST, NoiseApply)
+{
+  const size_t rangeCount = 64 * 2048;
+  const unsigned int scanCount = 50;
+
+  std::ostringstream noiseStream;
+  noiseStream << "<sdf version='1.6'>"
+              << "  <noise type='gaussian'>"
+              << "    <mean>0.0</mean>"
+              << "    <stddev>0.01</stddev>"
+              << "  </noise>"
+              << "</sdf>";
+  sdf::ElementPtr noiseSdf(new sdf::Element);
+  sdf::initFile("noise.sdf", noiseSdf);
+  ASSERT_TRUE(sdf::readString(noiseStream.str(), noiseSdf));
+
+  sensors::NoisePtr noise = sensors::NoiseFactory::NewNoiseModel(noiseSdf);
+  ASSERT_TRUE(noise != nullptr);
+  noise->SetSeed(sensors::Noise::StreamSeed(
+      ignition::math::Rand::Seed(), "sensor_stress"));
+
+  std::vector<double> ranges(rangeCount, 10.0);
+
+  // One virtual call per range
+  common::Time start = common::Time::GetWallTime();
+  for (unsigned int s = 0; s < scanCount; ++s)
+  {
+    for (auto &range : ranges)
+      range = noise->Apply(10.0);
+  }
+  double scalarTime =
+      (common::Time::GetWallTime() - start).Double() / scanCount;
+
+  // One call per scan
+  start = common::Time::GetWallTime();
+  for (unsigned int s = 0; s < scanCount; ++s)
+  {
+    std::fill(ranges.begin(), ranges.end(), 10.0);
+    noise->Apply(ranges.data(), ranges.size());
+  }
+  double batchTime =
+      (common::Time::GetWallTime() - start).Double() / scanCount;
+
+  for (auto const &range : ranges)
+    EXPECT_NEAR(10.0, range, 0.1);
+
+  // Output the time per scan for human testing purposes
+  gzmsg << "Noise on [" << rangeCount << "] ranges: per range ["
+        << scalarTime * 1e3 << " ms] batch [" << batchTime * 1e3
+        << " ms] speedup [" << scalarTime / batchTime << "]" << std::endl;
+}
+
 /////////////////////////////////////////////////
 int main(int argc, char **argv)
 {
@@ -15,6 +15,11 @@
  *
 */
 
+#include <algorithm>
+#include <deque>
+#include <set>
+#include <vector>
+
 #include <boost/thread.hpp>
 #include "gazebo/test/ServerFixture.hh"
 #include "RAMLibrary.hh"
@@ -236,6 +241,227 @@ TEST_F(TransportStressTest, ManyNodes)
   delete [] fakeData;
 }
 
+/////////////////////////////////////////////////
+std::vector<double> g_latencies;
+
+void LatencyCB(ConstTimePtr &_msg)
+{
+  common::Time latency = common::Time::GetWallTime() - msgs::Convert(*_msg);
+
+  boost::mutex::scoped_lock lock(g_mutex);
+  g_latencies.push_back(latency.Double());
+}
+
+/////////////////////////////////////////////////
+/// \brief Measure the latency of handing a wall time stamp to another
+/// thread through a condition variable, at the same rate as the messages.
+/// This is the baseline of the machine's scheduling latency.
+/// \param[in] _count Number of stamps to hand over.
+/// \return Sorted latencies, in seconds.
+std::vector<double> HandoffLatencies(const unsigned int _count)
+{
+  boost::mutex mutex;
+  boost::condition_variable cond;
+  std::deque<common::Time> stamps;
+  std::vector<double> latencies;
+  latencies.reserve(_count);
+
+  boost::thread consumer([&]()
+  {
+    boost::mutex::scoped_lock lock(mutex);
+    while (latencies.size() < _count)
+    {
+      while (stamps.empty())
+        cond.wait(lock);
+      latencies.push_back(
+          (common::Time::GetWallTime() - stamps.front()).Double());
+      stamps.pop_front();
+    }
+  });
+
+  for (unsigned int i = 0; i < _count; ++i)
+  {
+    {
+      boost::mutex::scoped_lock lock(mutex);
+      stamps.push_back(common::Time::GetWallTime());
+    }
+    cond.notify_one();
+    common::Time::MSleep(1);
+  }
+  consumer.join();
+
+  std::sort(latencies.begin(), latencies.end());
+  return latencies;
+}
+
+/////////////////////////////////////////////////
+// Measure the time between publishing a small message at a control loop
+// rate and receiving it. Each message is stamped with the wall time at
+// which it is published.
+TEST_F(TransportStressTest, PublishLatency)
+{
+  Load("worlds/empty.world");
+
+  const unsigned int count = 2000;
+  {
+    boost::mutex::scoped_lock lock(g_mutex);
+    g_latencies.clear();
+    g_latencies.reserve(count);
+  }
+
+  transport::NodePtr testNode = transport::NodePtr(new transport::Node());
+  testNode->Init("default");
+
+  transport::PublisherPtr pub = testNode->Advertise<msgs::Time>(
+      "~/test/latency__", count);
+  transport::SubscriberPtr sub = testNode->Subscribe("~/test/latency__",
+      &LatencyCB);
+
+  // Publish at 1 kHz
+  msgs::Time msg;
+  for (unsigned int i = 0; i < count; ++i)
+  {
+    msgs::Set(&msg, common::Time::GetWallTime());
+    pub->Publish(msg);
+    common::Time::MSleep(1);
+  }
+
+  // Wait for all the messages
+  int waitCount = 0;
+  while (waitCount < 50)
+  {
+    {
+      boost::mutex::scoped_lock lock(g_mutex);
+      if (g_latencies.size() >= count)
+        break;
+    }
+    common::Time::MSleep(100);
+    waitCount++;
+  }
+
+  std::vector<double> latencies;
+  {
+    boost::mutex::scoped_lock lock(g_mutex);
+    latencies = g_latencies;
+  }
+  ASSERT_EQ(count, latencies.size());
+
+  std::sort(latencies.begin(), latencies.end());
+  double p50 = latencies[latencies.size() / 2];
+  double p99 = latencies[latencies.size() * 99 / 100];
+
+  // Baseline on the same machine, under the same load
+  std::vector<double> baseline = HandoffLatencies(count);
+  double baselineP50 = baseline[baseline.size() / 2];
+  double baselineP99 = baseline[baseline.size() * 99 / 100];
+
+  // Output the latency for human testing purposes
+  gzmsg << "Publish to receive latency of " << count << " messages: "
+        << "p50 [" << p50 * 1e3 << "] ms, p99 [" << p99 * 1e3 << "] ms, "
+        << "max [" << latencies.back() * 1e3 << "] ms" << std::endl;
+  gzmsg << "Thread handoff baseline: "
+        << "p50 [" << baselineP50 * 1e3 << "] ms, "
+        << "p99 [" << baselineP99 * 1e3 << "] ms" << std::endl;
+
+  // Messages must not wait for the 100 ms fallback period of the
+  // connection manager, which would put the median around 50 ms. A message
+  // crosses a few more threads than the baseline, and the margins scale
+  // with the scheduling latency of a loaded machine.
+  EXPECT_LT(p50, 4 * baselineP50 + 0.02);
+  EXPECT_LT(p99, 4 * baselineP99 + 0.05);
+}
+
+/////////////////////////////////////////////////
+unsigned int g_fanOutCount = 0;
+std::set<const msgs::PosesStamped *> g_fanOutMsgs;
+
+void FanOutCB(ConstPosesStampedPtr &_msg)
+{
+  boost::mutex::scoped_lock lock(g_mutex);
+  g_fanOutMsgs.insert(_msg.get());
+  g_fanOutCount++;
+}
+
+/////////////////////////////////////////////////
+// Deliver serialized messages, as received from a remote publisher, to
+// many nodes subscribed to the same topic. Each message must be decoded
+// once and shared by all the subscribers.
+TEST_F(TransportStressTest, ManySubscribers)
+{
+  Load("worlds/empty.world");
+
+  const unsigned int nodeCount = 50;
+  const unsigned int msgCount = 1000;
+  const std::string topic = "~/test/fan_out__";
+
+  {
+    boost::mutex::scoped_lock lock(g_mutex);
+    g_fanOutCount = 0;
+    g_fanOutMsgs.clear();
+  }
+
+  transport::NodePtr pubNode(new transport::Node());
+  pubNode->Init("default");
+  transport::PublisherPtr pub = pubNode->Advertise<msgs::PosesStamped>(topic);
+
+  std::vector<transport::NodePtr> nodes;
+  std::vector<transport::SubscriberPtr> subs;
+  for (unsigned int i = 0; i < nodeCount; ++i)
+  {
+    nodes.push_back(transport::NodePtr(new transport::Node()));
+    nodes.back()->Init("default");
+    subs.push_back(nodes.back()->Subscribe(topic, &FanOutCB));
+  }
+
+  transport::PublicationPtr publication =
+      transport::TopicManager::Instance()->FindPublication(
+      pubNode->DecodeTopicName(topic));
+  ASSERT_TRUE(publication != NULL);
+
+  // A message similar to ~/pose/info with 100 models
+  msgs::PosesStamped msg;
+  msgs::Set(msg.mutable_time(), common::Time::GetWallTime());
+  for (unsigned int i = 0; i < 100; ++i)
+  {
+    msgs::Pose *pose = msg.add_pose();
+    pose->set_name("model_" + std::to_string(i));
+    pose->set_id(i);
+    msgs::Set(pose, ignition::math::Pose3d(i, i, i, 0, 0, 0));
+  }
+  std::string data;
+  msg.SerializeToString(&data);
+
+  common::Time startTime = common::Time::GetWallTime();
+  for (unsigned int i = 0; i < msgCount; ++i)
+    publication->LocalPublish(data);
+
+  const unsigned int expected = nodeCount * msgCount;
+  int waitCount = 0;
+  while (waitCount < 1000)
+  {
+    {
+      boost::mutex::scoped_lock lock(g_mutex);
+      if (g_fanOutCount >= expected)
+        break;
+    }
+    common::Time::MSleep(10);
+    waitCount++;
+  }
+  common::Time elapsed = common::Time::GetWallTime() - startTime;
+
+  boost::mutex::scoped_lock lock(g_mutex);
+  EXPECT_EQ(expected, g_fanOutCount);
+
+  // Every subscriber received the same decoded message
+  EXPECT_EQ(msgCount, g_fanOutMsgs.size());
+
+  // Output the throughput for human testing purposes
+  gzmsg << "Delivered " << msgCount << " messages to " << nodeCount
+        << " subscribers in " << elapsed.Double() << " s, "
+        << elapsed.Double() * 1e6 / expected << " us per callback"
+        << std::endl;
+}
+
 /////////////////////////////////////////////////
 // Main function
 int main(int argc, char **argv)
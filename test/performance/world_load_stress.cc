@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2026 Open Source Robotics Foundation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+*/
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <boost/filesystem.hpp>
+
+#include "gazebo/common/MeshManager.hh"
+#include "gazebo/test/ServerFixture.hh"
+#include "test_config.h"
+
+using namespace gazebo;
+
+class WorldLoadStressTest : public ServerFixture,
+                            public testing::WithParamInterface<unsigned int>
+{
+  /// \brief Write a world with _count static models, each with a mesh
+  /// collision from a distinct file so that every mesh is parsed.
+  /// \param[in] _count Number of models.
+  /// \return Path to the world file.
+  public: std::string WriteWorld(const unsigned int _count);
+
+  /// \brief Directory holding the generated world and meshes.
+  public: boost::filesystem::path dir;
+};
+
+/////////////////////////////////////////////////
+std::string WorldLoadStressTest::WriteWorld(const unsigned int _count)
+{
+  this->dir = boost::filesystem::current_path() / "tmp" / "world_load";
+  boost::filesystem::remove_all(this->dir);
+  boost::filesystem::create_directories(this->dir / "meshes");
+
+  boost::filesystem::path mesh = boost::filesystem::path(PROJECT_SOURCE_PATH)
+      / "media" / "models" / "chair3" / "models" / "chair.dae";
+
+  std::ostringstream world;
+  world << "<?xml version='1.0'?>\n"
+        << "<sdf version='1.6'><world name='default'>\n"
+        << "<include><uri>model://ground_plane</uri></include>\n";
+
+  for (unsigned int i = 0; i < _count; ++i)
+  {
+    boost::filesystem::path copy =
+        this->dir / "meshes" / ("chair_" + std::to_string(i) + ".dae");
+    boost::filesystem::copy_file(mesh, copy);
+
+    world << "<model name='chair_" << i << "'><static>true</static>"
+          << "<pose>" << (i % 20) * 2 << " " << (i / 20) * 2 << " 0 0 0 0"
+          << "</pose><link name='link'><collision name='collision'>"
+          << "<geometry><mesh><uri>" << copy.string() << "</uri>"
+          << "<scale>0.01 0.01 0.01</scale></mesh></geometry>"
+          << "</collision></link></model>\n";
+  }
+  world << "</world></sdf>\n";
+
+  std::string filename = (this->dir / "world_load.world").string();
+  std::ofstream out(filename);
+  out << world.str();
+  return filename;
+}
+
+/////////////////////////////////////////////////
+// Measure the cold start of a world with many mesh models. The disk mesh
+// cache is disabled so that every mesh is parsed.
+TEST_P(WorldLoadStressTest, ColdStart)
+{
+  unsigned int count = GetParam();
+  std::string filename = this->WriteWorld(count);
+
+  common::MeshManager::Instance()->SetCachePath("");
+
+  common::Time startTime = common::Time::GetWallTime();
+  Load(filename, true);
+  common::Time elapsed = common::Time::GetWallTime() - startTime;
+
+  physics::WorldPtr world = physics::get_world("default");
+  ASSERT_TRUE(world != NULL);
+  EXPECT_EQ(count + 1u, world->ModelCount());
+
+  gzmsg << "Loaded a world with [" << count << "] mesh models in ["
+        << elapsed.Double() << "] s\n";
+
+  EXPECT_LT(elapsed, common::Time(count / 2, 0));
+
+  boost::filesystem::remove_all(this->dir);
+}
+
+INSTANTIATE_TEST_CASE_P(Models, WorldLoadStressTest,
+    ::testing::Values(100u, 300u));
+
+/////////////////////////////////////////////////
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
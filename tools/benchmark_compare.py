@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2026 Open Source Robotics Foundation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Compare two result files of the PERFORMANCE_benchmark_suite test.
+
+Usage:
+  benchmark_compare.py baseline.json candidate.json [--threshold 0.1]
+
+Runs are matched by world and physics engine. A run regresses when its
+real time factor drops, or when the per step time of a profiled scope or the
+peak memory grows, by more than the threshold. Scopes that take less than
+--min-us per step in the baseline are ignored, since their timing is mostly
+noise. A run of the baseline that is missing from the candidate counts as a
+regression. Exits with status 1 if any run regressed.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(filename):
+    with open(filename) as f:
+        data = json.load(f)
+    runs = {}
+    for result in data.get('results', []):
+        runs[(result['world'], result['physics'])] = result
+    return data.get('gazebo_version', '?'), runs
+
+
+def change(baseline, candidate):
+    if baseline == 0:
+        return 0.0
+    return (candidate - baseline) / baseline
+
+
+def compare_run(baseline, candidate, args):
+    """Return a list of (metric, baseline, candidate, change, regressed)."""
+    rows = []
+
+    rtf = change(baseline['rtf'], candidate['rtf'])
+    rows.append(('rtf', baseline['rtf'], candidate['rtf'], rtf,
+                 rtf < -args.threshold))
+
+    memory = change(baseline['peak_memory_kb'], candidate['peak_memory_kb'])
+    rows.append(('peak_memory_kb', baseline['peak_memory_kb'],
+                 candidate['peak_memory_kb'], memory,
+                 memory > args.memory_threshold))
+
+    for topic, rate in sorted(baseline.get('message_rates', {}).items()):
+        if topic in candidate.get('message_rates', {}):
+            other = candidate['message_rates'][topic]
+            rows.append(('rate ' + topic, rate, other, change(rate, other),
+                         False))
+
+    candidate_scopes = candidate.get('scopes', {})
+    for name, stats in sorted(baseline.get('scopes', {}).items()):
+        if name not in candidate_scopes:
+            continue
+        before = stats['per_step_us']
+        after = candidate_scopes[name]['per_step_us']
+        delta = change(before, after)
+        rows.append(('us/step ' + name, before, after, delta,
+                     before >= args.min_us and delta > args.threshold))
+    return rows
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Compare two benchmark suite result files.')
+    parser.add_argument('baseline', help='JSON results of the baseline')
+    parser.add_argument('candidate', help='JSON results to check')
+    parser.add_argument('--threshold', type=float, default=0.1,
+                        help='relative change of the RTF or of the time of '
+                             'a scope that is a regression (default 0.1)')
+    parser.add_argument('--memory-threshold', type=float, default=0.1,
+                        help='relative growth of the peak memory that is a '
+                             'regression (default 0.1)')
+    parser.add_argument('--min-us', type=float, default=1.0,
+                        help='ignore scopes faster than this per step in the '
+                             'baseline (default 1 us)')
+    parser.add_argument('--all', action='store_true',
+                        help='print every metric, not only regressions')
+    args = parser.parse_args()
+
+    baseline_version, baseline = load(args.baseline)
+    candidate_version, candidate = load(args.candidate)
+    print('Baseline %s, candidate %s' % (baseline_version, candidate_version))
+
+    regressions = 0
+    for key in sorted(baseline):
+        world, physics = key
+        if key not in candidate:
+            # A run that crashed or was skipped must not pass silently
+            print('\n%s [%s]: MISSING from the candidate' % (world, physics))
+            regressions += 1
+            continue
+
+        rows = compare_run(baseline[key], candidate[key], args)
+        failed = [row for row in rows if row[4]]
+        regressions += len(failed)
+
+        print('\n%s [%s]: %s' % (world, physics,
+                                 'REGRESSED' if failed else 'ok'))
+        for metric, before, after, delta, regressed in rows:
+            if regressed or args.all:
+                print('  %-50s %12.2f %12.2f %+7.1f%%%s' % (
+                    metric, before, after, delta * 100.0,
+                    '  <--' if regressed else ''))
+
+    for key in sorted(set(candidate) - set(baseline)):
+        print('\n%s [%s]: new in the candidate' % key)
+
+    print('\n%d regression(s)' % regressions)
+    return 1 if regressions else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
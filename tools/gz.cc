@@ -19,6 +19,8 @@
 #include <tinyxml.h>
 #include <boost/filesystem.hpp>
 #include <boost/algorithm/string.hpp>
+#include <algorithm>
+#include <memory>
 #include <streambuf>
 
 #include <gazebo/common/common.hh>
@@ -901,7 +903,9 @@ StatsCommand::StatsCommand()
     ("world-name,w", po::value<std::string>(), "World name.")
     ("duration,d", po::value<uint64_t>(), "Duration (seconds) to run.")
     ("plot,p", "Output comma-separated values, useful for processing and "
-     "plotting.");
+     "plotting.")
+    ("plugins", "Print the time spent in the event callbacks of each "
+     "plugin, per step and since the server started.");
 }
 
 /////////////////////////////////////////////////
@@ -910,7 +914,10 @@ void StatsCommand::HelpDetailed()
   std::cerr <<
     "\tPrint gzserver statics to standard out. If a name for the world, \n"
     "\toption -w, is not specified, the first world found on \n"
-    "\tthe Gazebo master will be used.\n"
+    "\tthe Gazebo master will be used. With --plugins, the time spent \n"
+    "\tin the event callbacks of each plugin is printed once per second.\n"
+    "\tIOThreads is the utilization of each transport IO thread of \n"
+    "\tgzserver over the last second.\n"
     << std::endl;
 }
 
@@ -928,6 +935,13 @@ bool StatsCommand::RunImpl()
   transport::SubscriberPtr sub =
     node->Subscribe("~/world_stats", &StatsCommand::CB, this);
 
+  transport::SubscriberPtr profilerSub;
+  if (this->vm.count("plugins"))
+  {
+    profilerSub =
+      node->Subscribe("~/profiler", &StatsCommand::ProfilerCB, this);
+  }
+
   boost::mutex::scoped_lock lock(this->sigMutex);
   if (this->vm.count("duration"))
     this->sigCondition.timed_wait(lock,
@@ -999,8 +1013,49 @@ void StatsCommand::CB(ConstWorldStatisticsPtr &_msg)
     fflush(stdout);
   }
   else
-    printf("Factor[%4.2f] SimTime[%4.2f] RealTime[%4.2f] Paused[%c]\n",
+  {
+    printf("Factor[%4.2f] SimTime[%4.2f] RealTime[%4.2f] Paused[%c]",
         percent, simTime.Double(), realTime.Double(), paused);
+    if (_msg->io_thread_utilization_size() > 0)
+    {
+      printf(" IOThreads[");
+      for (int i = 0; i < _msg->io_thread_utilization_size(); ++i)
+      {
+        printf("%s%3.0f%%", i > 0 ? " " : "",
+            _msg->io_thread_utilization(i) * 100.0);
+      }
+      printf("]");
+    }
+    printf("\n");
+  }
+}
+
+/////////////////////////////////////////////////
+void StatsCommand::ProfilerCB(ConstProfilerStatisticsPtr &_msg)
+{
+  GZ_ASSERT(_msg, "Invalid message received");
+
+  uint64_t steps = std::max<uint64_t>(_msg->steps(), 1u);
+  for (int i = 0; i < _msg->scope_size(); ++i)
+  {
+    const msgs::ProfilerStatistics::Scope &scope = _msg->scope(i);
+    if (scope.name().compare(0, 8, "Plugin::") != 0)
+      continue;
+
+    if (this->vm.count("plot"))
+    {
+      printf("%s, %12.6f, %12.6f, %12.6f\n", scope.name().c_str(),
+          scope.total() / steps * 1e3, scope.max() * 1e3,
+          scope.cumulative());
+    }
+    else
+    {
+      printf("%s PerStep[%4.3f ms] Max[%4.3f ms] Cumulative[%4.3f s]\n",
+          scope.name().c_str(), scope.total() / steps * 1e3,
+          scope.max() * 1e3, scope.cumulative());
+    }
+  }
+  fflush(stdout);
 }
 
 /////////////////////////////////////////////////
@@ -1139,6 +1194,232 @@ bool SDFCommand::RunImpl()
   return true;
 }
 
+/////////////////////////////////////////////////
+HeightmapCommand::HeightmapCommand()
+  : Command("heightmap", "Bake and inspect heightmap tile caches")
+{
+  // Options that are visible to the user through help.
+  this->visibleOptions.add_options()
+    ("bake,b", po::value<std::string>(),
+     "Bake a tile cache from a heightmap image or DEM file.")
+    ("output,o", po::value<std::string>(),
+     "Tile cache file to write. Defaults to the input file with a .gzhtc "
+     "extension.")
+    ("size,s", po::value<std::string>(),
+     "Terrain size in meters. Comma separated 3-tuple without whitespace, "
+     "eg: -s 50000,50000,800. Defaults to the DEM extents, or 1,1,1 for "
+     "images.")
+    ("sampling,a", po::value<int>()->default_value(2),
+     "Heightmap sampling, must be a power of 2.")
+    ("tile-size,t", po::value<unsigned int>()->default_value(256),
+     "Number of vertices per tile side.")
+    ("info,i", po::value<std::string>(), "Print information about a tile "
+     "cache.");
+}
+
+/////////////////////////////////////////////////
+void HeightmapCommand::HelpDetailed()
+{
+  std::cerr <<
+    "\tBake a heightmap image or DEM file into a tile cache once, then\n"
+    "\tuse the cache file as the <uri> of a heightmap collision so that\n"
+    "\tits heights are paged from disk on demand.\n"
+    << std::endl;
+}
+
+/////////////////////////////////////////////////
+bool HeightmapCommand::TransportRequired()
+{
+  return false;
+}
+
+/////////////////////////////////////////////////
+bool HeightmapCommand::RunImpl()
+{
+  if (this->vm.count("bake"))
+  {
+    boost::filesystem::path path = this->vm["bake"].as<std::string>();
+    if (!boost::filesystem::exists(path))
+    {
+      std::cerr << "Error: File doesn't exist[" << path.string() << "]\n";
+      return false;
+    }
+
+    std::unique_ptr<common::HeightmapData> data(
+        common::HeightmapDataLoader::LoadTerrainFile(path.string()));
+    if (!data)
+    {
+      std::cerr << "Unable to load heightmap data[" << path.string() << "]\n";
+      return false;
+    }
+
+    ignition::math::Vector3d size(1, 1, 1);
+    if (this->vm.count("size"))
+    {
+      auto values = common::split(this->vm["size"].as<std::string>(), ",");
+      if (values.size() != 3u)
+      {
+        std::cerr << "Error: Size must be a 3-tuple, eg: -s 10,10,1\n";
+        return false;
+      }
+      size.Set(boost::lexical_cast<double>(values[0]),
+               boost::lexical_cast<double>(values[1]),
+               boost::lexical_cast<double>(values[2]));
+    }
+#ifdef HAVE_GDAL
+    else
+    {
+      auto dem = dynamic_cast<common::Dem *>(data.get());
+      if (dem)
+      {
+        size.Set(dem->GetWorldWidth(), dem->GetWorldHeight(),
+            dem->GetMaxElevation() - dem->GetMinElevation());
+      }
+    }
+#endif
+
+    std::string output = this->vm.count("output") ?
+        this->vm["output"].as<std::string>() :
+        path.replace_extension(".gzhtc").string();
+
+    if (!common::HeightmapTileCache::Bake(data.get(),
+          this->vm["sampling"].as<int>(), size,
+          this->vm["tile-size"].as<unsigned int>(), output))
+    {
+      std::cerr << "Unable to bake heightmap tile cache[" << output << "]\n";
+      return false;
+    }
+
+    std::cout << "Baked heightmap tile cache[" << output << "]\n";
+  }
+  else if (this->vm.count("info"))
+  {
+    std::string filename = this->vm["info"].as<std::string>();
+    common::HeightmapTileCache cache;
+    if (!cache.Load(filename))
+      return false;
+
+    unsigned int tilesPerSide =
+        (cache.VertSize() + cache.TileSize() - 1) / cache.TileSize();
+    std::cout << "Vertices:  " << cache.VertSize() << "x" << cache.VertSize()
+              << "\n"
+              << "Tiles:     " << tilesPerSide << "x" << tilesPerSide
+              << " of " << cache.TileSize() << "x" << cache.TileSize() << "\n"
+              << "Sampling:  " << cache.SubSampling() << "\n"
+              << "Size:      " << cache.Size() << "\n"
+              << "Heights:   [" << cache.MinHeight() << ", "
+              << cache.MaxHeight() << "]\n";
+  }
+  else
+  {
+    this->Help();
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////
+MeshCommand::MeshCommand()
+  : Command("mesh", "Manage the mesh cache")
+{
+  // Options that are visible to the user through help.
+  this->visibleOptions.add_options()
+    ("prewarm,w", po::value<std::string>(),
+     "Load a mesh file, or every mesh file in a directory and its "
+     "subdirectories, and store them in the mesh cache.")
+    ("cache-path,c", po::value<std::string>(),
+     "Mesh cache directory. Defaults to GAZEBO_MESH_CACHE_PATH.")
+    ("info,i", "Print the mesh cache directory.");
+}
+
+/////////////////////////////////////////////////
+void MeshCommand::HelpDetailed()
+{
+  std::cerr <<
+    "\tLoaded meshes are stored in a binary cache so that later loads\n"
+    "\tskip parsing the source file. Prewarm the cache once, for example\n"
+    "\tin a container image, to make the first simulation start fast.\n"
+    "\tThe cache is disabled unless GAZEBO_MESH_CACHE_PATH is set to a\n"
+    "\twritable directory, for gazebo as well as for this command.\n"
+    << std::endl;
+}
+
+/////////////////////////////////////////////////
+bool MeshCommand::TransportRequired()
+{
+  return false;
+}
+
+/////////////////////////////////////////////////
+bool MeshCommand::RunImpl()
+{
+  common::MeshManager *manager = common::MeshManager::Instance();
+  if (this->vm.count("cache-path"))
+    manager->SetCachePath(this->vm["cache-path"].as<std::string>());
+
+  if (this->vm.count("prewarm"))
+  {
+    if (manager->CachePath().empty())
+    {
+      std::cerr << "Error: The mesh cache is disabled, set "
+                << "GAZEBO_MESH_CACHE_PATH or use --cache-path\n";
+      return false;
+    }
+
+    boost::filesystem::path path = this->vm["prewarm"].as<std::string>();
+    if (!boost::filesystem::exists(path))
+    {
+      std::cerr << "Error: File doesn't exist[" << path.string() << "]\n";
+      return false;
+    }
+
+    std::vector<std::string> files;
+    if (boost::filesystem::is_directory(path))
+    {
+      for (boost::filesystem::recursive_directory_iterator it(path), end;
+           it != end; ++it)
+      {
+        if (boost::filesystem::is_regular_file(it->path()) &&
+            manager->IsValidFilename(it->path().string()))
+        {
+          files.push_back(boost::filesystem::canonical(it->path()).string());
+        }
+      }
+    }
+    else
+    {
+      files.push_back(boost::filesystem::canonical(path).string());
+    }
+
+    unsigned int loaded = 0;
+    for (auto const &file : files)
+    {
+      if (this->vm.count("verbose"))
+        std::cout << "Loading[" << file << "]\n";
+      if (manager->Load(file))
+        ++loaded;
+      else
+        std::cerr << "Unable to load mesh[" << file << "]\n";
+    }
+
+    std::cout << "Cached " << loaded << " of " << files.size()
+              << " meshes in[" << manager->CachePath() << "]\n";
+    return loaded == files.size();
+  }
+  else if (this->vm.count("info"))
+  {
+    std::string cachePath = manager->CachePath();
+    std::cout << "Mesh cache: "
+              << (cachePath.empty() ? "disabled" : cachePath) << "\n";
+  }
+  else
+  {
+    this->Help();
+  }
+
+  return true;
+}
+
 /////////////////////////////////////////////////
 HelpCommand::HelpCommand()
   : Command("help",
@@ -1302,9 +1583,11 @@ int main(int argc, char **argv)
   }
 
   g_commandMap["camera"] = new CameraCommand();
+  g_commandMap["heightmap"] = new HeightmapCommand();
   g_commandMap["help"] = new HelpCommand();
   g_commandMap["joint"] = new JointCommand();
   g_commandMap["marker"] = new MarkerCommand();
+  g_commandMap["mesh"] = new MeshCommand();
   g_commandMap["model"] = new ModelCommand();
   g_commandMap["world"] = new WorldCommand();
   g_commandMap["physics"] = new PhysicsCommand();
@@ -195,6 +195,11 @@ namespace gazebo
     /// \param[in] _msg World statistics message.
     private: void CB(ConstWorldStatisticsPtr &_msg);
 
+    /// \brief Profiler statistics callback, prints the cost of the plugin
+    /// event callbacks.
+    /// \param[in] _msg Profiler statistics message.
+    private: void ProfilerCB(ConstProfilerStatisticsPtr &_msg);
+
     /// \brief Sim time buffer
     private: std::list<common::Time> simTimes;
 
@@ -218,6 +223,38 @@ namespace gazebo
     protected: virtual bool TransportRequired();
   };
 
+  /// \brief Heightmap command
+  class HeightmapCommand : public Command
+  {
+    /// \brief Constructor
+    public: HeightmapCommand();
+
+    // Documentation inherited
+    public: virtual void HelpDetailed();
+
+    // Documentation inherited
+    protected: virtual bool RunImpl();
+
+    // Documentation inherited
+    protected: virtual bool TransportRequired();
+  };
+
+  /// \brief Mesh command
+  class MeshCommand : public Command
+  {
+    /// \brief Constructor
+    public: MeshCommand();
+
+    // Documentation inherited
+    public: virtual void HelpDetailed();
+
+    // Documentation inherited
+    protected: virtual bool RunImpl();
+
+    // Documentation inherited
+    protected: virtual bool TransportRequired();
+  };
+
   /// \brief Help command
   class HelpCommand : public Command
   {